@@ -0,0 +1,120 @@
+#ifndef EASTL_BENCHMARK_HPP
+#define EASTL_BENCHMARK_HPP
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <EASTL/internal/config.h>
+#include <EASTL/allocator.h>
+
+#if defined(EA_PLATFORM_UNIX) || defined(EA_PLATFORM_OSX)
+#include <sys/resource.h>
+#endif
+
+
+// EASTL expects us to define these, see allocator.h
+void* operator new[](size_t size, const char* /* pName */,
+                     int /* flags */, unsigned /* debugFlags */,
+                     const char* /* file */, int /* line */) {
+    return malloc(size);
+}
+void* operator new[](size_t size, size_t /* alignment */,
+                     size_t /* alignmentOffset */, const char* /* pName */,
+                     int /* flags */, unsigned /* debugFlags */,
+                     const char* /* file */, int /* line */) {
+    return malloc(size);
+}
+
+int Vsnprintf8(char8_t* pDestination, size_t n,
+               const char8_t* pFormat, va_list arguments) {
+#ifdef _MSC_VER
+        return _vsnprintf(pDestination, n, pFormat, arguments);
+#else
+        return vsnprintf(pDestination, n, pFormat, arguments);
+#endif
+}
+
+
+namespace benchmark {
+
+// Measures elapsed processor time in seconds.
+class timer {
+ public:
+  timer() : m_start(std::clock()) {}
+  void restart() { m_start = std::clock(); }
+  double elapsed() const { return double(std::clock() - m_start) / CLOCKS_PER_SEC; }
+ private:
+  std::clock_t m_start;
+};
+
+// Returns the peak resident set size of the process in KiB, or 0 if unknown.
+inline long peak_rss_kb() {
+#if defined(EA_PLATFORM_UNIX) || defined(EA_PLATFORM_OSX)
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#if defined(EA_PLATFORM_OSX)
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+#else
+  return 0;
+#endif
+}
+
+// Tracks the bytes which are currently allocated and the high water mark,
+// along with the number of allocations, across all instances.
+struct counters {
+  static size_t& current() { static size_t n = 0; return n; }
+  static size_t& peak() { static size_t n = 0; return n; }
+  static size_t& allocations() { static size_t n = 0; return n; }
+  static void reset() { current() = peak() = allocations() = 0; }
+};
+
+// An allocator which counts what goes through it and otherwise forwards to
+// the default EASTL allocator.
+class counting_allocator : public EASTLAllocatorType {
+ public:
+  counting_allocator(const char* pName = EASTL_NAME_VAL(EASTL_ALLOCATOR_DEFAULT_NAME))
+      : EASTLAllocatorType(pName) {}
+
+  void* allocate(size_t n, int flags = 0) {
+    on_allocate(n);
+    return EASTLAllocatorType::allocate(n, flags);
+  }
+  void* allocate(size_t n, size_t alignment, size_t offset, int flags = 0) {
+    on_allocate(n);
+    return EASTLAllocatorType::allocate(n, alignment, offset, flags);
+  }
+  void deallocate(void* p, size_t n) {
+    counters::current() -= n;
+    EASTLAllocatorType::deallocate(p, n);
+  }
+
+ private:
+  static void on_allocate(size_t n) {
+    ++counters::allocations();
+    counters::current() += n;
+    if (counters::current() > counters::peak()) { counters::peak() = counters::current(); }
+  }
+};
+
+inline bool operator==(counting_allocator const&, counting_allocator const&) { return true; }
+inline bool operator!=(counting_allocator const&, counting_allocator const&) { return false; }
+
+// Keeps the optimizer from discarding a computed value.
+template<class T>
+inline void do_not_optimize(T const& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  __asm__ __volatile__("" : : "r"(&value) : "memory");
+#else
+  static T volatile sink;
+  sink = value;
+  T const readBack = sink;
+  (void)readBack;
+#endif
+}
+
+} // namespace benchmark
+
+#endif // EASTL_BENCHMARK_HPP
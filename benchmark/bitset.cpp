@@ -0,0 +1,59 @@
+#include "benchmark.hpp"
+
+#include <EASTL/bitset.h>
+
+
+namespace {
+
+const int kRepeats = 20000;
+
+typedef eastl::bitset<65536> occupancy;
+
+// Returns an occupancy map with roughly one bit in `spacing` set.
+occupancy make(unsigned spacing, unsigned seed) {
+  occupancy b;
+  for (size_t i = 0; i < b.size(); ++i) {
+    seed = seed * 1103515245u + 12345u;
+    if ((seed >> 8) % spacing == 0) { b.set(i); }
+  }
+  return b;
+}
+
+void run(unsigned spacing) {
+  occupancy const a = make(spacing, 1);
+  occupancy b = make(spacing, 2);
+
+  benchmark::timer t;
+  size_t sum = 0;
+  for (int r = 0; r < kRepeats; ++r) {
+    b.flip(r);
+    sum += b.count();
+  }
+  double const count = t.elapsed();
+
+  t.restart();
+  for (int r = 0; r < kRepeats / 10; ++r) {
+    for (size_t i = a.find_first(); i != a.size(); i = a.find_next(i)) { sum += i; }
+    for (size_t i = a.find_last(); i != a.size(); i = a.find_prev(i)) { sum += i; }
+  }
+  double const find = t.elapsed() * 10;
+
+  t.restart();
+  for (int r = 0; r < kRepeats; ++r) {
+    b &= a;
+    b |= a;
+    b ^= a;
+  }
+  double const combine = t.elapsed();
+  benchmark::do_not_optimize(sum + b.count());
+
+  std::printf("1/%-5u count %7.2f us  find_next+find_prev %8.2f us  &=,|=,^= %7.2f us\n", spacing,
+              count * 1e6 / kRepeats, find * 1e6 / kRepeats, combine * 1e6 / kRepeats);
+}
+
+} // namespace
+
+int main() {
+  run(2);
+  run(64);
+}
@@ -0,0 +1,74 @@
+#include "benchmark.hpp"
+
+#include <EASTL/bitvector.h>
+
+
+namespace {
+
+const int kBits = 1 << 20;
+const int kRepeats = 200;
+
+typedef eastl::bitvector<> bits;
+
+// Fills b with bits set at roughly one in `spacing` positions.
+void fill(bits& b, unsigned spacing, unsigned seed) {
+  for (int i = 0; i < kBits; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    if ((seed >> 8) % spacing == 0) { b.set(i); }
+  }
+}
+
+void visit(unsigned spacing) {
+  bits b(kBits);
+  fill(b, spacing, 1);
+
+  benchmark::timer t;
+  unsigned long sum = 0;
+  for (int r = 0; r < kRepeats; ++r) {
+    for (bits::size_type i = 0; i < b.size(); ++i) {
+      if (b.test(i)) { sum += i; }
+    }
+  }
+  double const bitwise = t.elapsed();
+
+  t.restart();
+  for (int r = 0; r < kRepeats; ++r) {
+    for (bits::set_bit_iterator i = b.set_bits_begin(); i != b.set_bits_end(); ++i) { sum += *i; }
+  }
+  double const iterated = t.elapsed();
+  benchmark::do_not_optimize(sum);
+
+  std::printf("visit 1/%-5u test loop %8.3f ms  set_bit_iterator %8.3f ms\n", spacing,
+              bitwise * 1e3 / kRepeats, iterated * 1e3 / kRepeats);
+}
+
+void combine() {
+  bits a(kBits), b(kBits);
+  fill(a, 2, 1);
+  fill(b, 2, 2);
+
+  benchmark::timer t;
+  for (int r = 0; r < kRepeats; ++r) {
+    for (bits::size_type i = 0; i < a.size(); ++i) {
+      if (b.test(i)) { a.flip(i); }
+    }
+  }
+  double const bitwise = t.elapsed();
+
+  t.restart();
+  for (int r = 0; r < kRepeats; ++r) { a ^= b; }
+  double const wordwise = t.elapsed();
+  benchmark::do_not_optimize(a.count());
+
+  std::printf("xor  %9s bit loop  %8.3f ms  operator^=       %8.3f ms\n", "",
+              bitwise * 1e3 / kRepeats, wordwise * 1e3 / kRepeats);
+}
+
+} // namespace
+
+int main() {
+  visit(2);
+  visit(64);
+  visit(4096);
+  combine();
+}
@@ -0,0 +1,111 @@
+#include "benchmark.hpp"
+
+#include <EASTL/charconv.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+
+namespace {
+
+const int kRecords = 200000;
+const int kRounds = 5;
+
+// A metric record as a serializer sees it: a few counters and gauges.
+struct record {
+  long long id;
+  unsigned long long bytes;
+  double latency;
+  double ratio;
+};
+
+void report(const char* name, double elapsed) {
+  std::printf("%-28s %8.1f ns per record\n", name, elapsed * 1e9 / (kRecords * kRounds));
+}
+
+// Serializes each record as "id bytes latency ratio\n" into one reused string.
+void sprintf_records(eastl::vector<record> const& records) {
+  eastl::string s;
+  size_t sum = 0;
+  benchmark::timer t;
+  for (int round = 0; round < kRounds; ++round) {
+    for (int i = 0; i < kRecords; ++i) {
+      record const& r = records[i];
+      s.clear();
+      s.append_sprintf("%lld %llu %.17g %.17g\n", r.id, r.bytes, r.latency, r.ratio);
+      sum += s.size();
+    }
+  }
+  report("append_sprintf %.17g", t.elapsed());
+  benchmark::do_not_optimize(sum);
+}
+
+void append_records(eastl::vector<record> const& records) {
+  eastl::string s;
+  size_t sum = 0;
+  benchmark::timer t;
+  for (int round = 0; round < kRounds; ++round) {
+    for (int i = 0; i < kRecords; ++i) {
+      record const& r = records[i];
+      s.clear();
+      s.append_int(r.id).append(1, ' ').append_uint(r.bytes).append(1, ' ');
+      s.append_double(r.latency).append(1, ' ').append_double(r.ratio).append(1, '\n');
+      sum += s.size();
+    }
+  }
+  report("append_int / append_double", t.elapsed());
+  benchmark::do_not_optimize(sum);
+}
+
+// Reads the fields back, with strtoll/strtod and with from_chars.
+void parse_records(eastl::vector<eastl::string> const& lines, bool bFromChars) {
+  double sum = 0;
+  benchmark::timer t;
+  for (int round = 0; round < kRounds; ++round) {
+    for (int i = 0; i < kRecords; ++i) {
+      char const* p = lines[i].c_str();
+      char const* const pEnd = p + lines[i].size();
+      record r;
+      if (bFromChars) {
+        p = eastl::from_chars(p, pEnd, r.id).ptr + 1;
+        p = eastl::from_chars(p, pEnd, r.bytes).ptr + 1;
+        p = eastl::from_chars(p, pEnd, r.latency).ptr + 1;
+        eastl::from_chars(p, pEnd, r.ratio);
+      } else {
+        char* pNext;
+        r.id = strtoll(p, &pNext, 10);
+        r.bytes = strtoull(pNext + 1, &pNext, 10);
+        r.latency = strtod(pNext + 1, &pNext);
+        r.ratio = strtod(pNext + 1, &pNext);
+      }
+      sum += (double)r.id + (double)r.bytes + r.latency + r.ratio;
+    }
+  }
+  report(bFromChars ? "from_chars" : "strtoll / strtod", t.elapsed());
+  benchmark::do_not_optimize(sum);
+}
+
+} // namespace
+
+int main() {
+  eastl::vector<record> records;
+  uint32_t seed = 1;
+  for (int i = 0; i < kRecords; ++i) {
+    seed = seed * 1664525 + 1013904223;
+    record const r = { (long long)i * 7919 - 1000000, (unsigned long long)seed * 4099,
+                       (seed >> 8) / 1000.0, (double)(seed >> 16) / 65536.0 };
+    records.push_back(r);
+  }
+
+  eastl::vector<eastl::string> lines;
+  for (int i = 0; i < kRecords; ++i) {
+    eastl::string s;
+    s.append_int(records[i].id).append(1, ' ').append_uint(records[i].bytes).append(1, ' ');
+    s.append_double(records[i].latency).append(1, ' ').append_double(records[i].ratio);
+    lines.push_back(s);
+  }
+
+  sprintf_records(records);
+  append_records(records);
+  parse_records(lines, false);
+  parse_records(lines, true);
+}
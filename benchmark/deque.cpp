@@ -0,0 +1,46 @@
+#include "benchmark.hpp"
+
+#include <EASTL/deque.h>
+#include <EASTL/list.h>
+#include <EASTL/queue.h>
+
+
+namespace {
+
+const int kOperations = 20000000;
+
+// Runs a work queue which stays around `depth` entries deep: each step pops
+// the oldest item and pushes a new one.
+template<class Queue>
+void fifo(char const* name, int depth) {
+  benchmark::counters::reset();
+  benchmark::timer t;
+  long sum = 0;
+  {
+    Queue q;
+    for (int i = 0; i < depth; ++i) { q.push(i); }
+    for (int i = 0; i < kOperations; ++i) {
+      sum += q.front();
+      q.pop();
+      q.push(i);
+    }
+  }
+  benchmark::do_not_optimize(sum);
+  std::printf("%-6s depth %6d %8.2f ns/op %10lu allocations %8lu KiB peak\n", name, depth,
+              t.elapsed() * 1e9 / kOperations, (unsigned long)benchmark::counters::allocations(),
+              (unsigned long)(benchmark::counters::peak() / 1024));
+}
+
+} // namespace
+
+int main() {
+  typedef eastl::queue<long, eastl::deque<long, benchmark::counting_allocator> > deque_queue;
+  typedef eastl::queue<long, eastl::list<long, benchmark::counting_allocator> > list_queue;
+
+  int const depths[] = { 16, 1000, 100000 };
+
+  for (unsigned d = 0; d < sizeof(depths) / sizeof(depths[0]); ++d) {
+    fifo<list_queue>("list", depths[d]);
+    fifo<deque_queue>("deque", depths[d]);
+  }
+}
@@ -0,0 +1,51 @@
+#include "benchmark.hpp"
+
+#include <EASTL/eytzinger_map.h>
+#include <EASTL/vector.h>
+#include <EASTL/vector_map.h>
+
+
+namespace {
+
+const int kLookups = 4000000;
+
+template<class Map>
+void lookups(char const* name, Map const& m, eastl::vector<int> const& keys) {
+  benchmark::timer t;
+  long found = 0;
+  for (eastl::vector<int>::const_iterator i = keys.begin(); i != keys.end(); ++i) {
+    typename Map::const_iterator const j = m.find(*i);
+    if (j != m.end()) { found += j->second; }
+  }
+  benchmark::do_not_optimize(found);
+  std::printf("%-14s %9d keys %8.1f ns/find\n", name, int(m.size()), t.elapsed() * 1e9 / keys.size());
+}
+
+} // namespace
+
+int main() {
+  int const sizes[] = { 1000, 100000, 1000000, 10000000 };
+
+  for (unsigned s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+    int const n = sizes[s];
+
+    eastl::vector<eastl::pair<int, int> > values;
+    values.reserve(n);
+    for (int i = 0; i < n; ++i) { values.push_back(eastl::make_pair(2 * i, i)); }
+
+    // Random keys, half of them missing.
+    eastl::vector<int> keys;
+    keys.reserve(kLookups);
+    unsigned x = 12345;
+    for (int i = 0; i < kLookups; ++i) {
+      x = x * 1103515245u + 12345u;
+      keys.push_back(int((x >> 4) % unsigned(2 * n)));
+    }
+
+    eastl::vector_map<int, int> const vm(eastl::sorted_unique, values.begin(), values.end());
+    eastl::eytzinger_map<int, int> const em(eastl::sorted_unique, values.begin(), values.end());
+
+    lookups("vector_map", vm, keys);
+    lookups("eytzinger_map", em, keys);
+  }
+}
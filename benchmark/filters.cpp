@@ -0,0 +1,83 @@
+#include "benchmark.hpp"
+
+#include <EASTL/bloom_filter.h>
+#include <EASTL/cuckoo_filter.h>
+#include <EASTL/hash_set.h>
+#include <EASTL/vector.h>
+
+
+namespace {
+
+const int kCount = 4000000;
+
+typedef eastl::vector<uint64_t> keys;
+
+uint64_t next(uint64_t& seed) {
+  seed = seed * UINT64_C(6364136223846793005) + UINT64_C(1442695040888963407);
+  return seed >> 1;
+}
+
+// Prints the bytes per key, the measured false positive rate, and the time
+// per query for absent keys, which is the common case in front of a store.
+template<class Filter>
+void report(const char* name, Filter const& filter, eastl_size_t bytes, keys const& absent, double insert) {
+  benchmark::timer t;
+  eastl_size_t positives = 0;
+  for (eastl_size_t i = 0; i < absent.size(); ++i) { positives += filter.contains(absent[i]) ? 1 : 0; }
+  double const query = t.elapsed() / absent.size();
+  std::printf("%-28s %6.2f bytes/key  fpr %8.5f  insert %5.1f ns  query %5.1f ns\n", name,
+              double(bytes) / kCount, double(positives) / absent.size(), insert * 1e9 / kCount, query * 1e9);
+}
+
+void run(keys const& present, keys const& absent, double rate) {
+  std::printf("requested fpr %g\n", rate);
+
+  benchmark::timer t;
+  eastl::bloom_filter<uint64_t> bloom(kCount, rate);
+  for (eastl_size_t i = 0; i < present.size(); ++i) { bloom.insert(present[i]); }
+  report("  bloom_filter", bloom, bloom.size_in_bytes(), absent, t.elapsed());
+
+  eastl::vector<char> results(absent.size());
+  t.restart();
+  bloom.contains(absent.begin(), absent.end(), results.begin());
+  double const batch = t.elapsed() / absent.size();
+  benchmark::do_not_optimize(results[absent.size() / 2]);
+  std::printf("  bloom_filter batch query %5.1f ns\n", batch * 1e9);
+
+  t.restart();
+  eastl::cuckoo_filter<uint64_t> cuckoo(kCount, rate);
+  eastl_size_t const inserted = cuckoo.insert(present.begin(), present.end());
+  double const insert = t.elapsed();
+  if (inserted != present.size()) { std::printf("  cuckoo_filter full after %u\n", (unsigned)inserted); }
+  report("  cuckoo_filter", cuckoo, cuckoo.size_in_bytes(), absent, insert);
+
+  t.restart();
+  cuckoo.contains(absent.begin(), absent.end(), results.begin());
+  std::printf("  cuckoo_filter batch query %5.1f ns  (load %.2f)\n", t.elapsed() / absent.size() * 1e9, cuckoo.load_factor());
+}
+
+} // namespace
+
+int main() {
+  keys present, absent;
+  uint64_t seed = 1;
+  for (int i = 0; i < kCount; ++i) { present.push_back(next(seed)); }
+  for (int i = 0; i < kCount; ++i) { absent.push_back(next(seed)); }
+
+  {
+    benchmark::counters::reset();
+    benchmark::timer t;
+    eastl::hash_set<uint64_t, eastl::hash<uint64_t>, eastl::equal_to<uint64_t>, benchmark::counting_allocator> set;
+    set.insert(present.begin(), present.end());
+    double const insert = t.elapsed();
+    t.restart();
+    eastl_size_t found = 0;
+    for (eastl_size_t i = 0; i < absent.size(); ++i) { found += set.find(absent[i]) != set.end() ? 1 : 0; }
+    std::printf("%-28s %6.2f bytes/key  fpr %8.5f  insert %5.1f ns  query %5.1f ns\n", "hash_set",
+                double(benchmark::counters::peak()) / kCount, double(found) / kCount,
+                insert * 1e9 / kCount, t.elapsed() * 1e9 / kCount);
+  }
+
+  run(present, absent, 0.01);
+  run(present, absent, 0.001);
+}
@@ -0,0 +1,81 @@
+#include "benchmark.hpp"
+
+#include <EASTL/allocator.h>
+#include <EASTL/mmap_allocator.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+
+struct record {
+  char payload[48];
+};
+EASTL_DECLARE_TRIVIAL_RELOCATE(record);
+
+namespace {
+
+const int kIterations = 20;
+const int kElements = 1000000;
+
+template<class Allocator>
+void vector_push_back(char const* name) {
+  benchmark::counters::reset();
+  size_t peak = 0;
+  benchmark::timer t;
+
+  for (int i = 0; i < kIterations; ++i) {
+    eastl::vector<record, Allocator> vec;
+    record const r = record();
+    for (int j = 0; j < kElements; ++j) { vec.push_back(r); }
+    benchmark::do_not_optimize(vec.size());
+    if (benchmark::counters::peak() > peak) { peak = benchmark::counters::peak(); }
+  }
+
+  double const seconds = t.elapsed();
+  std::printf("vector<record> %-12s %8.2f Mpush_back/s  peak %8lu KiB  %6lu allocations\n", name,
+              (double(kIterations) * kElements / seconds) / 1e6,
+              (unsigned long)(peak / 1024),
+              (unsigned long)(benchmark::counters::allocations() / kIterations));
+}
+
+template<class Allocator>
+void string_push_back(char const* name) {
+  benchmark::counters::reset();
+  benchmark::timer t;
+
+  for (int i = 0; i < kIterations; ++i) {
+    eastl::basic_string<char, Allocator> str;
+    for (int j = 0; j < kElements; ++j) { str.push_back(char('a' + (j & 15))); }
+    benchmark::do_not_optimize(str.size());
+  }
+
+  double const seconds = t.elapsed();
+  std::printf("string         %-12s %8.2f Mpush_back/s  peak %8lu KiB  %6lu allocations\n", name,
+              (double(kIterations) * kElements / seconds) / 1e6,
+              (unsigned long)(benchmark::counters::peak() / 1024),
+              (unsigned long)(benchmark::counters::allocations() / kIterations));
+}
+
+typedef benchmark::counting_allocator counting;
+
+} // namespace
+
+int main() {
+  vector_push_back<eastl::growth_policy_allocator<eastl::growth_policy_2x, counting> >("2x");
+  vector_push_back<eastl::growth_policy_allocator<eastl::growth_policy_1_5x, counting> >("1.5x");
+  vector_push_back<eastl::growth_policy_allocator<eastl::growth_policy_usable_size<>, counting> >("usable_size");
+
+  string_push_back<eastl::growth_policy_allocator<eastl::growth_policy_2x, counting> >("2x");
+  string_push_back<eastl::growth_policy_allocator<eastl::growth_policy_1_5x, counting> >("1.5x");
+
+  // Peak RSS is process-wide, so the mmap cases are reported together.
+  benchmark::timer t;
+  for (int i = 0; i < kIterations; ++i) {
+    eastl::vector<record, eastl::growth_policy_allocator<eastl::growth_policy_usable_size<>, eastl::mmap_allocator> > vec;
+    record const r = record();
+    for (int j = 0; j < kElements; ++j) { vec.push_back(r); }
+    benchmark::do_not_optimize(vec.size());
+  }
+  std::printf("vector<record> %-12s %8.2f Mpush_back/s  (mmap_allocator, page-rounded)\n", "usable_size",
+              (double(kIterations) * kElements / t.elapsed()) / 1e6);
+  std::printf("peak RSS %ld KiB\n", benchmark::peak_rss_kb());
+}
@@ -0,0 +1,80 @@
+#include "benchmark.hpp"
+
+#include <EASTL/bitvector.h>
+#include <EASTL/rank_select_index.h>
+
+
+namespace {
+
+const eastl_size_t kBits = 1u << 28; // 256M bits.
+const int kQueries = 1000000;
+const int kNaiveQueries = 100; // A scan per query is too slow for more.
+
+typedef eastl::bitvector<> bits;
+typedef eastl::rank_select_index<> index_type;
+
+unsigned next(unsigned& seed) {
+  seed = seed * 1103515245u + 12345u;
+  return seed >> 4;
+}
+
+// Counts the set bits before i, a word at a time.
+eastl_size_t naive_rank(bits const& b, eastl_size_t i) {
+  eastl_size_t n = 0;
+  eastl::BitsetWordType const* const words = b.data();
+  eastl_size_t const end = i / eastl::kBitsPerWord;
+  for (eastl_size_t w = 0; w < end; ++w) { n += eastl::BitsetCountBits(words[w]); }
+  if (i % eastl::kBitsPerWord) {
+    n += eastl::BitsetCountBits(words[end] & ((eastl::BitsetWordType(1) << (i % eastl::kBitsPerWord)) - 1));
+  }
+  return n;
+}
+
+// Finds the k-th set bit, skipping a word at a time.
+eastl_size_t naive_select(bits const& b, eastl_size_t k) {
+  eastl::BitsetWordType const* const words = b.data();
+  eastl_size_t w = 0;
+  for (eastl_size_t n; k >= (n = eastl::BitsetCountBits(words[w])); ++w) { k -= n; }
+  return w * eastl::kBitsPerWord + eastl::BitsetSelectBit(words[w], (uint32_t)k);
+}
+
+void run(unsigned spacing) {
+  bits b(kBits);
+  unsigned seed = 1;
+  for (eastl_size_t i = 0; i < kBits; ++i) {
+    if (next(seed) % spacing == 0) { b.set(i); }
+  }
+
+  benchmark::timer t;
+  index_type const index(b);
+  double const build = t.elapsed();
+  eastl_size_t const count = index.count();
+
+  eastl_size_t sum = 0;
+  t.restart();
+  for (int q = 0; q < kNaiveQueries; ++q) { sum += naive_rank(b, next(seed) % kBits); }
+  double const naiveRank = t.elapsed() / kNaiveQueries;
+  t.restart();
+  for (int q = 0; q < kNaiveQueries; ++q) { sum += naive_select(b, next(seed) % count); }
+  double const naiveSelect = t.elapsed() / kNaiveQueries;
+
+  t.restart();
+  for (int q = 0; q < kQueries; ++q) { sum += index.rank1(next(seed) % kBits); }
+  double const rank = t.elapsed() / kQueries;
+  t.restart();
+  for (int q = 0; q < kQueries; ++q) { sum += index.select1(next(seed) % count); }
+  double const select = t.elapsed() / kQueries;
+  benchmark::do_not_optimize(sum);
+
+  std::printf("density 1/%-4u overhead %4.2f%%  build %6.1f ms   rank1: scan %9.0f ns  index %5.1f ns   "
+              "select1: scan %9.0f ns  index %5.1f ns\n", spacing,
+              100.0 * index.size_in_bytes() / (kBits / 8), build * 1e3,
+              naiveRank * 1e9, rank * 1e9, naiveSelect * 1e9, select * 1e9);
+}
+
+} // namespace
+
+int main() {
+  run(2);
+  run(100);
+}
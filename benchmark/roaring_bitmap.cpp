@@ -0,0 +1,91 @@
+#include "benchmark.hpp"
+
+#include <EASTL/hash_set.h>
+#include <EASTL/roaring_bitmap.h>
+#include <EASTL/sort.h>
+#include <EASTL/vector.h>
+
+
+namespace {
+
+const int kValues = 1000000;
+const int kRepeats = 20;
+
+typedef eastl::vector<uint32_t, benchmark::counting_allocator> sorted_ids;
+typedef eastl::hash_set<uint32_t, eastl::hash<uint32_t>, eastl::equal_to<uint32_t>,
+                        benchmark::counting_allocator> hashed_ids;
+typedef eastl::roaring_bitmap<benchmark::counting_allocator> bitmap_ids;
+
+// Makes about kValues distinct ids below `universe`, in runs of `run` consecutive ids.
+void make_ids(sorted_ids& ids, uint32_t universe, uint32_t run, uint64_t seed) {
+  ids.clear();
+  while (ids.size() < (sorted_ids::size_type)kValues) {
+    for (int i = 0; i < kValues; i += run) {
+      seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+      uint32_t const start = (uint32_t)((seed >> 32) % (universe - run));
+      for (uint32_t j = 0; j < run; ++j) { ids.push_back(start + j); }
+    }
+    eastl::sort(ids.begin(), ids.end());
+    ids.erase(eastl::unique(ids.begin(), ids.end()), ids.end());
+  }
+}
+
+size_t intersect(sorted_ids const& a, sorted_ids const& b) {
+  size_t n = 0;
+  for (sorted_ids::const_iterator i = a.begin(), j = b.begin(); i != a.end() && j != b.end();) {
+    if (*i < *j) { ++i; }
+    else if (*j < *i) { ++j; }
+    else { ++n; ++i; ++j; }
+  }
+  return n;
+}
+
+void run(const char* name, uint32_t universe, uint32_t runLength) {
+  sorted_ids a, b;
+  make_ids(a, universe, runLength, 1);
+  make_ids(b, universe, runLength, 2);
+
+  benchmark::counters::reset();
+  sorted_ids va(a.begin(), a.end()), vb(b.begin(), b.end());
+  size_t const vectorBytes = benchmark::counters::current() / 2;
+
+  benchmark::counters::reset();
+  hashed_ids ha(a.begin(), a.end()), hb(b.begin(), b.end());
+  size_t const hashBytes = benchmark::counters::current() / 2;
+
+  benchmark::counters::reset();
+  bitmap_ids ra(a.begin(), a.end()), rb(b.begin(), b.end());
+  ra.run_optimize();
+  rb.run_optimize();
+  size_t const bitmapBytes = benchmark::counters::current() / 2;
+
+  size_t sum = 0;
+  benchmark::timer t;
+  for (int r = 0; r < kRepeats; ++r) { sum += intersect(va, vb); }
+  double const vectorTime = t.elapsed();
+
+  t.restart();
+  for (int r = 0; r < kRepeats; ++r) {
+    for (hashed_ids::const_iterator i = ha.begin(); i != ha.end(); ++i) { sum += hb.count(*i); }
+  }
+  double const hashTime = t.elapsed();
+
+  t.restart();
+  for (int r = 0; r < kRepeats; ++r) { sum += (size_t)(ra & rb).cardinality(); }
+  double const bitmapTime = t.elapsed();
+  benchmark::do_not_optimize(sum);
+
+  std::printf("%-22s bytes/id: vector %5.2f  hash_set %5.2f  roaring %5.2f   "
+              "intersect ms: vector %7.3f  hash_set %7.3f  roaring %7.3f\n", name,
+              (double)vectorBytes / a.size(), (double)hashBytes / a.size(), (double)bitmapBytes / a.size(),
+              vectorTime * 1e3 / kRepeats, hashTime * 1e3 / kRepeats, bitmapTime * 1e3 / kRepeats);
+}
+
+} // namespace
+
+int main() {
+  run("sparse (1 in 1000)", 1000000000u, 1);
+  run("medium (1 in 30)", 30000000u, 1);
+  run("dense (1 in 4)", 4000000u, 1);
+  run("clustered (runs of 64)", 1000000000u, 64);
+}
@@ -0,0 +1,111 @@
+#include "benchmark.hpp"
+
+#include <EASTL/rope.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+
+namespace {
+
+const int kResponses = 200;
+const int kFragments = 256;    // Per response, each 2-6 KB, so about 1 MB per response.
+
+typedef eastl::basic_string<char, benchmark::counting_allocator> string_type;
+typedef eastl::basic_rope<char, benchmark::counting_allocator> rope_type;
+
+struct fragment {
+  const char* p;
+  eastl_size_t n;
+};
+
+void report(const char* name, double elapsed) {
+  std::printf("%-28s %8.1f us per response   %6.1f allocations per response   peak %6.1f MB\n", name,
+              elapsed * 1e6 / kResponses, double(benchmark::counters::allocations()) / kResponses,
+              benchmark::counters::peak() / 1048576.0);
+}
+
+// Builds each response by appending the fragments and then prepending a
+// header, and hands its chars to a scatter-gather write, modelled here by
+// summing the chunk sizes and one char of each.
+void strings(eastl::vector<fragment> const& fragments) {
+  benchmark::counters::reset();
+  benchmark::timer t;
+  size_t sum = 0;
+  for (int r = 0; r < kResponses; ++r) {
+    string_type s;
+    for (int i = 0; i < kFragments; ++i) {
+      fragment const& f = fragments[(r + i) % fragments.size()];
+      s.append(f.p, f.p + f.n);
+    }
+    s.insert(0, "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n\r\n");
+    sum += s.size() + (unsigned char)s[s.size() / 2];
+  }
+  report("string append + insert", t.elapsed());
+  benchmark::do_not_optimize(sum);
+}
+
+void ropes(eastl::vector<fragment> const& fragments, bool bFlatten) {
+  benchmark::counters::reset();
+  benchmark::timer t;
+  size_t sum = 0;
+  for (int r = 0; r < kResponses; ++r) {
+    rope_type s;
+    for (int i = 0; i < kFragments; ++i) {
+      fragment const& f = fragments[(r + i) % fragments.size()];
+      s.append(f.p, f.n);
+    }
+    s.prepend(eastl::string_view("HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n\r\n"));
+    if (bFlatten) {
+      string_type const flat = s.flatten();
+      sum += flat.size() + (unsigned char)flat[flat.size() / 2];
+    } else {
+      for (rope_type::chunk_iterator it = s.chunk_begin(); it != s.chunk_end(); ++it) {
+        sum += (*it).size() + (unsigned char)(*it)[0];
+      }
+    }
+  }
+  report(bFlatten ? "rope append + flatten" : "rope append + chunks", t.elapsed());
+  benchmark::do_not_optimize(sum);
+}
+
+// The fragments are themselves ropes, such as cached rendered items, so
+// appending them copies nothing.
+void shared_ropes(eastl::vector<fragment> const& fragments) {
+  eastl::vector<rope_type> items;
+  for (eastl_size_t i = 0; i < fragments.size(); ++i) { items.push_back(rope_type(fragments[i].p, fragments[i].n)); }
+
+  benchmark::counters::reset();
+  benchmark::timer t;
+  size_t sum = 0;
+  for (int r = 0; r < kResponses; ++r) {
+    rope_type s;
+    for (int i = 0; i < kFragments; ++i) { s += items[(r + i) % items.size()]; }
+    s.prepend(eastl::string_view("HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n\r\n"));
+    for (rope_type::chunk_iterator it = s.chunk_begin(); it != s.chunk_end(); ++it) {
+      sum += (*it).size() + (unsigned char)(*it)[0];
+    }
+  }
+  report("rope of shared ropes", t.elapsed());
+  benchmark::do_not_optimize(sum);
+}
+
+} // namespace
+
+int main() {
+  eastl::vector<eastl::string> storage;
+  eastl::vector<fragment> fragments;
+  uint32_t seed = 1;
+  for (int i = 0; i < 97; ++i) {
+    seed = seed * 1664525 + 1013904223;
+    storage.push_back(eastl::string(2048 + (seed >> 8) % 4096, (char)('a' + i % 26)));
+  }
+  for (eastl_size_t i = 0; i < storage.size(); ++i) {
+    fragment const f = { storage[i].data(), storage[i].size() };
+    fragments.push_back(f);
+  }
+
+  strings(fragments);
+  ropes(fragments, false);
+  ropes(fragments, true);
+  shared_ropes(fragments);
+}
@@ -0,0 +1,60 @@
+#include "benchmark.hpp"
+
+#include <EASTL/split_vector_map.h>
+#include <EASTL/vector.h>
+#include <EASTL/vector_map.h>
+
+
+struct payload {
+  char bytes[200];
+};
+EASTL_DECLARE_TRIVIAL_RELOCATE(payload);
+
+namespace {
+
+const int kLookups = 4000000;
+
+template<class Map>
+void lookups(char const* name, Map const& m, eastl::vector<long> const& keys) {
+  benchmark::timer t;
+  long found = 0;
+  for (eastl::vector<long>::const_iterator i = keys.begin(); i != keys.end(); ++i) {
+    typename Map::const_iterator const j = m.find(*i);
+    if (j != m.end()) { found += j->second.bytes[0]; }
+  }
+  benchmark::do_not_optimize(found);
+  std::printf("%-17s %8d keys %8.1f ns/find\n", name, int(m.size()), t.elapsed() * 1e9 / keys.size());
+}
+
+} // namespace
+
+int main() {
+  int const sizes[] = { 1000, 100000, 1000000 };
+
+  for (unsigned s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+    int const n = sizes[s];
+
+    eastl::vector<eastl::pair<long, payload> > values;
+    values.reserve(n);
+    payload p = payload();
+    for (int i = 0; i < n; ++i) {
+      p.bytes[0] = char(i);
+      values.push_back(eastl::make_pair(long(2 * i), p));
+    }
+
+    // Random keys, half of them missing.
+    eastl::vector<long> keys;
+    keys.reserve(kLookups);
+    unsigned x = 12345;
+    for (int i = 0; i < kLookups; ++i) {
+      x = x * 1103515245u + 12345u;
+      keys.push_back(long((x >> 4) % unsigned(2 * n)));
+    }
+
+    eastl::vector_map<long, payload> const vm(eastl::sorted_unique, values.begin(), values.end());
+    eastl::split_vector_map<long, payload> const sm(eastl::sorted_unique, values.begin(), values.end());
+
+    lookups("vector_map", vm, keys);
+    lookups("split_vector_map", sm, keys);
+  }
+}
@@ -0,0 +1,79 @@
+#include "benchmark.hpp"
+
+#include <EASTL/sort.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+
+namespace {
+
+const int kCount = 1000000;
+
+typedef eastl::basic_string<char, benchmark::counting_allocator> string_type;
+
+unsigned next(unsigned& seed) {
+  seed = seed * 1103515245u + 12345u;
+  return seed >> 8;
+}
+
+// Returns a token of 3 to 15 characters 80% of the time, else 16 to 63.
+void make_token(unsigned& seed, char* p, int& n) {
+  n = (next(seed) % 100 < 80) ? 3 + next(seed) % 13 : 16 + next(seed) % 48;
+  for (int i = 0; i < n; ++i) { p[i] = (char)('a' + next(seed) % 26); }
+}
+
+void report(const char* name, double seconds, size_t allocations) {
+  std::printf("%-30s %7.1f ns/string  %5.2f allocations/string\n", name,
+              seconds * 1e9 / kCount, double(allocations) / kCount);
+}
+
+} // namespace
+
+int main() {
+  eastl::vector<char> text;
+  eastl::vector<int> lengths;
+  unsigned seed = 1;
+  for (int i = 0; i < kCount; ++i) {
+    char token[64];
+    int n;
+    make_token(seed, token, n);
+    text.insert(text.end(), token, token + n);
+    lengths.push_back(n);
+  }
+
+  eastl::vector<string_type> strings;
+  strings.reserve(kCount);
+
+  benchmark::counters::reset();
+  benchmark::timer t;
+  char const* p = text.data();
+  for (int i = 0; i < kCount; p += lengths[i], ++i) { strings.push_back(string_type(p, p + lengths[i])); }
+  report("construct from tokens", t.elapsed(), benchmark::counters::allocations());
+  std::printf("%-30s %7.1f bytes/string (sizeof %u)\n", "memory",
+              sizeof(string_type) + double(benchmark::counters::current()) / kCount, (unsigned)sizeof(string_type));
+
+  benchmark::counters::reset();
+  t.restart();
+  {
+    eastl::vector<string_type> copy(strings);
+    benchmark::do_not_optimize(copy.back().size());
+  }
+  report("copy vector<string>", t.elapsed(), benchmark::counters::allocations());
+
+  benchmark::counters::reset();
+  t.restart();
+  size_t total = 0;
+  for (int i = 0; i + 1 < kCount; ++i) {
+    string_type key(strings[i]);
+    key += '.';
+    key += strings[i + 1].c_str();
+    total += key.size();
+  }
+  benchmark::do_not_optimize(total);
+  report("concatenate pairs", t.elapsed(), benchmark::counters::allocations());
+
+  benchmark::counters::reset();
+  t.restart();
+  eastl::sort(strings.begin(), strings.end());
+  report("sort", t.elapsed(), benchmark::counters::allocations());
+}
@@ -0,0 +1,56 @@
+#include "benchmark.hpp"
+
+#include <EASTL/hash_map.h>
+#include <EASTL/string.h>
+#include <EASTL/string_cow.h>
+#include <EASTL/vector.h>
+
+
+namespace {
+
+const int kBlobs = 8;
+const int kCopies = 200000;
+const int kBlobSize = 4096;
+
+typedef eastl::basic_string<char, benchmark::counting_allocator> string_type;
+typedef eastl::basic_string_cow<char, benchmark::counting_allocator> cow_type;
+
+// Copies each of a few large strings into many vector elements and hash_map
+// values, as when a config blob is handed to every request, then reads one
+// character from each copy.
+template<class String>
+void run(const char* name, eastl::vector<String> const& blobs) {
+  benchmark::counters::reset();
+  benchmark::timer t;
+  size_t sum = 0;
+  {
+    eastl::vector<String> copies;
+    eastl::hash_map<int, String> byId;
+    copies.reserve(kCopies);
+    for (int i = 0; i < kCopies; ++i) {
+      copies.push_back(blobs[i % kBlobs]);
+      if (i % 16 == 0) { byId[i] = blobs[i % kBlobs]; }
+    }
+    for (int i = 0; i < kCopies; ++i) { sum += (unsigned char)copies[i][i % kBlobSize]; }
+    std::printf("%-12s %7.1f ns per copy   %5.2f allocations per copy   peak %8.1f MB\n", name,
+                t.elapsed() * 1e9 / (kCopies + kCopies / 16), double(benchmark::counters::allocations()) / (kCopies + kCopies / 16),
+                benchmark::counters::peak() / 1048576.0);
+  }
+  benchmark::do_not_optimize(sum);
+}
+
+} // namespace
+
+int main() {
+  eastl::vector<string_type> strings;
+  eastl::vector<cow_type> cows;
+  for (int b = 0; b < kBlobs; ++b) {
+    string_type s;
+    for (int i = 0; i < kBlobSize; ++i) { s.push_back((char)('a' + (b + i) % 26)); }
+    strings.push_back(s);
+    cows.push_back(cow_type(s.data(), s.size()));
+  }
+
+  run("string", strings);
+  run("string_cow", cows);
+}
@@ -0,0 +1,100 @@
+#include "benchmark.hpp"
+
+#include <EASTL/string.h>
+#include <EASTL/string_pool.h>
+#include <EASTL/vector.h>
+
+#include <thread>
+
+
+namespace {
+
+const int kDistinct = 20000;
+const int kRecords = 2000000;
+const int kThreads = 4;
+
+typedef eastl::basic_string<char, benchmark::counting_allocator> string_type;
+typedef eastl::basic_string_pool<char, benchmark::counting_allocator> pool_type;
+
+// Stores the tag of each of many records, as a loader does, where the tags
+// are drawn from a few thousand identifiers, then compares each to the last.
+void strings(eastl::vector<eastl::string> const& input) {
+  benchmark::counters::reset();
+  benchmark::timer t;
+  size_t same = 0;
+  {
+    eastl::vector<string_type> tags;
+    tags.reserve(kRecords);
+    for (int i = 0; i < kRecords; ++i) { tags.push_back(string_type(input[i].data(), input[i].size())); }
+    for (int i = 1; i < kRecords; ++i) { same += (tags[i] == tags[i - 1]); }
+    std::printf("%-20s %6.1f ns per record   %5.2f allocations per record   peak %7.1f MB\n", "string",
+                t.elapsed() * 1e9 / kRecords, double(benchmark::counters::allocations()) / kRecords,
+                benchmark::counters::peak() / 1048576.0);
+  }
+  benchmark::do_not_optimize(same);
+}
+
+void atoms(eastl::vector<eastl::string> const& input) {
+  benchmark::counters::reset();
+  benchmark::timer t;
+  size_t same = 0;
+  {
+    pool_type pool;
+    eastl::vector<pool_type::atom_type, benchmark::counting_allocator> tags;
+    tags.reserve(kRecords);
+    for (int i = 0; i < kRecords; ++i) { tags.push_back(pool.intern(input[i])); }
+    for (int i = 1; i < kRecords; ++i) { same += (tags[i] == tags[i - 1]); }
+    std::printf("%-20s %6.1f ns per record   %5.2f allocations per record   peak %7.1f MB\n", "string_pool",
+                t.elapsed() * 1e9 / kRecords, double(benchmark::counters::allocations()) / kRecords,
+                benchmark::counters::peak() / 1048576.0);
+  }
+  benchmark::do_not_optimize(same);
+}
+
+// Interns the same records split among several threads, checking that every
+// thread got the same atom for the same string.
+void concurrent(eastl::vector<eastl::string> const& input, int nThreads) {
+  eastl::string_pool pool(true);
+  eastl::vector<eastl::string_pool::atom_type> tags(kRecords);
+  benchmark::timer t;
+  eastl::vector<std::thread*> threads;
+  for (int n = 0; n < nThreads; ++n) {
+    threads.push_back(new std::thread([&, n] {
+      for (int i = kRecords / nThreads * n, iEnd = kRecords / nThreads * (n + 1); i < iEnd; ++i) {
+        tags[i] = pool.intern(input[i]);
+      }
+    }));
+  }
+  for (int n = 0; n < nThreads; ++n) {
+    threads[n]->join();
+    delete threads[n];
+  }
+  double const elapsed = t.elapsed();
+
+  bool ok = (pool.size() == kDistinct);
+  for (int i = 0; i < kRecords; ++i) { ok = ok && (pool.str(tags[i]) == input[i]) && (pool.find(input[i]) == tags[i]); }
+  std::printf("concurrent, %d thread%s %6.1f ns per record   %s\n", nThreads, nThreads == 1 ? " " : "s",
+              elapsed * 1e9 / kRecords, ok ? "consistent" : "MISMATCH");
+}
+
+} // namespace
+
+int main() {
+  eastl::vector<eastl::string> names;
+  char name[64];
+  for (int i = 0; i < kDistinct; ++i) {
+    std::snprintf(name, sizeof(name), "service.request.latency.host%05d", i);
+    names.push_back(eastl::string(name));
+  }
+  eastl::vector<eastl::string> input;
+  uint32_t seed = 1;
+  for (int i = 0; i < kRecords; ++i) {
+    seed = seed * 1664525 + 1013904223;
+    input.push_back(names[(seed >> 8) % kDistinct]);
+  }
+
+  strings(input);
+  atoms(input);
+  concurrent(input, 1);
+  concurrent(input, kThreads);
+}
@@ -0,0 +1,75 @@
+#include "benchmark.hpp"
+
+#include <cstring>
+
+#include <EASTL/internal/char_search.h>
+#include <EASTL/vector.h>
+
+
+namespace {
+
+const size_t kBytes = 100000000; // Scanned per measurement.
+
+// Each search runs over every haystack-sized window of a text with no match
+// until its last character, so every character is examined.
+struct scalar_find     { const char* operator()(const char* p, const char* e) const { return eastl::CharFind<char>(p, e, '#'); } };
+struct simd_find       { const char* operator()(const char* p, const char* e) const { return eastl::CharFind(p, e, '#'); } };
+struct libc_find       { const char* operator()(const char* p, const char* e) const { const void* r = std::memchr(p, '#', size_t(e - p)); return r ? (const char*)r : e; } };
+struct scalar_rfind    { const char* operator()(const char* p, const char* e) const { return eastl::CharFindLast<char>(p, e, '#'); } };
+struct simd_rfind      { const char* operator()(const char* p, const char* e) const { return eastl::CharFindLast(p, e, '#'); } };
+
+const char kPattern[] = "needle#";
+struct scalar_search   { const char* operator()(const char* p, const char* e) const { return eastl::CharSearch<char>(p, e, kPattern, kPattern + 7); } };
+struct simd_search     { const char* operator()(const char* p, const char* e) const { return eastl::CharSearch(p, e, kPattern, kPattern + 7); } };
+
+const char kSet[] = " \t\r\n,;#";
+struct scalar_first_of { const char* operator()(const char* p, const char* e) const { return eastl::CharFindFirstOf<char>(p, e, kSet, kSet + 7); } };
+struct simd_first_of   { const char* operator()(const char* p, const char* e) const { return eastl::CharFindFirstOf(p, e, kSet, kSet + 7); } };
+
+const char kAlphabet[] = "abcdefghijklmnopqrstuvwxyz";
+struct scalar_not_of   { const char* operator()(const char* p, const char* e) const { return eastl::CharFindFirstNotOf<char>(p, e, kAlphabet, kAlphabet + 26); } };
+struct simd_not_of     { const char* operator()(const char* p, const char* e) const { return eastl::CharFindFirstNotOf(p, e, kAlphabet, kAlphabet + 26); } };
+
+// Returns the nanoseconds per search of haystacks of n characters.
+template<class Search>
+double run(eastl::vector<char> const& text, size_t n, Search search) {
+  size_t const nWindows = text.size() / n;
+  size_t const nRounds = kBytes / (nWindows * n) + 1;
+  size_t sum = 0;
+  benchmark::timer t;
+  for (size_t r = 0; r < nRounds; ++r) {
+    for (const char* p = text.data(), *end = p + nWindows * n; p != end; p += n)
+      sum += size_t(search(p, p + n) - p);
+  }
+  double const elapsed = t.elapsed();
+  benchmark::do_not_optimize(sum);
+  return elapsed * 1e9 / double(nRounds * nWindows);
+}
+
+template<class Scalar, class Simd>
+void row(const char* name, eastl::vector<char> const& text, size_t n, Scalar scalar, Simd simd) {
+  std::printf("%-20s %6u chars   scalar %8.1f ns   simd %8.1f ns\n", name, unsigned(n), run(text, n, scalar), run(text, n, simd));
+}
+
+} // namespace
+
+int main() {
+  // Lowercase words, and so no spaces, punctuation or pattern matches.
+  eastl::vector<char> text(1 << 16);
+  unsigned seed = 1;
+  for (size_t i = 0; i < text.size(); ++i) {
+    seed = seed * 1103515245u + 12345u;
+    text[i] = kAlphabet[(seed >> 16) % 26];
+  }
+
+  size_t const sizes[] = { 16, 64, 1024, 65536 };
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+    size_t const n = sizes[i];
+    row("find(char)", text, n, scalar_find(), simd_find());
+    std::printf("%-20s %6u chars   memchr %8.1f ns\n", "", unsigned(n), run(text, n, libc_find()));
+    row("rfind(char)", text, n, scalar_rfind(), simd_rfind());
+    row("find(7 chars)", text, n, scalar_search(), simd_search());
+    row("find_first_of(7)", text, n, scalar_first_of(), simd_first_of());
+    row("find_first_not_of(26)", text, n, scalar_not_of(), simd_not_of());
+  }
+}
@@ -0,0 +1,87 @@
+#include "benchmark.hpp"
+
+#include <EASTL/hash_map.h>
+#include <EASTL/map.h>
+#include <EASTL/string.h>
+#include <EASTL/string_view.h>
+#include <EASTL/vector.h>
+#include <EASTL/vector_map.h>
+
+
+namespace {
+
+const int kKeys = 50000;
+const int kQueries = 1000000;
+
+typedef eastl::basic_string<char, benchmark::counting_allocator> string_type;
+
+// hash<string> is only specialized for the default allocator.
+struct token_hash {
+  typedef int is_transparent;
+  size_t operator()(eastl::string_view const& v) const { return eastl::hash<eastl::string_view>()(v); }
+};
+
+unsigned next(unsigned& seed) {
+  seed = seed * 1103515245u + 12345u;
+  return seed >> 8;
+}
+
+// Returns a token of 3 to 15 characters 80% of the time, else 16 to 63,
+// from a small alphabet so that about half the queries hit.
+int make_token(unsigned& seed, char* p) {
+  int const n = (next(seed) % 100 < 80) ? 3 + next(seed) % 13 : 16 + next(seed) % 48;
+  for (int i = 0; i < n; ++i) { p[i] = (char)('a' + next(seed) % 4); }
+  return n;
+}
+
+// Looks up each token as a string constructed from it and as a view of it.
+template<class Container>
+void run(const char* name, Container const& c, eastl::vector<char> const& text, eastl::vector<int> const& lengths) {
+  size_t hits = 0;
+  benchmark::counters::reset();
+  benchmark::timer t;
+  char const* p = text.data();
+  for (int i = 0; i < kQueries; p += lengths[i], ++i) { hits += c.find(string_type(p, p + lengths[i])) != c.end(); }
+  double const viaString = t.elapsed();
+  size_t const allocations = benchmark::counters::allocations();
+
+  benchmark::counters::reset();
+  t.restart();
+  p = text.data();
+  for (int i = 0; i < kQueries; p += lengths[i], ++i) { hits -= c.find(eastl::string_view(p, lengths[i])) != c.end(); }
+  double const viaView = t.elapsed();
+  benchmark::do_not_optimize(hits);
+
+  std::printf("%-12s find(string) %6.1f ns  %4.2f allocations   find(string_view) %6.1f ns  %4.2f allocations\n",
+              name, viaString * 1e9 / kQueries, double(allocations) / kQueries,
+              viaView * 1e9 / kQueries, double(benchmark::counters::allocations()) / kQueries);
+}
+
+} // namespace
+
+int main() {
+  eastl::vector<char> text;
+  eastl::vector<int> lengths;
+  unsigned seed = 1;
+  for (int i = 0; i < kQueries; ++i) {
+    char token[64];
+    int const n = make_token(seed, token);
+    text.insert(text.end(), token, token + n);
+    lengths.push_back(n);
+  }
+
+  eastl::map<string_type, int> m;
+  eastl::hash_map<string_type, int, token_hash> hm;
+  eastl::vector_map<string_type, int> vm;
+  for (int i = 0; i < kKeys; ++i) {
+    char token[64];
+    string_type const key(token, token + make_token(seed, token));
+    m[key] = i;
+    hm[key] = i;
+    vm.insert(eastl::make_pair(key, i));
+  }
+
+  run("map", m, text, lengths);
+  run("hash_map", hm, text, lengths);
+  run("vector_map", vm, text, lengths);
+}
@@ -0,0 +1,107 @@
+#include "benchmark.hpp"
+
+#include <EASTL/string.h>
+#include <EASTL/utf.h>
+
+
+namespace {
+
+const int kRounds = 200;
+
+typedef eastl::basic_string<char8_t, benchmark::counting_allocator> string8_type;
+typedef eastl::basic_string<char16_t, benchmark::counting_allocator> string16_type;
+
+void report(const char* name, double elapsed, size_t nBytes) {
+  std::printf("%-36s %8.0f MB/s   %6.1f allocations per conversion\n", name, nBytes * kRounds / elapsed / 1e6,
+              double(benchmark::counters::allocations()) / kRounds);
+}
+
+// The scalar loop application code uses: validate and decode each code point
+// and push_back its UTF-16 units.
+bool scalar_convert(string8_type const& s, string16_type& dest) {
+  dest.clear();
+  for (const unsigned char* p = (const unsigned char*)s.data(), *pEnd = p + s.size(); p != pEnd;) {
+    uint32_t c = *p++;
+    if (c >= 0x80) {
+      int n = c >= 0xf0 ? 3 : c >= 0xe0 ? 2 : 1;
+      uint32_t const nMin = n == 3 ? 0x10000 : n == 2 ? 0x800 : 0x80;
+      if (c < 0xc2 || c > 0xf4 || pEnd - p < n) { return false; }
+      c &= 0x3f >> n;
+      for (; n > 0; --n, ++p) {
+        if ((*p & 0xc0) != 0x80) { return false; }
+        c = (c << 6) | (*p & 0x3f);
+      }
+      if (c < nMin || c > 0x10ffff || (c >= 0xd800 && c < 0xe000)) { return false; }
+    }
+    if (c >= 0x10000) {
+      dest.push_back((char16_t)(0xd7c0 + (c >> 10)));
+      dest.push_back((char16_t)(0xdc00 | (c & 0x3ff)));
+    } else {
+      dest.push_back((char16_t)c);
+    }
+  }
+  return true;
+}
+
+void convert(const char* name, string8_type const& s) {
+  size_t sum = 0;
+  std::printf("%s, %u bytes:\n", name, (unsigned)s.size());
+
+  benchmark::counters::reset();
+  benchmark::timer t;
+  for (int i = 0; i < kRounds; ++i) {
+    string16_type dest;
+    sum += scalar_convert(s, dest) + dest.size();
+  }
+  report("  scalar decode + push_back", t.elapsed(), s.size());
+
+  benchmark::counters::reset();
+  t.restart();
+  for (int i = 0; i < kRounds; ++i) {
+    string16_type dest;
+    sum += eastl::utf_convert(s, dest) + dest.size();
+  }
+  report("  utf_convert 8 to 16", t.elapsed(), s.size());
+
+  string16_type s16;
+  eastl::utf_convert(s, s16);
+  benchmark::counters::reset();
+  t.restart();
+  for (int i = 0; i < kRounds; ++i) {
+    string8_type dest;
+    sum += eastl::utf_convert(s16, dest) + dest.size();
+  }
+  report("  utf_convert 16 to 8", t.elapsed(), s.size());
+
+  benchmark::counters::reset();
+  t.restart();
+  for (int i = 0; i < kRounds; ++i) { sum += eastl::utf_validate(s); }
+  report("  utf_validate", t.elapsed(), s.size());
+
+  benchmark::do_not_optimize(sum);
+}
+
+} // namespace
+
+int main() {
+  // Log lines and JSON: ASCII with an occasional accented name or symbol.
+  string8_type ascii;
+  while (ascii.size() < 1000000) {
+    ascii += "{\"user\":\"Jos\xc3\xa9 Mart\xc3\xadnez\",\"amount\":\"12.50 \xe2\x82\xac\",\"status\":\"ok\",\"path\":\"/api/v1/orders/48213\"}\n";
+  }
+
+  // Mostly CJK text, three bytes a character, with ASCII punctuation.
+  string8_type cjk;
+  uint32_t seed = 1;
+  while (cjk.size() < 1000000) {
+    seed = seed * 1664525 + 1013904223;
+    uint32_t const c = 0x4e00 + (seed >> 16) % 0x5000;
+    cjk.push_back((char8_t)(0xe0 | (c >> 12)));
+    cjk.push_back((char8_t)(0x80 | ((c >> 6) & 0x3f)));
+    cjk.push_back((char8_t)(0x80 | (c & 0x3f)));
+    if ((seed >> 8) % 16 == 0) { cjk += ", "; }
+  }
+
+  convert("mostly ASCII", ascii);
+  convert("mostly CJK", cjk);
+}
@@ -0,0 +1,102 @@
+#include "benchmark.hpp"
+
+#include <EASTL/lazy_vector_map.h>
+#include <EASTL/map.h>
+#include <EASTL/vector.h>
+#include <EASTL/vector_map.h>
+
+
+namespace {
+
+typedef eastl::vector_map<int, int> int_map;
+typedef eastl::vector<eastl::pair<int, int> > pair_vector;
+
+const int kIterations = 5;
+
+// Deterministic keys with roughly 10% duplicates.
+pair_vector make_input(int n) {
+  pair_vector v;
+  v.reserve(n);
+  unsigned x = 12345;
+  for (int i = 0; i < n; ++i) {
+    x = x * 1103515245u + 12345u;
+    v.push_back(eastl::make_pair(int((x >> 8) % unsigned(n * 9 / 10 + 1)), i));
+  }
+  return v;
+}
+
+// What the range constructor used to do: build a map and copy it out.
+void legacy_map_copy(pair_vector const& in, int_map& out) {
+  eastl::map<int, int> const tmp(in.begin(), in.end());
+  int_map result;
+  for (eastl::map<int, int>::const_iterator i = tmp.begin(); i != tmp.end(); ++i) {
+    result.insert(result.end(), *i);
+  }
+  out.swap(result);
+}
+
+// What range insert used to do: insert the elements one by one.
+void legacy_insert_loop(pair_vector const& in, int_map& out) {
+  int_map result;
+  for (pair_vector::const_iterator i = in.begin(); i != in.end(); ++i) { result.insert(*i); }
+  out.swap(result);
+}
+
+// Insert one by one into a lazy_vector_map and read once.
+void lazy_insert_loop(pair_vector const& in, int_map& out) {
+  eastl::lazy_vector_map<int, int> lazy;
+  for (pair_vector::const_iterator i = in.begin(); i != in.end(); ++i) { lazy.insert(*i); }
+  int_map result(eastl::sorted_unique, lazy.begin(), lazy.end());
+  out.swap(result);
+}
+
+void range_ctor(pair_vector const& in, int_map& out) {
+  int_map result(in.begin(), in.end());
+  out.swap(result);
+}
+
+void range_insert(pair_vector const& in, int_map& out) {
+  // Half of the elements are already in the map.
+  int_map result(in.begin(), in.begin() + in.size() / 2);
+  result.insert(in.begin() + in.size() / 2, in.end());
+  out.swap(result);
+}
+
+template<class F>
+void run(char const* name, F f, pair_vector const& in) {
+  int_map out;
+  benchmark::timer t;
+  for (int i = 0; i < kIterations; ++i) {
+    f(in, out);
+    benchmark::do_not_optimize(out.size());
+  }
+  std::printf("%-20s %8d elements %10.2f ms  -> %d unique\n", name, int(in.size()),
+              t.elapsed() * 1000.0 / kIterations, int(out.size()));
+}
+
+} // namespace
+
+int main() {
+  int const sizes[] = { 10000, 100000, 1000000 };
+
+  for (unsigned s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+    pair_vector const in = make_input(sizes[s]);
+
+    run("legacy map copy", legacy_map_copy, in);
+    // Quadratic; too slow to be worth running on the largest input.
+    if (sizes[s] <= 100000) { run("legacy insert loop", legacy_insert_loop, in); }
+    run("lazy insert loop", lazy_insert_loop, in);
+    run("range ctor", range_ctor, in);
+    run("range insert", range_insert, in);
+
+    int_map const sorted(in.begin(), in.end());
+    pair_vector const sorted_in(sorted.begin(), sorted.end());
+    benchmark::timer t;
+    for (int i = 0; i < kIterations; ++i) {
+      int_map const m(eastl::sorted_unique, sorted_in.begin(), sorted_in.end());
+      benchmark::do_not_optimize(m.size());
+    }
+    std::printf("%-20s %8d elements %10.2f ms\n", "sorted_unique ctor", int(sorted_in.size()),
+                t.elapsed() * 1000.0 / kIterations);
+  }
+}
@@ -110,6 +110,7 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <EASTL/iterator.h>
 #include <EASTL/functional.h>
 #include <EASTL/internal/generic_iterator.h>
+#include <EASTL/internal/char_search.h>
 #include <EASTL/type_traits.h>
 
 #ifdef _MSC_VER
@@ -676,8 +677,11 @@ namespace eastl
         {
             // We cannot use memcpy because memcpy requires the entire source and dest ranges to be 
             // non-overlapping, whereas the copy algorithm requires only that 'result' not be within
-            // the range from first to last.
-            return (T*)memmove(result, first, (size_t)((uintptr_t)last - (uintptr_t)first)) + (last - first);
+            // the range from first to last. An empty range may be a pair of NULLs, which memmove 
+            // must not be passed even with a zero size, or the compiler may drop later NULL checks.
+            if(first != last)
+                memmove(result, first, (size_t)((uintptr_t)last - (uintptr_t)first));
+            return result + (last - first);
         }
     };
 
@@ -802,7 +806,9 @@ namespace eastl
         template <typename T>
         static T* do_copy(const T* first, const T* last, T* result)
         {
-            return (T*)memmove(result - (last - first), first, (size_t)((uintptr_t)last - (uintptr_t)first));
+            if(first != last) // See copy_impl about empty ranges.
+                memmove(result - (last - first), first, (size_t)((uintptr_t)last - (uintptr_t)first));
+            return result - (last - first);
         }
     };
 
@@ -1186,6 +1192,59 @@ namespace eastl
 
 
 
+    // find_first_of_impl
+    // Implements find_first_of and find_first_not_of, with CharFindFirstOf and 
+    // CharFindFirstNotOf when both ranges are arrays of char.
+    //
+    template <bool bCharPointers>
+    struct find_first_of_impl
+    {
+        template <typename ForwardIterator1, typename ForwardIterator2>
+        static ForwardIterator1 do_find(ForwardIterator1 first1, ForwardIterator1 last1, 
+                                        ForwardIterator2 first2, ForwardIterator2 last2)
+        {
+            for(; first1 != last1; ++first1)
+            {
+                for(ForwardIterator2 i = first2; i != last2; ++i)
+                {
+                    if(*first1 == *i)
+                        return first1;
+                }
+            }
+            return last1;
+        }
+
+        template <typename ForwardIterator1, typename ForwardIterator2>
+        static ForwardIterator1 do_find_not(ForwardIterator1 first1, ForwardIterator1 last1, 
+                                            ForwardIterator2 first2, ForwardIterator2 last2)
+        {
+            for(; first1 != last1; ++first1)
+            {
+                if(eastl::find(first2, last2, *first1) == last2)
+                    break;
+            }
+
+            return first1;
+        }
+    };
+
+    template <>
+    struct find_first_of_impl<true>
+    {
+        template <typename T1, typename T2>
+        static T1* do_find(T1* first1, T1* last1, T2* first2, T2* last2)
+        {
+            return const_cast<T1*>(CharFindFirstOf((const char*)first1, (const char*)last1, (const char*)first2, (const char*)last2));
+        }
+
+        template <typename T1, typename T2>
+        static T1* do_find_not(T1* first1, T1* last1, T2* first2, T2* last2)
+        {
+            return const_cast<T1*>(CharFindFirstNotOf((const char*)first1, (const char*)last1, (const char*)first2, (const char*)last2));
+        }
+    };
+
+
     /// find_first_of
     ///
     /// find_first_of is similar to find in that it performs linear search through 
@@ -1206,20 +1265,20 @@ namespace eastl
     /// Complexity: At most '(last1 - first1) * (last2 - first2)' applications of the 
     /// corresponding predicate.
     ///
+    /// Searches of char arrays for char arrays use CharFindFirstOf, which 
+    /// examines several characters per instruction where SIMD is available.
+    ///
     template <typename ForwardIterator1, typename ForwardIterator2>
-    ForwardIterator1
+    inline ForwardIterator1
     find_first_of(ForwardIterator1 first1, ForwardIterator1 last1, 
                   ForwardIterator2 first2, ForwardIterator2 last2)
     {
-        for(; first1 != last1; ++first1)
-        {
-            for(ForwardIterator2 i = first2; i != last2; ++i)
-            {
-                if(*first1 == *i)
-                    return first1;
-            }
-        }
-        return last1;
+        const bool bCharPointers = type_and<is_pointer<ForwardIterator1>::value,
+                                            is_pointer<ForwardIterator2>::value,
+                                            is_same<typename eastl::iterator_traits<ForwardIterator1>::value_type, char>::value,
+                                            is_same<typename eastl::iterator_traits<ForwardIterator2>::value_type, char>::value>::value;
+
+        return eastl::find_first_of_impl<bCharPointers>::do_find(first1, last1, first2, last2);
     }
 
 
@@ -1271,18 +1330,19 @@ namespace eastl
     /// Complexity: At most '(last1 - first1) * (last2 - first2)' applications of the 
     /// corresponding predicate.
     ///
+    /// As with find_first_of, searches of char arrays use CharFindFirstNotOf.
+    ///
     template<class ForwardIterator1, class ForwardIterator2>
-    ForwardIterator1
+    inline ForwardIterator1
     find_first_not_of(ForwardIterator1 first1, ForwardIterator1 last1, 
                       ForwardIterator2 first2, ForwardIterator2 last2)
     {
-        for(; first1 != last1; ++first1)
-        {
-            if(eastl::find(first2, last2, *first1) == last2)
-                break;
-        }
+        const bool bCharPointers = type_and<is_pointer<ForwardIterator1>::value,
+                                            is_pointer<ForwardIterator2>::value,
+                                            is_same<typename eastl::iterator_traits<ForwardIterator1>::value_type, char>::value,
+                                            is_same<typename eastl::iterator_traits<ForwardIterator2>::value_type, char>::value>::value;
 
-        return first1;
+        return eastl::find_first_of_impl<bCharPointers>::do_find_not(first1, last1, first2, last2);
     }
 
 
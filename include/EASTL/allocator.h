@@ -39,6 +39,7 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 
 #include <EASTL/internal/config.h>
+#include <EASTL/type_traits.h>
 #include <stddef.h>
 
 
@@ -71,6 +72,20 @@ namespace eastl
     };
 
 
+    /// allocation_result
+    ///
+    /// Returned by allocate_at_least. ptr is the allocated block (or NULL upon
+    /// failure) and count is the number of bytes that the caller may use, 
+    /// which is at least the number of bytes requested. The block may be freed 
+    /// with any size between the requested size and count, inclusive.
+    ///
+    struct allocation_result
+    {
+        void*  ptr;
+        size_t count;
+    };
+
+
     /// allocator
     ///
     /// In this allocator class, note that it is not templated on any type and
@@ -93,6 +108,9 @@ namespace eastl
         void* allocate(size_t n, size_t alignment, size_t offset, int flags = 0);
         void  deallocate(void* p, size_t n);
 
+        allocation_result allocate_at_least(size_t n, int flags = 0);
+        allocation_result allocate_at_least(size_t n, size_t alignment, size_t offset, int flags = 0);
+
         const char* get_name() const;
         void        set_name(const char* pName);
 
@@ -173,6 +191,232 @@ namespace eastl
         return EASTLAllocAligned(a, n, alignment, alignmentOffset);
     }
 
+
+    /// allocator_can_reallocate
+    ///
+    /// Identifies allocators which implement the following function in 
+    /// addition to the regular allocator interface:
+    ///     void* reallocate(void* p, size_t prevSize, size_t n, int flags = 0);
+    ///
+    /// reallocate resizes the block p (which was allocated with prevSize bytes)
+    /// to n bytes, possibly moving it, and returns the new block. The contents 
+    /// of the block up to the lesser of prevSize and n are preserved bitwise.
+    /// Passing a NULL p is the same as calling allocate(n). Containers use this 
+    /// to resize storage of trivially relocatable types without allocating a 
+    /// second block and copying, which is a significant win for very large 
+    /// blocks where the allocator can simply remap pages (e.g. mmap_allocator).
+    ///
+    /// By default allocators are assumed to not support reallocation. The user 
+    /// can declare support for a custom allocator like so:
+    ///     namespace eastl { template <> struct allocator_can_reallocate<MyAllocator> : public true_type{}; }
+    ///
+    template <typename Allocator>
+    struct allocator_can_reallocate : public false_type{};
+
+
+    /// allocator_usable_size
+    ///
+    /// Returns the number of bytes that are actually usable by the caller when 
+    /// n bytes are requested from the given allocator. Some allocators round 
+    /// requests up (e.g. to a size class or to a page), and containers can 
+    /// make use of the rounded up space instead of wasting it. By default we 
+    /// return n, as we know nothing about the allocator. The user can provide 
+    /// an overload for a custom allocator, in the allocator's namespace:
+    ///
+    /// Example usage:
+    ///     inline size_t allocator_usable_size(const MyAllocator&, size_t n)
+    ///         { return (n + 15) & ~15; }
+    ///
+    template <typename Allocator>
+    inline size_t allocator_usable_size(const Allocator&, size_t n)
+    {
+        return n;
+    }
+
+
+    /// growth_policy_2x
+    ///
+    /// A growth policy decides the new capacity of a container which has run 
+    /// out of space. It is called with the current capacity (in elements) and 
+    /// must return a value that is greater than nCapacity and at least 
+    /// nInitialCapacity. The container will use the larger of that value and 
+    /// the size it needs. See allocator_growth_policy for how a policy is selected.
+    ///
+    /// growth_policy_2x doubles the capacity. This is the EASTL default.
+    ///
+    struct growth_policy_2x
+    {
+        template <typename Allocator>
+        size_t operator()(const Allocator&, size_t nCapacity, size_t nInitialCapacity, size_t /*nElementSize*/) const
+        {
+            const size_t n = 2 * nCapacity;
+            return (n > nInitialCapacity) ? n : nInitialCapacity;
+        }
+    };
+
+
+    /// growth_policy_1_5x
+    ///
+    /// Grows the capacity by a factor of 1.5. This wastes less memory than 
+    /// doubling and allows the allocator to reuse a previously freed run of 
+    /// blocks for a later reallocation, which is impossible with a factor >= 2.
+    ///
+    struct growth_policy_1_5x
+    {
+        template <typename Allocator>
+        size_t operator()(const Allocator&, size_t nCapacity, size_t nInitialCapacity, size_t /*nElementSize*/) const
+        {
+            const size_t n = nCapacity + ((nCapacity + 1) / 2); // + 1 so that a capacity of 1 still grows.
+            return (n > nInitialCapacity) ? n : nInitialCapacity;
+        }
+    };
+
+
+    /// growth_policy_usable_size
+    ///
+    /// Grows according to GrowthPolicy and then rounds the result up so that 
+    /// the block fills all of the memory that the allocator would hand out for 
+    /// it anyway, as reported by allocator_usable_size. With mmap_allocator this 
+    /// results in page-rounded growth.
+    ///
+    template <typename GrowthPolicy = growth_policy_2x>
+    struct growth_policy_usable_size
+    {
+        template <typename Allocator>
+        size_t operator()(const Allocator& allocator, size_t nCapacity, size_t nInitialCapacity, size_t nElementSize) const
+        {
+            const size_t n = GrowthPolicy()(allocator, nCapacity, nInitialCapacity, nElementSize);
+            return allocator_usable_size(allocator, n * nElementSize) / nElementSize;
+        }
+    };
+
+
+    /// allocator_growth_policy
+    ///
+    /// Selects the growth policy which vector and basic_string use with a given
+    /// allocator type. The default is growth_policy_2x. The user can change the
+    /// policy for all containers that use a custom allocator by specializing 
+    /// this, or for individual containers by using growth_policy_allocator.
+    ///
+    /// Example usage:
+    ///     namespace eastl { template <> struct allocator_growth_policy<MyAllocator> { typedef growth_policy_1_5x type; }; }
+    ///
+    template <typename Allocator>
+    struct allocator_growth_policy
+    {
+        typedef growth_policy_2x type;
+    };
+
+
+    /// growth_policy_allocator
+    ///
+    /// Adapts Allocator such that containers which use it grow according to GrowthPolicy.
+    /// It otherwise behaves exactly like Allocator.
+    ///
+    /// Example usage:
+    ///     eastl::vector<Widget, growth_policy_allocator<growth_policy_1_5x> > widgetArray;
+    ///
+    template <typename GrowthPolicy, typename Allocator = EASTLAllocatorType>
+    class growth_policy_allocator : public Allocator
+    {
+    public:
+        typedef GrowthPolicy growth_policy_type;
+        typedef Allocator    base_type;
+
+        EASTL_ALLOCATOR_EXPLICIT growth_policy_allocator(const char* pName = EASTL_NAME_VAL(EASTL_ALLOCATOR_DEFAULT_NAME))
+            : Allocator(pName) { }
+
+        growth_policy_allocator(const Allocator& x)
+            : Allocator(x) { }
+    };
+
+    template <typename GrowthPolicy, typename Allocator>
+    struct allocator_growth_policy<growth_policy_allocator<GrowthPolicy, Allocator> >
+    {
+        typedef GrowthPolicy type;
+    };
+
+    template <typename GrowthPolicy, typename Allocator>
+    struct allocator_can_reallocate<growth_policy_allocator<GrowthPolicy, Allocator> > : public allocator_can_reallocate<Allocator>{};
+
+    template <typename GrowthPolicy, typename Allocator>
+    inline size_t allocator_usable_size(const growth_policy_allocator<GrowthPolicy, Allocator>& allocator, size_t n)
+    {
+        return allocator_usable_size(static_cast<const Allocator&>(allocator), n);
+    }
+
+
+    /// allocate_memory_at_least
+    ///
+    /// This is a memory allocation dispatching function like allocate_memory, 
+    /// except that it also returns the size of the block that was actually 
+    /// provided, so that containers can make use of any excess capacity the 
+    /// allocator handed back. Allocators which know their usable block sizes 
+    /// can implement:
+    ///     allocation_result allocate_at_least(size_t n, int flags = 0);
+    ///     allocation_result allocate_at_least(size_t n, size_t alignment, size_t offset, int flags = 0);
+    /// and provide an overload of this function which calls them, as is done 
+    /// for allocator, CoreAllocatorAdapter and fixed_vector_allocator.
+    /// Other allocators get the generic version below, which reports 
+    /// allocator_usable_size(a, n).
+    ///
+    template <typename Allocator>
+    allocation_result allocate_memory_at_least(Allocator& a, size_t n, size_t alignment, size_t alignmentOffset)
+    {
+        allocation_result result;
+        result.ptr   = allocate_memory(a, n, alignment, alignmentOffset);
+        result.count = allocator_usable_size(a, n);
+        return result;
+    }
+
+    namespace Internal
+    {
+        // Dispatches to an allocator's allocate_at_least member functions.
+        template <typename Allocator>
+        allocation_result allocate_at_least_member(Allocator& a, size_t n, size_t alignment, size_t alignmentOffset)
+        {
+            if(alignment <= 8)
+                return a.allocate_at_least(n);
+            return a.allocate_at_least(n, alignment, alignmentOffset);
+        }
+    }
+
+    inline allocation_result allocate_memory_at_least(allocator& a, size_t n, size_t alignment, size_t alignmentOffset)
+    {
+        return Internal::allocate_at_least_member(a, n, alignment, alignmentOffset);
+    }
+
+    template <typename GrowthPolicy, typename Allocator>
+    inline allocation_result allocate_memory_at_least(growth_policy_allocator<GrowthPolicy, Allocator>& a, size_t n, size_t alignment, size_t alignmentOffset)
+    {
+        return allocate_memory_at_least(static_cast<Allocator&>(a), n, alignment, alignmentOffset);
+    }
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // allocator
+    //
+    // allocate_at_least is implemented in terms of allocate, so we define 
+    // it here even if the user has provided their own allocator implementation.
+    ///////////////////////////////////////////////////////////////////////
+
+    inline allocation_result allocator::allocate_at_least(size_t n, int flags)
+    {
+        allocation_result result;
+        result.ptr   = allocate(n, flags);
+        result.count = result.ptr ? (size_t)EASTL_ALLOCATOR_USABLE_SIZE(result.ptr, n) : 0;
+        return result;
+    }
+
+
+    inline allocation_result allocator::allocate_at_least(size_t n, size_t alignment, size_t offset, int flags)
+    {
+        allocation_result result;
+        result.ptr   = allocate(n, alignment, offset, flags);
+        result.count = result.ptr ? (size_t)EASTL_ALLOCATOR_USABLE_SIZE(result.ptr, n) : 0;
+        return result;
+    }
+
 } // namespace eastl
 
 
@@ -69,6 +69,18 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
     #pragma warning(pop)
 #endif
 
+#if EASTL_BITSET_INTRINSICS_ENABLED && defined(_MSC_VER)
+    #pragma warning(push, 0)
+    #include <intrin.h>
+    #pragma warning(pop)
+#endif
+
+#if EASTL_AVX2
+    #include <immintrin.h>
+#elif EASTL_SSE2
+    #include <emmintrin.h>
+#endif
+
 #if EASTL_EXCEPTIONS_ENABLED
     #ifdef _MSC_VER
         #pragma warning(push, 0)
@@ -428,25 +440,47 @@ namespace eastl
 
 
 
+    /// EASTL_BITSET_POPCNT
+    ///
+    /// Defined as 1 if BitsetCountBits uses the popcnt instruction.
+    ///
+    #if EASTL_BITSET_INTRINSICS_ENABLED && (defined(__POPCNT__) || (defined(_MSC_VER) && defined(__AVX__)))
+        #define EASTL_BITSET_POPCNT 1
+    #else
+        #define EASTL_BITSET_POPCNT 0
+    #endif
+
+
     /// BitsetCountBits
     ///
-    /// This is a fast trick way to count bits without branches nor memory accesses.
+    /// Returns the number of set bits. Without a popcnt instruction, this is
+    /// a fast trick way to count bits without branches nor memory accesses.
     ///
     #if(EA_PLATFORM_WORD_SIZE == 4)
         inline uint32_t BitsetCountBits(uint32_t x)
         {
-            x = x - ((x >> 1) & 0x55555555);
-            x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
-            x = (x + (x >> 4)) & 0x0F0F0F0F;
-            return (uint32_t)((x * 0x01010101) >> 24);
+            #if EASTL_BITSET_POPCNT && defined(_MSC_VER)
+                return (uint32_t)__popcnt(x);
+            #elif EASTL_BITSET_POPCNT
+                return (uint32_t)__builtin_popcount(x);
+            #else
+                x = x - ((x >> 1) & 0x55555555);
+                x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+                x = (x + (x >> 4)) & 0x0F0F0F0F;
+                return (uint32_t)((x * 0x01010101) >> 24);
+            #endif
         }
     #else
         inline uint32_t BitsetCountBits(uint64_t x)
         {
+            #if EASTL_BITSET_POPCNT && defined(_MSC_VER)
+                return (uint32_t)__popcnt64(x);
+            #elif EASTL_BITSET_POPCNT
+                return (uint32_t)__builtin_popcountll(x);
             // GCC 3.x's implementation of UINT64_C is broken and fails to deal with 
             // the code below correctly. So we make a workaround for it. Earlier and 
             // later versions of GCC don't have this bug.
-            #if defined(__GNUC__) && (__GNUC__ == 3)
+            #elif defined(__GNUC__) && (__GNUC__ == 3)
                 x = x - ((x >> 1) & 0x5555555555555555ULL);
                 x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
                 x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
@@ -460,6 +494,77 @@ namespace eastl
         }
     #endif
 
+
+    /// BitsetAndOp, BitsetOrOp, BitsetXorOp, BitsetAndNotOp
+    ///
+    /// Combine two words, or two SIMD registers of words where available.
+    /// Used with BitsetCombineWords.
+    ///
+    struct BitsetAndOp
+    {
+        BitsetWordType operator()(BitsetWordType a, BitsetWordType b) const { return a & b; }
+        #if EASTL_AVX2
+            __m256i operator()(__m256i a, __m256i b) const { return _mm256_and_si256(a, b); }
+        #elif EASTL_SSE2
+            __m128i operator()(__m128i a, __m128i b) const { return _mm_and_si128(a, b); }
+        #endif
+    };
+
+    struct BitsetOrOp
+    {
+        BitsetWordType operator()(BitsetWordType a, BitsetWordType b) const { return a | b; }
+        #if EASTL_AVX2
+            __m256i operator()(__m256i a, __m256i b) const { return _mm256_or_si256(a, b); }
+        #elif EASTL_SSE2
+            __m128i operator()(__m128i a, __m128i b) const { return _mm_or_si128(a, b); }
+        #endif
+    };
+
+    struct BitsetXorOp
+    {
+        BitsetWordType operator()(BitsetWordType a, BitsetWordType b) const { return a ^ b; }
+        #if EASTL_AVX2
+            __m256i operator()(__m256i a, __m256i b) const { return _mm256_xor_si256(a, b); }
+        #elif EASTL_SSE2
+            __m128i operator()(__m128i a, __m128i b) const { return _mm_xor_si128(a, b); }
+        #endif
+    };
+
+    struct BitsetAndNotOp // a & ~b
+    {
+        BitsetWordType operator()(BitsetWordType a, BitsetWordType b) const { return a & ~b; }
+        #if EASTL_AVX2
+            __m256i operator()(__m256i a, __m256i b) const { return _mm256_andnot_si256(b, a); }
+        #elif EASTL_SSE2
+            __m128i operator()(__m128i a, __m128i b) const { return _mm_andnot_si128(b, a); }
+        #endif
+    };
+
+
+    /// BitsetCombineWords
+    ///
+    /// Does p[i] = op(p[i], pX[i]) for the n words at p, a SIMD register at
+    /// a time for as long as there are enough words left. This is for word
+    /// counts known only at runtime; BitsetBase's fixed-count loops are
+    /// vectorized at least as well by the compiler.
+    ///
+    template <typename Op>
+    inline void BitsetCombineWords(BitsetWordType* p, const BitsetWordType* pX, size_t n, Op op)
+    {
+        size_t i = 0;
+
+        #if EASTL_AVX2
+            for(const size_t nStep = sizeof(__m256i) / sizeof(BitsetWordType); (i + nStep) <= n; i += nStep)
+                _mm256_storeu_si256((__m256i*)(p + i), op(_mm256_loadu_si256((const __m256i*)(p + i)), _mm256_loadu_si256((const __m256i*)(pX + i))));
+        #elif EASTL_SSE2
+            for(const size_t nStep = sizeof(__m128i) / sizeof(BitsetWordType); (i + nStep) <= n; i += nStep)
+                _mm_storeu_si128((__m128i*)(p + i), op(_mm_loadu_si128((const __m128i*)(p + i)), _mm_loadu_si128((const __m128i*)(pX + i))));
+        #endif
+
+        for(; i < n; ++i)
+            p[i] = op(p[i], pX[i]);
+    }
+
     // const static char kBitsPerUint16[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
     #define EASTL_BITSET_COUNT_STRING "\0\1\1\2\1\2\2\3\1\2\2\3\2\3\3\4"
 
@@ -637,24 +742,7 @@ namespace eastl
         size_type n = 0;
 
         for(size_t i = 0; i < NW; i++)
-        {
-            #if defined(__GNUC__) && (((__GNUC__ * 100) + __GNUC_MINOR__) >= 304) && !defined(__SNC__) && !defined(EA_PLATFORM_ANDROID) // GCC 3.4 or later
-                #if(EA_PLATFORM_WORD_SIZE == 4)
-                    n += (size_type)__builtin_popcountl(mWord[i]);
-                #else
-                    n += (size_type)__builtin_popcountll(mWord[i]);
-                #endif
-            #elif defined(__GNUC__) && (__GNUC__ < 3)
-                n +=  BitsetCountBits(mWord[i]); // GCC 2.x compiler inexplicably blows up on the code below.
-            #else
-                for(word_type w = mWord[i]; w; w >>= 4)
-                    n += EASTL_BITSET_COUNT_STRING[w & 0xF];
-
-                // Version which seems to run slower in benchmarks:
-                // n +=  BitsetCountBits(mWord[i]);
-            #endif
-
-        }
+            n += (size_type)BitsetCountBits(mWord[i]);
         return n;
     }
 
@@ -692,37 +780,51 @@ namespace eastl
     #if(EA_PLATFORM_WORD_SIZE == 4)
         inline uint32_t GetFirstBit(uint32_t x)
         {
-            if(x)
-            {
-                uint32_t n = 1;
+            #if EASTL_BITSET_INTRINSICS_ENABLED && defined(_MSC_VER)
+                unsigned long n;
+                return _BitScanForward(&n, x) ? (uint32_t)n : 32;
+            #elif EASTL_BITSET_INTRINSICS_ENABLED
+                return x ? (uint32_t)__builtin_ctz(x) : 32;
+            #else
+                if(x)
+                {
+                    uint32_t n = 1;
 
-                if((x & 0x0000FFFF) == 0) { n += 16; x >>= 16; }
-                if((x & 0x000000FF) == 0) { n +=  8; x >>=  8; }
-                if((x & 0x0000000F) == 0) { n +=  4; x >>=  4; }
-                if((x & 0x00000003) == 0) { n +=  2; x >>=  2; }
+                    if((x & 0x0000FFFF) == 0) { n += 16; x >>= 16; }
+                    if((x & 0x000000FF) == 0) { n +=  8; x >>=  8; }
+                    if((x & 0x0000000F) == 0) { n +=  4; x >>=  4; }
+                    if((x & 0x00000003) == 0) { n +=  2; x >>=  2; }
 
-                return (n - ((uint32_t)x & 1));
-            }
+                    return (n - ((uint32_t)x & 1));
+                }
 
-            return 32;
+                return 32;
+            #endif
         }
     #else
         inline uint32_t GetFirstBit(uint64_t x)
         {
-            if(x)
-            {
-                uint32_t n = 1;
+            #if EASTL_BITSET_INTRINSICS_ENABLED && defined(_MSC_VER) && defined(_M_X64)
+                unsigned long n;
+                return _BitScanForward64(&n, x) ? (uint32_t)n : 64;
+            #elif EASTL_BITSET_INTRINSICS_ENABLED && !defined(_MSC_VER)
+                return x ? (uint32_t)__builtin_ctzll(x) : 64;
+            #else
+                if(x)
+                {
+                    uint32_t n = 1;
 
-                if((x & 0xFFFFFFFF) == 0) { n += 32; x >>= 32; }
-                if((x & 0x0000FFFF) == 0) { n += 16; x >>= 16; }
-                if((x & 0x000000FF) == 0) { n +=  8; x >>=  8; }
-                if((x & 0x0000000F) == 0) { n +=  4; x >>=  4; }
-                if((x & 0x00000003) == 0) { n +=  2; x >>=  2; }
+                    if((x & 0xFFFFFFFF) == 0) { n += 32; x >>= 32; }
+                    if((x & 0x0000FFFF) == 0) { n += 16; x >>= 16; }
+                    if((x & 0x000000FF) == 0) { n +=  8; x >>=  8; }
+                    if((x & 0x0000000F) == 0) { n +=  4; x >>=  4; }
+                    if((x & 0x00000003) == 0) { n +=  2; x >>=  2; }
 
-                return (n - ((uint32_t)x & 1));
-            }
+                    return (n - ((uint32_t)x & 1));
+                }
 
-            return 64;
+                return 64;
+            #endif
         }
     #endif
 
@@ -781,39 +883,53 @@ namespace eastl
     #if(EA_PLATFORM_WORD_SIZE == 4)
         inline uint32_t GetLastBit(uint32_t x)
         {
-            if(x)
-            {
-                uint32_t n = 0;
+            #if EASTL_BITSET_INTRINSICS_ENABLED && defined(_MSC_VER)
+                unsigned long n;
+                return _BitScanReverse(&n, x) ? (uint32_t)n : 32;
+            #elif EASTL_BITSET_INTRINSICS_ENABLED
+                return x ? (uint32_t)(31 - __builtin_clz(x)) : 32;
+            #else
+                if(x)
+                {
+                    uint32_t n = 0;
 
-                if(x & 0xFFFF0000) { n += 16; x >>= 16; }
-                if(x & 0xFFFFFF00) { n +=  8; x >>=  8; }
-                if(x & 0xFFFFFFF0) { n +=  4; x >>=  4; }
-                if(x & 0xFFFFFFFC) { n +=  2; x >>=  2; }
-                if(x & 0xFFFFFFFE) { n +=  1;           }
+                    if(x & 0xFFFF0000) { n += 16; x >>= 16; }
+                    if(x & 0xFFFFFF00) { n +=  8; x >>=  8; }
+                    if(x & 0xFFFFFFF0) { n +=  4; x >>=  4; }
+                    if(x & 0xFFFFFFFC) { n +=  2; x >>=  2; }
+                    if(x & 0xFFFFFFFE) { n +=  1;           }
 
-                return n;
-            }
+                    return n;
+                }
 
-            return 32;
+                return 32;
+            #endif
         }
     #else
         inline uint32_t GetLastBit(uint64_t x)
         {
-            if(x)
-            {
-                uint32_t n = 0;
+            #if EASTL_BITSET_INTRINSICS_ENABLED && defined(_MSC_VER) && defined(_M_X64)
+                unsigned long n;
+                return _BitScanReverse64(&n, x) ? (uint32_t)n : 64;
+            #elif EASTL_BITSET_INTRINSICS_ENABLED && !defined(_MSC_VER)
+                return x ? (uint32_t)(63 - __builtin_clzll(x)) : 64;
+            #else
+                if(x)
+                {
+                    uint32_t n = 0;
 
-                if(x & UINT64_C(0xFFFFFFFF00000000)) { n += 32; x >>= 32; }
-                if(x & 0xFFFF0000)                   { n += 16; x >>= 16; }
-                if(x & 0xFFFFFF00)                   { n +=  8; x >>=  8; }
-                if(x & 0xFFFFFFF0)                   { n +=  4; x >>=  4; }
-                if(x & 0xFFFFFFFC)                   { n +=  2; x >>=  2; }
-                if(x & 0xFFFFFFFE)                   { n +=  1;           }
+                    if(x & UINT64_C(0xFFFFFFFF00000000)) { n += 32; x >>= 32; }
+                    if(x & 0xFFFF0000)                   { n += 16; x >>= 16; }
+                    if(x & 0xFFFFFF00)                   { n +=  8; x >>=  8; }
+                    if(x & 0xFFFFFFF0)                   { n +=  4; x >>=  4; }
+                    if(x & 0xFFFFFFFC)                   { n +=  2; x >>=  2; }
+                    if(x & 0xFFFFFFFE)                   { n +=  1;           }
 
-                return n;
-            }
+                    return n;
+                }
 
-            return 64;
+                return 64;
+            #endif
         }
     #endif
 
@@ -960,20 +1076,7 @@ namespace eastl
     inline BitsetBase<1>::size_type
     BitsetBase<1>::count() const
     {
-        #if defined(__GNUC__) && (((__GNUC__ * 100) + __GNUC_MINOR__) >= 304) && !defined(__SNC__) && !defined(EA_PLATFORM_ANDROID) // GCC 3.4 or later
-            #if(EA_PLATFORM_WORD_SIZE == 4)
-                return (size_type)__builtin_popcountl(mWord[0]);
-            #else
-                return (size_type)__builtin_popcountll(mWord[0]);
-            #endif
-        #elif defined(__GNUC__) && (__GNUC__ < 3)
-            return BitsetCountBits(mWord[0]); // GCC 2.x compiler inexplicably blows up on the code below.
-        #else
-            size_type n = 0;
-            for(word_type w = mWord[0]; w; w >>= 4)
-                n += EASTL_BITSET_COUNT_STRING[w & 0xF];
-            return n;
-        #endif
+        return (size_type)BitsetCountBits(mWord[0]);
     }
 
 
@@ -1162,16 +1265,7 @@ namespace eastl
     inline BitsetBase<2>::size_type
     BitsetBase<2>::count() const
     {
-        #if defined(__GNUC__) && (((__GNUC__ * 100) + __GNUC_MINOR__) >= 304) && !defined(__SNC__) && !defined(EA_PLATFORM_ANDROID) // GCC 3.4 or later
-            #if(EA_PLATFORM_WORD_SIZE == 4)
-                return (size_type)__builtin_popcountl(mWord[0])  + (size_type)__builtin_popcountl(mWord[1]);
-            #else
-                return (size_type)__builtin_popcountll(mWord[0]) + (size_type)__builtin_popcountll(mWord[1]);
-            #endif
-
-        #else
-            return BitsetCountBits(mWord[0]) + BitsetCountBits(mWord[1]);
-        #endif
+        return (size_type)BitsetCountBits(mWord[0]) + (size_type)BitsetCountBits(mWord[1]);
     }
 
 
@@ -0,0 +1,730 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/bitvector.h
+//
+// Implements a runtime-sized bit array.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// bitvector is to bitset what vector is to an array: a sequence of bits
+// whose size is set at runtime and which can grow. The bits are packed into
+// BitsetWordType words (see bitset.h), and the operations work on a word
+// at a time:
+//    - operator&=, |=, ^= and and_not combine two bitvectors of the same
+//      size, using SSE2 or AVX2 when available (see BitsetCombineWords).
+//    - count uses BitsetCountBits, and find_first, find_next, find_last and
+//      find_prev skip over zero words, using GetFirstBit and GetLastBit.
+//    - set_bits_begin and set_bits_end iterate over the indices of the set
+//      bits, which costs a bit scan per set bit plus a test per zero word.
+//
+// The bits past size() in the last word are always zero, so that the word
+// operations don't need to mask anything.
+//
+// Example usage:
+//    eastl::bitvector<> visited(graph.node_count());
+//    visited.set(start);
+//
+//    for(eastl::bitvector<>::set_bit_iterator it = frontier.set_bits_begin(); it != frontier.set_bits_end(); ++it)
+//        Visit(*it);
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_BITVECTOR_H
+#define EASTL_BITVECTOR_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/bitset.h>
+#include <EASTL/vector.h>
+#include <EASTL/algorithm.h>
+
+
+namespace eastl
+{
+
+    /// EASTL_BITVECTOR_DEFAULT_NAME
+    ///
+    /// Defines a default container name in the absence of a user-provided name.
+    ///
+    #ifndef EASTL_BITVECTOR_DEFAULT_NAME
+        #define EASTL_BITVECTOR_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " bitvector" // Unless the user overrides something, this is "EASTL bitvector".
+    #endif
+
+
+    /// EASTL_BITVECTOR_DEFAULT_ALLOCATOR
+    ///
+    #ifndef EASTL_BITVECTOR_DEFAULT_ALLOCATOR
+        #define EASTL_BITVECTOR_DEFAULT_ALLOCATOR allocator_type(EASTL_BITVECTOR_DEFAULT_NAME)
+    #endif
+
+
+
+    /// BitvectorSetBitIterator
+    ///
+    /// A forward iterator over the indices of the set bits of a bitvector,
+    /// in increasing order. It keeps the not yet visited bits of the current
+    /// word, so each increment clears one bit and scans for the next.
+    ///
+    template <typename SizeType>
+    struct BitvectorSetBitIterator
+    {
+        typedef BitvectorSetBitIterator<SizeType>      this_type;
+        typedef BitsetWordType                         word_type;
+        typedef SizeType                               value_type;
+        typedef ptrdiff_t                              difference_type;
+        typedef const SizeType*                        pointer;
+        typedef SizeType                               reference; // Indices are computed, so they are returned by value.
+        typedef EASTL_ITC_NS::forward_iterator_tag     iterator_category;
+
+    public:
+        const word_type* mpWord;     // The word we are in.
+        const word_type* mpWordEnd;
+        word_type        mWord;      // The bits of *mpWord that we haven't visited yet.
+        SizeType         mnBitBase;  // Index of the first bit of *mpWord.
+
+    public:
+        BitvectorSetBitIterator()
+            : mpWord(NULL), mpWordEnd(NULL), mWord(0), mnBitBase(0) { }
+
+        BitvectorSetBitIterator(const word_type* pWord, const word_type* pWordEnd, SizeType nBitBase)
+            : mpWord(pWord), mpWordEnd(pWordEnd), mWord((pWord != pWordEnd) ? *pWord : 0), mnBitBase(nBitBase)
+        {
+            if(!mWord)
+                DoSkipZeroWords();
+        }
+
+        reference operator*() const
+            { return (SizeType)(mnBitBase + GetFirstBit(mWord)); }
+
+        this_type& operator++()
+        {
+            mWord &= (mWord - 1); // Clear the lowest set bit.
+            if(!mWord)
+                DoSkipZeroWords();
+            return *this;
+        }
+
+        this_type operator++(int)
+            { const this_type temp(*this); operator++(); return temp; }
+
+        bool operator==(const this_type& x) const
+            { return (mpWord == x.mpWord) && (mWord == x.mWord); }
+
+        bool operator!=(const this_type& x) const
+            { return (mpWord != x.mpWord) || (mWord != x.mWord); }
+
+    protected:
+        void DoSkipZeroWords()
+        {
+            while((mpWord != mpWordEnd) && (++mpWord != mpWordEnd))
+            {
+                mnBitBase += kBitsPerWord;
+                if((mWord = *mpWord) != 0)
+                    break;
+            }
+        }
+
+    }; // BitvectorSetBitIterator
+
+
+
+
+    /// bitvector
+    ///
+    /// Implements a runtime-sized bit array. See the top of this file for a
+    /// description.
+    ///
+    template <typename Allocator = EASTLAllocatorType>
+    class bitvector
+    {
+    public:
+        typedef bitvector<Allocator>                        this_type;
+        typedef BitsetWordType                              word_type;
+        typedef Allocator                                   allocator_type;
+        typedef eastl::vector<word_type, Allocator>         container_type;
+        typedef bool                                        value_type;
+        typedef eastl_size_t                                size_type;
+        typedef ptrdiff_t                                   difference_type;
+        typedef BitvectorSetBitIterator<size_type>          set_bit_iterator;
+
+    protected:
+        container_type mContainer;
+        size_type      mnSize;     // The number of bits.
+
+    public:
+        bitvector();
+        explicit bitvector(const allocator_type& allocator);
+        explicit bitvector(size_type n, bool value = false, const allocator_type& allocator = EASTL_BITVECTOR_DEFAULT_ALLOCATOR);
+
+        bool      empty() const;
+        size_type size() const;
+        size_type capacity() const;
+
+        void resize(size_type n, bool value = false);
+        void reserve(size_type n);
+        void clear();
+
+        void push_back(bool value);
+        void pop_back();
+
+        bool test(size_type i) const;
+        bool operator[](size_type i) const;
+
+        this_type& set();
+        this_type& set(size_type i, bool value = true);
+        this_type& reset();
+        this_type& reset(size_type i);
+        this_type& flip();
+        this_type& flip(size_type i);
+
+        this_type& operator&=(const this_type& x);
+        this_type& operator|=(const this_type& x);
+        this_type& operator^=(const this_type& x);
+        this_type& and_not(const this_type& x);    // Clears the bits which are set in x: *this &= ~x.
+
+        size_type count() const;
+        bool      any() const;
+        bool      none() const;
+        bool      all() const;
+
+        // These return size() if there is no such bit, as bitset returns its size.
+        size_type find_first() const;
+        size_type find_next(size_type last_find) const;
+        size_type find_last() const;
+        size_type find_prev(size_type last_find) const;
+
+        set_bit_iterator set_bits_begin() const;
+        set_bit_iterator set_bits_end() const;
+
+        word_type*       data();                   // The bits, kBitsPerWord to a word, starting from the least significant bit of the first word.
+        const word_type* data() const;
+        size_type        word_count() const;
+
+        void swap(this_type& x);
+
+        allocator_type& get_allocator();
+        void            set_allocator(const allocator_type& allocator);
+
+        bool validate() const;
+
+    protected:
+        template <typename Op>
+        void DoCombine(const this_type& x, Op op);
+
+        void DoClearUnusedBits();
+
+        static size_type DoWordCount(size_type nBitCount);
+
+    }; // class bitvector
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // bitvector
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename Allocator>
+    inline bitvector<Allocator>::bitvector()
+        : mContainer(EASTL_BITVECTOR_DEFAULT_ALLOCATOR), mnSize(0)
+    {
+    }
+
+
+    template <typename Allocator>
+    inline bitvector<Allocator>::bitvector(const allocator_type& allocator)
+        : mContainer(allocator), mnSize(0)
+    {
+    }
+
+
+    template <typename Allocator>
+    inline bitvector<Allocator>::bitvector(size_type n, bool value, const allocator_type& allocator)
+        : mContainer(DoWordCount(n), value ? ~word_type(0) : word_type(0), allocator), mnSize(n)
+    {
+        DoClearUnusedBits();
+    }
+
+
+    template <typename Allocator>
+    inline bool bitvector<Allocator>::empty() const
+    {
+        return mnSize == 0;
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::size_type
+    bitvector<Allocator>::size() const
+    {
+        return mnSize;
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::size_type
+    bitvector<Allocator>::capacity() const
+    {
+        return (size_type)mContainer.capacity() * kBitsPerWord;
+    }
+
+
+    template <typename Allocator>
+    void bitvector<Allocator>::resize(size_type n, bool value)
+    {
+        if((n > mnSize) && value && (mnSize & kBitsPerWordMask))
+            mContainer.back() |= (~word_type(0) << (mnSize & kBitsPerWordMask)); // Set the new bits of the current last word.
+
+        mContainer.resize(DoWordCount(n), value ? ~word_type(0) : word_type(0));
+        mnSize = n;
+        DoClearUnusedBits();
+    }
+
+
+    template <typename Allocator>
+    inline void bitvector<Allocator>::reserve(size_type n)
+    {
+        mContainer.reserve(DoWordCount(n));
+    }
+
+
+    template <typename Allocator>
+    inline void bitvector<Allocator>::clear()
+    {
+        mContainer.clear();
+        mnSize = 0;
+    }
+
+
+    template <typename Allocator>
+    inline void bitvector<Allocator>::push_back(bool value)
+    {
+        if((mnSize & kBitsPerWordMask) == 0)
+            mContainer.push_back(word_type(0));
+        if(value)
+            mContainer.back() |= (word_type(1) << (mnSize & kBitsPerWordMask));
+        ++mnSize;
+    }
+
+
+    template <typename Allocator>
+    inline void bitvector<Allocator>::pop_back()
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mnSize == 0))
+                EASTL_FAIL_MSG("bitvector::pop_back -- empty bitvector");
+        #endif
+
+        --mnSize;
+        if((mnSize & kBitsPerWordMask) == 0)
+            mContainer.pop_back();
+        else
+            mContainer.back() &= ~(word_type(1) << (mnSize & kBitsPerWordMask));
+    }
+
+
+    template <typename Allocator>
+    inline bool bitvector<Allocator>::test(size_type i) const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(i >= mnSize))
+                EASTL_FAIL_MSG("bitvector::test -- out of range");
+        #endif
+
+        return (mContainer[i >> kBitsPerWordShift] >> (i & kBitsPerWordMask)) & 1;
+    }
+
+
+    template <typename Allocator>
+    inline bool bitvector<Allocator>::operator[](size_type i) const
+    {
+        return test(i);
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::this_type&
+    bitvector<Allocator>::set()
+    {
+        eastl::fill(mContainer.begin(), mContainer.end(), ~word_type(0));
+        DoClearUnusedBits();
+        return *this;
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::this_type&
+    bitvector<Allocator>::set(size_type i, bool value)
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(i >= mnSize))
+                EASTL_FAIL_MSG("bitvector::set -- out of range");
+        #endif
+
+        if(value)
+            mContainer[i >> kBitsPerWordShift] |=  (word_type(1) << (i & kBitsPerWordMask));
+        else
+            mContainer[i >> kBitsPerWordShift] &= ~(word_type(1) << (i & kBitsPerWordMask));
+        return *this;
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::this_type&
+    bitvector<Allocator>::reset()
+    {
+        eastl::fill(mContainer.begin(), mContainer.end(), word_type(0));
+        return *this;
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::this_type&
+    bitvector<Allocator>::reset(size_type i)
+    {
+        return set(i, false);
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::this_type&
+    bitvector<Allocator>::flip()
+    {
+        for(typename container_type::iterator it = mContainer.begin(); it != mContainer.end(); ++it)
+            *it = ~*it;
+        DoClearUnusedBits();
+        return *this;
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::this_type&
+    bitvector<Allocator>::flip(size_type i)
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(i >= mnSize))
+                EASTL_FAIL_MSG("bitvector::flip -- out of range");
+        #endif
+
+        mContainer[i >> kBitsPerWordShift] ^= (word_type(1) << (i & kBitsPerWordMask));
+        return *this;
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::this_type&
+    bitvector<Allocator>::operator&=(const this_type& x)
+    {
+        DoCombine(x, BitsetAndOp());
+        return *this;
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::this_type&
+    bitvector<Allocator>::operator|=(const this_type& x)
+    {
+        DoCombine(x, BitsetOrOp());
+        return *this;
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::this_type&
+    bitvector<Allocator>::operator^=(const this_type& x)
+    {
+        DoCombine(x, BitsetXorOp());
+        return *this;
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::this_type&
+    bitvector<Allocator>::and_not(const this_type& x)
+    {
+        DoCombine(x, BitsetAndNotOp());
+        return *this;
+    }
+
+
+    template <typename Allocator>
+    typename bitvector<Allocator>::size_type
+    bitvector<Allocator>::count() const
+    {
+        size_type n = 0;
+
+        for(typename container_type::const_iterator it = mContainer.begin(); it != mContainer.end(); ++it)
+            n += (size_type)BitsetCountBits(*it);
+        return n;
+    }
+
+
+    template <typename Allocator>
+    inline bool bitvector<Allocator>::any() const
+    {
+        for(typename container_type::const_iterator it = mContainer.begin(); it != mContainer.end(); ++it)
+        {
+            if(*it)
+                return true;
+        }
+        return false;
+    }
+
+
+    template <typename Allocator>
+    inline bool bitvector<Allocator>::none() const
+    {
+        return !any();
+    }
+
+
+    template <typename Allocator>
+    inline bool bitvector<Allocator>::all() const
+    {
+        return count() == mnSize;
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::size_type
+    bitvector<Allocator>::find_first() const
+    {
+        const size_type nWordCount = (size_type)mContainer.size();
+
+        for(size_type word_index = 0; word_index < nWordCount; ++word_index)
+        {
+            if(mContainer[word_index])
+                return (word_index * kBitsPerWord) + GetFirstBit(mContainer[word_index]);
+        }
+
+        return mnSize;
+    }
+
+
+    template <typename Allocator>
+    typename bitvector<Allocator>::size_type
+    bitvector<Allocator>::find_next(size_type last_find) const
+    {
+        if(++last_find < mnSize)
+        {
+            const size_type nWordCount = (size_type)mContainer.size();
+            size_type       word_index = (size_type)(last_find >> kBitsPerWordShift);
+
+            // Mask off the bits before last_find so that the search becomes a "find first".
+            word_type this_word = mContainer[word_index] & (~word_type(0) << (last_find & kBitsPerWordMask));
+
+            for(;;)
+            {
+                if(this_word)
+                    return (word_index * kBitsPerWord) + GetFirstBit(this_word);
+                if(++word_index == nWordCount)
+                    break;
+                this_word = mContainer[word_index];
+            }
+        }
+
+        return mnSize;
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::size_type
+    bitvector<Allocator>::find_last() const
+    {
+        for(size_type word_index = (size_type)mContainer.size(); word_index-- != 0; )
+        {
+            if(mContainer[word_index])
+                return (word_index * kBitsPerWord) + GetLastBit(mContainer[word_index]);
+        }
+
+        return mnSize;
+    }
+
+
+    template <typename Allocator>
+    typename bitvector<Allocator>::size_type
+    bitvector<Allocator>::find_prev(size_type last_find) const
+    {
+        if((last_find != 0) && (last_find <= mnSize))
+        {
+            --last_find;
+
+            size_type word_index = (size_type)(last_find >> kBitsPerWordShift);
+
+            // Mask off the bits after last_find so that the search becomes a "find last".
+            word_type this_word = mContainer[word_index] & (~word_type(0) >> (kBitsPerWordMask - (last_find & kBitsPerWordMask)));
+
+            for(;;)
+            {
+                if(this_word)
+                    return (word_index * kBitsPerWord) + GetLastBit(this_word);
+                if(word_index-- == 0)
+                    break;
+                this_word = mContainer[word_index];
+            }
+        }
+
+        return mnSize;
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::set_bit_iterator
+    bitvector<Allocator>::set_bits_begin() const
+    {
+        return set_bit_iterator(mContainer.data(), mContainer.data() + mContainer.size(), 0);
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::set_bit_iterator
+    bitvector<Allocator>::set_bits_end() const
+    {
+        const word_type* const pWordEnd = mContainer.data() + mContainer.size();
+        return set_bit_iterator(pWordEnd, pWordEnd, (size_type)mContainer.size() * kBitsPerWord);
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::word_type*
+    bitvector<Allocator>::data()
+    {
+        return mContainer.data();
+    }
+
+
+    template <typename Allocator>
+    inline const typename bitvector<Allocator>::word_type*
+    bitvector<Allocator>::data() const
+    {
+        return mContainer.data();
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::size_type
+    bitvector<Allocator>::word_count() const
+    {
+        return (size_type)mContainer.size();
+    }
+
+
+    template <typename Allocator>
+    inline void bitvector<Allocator>::swap(this_type& x)
+    {
+        mContainer.swap(x.mContainer);
+        eastl::swap(mnSize, x.mnSize);
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::allocator_type&
+    bitvector<Allocator>::get_allocator()
+    {
+        return mContainer.get_allocator();
+    }
+
+
+    template <typename Allocator>
+    inline void bitvector<Allocator>::set_allocator(const allocator_type& allocator)
+    {
+        mContainer.set_allocator(allocator);
+    }
+
+
+    template <typename Allocator>
+    inline bool bitvector<Allocator>::validate() const
+    {
+        if(!mContainer.validate())
+            return false;
+        if((size_type)mContainer.size() != DoWordCount(mnSize))
+            return false;
+        if((mnSize & kBitsPerWordMask) && (mContainer.back() & (~word_type(0) << (mnSize & kBitsPerWordMask))))
+            return false; // The unused bits must be zero.
+        return true;
+    }
+
+
+    template <typename Allocator>
+    template <typename Op>
+    inline void bitvector<Allocator>::DoCombine(const this_type& x, Op op)
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mnSize != x.mnSize))
+                EASTL_FAIL_MSG("bitvector -- combining bitvectors of different sizes");
+        #endif
+
+        // None of the operations set bits which are clear in both operands,
+        // so the unused bits stay zero.
+        BitsetCombineWords(mContainer.data(), x.mContainer.data(), mContainer.size(), op);
+    }
+
+
+    template <typename Allocator>
+    inline void bitvector<Allocator>::DoClearUnusedBits()
+    {
+        if(mnSize & kBitsPerWordMask)
+            mContainer.back() &= ~(~word_type(0) << (mnSize & kBitsPerWordMask));
+    }
+
+
+    template <typename Allocator>
+    inline typename bitvector<Allocator>::size_type
+    bitvector<Allocator>::DoWordCount(size_type nBitCount)
+    {
+        return (size_type)((nBitCount + kBitsPerWordMask) >> kBitsPerWordShift);
+    }
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // global operators
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename Allocator>
+    inline bool operator==(const bitvector<Allocator>& a, const bitvector<Allocator>& b)
+    {
+        // The unused bits are always zero, so we can compare whole words.
+        return (a.size() == b.size()) && (a.empty() || (memcmp(a.data(), b.data(), a.word_count() * sizeof(BitsetWordType)) == 0));
+    }
+
+
+    template <typename Allocator>
+    inline bool operator!=(const bitvector<Allocator>& a, const bitvector<Allocator>& b)
+    {
+        return !(a == b);
+    }
+
+
+    template <typename Allocator>
+    inline bitvector<Allocator> operator&(const bitvector<Allocator>& a, const bitvector<Allocator>& b)
+    {
+        return bitvector<Allocator>(a) &= b;
+    }
+
+
+    template <typename Allocator>
+    inline bitvector<Allocator> operator|(const bitvector<Allocator>& a, const bitvector<Allocator>& b)
+    {
+        return bitvector<Allocator>(a) |= b;
+    }
+
+
+    template <typename Allocator>
+    inline bitvector<Allocator> operator^(const bitvector<Allocator>& a, const bitvector<Allocator>& b)
+    {
+        return bitvector<Allocator>(a) ^= b;
+    }
+
+
+    template <typename Allocator>
+    inline void swap(bitvector<Allocator>& a, bitvector<Allocator>& b)
+    {
+        a.swap(b);
+    }
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
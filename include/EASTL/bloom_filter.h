@@ -0,0 +1,529 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/bloom_filter.h
+//
+// Implements a blocked bloom filter.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// A bloom filter answers "might this value have been inserted?" using a few
+// bits per value, with no false negatives and a configurable rate of false
+// positives. It's used in front of a slower lookup, such as an on-disk store,
+// to skip most of the lookups for absent values.
+//
+// This is the blocked variant: the bit array is divided into 512-bit blocks,
+// each one 64-byte cache line, and all the bits for a value are in one block
+// chosen by its hash. So an insert or query touches one cache line instead of
+// k of them. The price is a little more memory for the same false positive
+// rate, because the blocks don't fill evenly; the constructor accounts for
+// that when it sizes the filter.
+//
+// The hash of a value is hash_mix(Hash()(value)), so the filter reuses the
+// eastl::hash specializations, including those for strings. The batch insert
+// and contains functions compute the hashes of a group of values and
+// prefetch their blocks before touching any of them, which hides most of
+// the cache misses when the filter is bigger than the cache.
+//
+// Example usage:
+//    eastl::bloom_filter<eastl::string> filter(nKeyCount, 0.01);
+//    filter.insert(keys.begin(), keys.end());
+//
+//    if(filter.contains(key))  // Else key is certainly not in the store.
+//        LookUpInStore(key);
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_BLOOM_FILTER_H
+#define EASTL_BLOOM_FILTER_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/functional.h>
+#include <EASTL/vector.h>
+#include <math.h>
+#include <string.h>
+
+
+namespace eastl
+{
+
+    /// EASTL_BLOOM_FILTER_DEFAULT_NAME
+    ///
+    /// Defines a default container name in the absence of a user-provided name.
+    ///
+    #ifndef EASTL_BLOOM_FILTER_DEFAULT_NAME
+        #define EASTL_BLOOM_FILTER_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " bloom_filter" // Unless the user overrides something, this is "EASTL bloom_filter".
+    #endif
+
+
+    /// EASTL_BLOOM_FILTER_DEFAULT_ALLOCATOR
+    ///
+    #ifndef EASTL_BLOOM_FILTER_DEFAULT_ALLOCATOR
+        #define EASTL_BLOOM_FILTER_DEFAULT_ALLOCATOR allocator_type(EASTL_BLOOM_FILTER_DEFAULT_NAME)
+    #endif
+
+
+
+    /// bloom_filter
+    ///
+    /// Implements a blocked bloom filter. See the top of this file for a
+    /// description.
+    ///
+    template <typename T, typename Hash = eastl::hash<T>, typename Allocator = EASTLAllocatorType>
+    class bloom_filter
+    {
+    public:
+        typedef bloom_filter<T, Hash, Allocator>            this_type;
+        typedef T                                           value_type;
+        typedef Hash                                        hasher;
+        typedef eastl_size_t                                size_type;
+        typedef Allocator                                   allocator_type;
+
+        enum
+        {
+            kBlockBitCount  = 512,
+            kWordsPerBlock  = kBlockBitCount / 64,
+            kMaxHashCount   = 16,
+            kBatchSize      = 16    // Values hashed and prefetched ahead by the batch functions.
+        };
+
+    public:
+        bloom_filter();
+        explicit bloom_filter(const allocator_type& allocator);
+        bloom_filter(size_type nExpectedCount, double fFalsePositiveRate, const Hash& hashFunction = Hash(),
+                     const allocator_type& allocator = EASTL_BLOOM_FILTER_DEFAULT_ALLOCATOR);
+        bloom_filter(const this_type& x);
+
+        this_type& operator=(const this_type& x);
+
+        void reset(size_type nExpectedCount, double fFalsePositiveRate); // Resizes the filter and clears it.
+        void clear();
+        void swap(this_type& x);
+
+        void insert(const value_type& value);
+        bool contains(const value_type& value) const; // False if value was never inserted; true if it was, or with the false positive rate.
+
+        template <typename InputIterator>
+        void insert(InputIterator first, InputIterator last);
+
+        template <typename InputIterator, typename OutputIterator>
+        OutputIterator contains(InputIterator first, InputIterator last, OutputIterator result) const; // Writes a bool per value.
+
+        this_type& operator|=(const this_type& x); // x must have been made with the same parameters.
+
+        size_type size() const;             // Number of inserts, which counts repeated values again.
+        size_type bit_count() const;
+        size_type hash_count() const;       // Bits set per value.
+        size_type size_in_bytes() const;
+        double    false_positive_rate() const; // Expected rate, after size() distinct values.
+
+        bool validate() const;
+
+    protected:
+        typedef vector<uint64_t, Allocator> word_vector_type;
+
+        word_vector_type mStorage;      // The blocks, plus room to align them to 64 bytes.
+        uint32_t         mnBlockCount;
+        uint32_t         mnHashCount;
+        size_type        mnSize;
+        Hash             mHash;
+
+    protected:
+        uint64_t        DoHash(const value_type& value) const;
+        uint64_t*       DoGetBlock(uint64_t h);
+        const uint64_t* DoGetBlock(uint64_t h) const;
+        void            DoAlignCopiedBlocks(const this_type& x);
+        void            DoInsert(uint64_t h);
+        bool            DoContains(uint64_t h) const;
+
+        static double DoExpectedRate(double fCount, uint32_t nBlockCount, uint32_t nHashCount);
+
+    }; // class bloom_filter
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // bloom_filter
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename T, typename Hash, typename Allocator>
+    inline bloom_filter<T, Hash, Allocator>::bloom_filter()
+        : mStorage(EASTL_BLOOM_FILTER_DEFAULT_ALLOCATOR),
+          mnBlockCount(0),
+          mnHashCount(0),
+          mnSize(0),
+          mHash()
+    {
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline bloom_filter<T, Hash, Allocator>::bloom_filter(const allocator_type& allocator)
+        : mStorage(allocator),
+          mnBlockCount(0),
+          mnHashCount(0),
+          mnSize(0),
+          mHash()
+    {
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline bloom_filter<T, Hash, Allocator>::bloom_filter(size_type nExpectedCount, double fFalsePositiveRate,
+                                                          const Hash& hashFunction, const allocator_type& allocator)
+        : mStorage(allocator),
+          mnBlockCount(0),
+          mnHashCount(0),
+          mnSize(0),
+          mHash(hashFunction)
+    {
+        reset(nExpectedCount, fFalsePositiveRate);
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline bloom_filter<T, Hash, Allocator>::bloom_filter(const this_type& x)
+        : mStorage(x.mStorage),
+          mnBlockCount(x.mnBlockCount),
+          mnHashCount(x.mnHashCount),
+          mnSize(x.mnSize),
+          mHash(x.mHash)
+    {
+        DoAlignCopiedBlocks(x);
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline typename bloom_filter<T, Hash, Allocator>::this_type&
+    bloom_filter<T, Hash, Allocator>::operator=(const this_type& x)
+    {
+        if(&x != this)
+        {
+            mStorage     = x.mStorage;
+            mnBlockCount = x.mnBlockCount;
+            mnHashCount  = x.mnHashCount;
+            mnSize       = x.mnSize;
+            mHash        = x.mHash;
+            DoAlignCopiedBlocks(x);
+        }
+
+        return *this;
+    }
+
+
+    /// DoAlignCopiedBlocks
+    ///
+    /// After mStorage has been copied from x, the blocks are at the same
+    /// index as in x, which is where x's allocation happened to be aligned.
+    /// This moves them to where our own allocation is aligned, which is
+    /// where DoGetBlock looks for them.
+    ///
+    template <typename T, typename Hash, typename Allocator>
+    void bloom_filter<T, Hash, Allocator>::DoAlignCopiedBlocks(const this_type& x)
+    {
+        if(mnBlockCount)
+        {
+            const uint64_t* const pSource = mStorage.data() + (x.DoGetBlock(0) - x.mStorage.data());
+            uint64_t* const       pDest   = DoGetBlock(0);
+
+            if(pDest != pSource)
+                memmove(pDest, pSource, (size_t)mnBlockCount * kWordsPerBlock * sizeof(uint64_t));
+        }
+    }
+
+
+    /// reset
+    ///
+    /// Uses log2(1 / rate) hashes, the optimum for a plain bloom filter, and
+    /// then the fewest blocks for which the expected rate of the blocked
+    /// filter is within the requested one.
+    ///
+    template <typename T, typename Hash, typename Allocator>
+    void bloom_filter<T, Hash, Allocator>::reset(size_type nExpectedCount, double fFalsePositiveRate)
+    {
+        EASTL_ASSERT((fFalsePositiveRate > 0.0) && (fFalsePositiveRate < 1.0));
+
+        const double fBits = -log(fFalsePositiveRate) / log(2.0);
+        const double fCount = (double)eastl::max_alt(nExpectedCount, (size_type)1);
+
+        mnHashCount  = (uint32_t)eastl::min_alt(eastl::max_alt(fBits + 0.5, 1.0), (double)kMaxHashCount);
+        mnBlockCount = (uint32_t)eastl::max_alt(ceil((fCount * fBits * 1.44) / kBlockBitCount), 1.0);
+
+        while(DoExpectedRate(fCount, mnBlockCount, mnHashCount) > fFalsePositiveRate)
+            mnBlockCount += eastl::max_alt(mnBlockCount / 64, (uint32_t)1);
+
+        const size_t nWordCount = ((size_t)mnBlockCount * kWordsPerBlock) + (kWordsPerBlock - 1); // The padding lets the blocks be aligned to 64 bytes.
+        EASTL_ASSERT(nWordCount == (size_type)nWordCount); // The blocks must fit in a vector.
+
+        mStorage.clear();
+        mStorage.resize((size_type)nWordCount, 0);
+        mnSize = 0;
+    }
+
+
+    /// DoExpectedRate
+    ///
+    /// A block that holds i values has each bit set with probability
+    /// q = 1 - (1 - 1/512)^(k * i), so a query for an absent value that maps
+    /// to it succeeds with probability q^k. The number of values per block is
+    /// Poisson distributed, so we average q^k over that distribution.
+    ///
+    template <typename T, typename Hash, typename Allocator>
+    double bloom_filter<T, Hash, Allocator>::DoExpectedRate(double fCount, uint32_t nBlockCount, uint32_t nHashCount)
+    {
+        const double fMean   = fCount / nBlockCount;
+        const double fSpread = 10.0 * sqrt(fMean) + 10.0;
+        const double fLast   = fMean + fSpread;
+        const double fMiss   = log(1.0 - (1.0 / kBlockBitCount)) * nHashCount;
+        double       fRate   = 0.0;
+
+        for(double i = floor(eastl::max_alt(fMean - fSpread, 0.0)); i <= fLast; i += 1.0)
+        {
+            const double fProbability = exp((i * log(fMean)) - fMean - lgamma(i + 1.0));
+            fRate += fProbability * pow(1.0 - exp(fMiss * i), (double)nHashCount);
+        }
+
+        return fRate;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline void bloom_filter<T, Hash, Allocator>::clear()
+    {
+        eastl::fill(mStorage.begin(), mStorage.end(), (uint64_t)0);
+        mnSize = 0;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline void bloom_filter<T, Hash, Allocator>::swap(this_type& x)
+    {
+        mStorage.swap(x.mStorage);
+        eastl::swap(mnBlockCount, x.mnBlockCount);
+        eastl::swap(mnHashCount, x.mnHashCount);
+        eastl::swap(mnSize, x.mnSize);
+        eastl::swap(mHash, x.mHash);
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline uint64_t bloom_filter<T, Hash, Allocator>::DoHash(const value_type& value) const
+    {
+        return hash_mix((uint64_t)mHash(value));
+    }
+
+
+    /// DoGetBlock
+    ///
+    /// The block is chosen by the high 32 bits of the hash, scaled to the
+    /// block count with a multiply instead of a division.
+    ///
+    template <typename T, typename Hash, typename Allocator>
+    inline uint64_t* bloom_filter<T, Hash, Allocator>::DoGetBlock(uint64_t h)
+    {
+        uint64_t* const pBlocks = (uint64_t*)(((uintptr_t)mStorage.data() + 63) & ~(uintptr_t)63);
+        return pBlocks + ((((h >> 32) * mnBlockCount) >> 32) * kWordsPerBlock);
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline const uint64_t* bloom_filter<T, Hash, Allocator>::DoGetBlock(uint64_t h) const
+    {
+        return const_cast<this_type*>(this)->DoGetBlock(h);
+    }
+
+
+    /// BloomFilterBit
+    ///
+    /// Returns the i-th bit within a block for the low 32 bits of a hash:
+    /// the top 9 bits of the product with the i-th of a set of odd
+    /// constants. This is how split block bloom filters pick their bits.
+    /// It's a multiply per bit like double hashing (a + i * b), but the bits
+    /// are close to independent, whereas with double hashing two values that
+    /// share a and b share all their bits, which triples the false positive
+    /// rate at 0.001.
+    ///
+    inline uint32_t BloomFilterBit(uint32_t h, uint32_t i)
+    {
+        static const uint32_t kSalts[16] =
+        {
+            0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du, 0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u,
+            0x9e3779b1u, 0x85ebca77u, 0xc2b2ae3du, 0x27d4eb2fu, 0x165667b1u, 0xd3a2646du, 0xfd7046c5u, 0xb55a4f09u
+        };
+
+        return (h * kSalts[i]) >> 23;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline void bloom_filter<T, Hash, Allocator>::DoInsert(uint64_t h)
+    {
+        EASTL_ASSERT(mnBlockCount != 0); // The filter must be sized by the constructor or reset.
+
+        uint64_t* const pBlock = DoGetBlock(h);
+
+        for(uint32_t i = 0; i < mnHashCount; ++i)
+        {
+            const uint32_t nBit = BloomFilterBit((uint32_t)h, i);
+            pBlock[nBit / 64] |= UINT64_C(1) << (nBit % 64);
+        }
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline bool bloom_filter<T, Hash, Allocator>::DoContains(uint64_t h) const
+    {
+        if(!mnBlockCount)
+            return false;
+
+        const uint64_t* const pBlock = DoGetBlock(h);
+        uint64_t              nMiss  = 0;
+
+        for(uint32_t i = 0; i < mnHashCount; ++i)
+        {
+            const uint32_t nBit = BloomFilterBit((uint32_t)h, i);
+            nMiss |= ~pBlock[nBit / 64] & (UINT64_C(1) << (nBit % 64));
+        }
+
+        return nMiss == 0;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline void bloom_filter<T, Hash, Allocator>::insert(const value_type& value)
+    {
+        DoInsert(DoHash(value));
+        ++mnSize;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline bool bloom_filter<T, Hash, Allocator>::contains(const value_type& value) const
+    {
+        return DoContains(DoHash(value));
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    template <typename InputIterator>
+    void bloom_filter<T, Hash, Allocator>::insert(InputIterator first, InputIterator last)
+    {
+        uint64_t hashes[kBatchSize];
+
+        while(first != last)
+        {
+            size_type n = 0;
+
+            for(; (n < kBatchSize) && (first != last); ++first, ++n)
+            {
+                hashes[n] = DoHash(*first);
+                EASTL_PREFETCH(DoGetBlock(hashes[n]));
+            }
+
+            for(size_type i = 0; i < n; ++i)
+                DoInsert(hashes[i]);
+            mnSize += n;
+        }
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    template <typename InputIterator, typename OutputIterator>
+    OutputIterator bloom_filter<T, Hash, Allocator>::contains(InputIterator first, InputIterator last, OutputIterator result) const
+    {
+        uint64_t hashes[kBatchSize];
+
+        while(first != last)
+        {
+            size_type n = 0;
+
+            for(; (n < kBatchSize) && (first != last); ++first, ++n)
+            {
+                hashes[n] = DoHash(*first);
+                EASTL_PREFETCH(DoGetBlock(hashes[n]));
+            }
+
+            for(size_type i = 0; i < n; ++i, ++result)
+                *result = DoContains(hashes[i]);
+        }
+
+        return result;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    typename bloom_filter<T, Hash, Allocator>::this_type&
+    bloom_filter<T, Hash, Allocator>::operator|=(const this_type& x)
+    {
+        EASTL_ASSERT((mnBlockCount == x.mnBlockCount) && (mnHashCount == x.mnHashCount));
+
+        uint64_t* const       pBlocks  = DoGetBlock(0);
+        const uint64_t* const pBlocksX = x.DoGetBlock(0);
+
+        for(size_t i = 0, iEnd = (size_t)mnBlockCount * kWordsPerBlock; i < iEnd; ++i)
+            pBlocks[i] |= pBlocksX[i];
+        mnSize += x.mnSize;
+        return *this;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline typename bloom_filter<T, Hash, Allocator>::size_type
+    bloom_filter<T, Hash, Allocator>::size() const
+    {
+        return mnSize;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline typename bloom_filter<T, Hash, Allocator>::size_type
+    bloom_filter<T, Hash, Allocator>::bit_count() const
+    {
+        return (size_type)mnBlockCount * kBlockBitCount;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline typename bloom_filter<T, Hash, Allocator>::size_type
+    bloom_filter<T, Hash, Allocator>::hash_count() const
+    {
+        return mnHashCount;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline typename bloom_filter<T, Hash, Allocator>::size_type
+    bloom_filter<T, Hash, Allocator>::size_in_bytes() const
+    {
+        return (size_type)(sizeof(*this) + (mStorage.capacity() * sizeof(uint64_t)));
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline double bloom_filter<T, Hash, Allocator>::false_positive_rate() const
+    {
+        return (mnBlockCount && mnSize) ? DoExpectedRate((double)mnSize, mnBlockCount, mnHashCount) : 0.0;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline bool bloom_filter<T, Hash, Allocator>::validate() const
+    {
+        if(!mnBlockCount)
+            return mStorage.empty() && (mnSize == 0);
+        return (mnHashCount >= 1) && (mnHashCount <= kMaxHashCount) &&
+               (mStorage.size() == (((size_t)mnBlockCount * kWordsPerBlock) + (kWordsPerBlock - 1)));
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline void swap(bloom_filter<T, Hash, Allocator>& a, bloom_filter<T, Hash, Allocator>& b)
+    {
+        a.swap(b);
+    }
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
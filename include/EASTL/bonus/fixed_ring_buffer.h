@@ -0,0 +1,78 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/bonus/fixed_ring_buffer.h
+//
+// Implements a ring_buffer whose storage is part of the object.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_FIXED_RING_BUFFER_H
+#define EASTL_FIXED_RING_BUFFER_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/bonus/ring_buffer.h>
+#include <EASTL/fixed_vector.h>
+
+
+namespace eastl
+{
+
+    /// fixed_ring_buffer
+    ///
+    /// A ring_buffer of nodeCount elements kept in a fixed_vector, so that it
+    /// never touches the heap. It is always in overwrite mode: once full,
+    /// push_back replaces the oldest element. Since the storage can't grow,
+    /// set_overwrite isn't available.
+    ///
+    /// Example usage:
+    ///    eastl::fixed_ring_buffer<FrameStats, 120> history; // The last two seconds at 60 Hz.
+    ///    history.push_back(stats);
+    ///
+    template <typename T, size_t nodeCount>
+    class fixed_ring_buffer : public ring_buffer<T, fixed_vector<T, nodeCount, false> >
+    {
+    public:
+        typedef ring_buffer<T, fixed_vector<T, nodeCount, false> > base_type;
+        typedef fixed_ring_buffer<T, nodeCount>                     this_type;
+        typedef typename base_type::size_type                       size_type;
+
+        enum { kMaxSize = nodeCount };
+
+    public:
+        fixed_ring_buffer();
+
+        size_type max_size() const; // Returns the fixed capacity, which is the user-supplied nodeCount parameter.
+
+    private:
+        using base_type::set_overwrite;
+        using base_type::set_capacity;
+        using base_type::reserve;
+
+    }; // class fixed_ring_buffer
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // fixed_ring_buffer
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename T, size_t nodeCount>
+    inline fixed_ring_buffer<T, nodeCount>::fixed_ring_buffer()
+        : base_type(nodeCount, true)
+    {
+    }
+
+
+    template <typename T, size_t nodeCount>
+    inline typename fixed_ring_buffer<T, nodeCount>::size_type
+    fixed_ring_buffer<T, nodeCount>::max_size() const
+    {
+        return kMaxSize;
+    }
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
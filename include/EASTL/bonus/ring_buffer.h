@@ -0,0 +1,765 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/bonus/ring_buffer.h
+//
+// Implements a circular buffer on top of a random access container.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// ring_buffer keeps its elements in a container whose size is the ring's
+// capacity, and tracks which slot holds the oldest element and how many
+// slots are in use. Thus:
+//    - push_back, push_front, pop_front and pop_back are O(1) and never
+//      allocate unless the ring is full and has to grow.
+//    - In overwrite mode a full ring doesn't grow; instead push_back replaces
+//      the oldest element (and push_front the newest). This is the usual
+//      fixed-size rolling window.
+//    - Every slot of the container holds a constructed element, so T must be
+//      default-constructible and assignable. Popping an element doesn't
+//      destroy it; it is assigned over when its slot is reused.
+//    - The elements occupy at most two contiguous runs of the container.
+//      array_one and array_two return them, so that consumers can memcpy or
+//      vectorize over them instead of going through ring iterators. This
+//      requires a contiguous container such as vector or fixed_vector.
+//    - Iterators are random access and refer to a position relative to the
+//      front, so any push or pop invalidates them.
+//
+// Example usage:
+//    eastl::ring_buffer<float> window(256, true); // The last 256 samples.
+//    window.push_back(sample);
+//
+//    eastl::ring_buffer<float>::span_type a = window.array_one();
+//    eastl::ring_buffer<float>::span_type b = window.array_two();
+//    float sum = Sum(a.first, a.second) + Sum(b.first, b.second);
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_RING_BUFFER_H
+#define EASTL_RING_BUFFER_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/iterator.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/utility.h>
+#include <EASTL/vector.h>
+
+#ifdef _MSC_VER
+    #pragma warning(push, 0)
+    #include <stddef.h>
+    #pragma warning(pop)
+#else
+    #include <stddef.h>
+#endif
+
+
+namespace eastl
+{
+
+    /// RingBufferIterator
+    ///
+    /// Refers to the element at a given distance from the front of a ring.
+    ///
+    template <typename T, typename Pointer, typename Reference, typename RingBuffer>
+    struct RingBufferIterator
+    {
+        typedef RingBufferIterator<T, Pointer, Reference, RingBuffer>   this_type;
+        typedef RingBufferIterator<T, T*, T&, RingBuffer>               iterator;
+        typedef typename RingBuffer::size_type                          size_type;
+        typedef ptrdiff_t                                               difference_type;
+        typedef T                                                       value_type;
+        typedef Pointer                                                 pointer;
+        typedef Reference                                               reference;
+        typedef EASTL_ITC_NS::random_access_iterator_tag                iterator_category;
+
+    public:
+        RingBuffer* mpRingBuffer;
+        size_type   mnIndex;      // Distance from the front of the ring.
+
+    public:
+        RingBufferIterator()
+            : mpRingBuffer(NULL), mnIndex(0) { }
+
+        RingBufferIterator(RingBuffer* pRingBuffer, size_type nIndex)
+            : mpRingBuffer(pRingBuffer), mnIndex(nIndex) { }
+
+        RingBufferIterator(const iterator& x)
+            : mpRingBuffer(x.mpRingBuffer), mnIndex(x.mnIndex) { }
+
+        this_type& operator=(const iterator& x)
+            { mpRingBuffer = x.mpRingBuffer; mnIndex = x.mnIndex; return *this; }
+
+        reference operator*() const
+            { return (*mpRingBuffer)[mnIndex]; }
+
+        pointer operator->() const
+            { return &(*mpRingBuffer)[mnIndex]; }
+
+        this_type& operator++()
+            { ++mnIndex; return *this; }
+
+        this_type operator++(int)
+            { const this_type temp(*this); ++mnIndex; return temp; }
+
+        this_type& operator--()
+            { --mnIndex; return *this; }
+
+        this_type operator--(int)
+            { const this_type temp(*this); --mnIndex; return temp; }
+
+        this_type& operator+=(difference_type n)
+            { mnIndex = (size_type)(mnIndex + n); return *this; }
+
+        this_type& operator-=(difference_type n)
+            { mnIndex = (size_type)(mnIndex - n); return *this; }
+
+        this_type operator+(difference_type n) const
+            { return this_type(mpRingBuffer, (size_type)(mnIndex + n)); }
+
+        this_type operator-(difference_type n) const
+            { return this_type(mpRingBuffer, (size_type)(mnIndex - n)); }
+
+        reference operator[](difference_type n) const
+            { return (*mpRingBuffer)[(size_type)(mnIndex + n)]; }
+
+    }; // RingBufferIterator
+
+
+    // The C++ defect report #179 requires that we support comparisons between const and non-const iterators.
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, typename RingBuffer>
+    inline bool operator==(const RingBufferIterator<T, PointerA, ReferenceA, RingBuffer>& a,
+                           const RingBufferIterator<T, PointerB, ReferenceB, RingBuffer>& b)
+    {
+        return a.mnIndex == b.mnIndex;
+    }
+
+
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, typename RingBuffer>
+    inline bool operator!=(const RingBufferIterator<T, PointerA, ReferenceA, RingBuffer>& a,
+                           const RingBufferIterator<T, PointerB, ReferenceB, RingBuffer>& b)
+    {
+        return a.mnIndex != b.mnIndex;
+    }
+
+
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, typename RingBuffer>
+    inline bool operator<(const RingBufferIterator<T, PointerA, ReferenceA, RingBuffer>& a,
+                          const RingBufferIterator<T, PointerB, ReferenceB, RingBuffer>& b)
+    {
+        return a.mnIndex < b.mnIndex;
+    }
+
+
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, typename RingBuffer>
+    inline bool operator>(const RingBufferIterator<T, PointerA, ReferenceA, RingBuffer>& a,
+                          const RingBufferIterator<T, PointerB, ReferenceB, RingBuffer>& b)
+    {
+        return a.mnIndex > b.mnIndex;
+    }
+
+
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, typename RingBuffer>
+    inline bool operator<=(const RingBufferIterator<T, PointerA, ReferenceA, RingBuffer>& a,
+                           const RingBufferIterator<T, PointerB, ReferenceB, RingBuffer>& b)
+    {
+        return a.mnIndex <= b.mnIndex;
+    }
+
+
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, typename RingBuffer>
+    inline bool operator>=(const RingBufferIterator<T, PointerA, ReferenceA, RingBuffer>& a,
+                           const RingBufferIterator<T, PointerB, ReferenceB, RingBuffer>& b)
+    {
+        return a.mnIndex >= b.mnIndex;
+    }
+
+
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, typename RingBuffer>
+    inline ptrdiff_t operator-(const RingBufferIterator<T, PointerA, ReferenceA, RingBuffer>& a,
+                               const RingBufferIterator<T, PointerB, ReferenceB, RingBuffer>& b)
+    {
+        return (ptrdiff_t)a.mnIndex - (ptrdiff_t)b.mnIndex;
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, typename RingBuffer>
+    inline RingBufferIterator<T, Pointer, Reference, RingBuffer>
+    operator+(ptrdiff_t n, const RingBufferIterator<T, Pointer, Reference, RingBuffer>& x)
+    {
+        return x + n;
+    }
+
+
+
+
+    /// ring_buffer
+    ///
+    /// Implements a circular buffer. See the top of this file for a
+    /// description. Container must be a random access container with
+    /// resize and swap, such as vector, fixed_vector or deque.
+    ///
+    template <typename T, typename Container = eastl::vector<T> >
+    class ring_buffer
+    {
+    public:
+        typedef ring_buffer<T, Container>                                     this_type;
+        typedef Container                                                     container_type;
+        typedef T                                                             value_type;
+        typedef T*                                                            pointer;
+        typedef const T*                                                      const_pointer;
+        typedef T&                                                            reference;
+        typedef const T&                                                      const_reference;
+        typedef typename Container::size_type                                 size_type;
+        typedef ptrdiff_t                                                     difference_type;
+        typedef RingBufferIterator<T, T*, T&, this_type>                      iterator;
+        typedef RingBufferIterator<T, const T*, const T&, this_type>          const_iterator;
+        typedef eastl::reverse_iterator<iterator>                             reverse_iterator;
+        typedef eastl::reverse_iterator<const_iterator>                       const_reverse_iterator;
+        typedef eastl::pair<pointer, size_type>                               span_type;
+        typedef eastl::pair<const_pointer, size_type>                         const_span_type;
+
+    protected:
+        container_type c;
+        size_type      mnBegin;       // Slot of the front element.
+        size_type      mnSize;        // Number of elements in the ring.
+        size_type      mnCapacity;    // Same as c.size(), which some containers compute with a division.
+        bool           mbOverwrite;   // If true, pushing into a full ring overwrites instead of growing.
+
+    public:
+        explicit ring_buffer(size_type capacity = 0, bool bOverwrite = false);
+
+        iterator       begin();
+        const_iterator begin() const;
+
+        iterator       end();
+        const_iterator end() const;
+
+        reverse_iterator       rbegin();
+        const_reverse_iterator rbegin() const;
+
+        reverse_iterator       rend();
+        const_reverse_iterator rend() const;
+
+        bool      empty() const;
+        bool      full() const;
+        size_type size() const;
+        size_type capacity() const;
+
+        void set_capacity(size_type n); // If n is less than size(), the oldest elements are dropped.
+        void reserve(size_type n);      // Grows the capacity to at least n.
+
+        bool overwrites() const;
+        void set_overwrite(bool bOverwrite);
+
+        reference       operator[](size_type n);
+        const_reference operator[](size_type n) const;
+
+        reference       front();
+        const_reference front() const;
+
+        reference       back();
+        const_reference back() const;
+
+        void      push_back(const value_type& value);
+        reference push_back();
+
+        void      push_front(const value_type& value);
+        reference push_front();
+
+        void pop_front();
+        void pop_back();
+
+        void clear();
+
+        span_type       array_one();        // The elements from the front up to the end of the container or the back.
+        const_span_type array_one() const;
+        span_type       array_two();        // The elements which wrapped around to the start of the container; possibly none.
+        const_span_type array_two() const;
+
+        void swap(this_type& x);
+
+        container_type&       get_container();
+        const container_type& get_container() const;
+
+        bool validate() const;
+
+    protected:
+        size_type DoSlot(size_type n) const;
+        void      DoGrow();
+
+    }; // class ring_buffer
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // ring_buffer
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename T, typename Container>
+    inline ring_buffer<T, Container>::ring_buffer(size_type capacity, bool bOverwrite)
+        : c(), mnBegin(0), mnSize(0), mnCapacity(0), mbOverwrite(bOverwrite)
+    {
+        set_capacity(capacity);
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::iterator
+    ring_buffer<T, Container>::begin()
+    {
+        return iterator(this, 0);
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::const_iterator
+    ring_buffer<T, Container>::begin() const
+    {
+        return const_iterator(const_cast<this_type*>(this), 0);
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::iterator
+    ring_buffer<T, Container>::end()
+    {
+        return iterator(this, mnSize);
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::const_iterator
+    ring_buffer<T, Container>::end() const
+    {
+        return const_iterator(const_cast<this_type*>(this), mnSize);
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::reverse_iterator
+    ring_buffer<T, Container>::rbegin()
+    {
+        return reverse_iterator(end());
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::const_reverse_iterator
+    ring_buffer<T, Container>::rbegin() const
+    {
+        return const_reverse_iterator(end());
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::reverse_iterator
+    ring_buffer<T, Container>::rend()
+    {
+        return reverse_iterator(begin());
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::const_reverse_iterator
+    ring_buffer<T, Container>::rend() const
+    {
+        return const_reverse_iterator(begin());
+    }
+
+
+    template <typename T, typename Container>
+    inline bool ring_buffer<T, Container>::empty() const
+    {
+        return mnSize == 0;
+    }
+
+
+    template <typename T, typename Container>
+    inline bool ring_buffer<T, Container>::full() const
+    {
+        return mnSize == mnCapacity;
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::size_type
+    ring_buffer<T, Container>::size() const
+    {
+        return mnSize;
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::size_type
+    ring_buffer<T, Container>::capacity() const
+    {
+        return mnCapacity;
+    }
+
+
+    template <typename T, typename Container>
+    void ring_buffer<T, Container>::set_capacity(size_type n)
+    {
+        if(n != mnCapacity)
+        {
+            while(mnSize > n)
+                pop_front();
+
+            if(mnSize == 0)
+                c.resize(n);
+            else
+            {
+                // Lay the elements out from slot 0 of a new container, so that
+                // they are contiguous until the ring wraps again.
+                container_type temp;
+                temp.resize(n);
+
+                for(size_type i = 0; i < mnSize; ++i)
+                    temp[i] = c[DoSlot(i)];
+
+                c.swap(temp);
+            }
+
+            mnBegin    = 0;
+            mnCapacity = n;
+        }
+    }
+
+
+    template <typename T, typename Container>
+    inline void ring_buffer<T, Container>::reserve(size_type n)
+    {
+        if(n > mnCapacity)
+            set_capacity(n);
+    }
+
+
+    template <typename T, typename Container>
+    inline bool ring_buffer<T, Container>::overwrites() const
+    {
+        return mbOverwrite;
+    }
+
+
+    template <typename T, typename Container>
+    inline void ring_buffer<T, Container>::set_overwrite(bool bOverwrite)
+    {
+        mbOverwrite = bOverwrite;
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::reference
+    ring_buffer<T, Container>::operator[](size_type n)
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(n >= mnSize))
+                EASTL_FAIL_MSG("ring_buffer::operator[] -- out of range");
+        #endif
+
+        return c[DoSlot(n)];
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::const_reference
+    ring_buffer<T, Container>::operator[](size_type n) const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(n >= mnSize))
+                EASTL_FAIL_MSG("ring_buffer::operator[] -- out of range");
+        #endif
+
+        return c[DoSlot(n)];
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::reference
+    ring_buffer<T, Container>::front()
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mnSize == 0))
+                EASTL_FAIL_MSG("ring_buffer::front -- empty ring_buffer");
+        #endif
+
+        return c[mnBegin];
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::const_reference
+    ring_buffer<T, Container>::front() const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mnSize == 0))
+                EASTL_FAIL_MSG("ring_buffer::front -- empty ring_buffer");
+        #endif
+
+        return c[mnBegin];
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::reference
+    ring_buffer<T, Container>::back()
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mnSize == 0))
+                EASTL_FAIL_MSG("ring_buffer::back -- empty ring_buffer");
+        #endif
+
+        return c[DoSlot(mnSize - 1)];
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::const_reference
+    ring_buffer<T, Container>::back() const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mnSize == 0))
+                EASTL_FAIL_MSG("ring_buffer::back -- empty ring_buffer");
+        #endif
+
+        return c[DoSlot(mnSize - 1)];
+    }
+
+
+    template <typename T, typename Container>
+    inline void ring_buffer<T, Container>::push_back(const value_type& value)
+    {
+        if(EASTL_LIKELY(mnSize < mnCapacity))
+            c[DoSlot(mnSize++)] = value;
+        else if(mbOverwrite && mnCapacity)
+        {
+            // The new back takes the slot of the old front.
+            c[mnBegin] = value;
+            mnBegin = DoSlot(1);
+        }
+        else
+        {
+            const value_type temp(value); // value may be one of our elements, which growing moves.
+            DoGrow();
+            c[DoSlot(mnSize++)] = temp;
+        }
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::reference
+    ring_buffer<T, Container>::push_back()
+    {
+        push_back(value_type());
+        return back();
+    }
+
+
+    template <typename T, typename Container>
+    inline void ring_buffer<T, Container>::push_front(const value_type& value)
+    {
+        if(EASTL_LIKELY(mnSize < mnCapacity))
+        {
+            mnBegin = DoSlot(mnCapacity - 1);
+            c[mnBegin] = value;
+            ++mnSize;
+        }
+        else if(mbOverwrite && mnCapacity)
+        {
+            // The new front takes the slot of the old back.
+            mnBegin = DoSlot(mnCapacity - 1);
+            c[mnBegin] = value;
+        }
+        else
+        {
+            const value_type temp(value);
+            DoGrow();
+            mnBegin = DoSlot(mnCapacity - 1);
+            c[mnBegin] = temp;
+            ++mnSize;
+        }
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::reference
+    ring_buffer<T, Container>::push_front()
+    {
+        push_front(value_type());
+        return front();
+    }
+
+
+    template <typename T, typename Container>
+    inline void ring_buffer<T, Container>::pop_front()
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mnSize == 0))
+                EASTL_FAIL_MSG("ring_buffer::pop_front -- empty ring_buffer");
+        #endif
+
+        mnBegin = DoSlot(1);
+        --mnSize;
+    }
+
+
+    template <typename T, typename Container>
+    inline void ring_buffer<T, Container>::pop_back()
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mnSize == 0))
+                EASTL_FAIL_MSG("ring_buffer::pop_back -- empty ring_buffer");
+        #endif
+
+        --mnSize;
+    }
+
+
+    template <typename T, typename Container>
+    inline void ring_buffer<T, Container>::clear()
+    {
+        mnBegin = 0;
+        mnSize  = 0;
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::span_type
+    ring_buffer<T, Container>::array_one()
+    {
+        if(mnSize == 0)
+            return span_type(NULL, 0);
+        return span_type(&c[mnBegin], eastl::min_alt(mnSize, (size_type)(mnCapacity - mnBegin)));
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::const_span_type
+    ring_buffer<T, Container>::array_one() const
+    {
+        if(mnSize == 0)
+            return const_span_type(NULL, 0);
+        return const_span_type(&c[mnBegin], eastl::min_alt(mnSize, (size_type)(mnCapacity - mnBegin)));
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::span_type
+    ring_buffer<T, Container>::array_two()
+    {
+        const size_type nFirst = mnCapacity - mnBegin;
+
+        if(mnSize <= nFirst)
+            return span_type(NULL, 0);
+        return span_type(&c[0], mnSize - nFirst);
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::const_span_type
+    ring_buffer<T, Container>::array_two() const
+    {
+        const size_type nFirst = mnCapacity - mnBegin;
+
+        if(mnSize <= nFirst)
+            return const_span_type(NULL, 0);
+        return const_span_type(&c[0], mnSize - nFirst);
+    }
+
+
+    template <typename T, typename Container>
+    inline void ring_buffer<T, Container>::swap(this_type& x)
+    {
+        c.swap(x.c);
+        eastl::swap(mnBegin,     x.mnBegin);
+        eastl::swap(mnSize,      x.mnSize);
+        eastl::swap(mnCapacity,  x.mnCapacity);
+        eastl::swap(mbOverwrite, x.mbOverwrite);
+    }
+
+
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::container_type&
+    ring_buffer<T, Container>::get_container()
+    {
+        return c;
+    }
+
+
+    template <typename T, typename Container>
+    inline const typename ring_buffer<T, Container>::container_type&
+    ring_buffer<T, Container>::get_container() const
+    {
+        return c;
+    }
+
+
+    template <typename T, typename Container>
+    inline bool ring_buffer<T, Container>::validate() const
+    {
+        if(mnCapacity != (size_type)c.size())
+            return false;
+        if(mnSize > mnCapacity)
+            return false;
+        if((mnBegin >= mnCapacity) && (mnBegin != 0))
+            return false;
+        return true;
+    }
+
+
+    // Returns the container slot of the element n positions from the front,
+    // for n in [0, capacity]. This avoids a division.
+    template <typename T, typename Container>
+    inline typename ring_buffer<T, Container>::size_type
+    ring_buffer<T, Container>::DoSlot(size_type n) const
+    {
+        const size_type i = mnBegin + n;
+        return (i >= mnCapacity) ? (size_type)(i - mnCapacity) : i;
+    }
+
+
+    template <typename T, typename Container>
+    void ring_buffer<T, Container>::DoGrow()
+    {
+        set_capacity((mnCapacity > 4) ? (2 * mnCapacity) : 8);
+    }
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // global operators
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename T, typename Container>
+    inline bool operator==(const ring_buffer<T, Container>& a, const ring_buffer<T, Container>& b)
+    {
+        return (a.size() == b.size()) && eastl::equal(a.begin(), a.end(), b.begin());
+    }
+
+
+    template <typename T, typename Container>
+    inline bool operator!=(const ring_buffer<T, Container>& a, const ring_buffer<T, Container>& b)
+    {
+        return !(a == b);
+    }
+
+
+    template <typename T, typename Container>
+    inline bool operator<(const ring_buffer<T, Container>& a, const ring_buffer<T, Container>& b)
+    {
+        return eastl::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+
+    template <typename T, typename Container>
+    inline void swap(ring_buffer<T, Container>& a, ring_buffer<T, Container>& b)
+    {
+        a.swap(b);
+    }
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -0,0 +1,1004 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/charconv.h
+//
+// Implements to_chars and from_chars, which convert numbers to and from
+// decimal text without a format string, locale or allocation.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// These follow C++17's <charconv>. They write into or read from a char
+// range [first, last), which need not be 0-terminated, and report the
+// end of what they wrote or read along with an error code:
+//    - Integers are written two digits per step from a table of the 100
+//      digit pairs, after counting the digits so they can be written
+//      straight into place.
+//    - Floating point values are written as the shortest decimal which
+//      reads back as the same value, found with Grisu2 (Loitsch, "Printing
+//      Floating-Point Numbers Quickly and Accurately with Integers"). In
+//      rare cases Grisu2 gives a digit more than the shortest; its output
+//      always reads back exactly. Like std::to_chars with no format, the
+//      result is in fixed notation (123.45, 0.001) or scientific notation
+//      (1e+21, 1.5e-07), whichever is shorter. Whole numbers in fixed
+//      notation are the shortest digits followed by zeros, as in 645737700
+//      for the float 645737728.
+//    - from_chars accepts an optional '-' (for signed and floating point
+//      types), digits, and for floating point an optional fraction and
+//      exponent, or inf, infinity or nan in any case. It doesn't skip
+//      whitespace or accept '+'. Floating point text with at most 19
+//      significant digits and a small exponent converts exactly with one
+//      multiplication or division (Clinger's fast path). Other text is
+//      passed to strtod, after being rewritten as digits and an exponent
+//      so that the locale's decimal point doesn't matter.
+//
+// basic_string's append_int, append_uint and append_double, and the
+// eastl::to_string functions in string.h, write with these.
+//
+// Example usage:
+//    char buffer[64];
+//    eastl::to_chars_result r = eastl::to_chars(buffer, buffer + sizeof(buffer), 0.1);  // Writes "0.1".
+//
+//    double value;
+//    eastl::from_chars_result r2 = eastl::from_chars(pField, pFieldEnd, value);
+//    if(r2.ec == eastl::kCharsOK)
+//        pField = r2.ptr;
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_CHARCONV_H
+#define EASTL_CHARCONV_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/type_traits.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+namespace eastl
+{
+
+    /// chars_error
+    ///
+    /// The ec member of to_chars_result and from_chars_result.
+    ///
+    enum chars_error
+    {
+        kCharsOK = 0,
+        kCharsInvalidArgument,      // from_chars found no number at first. ptr is first.
+        kCharsResultOutOfRange,     // from_chars found a number which the type can't hold. ptr is past the number, and the value is unchanged.
+        kCharsValueTooLarge         // to_chars' range is too small. ptr is last, and the range's contents are unspecified.
+    };
+
+    struct to_chars_result
+    {
+        char*       ptr;
+        chars_error ec;
+    };
+
+    struct from_chars_result
+    {
+        const char* ptr;
+        chars_error ec;
+    };
+
+
+    /// kMaxIntegerChars / kMaxDoubleChars / kMaxFloatChars
+    ///
+    /// The most chars to_chars writes for an integer of up to 64 bits, a
+    /// double, and a float, as in "-9223372036854775808", "-2.2250738585072014e-308"
+    /// and "-1.17549435e-38".
+    ///
+    enum
+    {
+        kMaxIntegerChars = 20,
+        kMaxDoubleChars  = 24,
+        kMaxFloatChars   = 15
+    };
+
+
+    namespace Internal
+    {
+        // The chars of 00 to 99.
+        inline const char* DigitPairs()
+        {
+            static const char kDigitPairs[201] =
+                "00010203040506070809" "10111213141516171819" "20212223242526272829" "30313233343536373839" "40414243444546474849"
+                "50515253545556575859" "60616263646566676869" "70717273747576777879" "80818283848586878889" "90919293949596979899";
+            return kDigitPairs;
+        }
+
+
+        inline int CountDigits(uint32_t n)
+        {
+            for(int nDigits = 1; ; nDigits += 4, n /= 10000)
+            {
+                if(n < 10)    return nDigits;
+                if(n < 100)   return nDigits + 1;
+                if(n < 1000)  return nDigits + 2;
+                if(n < 10000) return nDigits + 3;
+            }
+        }
+
+
+        inline int CountDigits(uint64_t n)
+        {
+            int nDigits = 0;
+
+            for(; n >> 32; n /= 10000)
+                nDigits += 4;
+            return nDigits + CountDigits((uint32_t)n);
+        }
+
+
+        // WriteDigits
+        // Writes the digits of n backwards, ending just before pEnd.
+        template <typename CharT>
+        inline void WriteDigits(CharT* pEnd, uint32_t n)
+        {
+            const char* const pPairs = DigitPairs();
+
+            while(n >= 100)
+            {
+                const uint32_t i = (n % 100) * 2;
+                n /= 100;
+                *--pEnd = (CharT)pPairs[i + 1];
+                *--pEnd = (CharT)pPairs[i];
+            }
+
+            if(n >= 10)
+            {
+                *--pEnd = (CharT)pPairs[n * 2 + 1];
+                *--pEnd = (CharT)pPairs[n * 2];
+            }
+            else
+                *--pEnd = (CharT)('0' + n);
+        }
+
+
+        template <typename CharT>
+        inline void WriteDigits(CharT* pEnd, uint64_t n)
+        {
+            const char* const pPairs = DigitPairs();
+
+            while(n >> 32) // Use 64 bit division only while needed.
+            {
+                const uint32_t i = (uint32_t)(n % 100) * 2;
+                n /= 100;
+                *--pEnd = (CharT)pPairs[i + 1];
+                *--pEnd = (CharT)pPairs[i];
+            }
+
+            WriteDigits(pEnd, (uint32_t)n);
+        }
+
+
+        // WriteInteger
+        // Writes n in decimal at p, which must have room for kMaxIntegerChars,
+        // and returns the end of what it wrote.
+        template <typename CharT>
+        inline CharT* WriteInteger(CharT* p, uint64_t n, bool bNegative)
+        {
+            if(bNegative)
+                *p++ = (CharT)'-';
+
+            if(n >> 32)
+            {
+                p += CountDigits(n);
+                WriteDigits(p, n);
+            }
+            else
+            {
+                p += CountDigits((uint32_t)n);
+                WriteDigits(p, (uint32_t)n);
+            }
+
+            return p;
+        }
+
+
+        template <typename CharT, typename T>
+        inline CharT* WriteInteger(CharT* p, T value)
+        {
+            const bool bNegative = eastl::is_signed<T>::value && (value < 0);
+            const uint64_t n     = bNegative ? (0 - (uint64_t)value) : (uint64_t)value;
+
+            return WriteInteger(p, n, bNegative);
+        }
+
+
+
+        ///////////////////////////////////////////////////////////////////////
+        // Grisu2
+        //
+        // A value v is bracketed by the midpoints m- and m+ between it and its
+        // neighboring floating point values; any decimal strictly between them
+        // reads back as v. Grisu2 scales v, m- and m+ by a cached power of ten
+        // so their binary exponent is in [-60, -32], which makes the integer
+        // and fraction parts of the scaled m+ fit 32 and 64 bits, and then
+        // generates digits of m+ until the remainder is within the bracket.
+        // Scaling with 64 bit products loses up to one unit in each of the
+        // bracket's ends, so the bracket is narrowed by one unit to stay
+        // within the true one.
+        ///////////////////////////////////////////////////////////////////////
+
+        struct DiyFp // "Do it yourself floating point": f * 2^e.
+        {
+            uint64_t f;
+            int      e;
+
+            DiyFp() {}
+            DiyFp(uint64_t f_, int e_) : f(f_), e(e_) {}
+        };
+
+
+        // The upper 64 bits of the 128 bit product of the significands, rounded.
+        inline DiyFp DiyFpMultiply(const DiyFp& x, const DiyFp& y)
+        {
+            const uint64_t xLo = x.f & 0xFFFFFFFFu, xHi = x.f >> 32;
+            const uint64_t yLo = y.f & 0xFFFFFFFFu, yHi = y.f >> 32;
+            const uint64_t p0  = xLo * yLo;
+            const uint64_t p1  = xLo * yHi;
+            const uint64_t p2  = xHi * yLo;
+            const uint64_t p3  = xHi * yHi;
+            const uint64_t q   = (p0 >> 32) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu) + (UINT64_C(1) << 31);
+
+            return DiyFp(p3 + (p1 >> 32) + (p2 >> 32) + (q >> 32), x.e + y.e + 64);
+        }
+
+
+        inline DiyFp DiyFpNormalize(DiyFp x)
+        {
+            while(!(x.f >> 63))
+            {
+                x.f <<= 1;
+                x.e--;
+            }
+            return x;
+        }
+
+
+        template <typename FloatT> struct FloatBits;
+
+        template <>
+        struct FloatBits<double>
+        {
+            typedef uint64_t bits_type;
+            enum { kPrecision = 53, kBias = 1023 + 52 }; // kPrecision includes the hidden bit.
+        };
+
+        template <>
+        struct FloatBits<float>
+        {
+            typedef uint32_t bits_type;
+            enum { kPrecision = 24, kBias = 127 + 23 };
+        };
+
+
+        // Sets v to value, which must be finite and positive, and m- and m+ to
+        // the midpoints between it and its neighbors, m+ normalized and m- with
+        // the same exponent.
+        template <typename FloatT>
+        void GrisuBoundaries(FloatT value, DiyFp& v, DiyFp& mMinus, DiyFp& mPlus)
+        {
+            typedef typename FloatBits<FloatT>::bits_type bits_type;
+
+            const int       kPrecision = FloatBits<FloatT>::kPrecision;
+            const int       kBias      = FloatBits<FloatT>::kBias;
+            const uint64_t  kHiddenBit = UINT64_C(1) << (kPrecision - 1);
+
+            bits_type bits;
+            memcpy(&bits, &value, sizeof(bits));
+
+            const uint64_t nExponent    = (uint64_t)(bits >> (kPrecision - 1));
+            const uint64_t nSignificand = (uint64_t)bits & (kHiddenBit - 1);
+
+            if(nExponent == 0) // Denormal
+                v = DiyFp(nSignificand, 1 - kBias);
+            else
+                v = DiyFp(nSignificand + kHiddenBit, (int)nExponent - kBias);
+
+            // The neighbor below is closer if v is a power of two above the smallest normal.
+            const bool bLowerCloser = (nSignificand == 0) && (nExponent > 1);
+
+            mPlus  = DiyFpNormalize(DiyFp((v.f << 1) + 1, v.e - 1));
+            mMinus = bLowerCloser ? DiyFp((v.f << 2) - 1, v.e - 2) : DiyFp((v.f << 1) - 1, v.e - 1);
+            mMinus = DiyFp(mMinus.f << (mMinus.e - mPlus.e), mPlus.e);
+            v      = DiyFpNormalize(v);
+        }
+
+
+        struct GrisuCachedPower
+        {
+            uint64_t f;
+            int      e;
+            int      k;     // The decimal exponent: f * 2^e is about 10^k.
+        };
+
+
+        // Returns a power of ten c for which e + c.e + 64 is in [-60, -32].
+        inline GrisuCachedPower GrisuGetCachedPower(int e)
+        {
+            // 10^-300 to 10^324 in steps of 8, rounded to 64 bit significands.
+            static const GrisuCachedPower kCachedPowers[] =
+            {
+                { UINT64_C(0xAB70FE17C79AC6CA), -1060, -300 },
+                { UINT64_C(0xFF77B1FCBEBCDC4F), -1034, -292 },
+                { UINT64_C(0xBE5691EF416BD60C), -1007, -284 },
+                { UINT64_C(0x8DD01FAD907FFC3C),  -980, -276 },
+                { UINT64_C(0xD3515C2831559A83),  -954, -268 },
+                { UINT64_C(0x9D71AC8FADA6C9B5),  -927, -260 },
+                { UINT64_C(0xEA9C227723EE8BCB),  -901, -252 },
+                { UINT64_C(0xAECC49914078536D),  -874, -244 },
+                { UINT64_C(0x823C12795DB6CE57),  -847, -236 },
+                { UINT64_C(0xC21094364DFB5637),  -821, -228 },
+                { UINT64_C(0x9096EA6F3848984F),  -794, -220 },
+                { UINT64_C(0xD77485CB25823AC7),  -768, -212 },
+                { UINT64_C(0xA086CFCD97BF97F4),  -741, -204 },
+                { UINT64_C(0xEF340A98172AACE5),  -715, -196 },
+                { UINT64_C(0xB23867FB2A35B28E),  -688, -188 },
+                { UINT64_C(0x84C8D4DFD2C63F3B),  -661, -180 },
+                { UINT64_C(0xC5DD44271AD3CDBA),  -635, -172 },
+                { UINT64_C(0x936B9FCEBB25C996),  -608, -164 },
+                { UINT64_C(0xDBAC6C247D62A584),  -582, -156 },
+                { UINT64_C(0xA3AB66580D5FDAF6),  -555, -148 },
+                { UINT64_C(0xF3E2F893DEC3F126),  -529, -140 },
+                { UINT64_C(0xB5B5ADA8AAFF80B8),  -502, -132 },
+                { UINT64_C(0x87625F056C7C4A8B),  -475, -124 },
+                { UINT64_C(0xC9BCFF6034C13053),  -449, -116 },
+                { UINT64_C(0x964E858C91BA2655),  -422, -108 },
+                { UINT64_C(0xDFF9772470297EBD),  -396, -100 },
+                { UINT64_C(0xA6DFBD9FB8E5B88F),  -369,  -92 },
+                { UINT64_C(0xF8A95FCF88747D94),  -343,  -84 },
+                { UINT64_C(0xB94470938FA89BCF),  -316,  -76 },
+                { UINT64_C(0x8A08F0F8BF0F156B),  -289,  -68 },
+                { UINT64_C(0xCDB02555653131B6),  -263,  -60 },
+                { UINT64_C(0x993FE2C6D07B7FAC),  -236,  -52 },
+                { UINT64_C(0xE45C10C42A2B3B06),  -210,  -44 },
+                { UINT64_C(0xAA242499697392D3),  -183,  -36 },
+                { UINT64_C(0xFD87B5F28300CA0E),  -157,  -28 },
+                { UINT64_C(0xBCE5086492111AEB),  -130,  -20 },
+                { UINT64_C(0x8CBCCC096F5088CC),  -103,  -12 },
+                { UINT64_C(0xD1B71758E219652C),   -77,   -4 },
+                { UINT64_C(0x9C40000000000000),   -50,    4 },
+                { UINT64_C(0xE8D4A51000000000),   -24,   12 },
+                { UINT64_C(0xAD78EBC5AC620000),     3,   20 },
+                { UINT64_C(0x813F3978F8940984),    30,   28 },
+                { UINT64_C(0xC097CE7BC90715B3),    56,   36 },
+                { UINT64_C(0x8F7E32CE7BEA5C70),    83,   44 },
+                { UINT64_C(0xD5D238A4ABE98068),   109,   52 },
+                { UINT64_C(0x9F4F2726179A2245),   136,   60 },
+                { UINT64_C(0xED63A231D4C4FB27),   162,   68 },
+                { UINT64_C(0xB0DE65388CC8ADA8),   189,   76 },
+                { UINT64_C(0x83C7088E1AAB65DB),   216,   84 },
+                { UINT64_C(0xC45D1DF942711D9A),   242,   92 },
+                { UINT64_C(0x924D692CA61BE758),   269,  100 },
+                { UINT64_C(0xDA01EE641A708DEA),   295,  108 },
+                { UINT64_C(0xA26DA3999AEF774A),   322,  116 },
+                { UINT64_C(0xF209787BB47D6B85),   348,  124 },
+                { UINT64_C(0xB454E4A179DD1877),   375,  132 },
+                { UINT64_C(0x865B86925B9BC5C2),   402,  140 },
+                { UINT64_C(0xC83553C5C8965D3D),   428,  148 },
+                { UINT64_C(0x952AB45CFA97A0B3),   455,  156 },
+                { UINT64_C(0xDE469FBD99A05FE3),   481,  164 },
+                { UINT64_C(0xA59BC234DB398C25),   508,  172 },
+                { UINT64_C(0xF6C69A72A3989F5C),   534,  180 },
+                { UINT64_C(0xB7DCBF5354E9BECE),   561,  188 },
+                { UINT64_C(0x88FCF317F22241E2),   588,  196 },
+                { UINT64_C(0xCC20CE9BD35C78A5),   614,  204 },
+                { UINT64_C(0x98165AF37B2153DF),   641,  212 },
+                { UINT64_C(0xE2A0B5DC971F303A),   667,  220 },
+                { UINT64_C(0xA8D9D1535CE3B396),   694,  228 },
+                { UINT64_C(0xFB9B7CD9A4A7443C),   720,  236 },
+                { UINT64_C(0xBB764C4CA7A44410),   747,  244 },
+                { UINT64_C(0x8BAB8EEFB6409C1A),   774,  252 },
+                { UINT64_C(0xD01FEF10A657842C),   800,  260 },
+                { UINT64_C(0x9B10A4E5E9913129),   827,  268 },
+                { UINT64_C(0xE7109BFBA19C0C9D),   853,  276 },
+                { UINT64_C(0xAC2820D9623BF429),   880,  284 },
+                { UINT64_C(0x80444B5E7AA7CF85),   907,  292 },
+                { UINT64_C(0xBF21E44003ACDD2D),   933,  300 },
+                { UINT64_C(0x8E679C2F5E44FF8F),   960,  308 },
+                { UINT64_C(0xD433179D9C8CB841),   986,  316 },
+                { UINT64_C(0x9E19DB92B4E31BA9),  1013,  324 }
+            };
+
+            const int f     = -60 - e - 1;
+            const int k     = ((f * 78913) / (1 << 18)) + (f > 0);  // ceil(f * log10(2))
+            const int index = (300 + k + 7) / 8;
+
+            EASTL_ASSERT((index >= 0) && (index < (int)(sizeof(kCachedPowers) / sizeof(kCachedPowers[0]))));
+            return kCachedPowers[index];
+        }
+
+
+        inline int GrisuLargestPow10(uint32_t n, uint32_t& nPow10)
+        {
+            if(n >= 1000000000) { nPow10 = 1000000000; return 10; }
+            if(n >=  100000000) { nPow10 =  100000000; return  9; }
+            if(n >=   10000000) { nPow10 =   10000000; return  8; }
+            if(n >=    1000000) { nPow10 =    1000000; return  7; }
+            if(n >=     100000) { nPow10 =     100000; return  6; }
+            if(n >=      10000) { nPow10 =      10000; return  5; }
+            if(n >=       1000) { nPow10 =       1000; return  4; }
+            if(n >=        100) { nPow10 =        100; return  3; }
+            if(n >=         10) { nPow10 =         10; return  2; }
+            nPow10 = 1;
+            return 1;
+        }
+
+
+        // Moves the last digit down toward v while the result stays in the
+        // bracket and gets closer to v.
+        inline void GrisuRound(char* pDigits, int nLength, uint64_t nDist, uint64_t nDelta, uint64_t nRest, uint64_t nTenK)
+        {
+            while((nRest < nDist) && ((nDelta - nRest) >= nTenK) &&
+                  (((nRest + nTenK) < nDist) || ((nDist - nRest) > (nRest + nTenK - nDist))))
+            {
+                pDigits[nLength - 1]--;
+                nRest += nTenK;
+            }
+        }
+
+
+        // Writes the digits of a decimal between mMinus and mPlus, as close to w
+        // as Grisu2 finds, to pDigits, and sets nLength, and nExponent so that
+        // the value is the digits times 10^nExponent.
+        inline void GrisuDigits(char* pDigits, int& nLength, int& nExponent, DiyFp mMinus, DiyFp w, DiyFp mPlus)
+        {
+            uint64_t    nDelta = mPlus.f - mMinus.f;
+            uint64_t    nDist  = mPlus.f - w.f;
+            const int   nShift = -mPlus.e;
+            const DiyFp one(UINT64_C(1) << nShift, mPlus.e);
+
+            uint32_t p1 = (uint32_t)(mPlus.f >> nShift);    // The integer part.
+            uint64_t p2 = mPlus.f & (one.f - 1);            // The fraction part.
+
+            uint32_t nPow10;
+            int      n = GrisuLargestPow10(p1, nPow10);
+
+            nLength = 0;
+            while(n > 0)
+            {
+                pDigits[nLength++] = (char)('0' + (p1 / nPow10));
+                p1 %= nPow10;
+                n--;
+
+                const uint64_t nRest = ((uint64_t)p1 << nShift) + p2;
+                if(nRest <= nDelta)
+                {
+                    nExponent += n;
+                    GrisuRound(pDigits, nLength, nDist, nDelta, nRest, (uint64_t)nPow10 << nShift);
+                    return;
+                }
+
+                nPow10 /= 10;
+            }
+
+            for(int m = 1; ; ++m)
+            {
+                p2 *= 10;
+                pDigits[nLength++] = (char)('0' + (p2 >> nShift));
+                p2 &= one.f - 1;
+                nDelta *= 10;
+                nDist  *= 10;
+
+                if(p2 <= nDelta)
+                {
+                    nExponent -= m;
+                    GrisuRound(pDigits, nLength, nDist, nDelta, p2, one.f);
+                    return;
+                }
+            }
+        }
+
+
+        template <typename FloatT>
+        void Grisu2(FloatT value, char* pDigits, int& nLength, int& nExponent)
+        {
+            DiyFp v, mMinus, mPlus;
+            GrisuBoundaries(value, v, mMinus, mPlus);
+
+            const GrisuCachedPower cached = GrisuGetCachedPower(mPlus.e);
+            const DiyFp            c(cached.f, cached.e);
+            const DiyFp            w       = DiyFpMultiply(v, c);
+            const DiyFp            wMinus  = DiyFpMultiply(mMinus, c);
+            const DiyFp            wPlus   = DiyFpMultiply(mPlus, c);
+
+            nExponent = -cached.k;
+            GrisuDigits(pDigits, nLength, nExponent, DiyFp(wMinus.f + 1, wMinus.e), w, DiyFp(wPlus.f - 1, wPlus.e));
+        }
+
+
+        // WriteFloat
+        // Writes value at p, which must have room for kMaxDoubleChars (or
+        // kMaxFloatChars for a float), and returns the end of what it wrote.
+        template <typename CharT, typename FloatT>
+        CharT* WriteFloat(CharT* p, FloatT value)
+        {
+            typedef typename FloatBits<FloatT>::bits_type bits_type;
+
+            bits_type bits;
+            memcpy(&bits, &value, sizeof(bits));
+
+            const int       kSignShift    = (int)(sizeof(bits_type) * 8) - 1;
+            const bits_type nExponentMask = (bits_type)(((bits_type)1 << kSignShift) - ((bits_type)1 << (FloatBits<FloatT>::kPrecision - 1)));
+
+            if((bits & nExponentMask) == nExponentMask) // If inf or nan...
+            {
+                const char* pText = (bits & (((bits_type)1 << (FloatBits<FloatT>::kPrecision - 1)) - 1)) ? "nan" : "inf";
+
+                if(bits >> kSignShift)
+                    *p++ = (CharT)'-';
+                for(; *pText; ++pText)
+                    *p++ = (CharT)*pText;
+                return p;
+            }
+
+            if(bits >> kSignShift)
+            {
+                *p++ = (CharT)'-';
+                value = -value;
+            }
+
+            if(value == 0)
+            {
+                *p++ = (CharT)'0';
+                return p;
+            }
+
+            char digits[18];
+            int  k, e;
+            Grisu2(value, digits, k, e);
+
+            // The value is 0.digits * 10^n. Use fixed notation unless scientific is shorter.
+            const int n          = k + e;
+            const int nFixed     = (n >= k) ? n : ((n > 0) ? (k + 1) : (2 - n + k));
+            const int nExp       = (n - 1 < 0) ? (1 - n) : (n - 1);
+            const int nScientific = ((k == 1) ? 1 : (k + 1)) + 2 + ((nExp >= 100) ? 3 : 2);
+
+            if(nFixed <= nScientific)
+            {
+                if(n >= k) // digits000
+                {
+                    for(int i = 0; i < k; ++i)
+                        *p++ = (CharT)digits[i];
+                    for(int i = k; i < n; ++i)
+                        *p++ = (CharT)'0';
+                }
+                else if(n > 0) // dig.its
+                {
+                    for(int i = 0; i < n; ++i)
+                        *p++ = (CharT)digits[i];
+                    *p++ = (CharT)'.';
+                    for(int i = n; i < k; ++i)
+                        *p++ = (CharT)digits[i];
+                }
+                else // 0.000digits
+                {
+                    *p++ = (CharT)'0';
+                    *p++ = (CharT)'.';
+                    for(int i = n; i < 0; ++i)
+                        *p++ = (CharT)'0';
+                    for(int i = 0; i < k; ++i)
+                        *p++ = (CharT)digits[i];
+                }
+            }
+            else // d.igitse+XX
+            {
+                *p++ = (CharT)digits[0];
+                if(k > 1)
+                {
+                    *p++ = (CharT)'.';
+                    for(int i = 1; i < k; ++i)
+                        *p++ = (CharT)digits[i];
+                }
+
+                *p++ = (CharT)'e';
+                *p++ = (CharT)((n - 1 < 0) ? '-' : '+');
+                if(nExp >= 100)
+                    *p++ = (CharT)('0' + (nExp / 100));
+                *p++ = (CharT)DigitPairs()[(nExp % 100) * 2];
+                *p++ = (CharT)DigitPairs()[(nExp % 100) * 2 + 1];
+            }
+
+            return p;
+        }
+
+
+        template <typename FloatT>
+        to_chars_result ToCharsFloat(char* first, char* last, FloatT value)
+        {
+            const int       kMaxChars = (sizeof(FloatT) == sizeof(float)) ? kMaxFloatChars : kMaxDoubleChars;
+            to_chars_result result;
+
+            if((last - first) >= kMaxChars)
+            {
+                result.ptr = WriteFloat(first, value);
+                result.ec  = kCharsOK;
+            }
+            else
+            {
+                char        buffer[kMaxDoubleChars];
+                const char* pEnd = WriteFloat(buffer, value);
+
+                if((pEnd - buffer) <= (last - first))
+                {
+                    memcpy(first, buffer, (size_t)(pEnd - buffer));
+                    result.ptr = first + (pEnd - buffer);
+                    result.ec  = kCharsOK;
+                }
+                else
+                {
+                    result.ptr = last;
+                    result.ec  = kCharsValueTooLarge;
+                }
+            }
+
+            return result;
+        }
+
+
+
+        ///////////////////////////////////////////////////////////////////////
+        // Parsing
+        ///////////////////////////////////////////////////////////////////////
+
+        inline bool IsDigit(char c)
+        {
+            return (unsigned)(c - '0') < 10;
+        }
+
+
+        // Returns the end of the text at p which matches pWord case insensitively, or NULL.
+        inline const char* MatchWord(const char* p, const char* last, const char* pWord)
+        {
+            for(; *pWord; ++p, ++pWord)
+            {
+                if((p == last) || ((*p | 0x20) != *pWord))
+                    return NULL;
+            }
+            return p;
+        }
+
+
+        template <typename T>
+        from_chars_result FromCharsInteger(const char* first, const char* last, T& value)
+        {
+            const bool        bSigned   = eastl::is_signed<T>::value;
+            const char*       p         = first;
+            bool              bNegative = false;
+            from_chars_result result;
+
+            if(bSigned && (p != last) && (*p == '-'))
+            {
+                bNegative = true;
+                ++p;
+            }
+
+            const char* const pDigits = p;
+            while((p != last) && (*p == '0'))
+                ++p;
+
+            // Up to 19 digits can't overflow 64 bits.
+            uint64_t n = 0;
+            for(const char* pEnd = (last - p) > 19 ? (p + 19) : last; (p != pEnd) && IsDigit(*p); ++p)
+                n = (n * 10) + (uint64_t)(*p - '0');
+
+            bool bOverflow = false;
+            if((p != last) && IsDigit(*p))
+            {
+                const uint64_t d = (uint64_t)(*p++ - '0');
+
+                bOverflow = (n > ((~(uint64_t)0 - d) / 10));
+                n = (n * 10) + d;
+
+                for(; (p != last) && IsDigit(*p); ++p)
+                    bOverflow = true;
+            }
+
+            if(p == pDigits) // No digits, not even zeros.
+            {
+                result.ptr = first;
+                result.ec  = kCharsInvalidArgument;
+                return result;
+            }
+
+            const int      nBits    = (int)(sizeof(T) * 8) - (bSigned ? 1 : 0);
+            const uint64_t nMaxBits = (nBits >= 64) ? ~(uint64_t)0 : ((UINT64_C(1) << nBits) - 1);
+            const uint64_t nMax     = nMaxBits + (bNegative ? 1 : 0); // -2^(nBits) fits a signed type.
+
+            result.ptr = p;
+            if(bOverflow || (n > nMax))
+                result.ec = kCharsResultOutOfRange;
+            else
+            {
+                value     = bNegative ? (T)(0 - n) : (T)n;
+                result.ec = kCharsOK;
+            }
+
+            return result;
+        }
+
+
+        template <typename FloatT>
+        inline FloatT Pow10Exact(int n); // 10^n for n up to the largest power of ten FloatT holds exactly.
+
+        template <>
+        inline double Pow10Exact<double>(int n)
+        {
+            static const double kPowers[23] =
+            {
+                1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+            };
+            return kPowers[n];
+        }
+
+        template <>
+        inline float Pow10Exact<float>(int n)
+        {
+            static const float kPowers[11] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+            return kPowers[n];
+        }
+
+
+        template <typename FloatT>
+        from_chars_result FromCharsFloat(const char* first, const char* last, FloatT& value)
+        {
+            // The most significant digits strtod needs to round correctly; a digit
+            // beyond them only matters in whether it is zero.
+            const int kMaxDigits = 768;
+
+            const char*       p         = first;
+            bool              bNegative = false;
+            from_chars_result result;
+
+            if((p != last) && (*p == '-'))
+            {
+                bNegative = true;
+                ++p;
+            }
+
+            if((p != last) && !IsDigit(*p) && (*p != '.'))
+            {
+                const char* pEnd;
+                FloatT      special = 0;
+
+                if((pEnd = MatchWord(p, last, "infinity")) != NULL || (pEnd = MatchWord(p, last, "inf")) != NULL)
+                    special = (FloatT)HUGE_VAL;
+                else if((pEnd = MatchWord(p, last, "nan")) != NULL)
+                {
+                    typedef typename FloatBits<FloatT>::bits_type bits_type;
+                    const bits_type nQuietNaN = (bits_type)((~(bits_type)0 >> 1) & ~(((bits_type)1 << (FloatBits<FloatT>::kPrecision - 2)) - 1));
+                    memcpy(&special, &nQuietNaN, sizeof(special)); // Positive, which 0 / 0 and the like aren't on all platforms.
+                }
+
+                if(pEnd)
+                {
+                    value      = bNegative ? -special : special;
+                    result.ptr = pEnd;
+                    result.ec  = kCharsOK;
+                }
+                else
+                {
+                    result.ptr = first;
+                    result.ec  = kCharsInvalidArgument;
+                }
+                return result;
+            }
+
+            // The significant digits go both to n, up to 19 of them, and to digits,
+            // up to kMaxDigits, for strtod. nExponent is the power of ten by which
+            // each must be multiplied.
+            char     digits[kMaxDigits + 1 + 1 + 12]; // Plus a sticky digit, 'e' and the exponent.
+            int      nDigits     = 0;
+            uint64_t n           = 0;
+            int      nExponent   = 0;   // For n.
+            int      nExponentD  = 0;   // For digits.
+            bool     bAnyDigits  = false;
+            bool     bTruncatedN = false;
+            bool     bSticky     = false;
+
+            for(int nPart = 0; nPart < 2; ++nPart) // The integer part, then the fraction.
+            {
+                for(; (p != last) && IsDigit(*p); ++p)
+                {
+                    const int d = *p - '0';
+                    bAnyDigits = true;
+
+                    if((nDigits == 0) && (d == 0))  // A leading zero
+                    {
+                        nExponent  -= nPart;
+                        nExponentD -= nPart;
+                        continue;
+                    }
+
+                    if(nDigits < 19)
+                    {
+                        n = (n * 10) + (uint64_t)d;
+                        nExponent -= nPart;
+                    }
+                    else
+                    {
+                        nExponent += 1 - nPart;
+                        bTruncatedN |= (d != 0);
+                    }
+
+                    if(nDigits < kMaxDigits)
+                    {
+                        digits[nDigits] = (char)('0' + d);
+                        nExponentD -= nPart;
+                    }
+                    else
+                    {
+                        nExponentD += 1 - nPart;
+                        bSticky |= (d != 0);
+                    }
+
+                    ++nDigits;
+                }
+
+                if((nPart == 0) && (p != last) && (*p == '.'))
+                    ++p;
+                else
+                    break;
+            }
+
+            if(!bAnyDigits)
+            {
+                result.ptr = first;
+                result.ec  = kCharsInvalidArgument;
+                return result;
+            }
+
+            if((p != last) && ((*p | 0x20) == 'e')) // The exponent is only part of the number if it has digits.
+            {
+                const char* pExp         = p + 1;
+                bool        bExpNegative = false;
+
+                if((pExp != last) && ((*pExp == '-') || (*pExp == '+')))
+                    bExpNegative = (*pExp++ == '-');
+
+                if((pExp != last) && IsDigit(*pExp))
+                {
+                    int e = 0;
+                    for(; (pExp != last) && IsDigit(*pExp); ++pExp)
+                    {
+                        if(e < 100000) // Beyond this the result is inf or 0 anyway.
+                            e = (e * 10) + (*pExp - '0');
+                    }
+
+                    nExponent  += bExpNegative ? -e : e;
+                    nExponentD += bExpNegative ? -e : e;
+                    p = pExp;
+                }
+            }
+
+            result.ptr = p;
+            result.ec  = kCharsOK;
+
+            const int      kMaxExact     = (sizeof(FloatT) == sizeof(float)) ? 10 : 22;
+            const uint64_t kMaxExactBits = UINT64_C(1) << FloatBits<FloatT>::kPrecision;
+            FloatT         x;
+
+            if(n == 0)
+                x = 0;
+            else if(!bTruncatedN && (nDigits <= 19) && (n <= kMaxExactBits) && (nExponent >= -kMaxExact) && (nExponent <= kMaxExact))
+            {
+                // n and the power of ten are exact, so one correctly rounded operation gives the result.
+                x = (FloatT)n;
+                x = (nExponent < 0) ? (x / Pow10Exact<FloatT>(-nExponent)) : (x * Pow10Exact<FloatT>(nExponent));
+            }
+            else
+            {
+                int nLength = (nDigits < kMaxDigits) ? nDigits : kMaxDigits;
+
+                if(bSticky)
+                {
+                    digits[nLength++] = '1';
+                    nExponentD--;
+                }
+
+                digits[nLength++] = 'e';
+                WriteInteger(digits + nLength, (uint64_t)(nExponentD < 0 ? -nExponentD : nExponentD), nExponentD < 0)[0] = 0;
+
+                if(sizeof(FloatT) == sizeof(float))
+                    x = (FloatT)strtof(digits, NULL);
+                else
+                    x = (FloatT)strtod(digits, NULL);
+
+                if((x == 0) || (x == (FloatT)HUGE_VAL)) // Nonzero digits underflowed or overflowed.
+                {
+                    result.ec = kCharsResultOutOfRange;
+                    return result;
+                }
+            }
+
+            value = bNegative ? -x : x;
+            return result;
+        }
+
+    } // namespace Internal
+
+
+
+    /// to_chars
+    ///
+    /// Writes value in decimal to [first, last).
+    ///
+    template <typename T>
+    inline typename eastl::enable_if<eastl::is_integral<T>::value, to_chars_result>::type
+    to_chars(char* first, char* last, T value)
+    {
+        to_chars_result result;
+
+        if((last - first) >= kMaxIntegerChars)
+        {
+            result.ptr = Internal::WriteInteger(first, value);
+            result.ec  = kCharsOK;
+        }
+        else
+        {
+            char        buffer[kMaxIntegerChars];
+            const char* pEnd = Internal::WriteInteger(buffer, value);
+
+            if((pEnd - buffer) <= (last - first))
+            {
+                memcpy(first, buffer, (size_t)(pEnd - buffer));
+                result.ptr = first + (pEnd - buffer);
+                result.ec  = kCharsOK;
+            }
+            else
+            {
+                result.ptr = last;
+                result.ec  = kCharsValueTooLarge;
+            }
+        }
+
+        return result;
+    }
+
+
+    /// to_chars
+    ///
+    /// Writes the shortest decimal which reads back as value to [first, last).
+    ///
+    inline to_chars_result to_chars(char* first, char* last, double value)
+    {
+        return Internal::ToCharsFloat(first, last, value);
+    }
+
+    inline to_chars_result to_chars(char* first, char* last, float value)
+    {
+        return Internal::ToCharsFloat(first, last, value);
+    }
+
+
+    /// from_chars
+    ///
+    /// Reads a number from the start of [first, last) into value.
+    ///
+    template <typename T>
+    inline typename eastl::enable_if<eastl::is_integral<T>::value, from_chars_result>::type
+    from_chars(const char* first, const char* last, T& value)
+    {
+        return Internal::FromCharsInteger(first, last, value);
+    }
+
+    inline from_chars_result from_chars(const char* first, const char* last, double& value)
+    {
+        return Internal::FromCharsFloat(first, last, value);
+    }
+
+    inline from_chars_result from_chars(const char* first, const char* last, float& value)
+    {
+        return Internal::FromCharsFloat(first, last, value);
+    }
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -85,6 +85,9 @@ namespace EA
             void* allocate(size_t n, size_t alignment, size_t offset, int flags = 0);
             void  deallocate(void* p, size_t n);
 
+            eastl::allocation_result allocate_at_least(size_t n, int flags = 0);
+            eastl::allocation_result allocate_at_least(size_t n, size_t alignment, size_t offset, int flags = 0);
+
             AllocatorType* get_allocator() const;
             void           set_allocator(AllocatorType* pAllocator);
 
@@ -109,6 +112,9 @@ namespace EA
         template<class AllocatorType>
         bool operator!=(const CoreAllocatorAdapter<AllocatorType>& a, const CoreAllocatorAdapter<AllocatorType>& b);
 
+        template<class AllocatorType>
+        eastl::allocation_result allocate_memory_at_least(CoreAllocatorAdapter<AllocatorType>& a, size_t n, size_t alignment, size_t alignmentOffset);
+
 
 
         /// EASTLICoreAllocator
@@ -219,6 +225,26 @@ namespace EA
             return mpCoreAllocator->Free(p, n);
         }
 
+        template<class AllocatorType>
+        inline eastl::allocation_result CoreAllocatorAdapter<AllocatorType>::allocate_at_least(size_t n, int flags)
+        {
+            // ICoreAllocator doesn't report block sizes, so we can only promise what was asked for.
+            // The user can specialize this for a core allocator type that knows better.
+            eastl::allocation_result result;
+            result.ptr   = allocate(n, flags);
+            result.count = result.ptr ? n : 0;
+            return result;
+        }
+
+        template<class AllocatorType>
+        inline eastl::allocation_result CoreAllocatorAdapter<AllocatorType>::allocate_at_least(size_t n, size_t alignment, size_t offset, int flags)
+        {
+            eastl::allocation_result result;
+            result.ptr   = allocate(n, alignment, offset, flags);
+            result.count = result.ptr ? n : 0;
+            return result;
+        }
+
         template<class AllocatorType>
         inline AllocatorType* CoreAllocatorAdapter<AllocatorType>::get_allocator() const
         {
@@ -279,6 +305,12 @@ namespace EA
                    (a.mnFlags         != b.mnFlags);
         }
 
+        template<class AllocatorType>
+        inline eastl::allocation_result allocate_memory_at_least(CoreAllocatorAdapter<AllocatorType>& a, size_t n, size_t alignment, size_t alignmentOffset)
+        {
+            return eastl::Internal::allocate_at_least_member(a, n, alignment, alignmentOffset);
+        }
+
 
     } // namespace Allocator
 
@@ -0,0 +1,690 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/cuckoo_filter.h
+//
+// Implements a cuckoo filter.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// A cuckoo filter answers the same question as a bloom filter, "might this
+// value have been inserted?", but it also supports removing values. It
+// stores a small fingerprint of each value in one of two buckets of four
+// slots. The second bucket is computed from the first bucket and the
+// fingerprint alone, so an existing fingerprint can be moved ("kicked") to
+// its other bucket to make room, as in cuckoo hashing, without knowing the
+// value it came from.
+//
+// A query reads two buckets, and a bucket fits in a single 64-bit word, so
+// it's compared against the fingerprint with a few word operations. For false
+// positive rates below about 3% a cuckoo filter uses less memory than a bloom
+// filter, and a query touches at most two cache lines however low the rate.
+//
+// Fingerprints are between 4 and 16 bits, chosen from the requested false
+// positive rate, so the lowest rate available is about 0.0001. The bucket
+// count is sized so that the expected count fills 90% of the slots. It
+// needn't be a power of two, because the alternate bucket is computed as
+// (g - i) modulo the bucket count rather than with an xor.
+//
+// Limitations:
+//    - insert can fail when the filter is nearly full. It then leaves the
+//      filter unchanged apart from the last value kicked, which it keeps in
+//      a one-entry stash, and later inserts fail until a remove frees room.
+//    - remove must only be given values that were inserted. Removing a value
+//      that wasn't inserted can remove another value with the same
+//      fingerprint, which then causes a false negative.
+//    - A value inserted more than 8 times can't be inserted again, because
+//      its two buckets are full of its own fingerprint.
+//
+// Example usage:
+//    eastl::cuckoo_filter<uint64_t> filter(nSessionCount, 0.001);
+//
+//    filter.insert(nSessionId);
+//    if(filter.contains(nSessionId))
+//        ...
+//    filter.remove(nSessionId);
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_CUCKOO_FILTER_H
+#define EASTL_CUCKOO_FILTER_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/functional.h>
+#include <EASTL/vector.h>
+#include <math.h>
+#include <string.h>
+
+
+namespace eastl
+{
+
+    /// EASTL_CUCKOO_FILTER_DEFAULT_NAME
+    ///
+    /// Defines a default container name in the absence of a user-provided name.
+    ///
+    #ifndef EASTL_CUCKOO_FILTER_DEFAULT_NAME
+        #define EASTL_CUCKOO_FILTER_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " cuckoo_filter" // Unless the user overrides something, this is "EASTL cuckoo_filter".
+    #endif
+
+
+    /// EASTL_CUCKOO_FILTER_DEFAULT_ALLOCATOR
+    ///
+    #ifndef EASTL_CUCKOO_FILTER_DEFAULT_ALLOCATOR
+        #define EASTL_CUCKOO_FILTER_DEFAULT_ALLOCATOR allocator_type(EASTL_CUCKOO_FILTER_DEFAULT_NAME)
+    #endif
+
+
+
+    /// cuckoo_filter
+    ///
+    /// Implements a cuckoo filter with four fingerprints per bucket. See the
+    /// top of this file for a description.
+    ///
+    template <typename T, typename Hash = eastl::hash<T>, typename Allocator = EASTLAllocatorType>
+    class cuckoo_filter
+    {
+    public:
+        typedef cuckoo_filter<T, Hash, Allocator>           this_type;
+        typedef T                                           value_type;
+        typedef Hash                                        hasher;
+        typedef eastl_size_t                                size_type;
+        typedef Allocator                                   allocator_type;
+
+        enum
+        {
+            kSlotCount              = 4,    // Fingerprints per bucket.
+            kMinFingerprintBitCount = 4,
+            kMaxFingerprintBitCount = 16,
+            kMaxKickCount           = 500,
+            kBatchSize              = 16    // Values hashed and prefetched ahead by the batch functions.
+        };
+
+    public:
+        cuckoo_filter();
+        explicit cuckoo_filter(const allocator_type& allocator);
+        cuckoo_filter(size_type nExpectedCount, double fFalsePositiveRate, const Hash& hashFunction = Hash(),
+                      const allocator_type& allocator = EASTL_CUCKOO_FILTER_DEFAULT_ALLOCATOR);
+
+        void reset(size_type nExpectedCount, double fFalsePositiveRate); // Resizes the filter and clears it.
+        void clear();
+        void swap(this_type& x);
+
+        bool insert(const value_type& value);   // Returns false if the filter is too full.
+        bool contains(const value_type& value) const;
+        bool remove(const value_type& value);   // Returns false if value's fingerprint wasn't found.
+
+        template <typename InputIterator>
+        size_type insert(InputIterator first, InputIterator last); // Returns the number inserted; stops at the first failure.
+
+        template <typename InputIterator, typename OutputIterator>
+        OutputIterator contains(InputIterator first, InputIterator last, OutputIterator result) const; // Writes a bool per value.
+
+        size_type size() const;
+        size_type capacity() const;             // Slot count. Inserts start to fail at about 95% of it.
+        size_type bucket_count() const;
+        size_type fingerprint_bit_count() const;
+        size_type size_in_bytes() const;
+        double    load_factor() const;
+        double    false_positive_rate() const;  // Expected rate at the current size.
+
+        bool validate() const;
+
+    protected:
+        typedef vector<uint8_t, Allocator> byte_vector_type;
+
+        byte_vector_type mBuckets;      // kSlotCount fingerprints of mnFingerprintBitCount bits per bucket, packed, plus 8 bytes of padding.
+        uint32_t         mnBucketCount;
+        uint32_t         mnFingerprintBitCount;
+        uint32_t         mnBucketByteCount;
+        size_type        mnSize;
+        uint32_t         mnVictimFingerprint; // 0 if the stash is empty.
+        uint32_t         mnVictimIndex;
+        uint32_t         mnRandom;      // State of the generator that picks the slots to kick.
+        Hash             mHash;
+
+    protected:
+        void     DoGetLocation(const value_type& value, uint32_t& nFingerprint, uint32_t& nIndex) const;
+        uint32_t DoGetAltIndex(uint32_t nIndex, uint32_t nFingerprint) const;
+        uint64_t DoReadBucket(uint32_t nIndex) const;
+        void     DoWriteBucket(uint32_t nIndex, uint64_t bucket);
+        uint64_t DoLaneLowBits() const;
+        bool     DoBucketHas(uint64_t bucket, uint32_t nFingerprint) const;
+        bool     DoInsertIntoBucket(uint32_t nIndex, uint32_t nFingerprint);
+        bool     DoRemoveFromBucket(uint32_t nIndex, uint32_t nFingerprint);
+        bool     DoInsert(uint32_t nIndex, uint32_t nFingerprint);
+        bool     DoContains(uint32_t nIndex, uint32_t nFingerprint) const;
+
+    }; // class cuckoo_filter
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // cuckoo_filter
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename T, typename Hash, typename Allocator>
+    inline cuckoo_filter<T, Hash, Allocator>::cuckoo_filter()
+        : mBuckets(EASTL_CUCKOO_FILTER_DEFAULT_ALLOCATOR),
+          mnBucketCount(0),
+          mnFingerprintBitCount(0),
+          mnBucketByteCount(0),
+          mnSize(0),
+          mnVictimFingerprint(0),
+          mnVictimIndex(0),
+          mnRandom(1),
+          mHash()
+    {
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline cuckoo_filter<T, Hash, Allocator>::cuckoo_filter(const allocator_type& allocator)
+        : mBuckets(allocator),
+          mnBucketCount(0),
+          mnFingerprintBitCount(0),
+          mnBucketByteCount(0),
+          mnSize(0),
+          mnVictimFingerprint(0),
+          mnVictimIndex(0),
+          mnRandom(1),
+          mHash()
+    {
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline cuckoo_filter<T, Hash, Allocator>::cuckoo_filter(size_type nExpectedCount, double fFalsePositiveRate,
+                                                            const Hash& hashFunction, const allocator_type& allocator)
+        : mBuckets(allocator),
+          mnBucketCount(0),
+          mnFingerprintBitCount(0),
+          mnBucketByteCount(0),
+          mnSize(0),
+          mnVictimFingerprint(0),
+          mnVictimIndex(0),
+          mnRandom(1),
+          mHash(hashFunction)
+    {
+        reset(nExpectedCount, fFalsePositiveRate);
+    }
+
+
+    /// reset
+    ///
+    /// A query compares against up to 8 fingerprints, so f bit fingerprints
+    /// give a rate of about 8 / 2^f. f is rounded up to an even count so that
+    /// a bucket is a whole number of bytes.
+    ///
+    template <typename T, typename Hash, typename Allocator>
+    void cuckoo_filter<T, Hash, Allocator>::reset(size_type nExpectedCount, double fFalsePositiveRate)
+    {
+        EASTL_ASSERT((fFalsePositiveRate > 0.0) && (fFalsePositiveRate < 1.0));
+
+        uint32_t nBitCount = (uint32_t)ceil(log(2.0 * kSlotCount / fFalsePositiveRate) / log(2.0));
+        nBitCount = eastl::min_alt(eastl::max_alt((nBitCount + 1) & ~1u, (uint32_t)kMinFingerprintBitCount), (uint32_t)kMaxFingerprintBitCount);
+
+        mnFingerprintBitCount = nBitCount;
+        mnBucketByteCount     = (kSlotCount * nBitCount) / 8;
+        mnBucketCount         = (uint32_t)eastl::max_alt(ceil((double)nExpectedCount / (kSlotCount * 0.9)), 1.0);
+
+        const size_t nByteCount = ((size_t)mnBucketCount * mnBucketByteCount) + 8; // The padding lets the last bucket be read as a whole word.
+        EASTL_ASSERT(nByteCount == (size_type)nByteCount); // The buckets must fit in a vector.
+
+        mBuckets.clear();
+        mBuckets.resize((size_type)nByteCount, 0);
+        mnSize              = 0;
+        mnVictimFingerprint = 0;
+        mnVictimIndex       = 0;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline void cuckoo_filter<T, Hash, Allocator>::clear()
+    {
+        eastl::fill(mBuckets.begin(), mBuckets.end(), (uint8_t)0);
+        mnSize              = 0;
+        mnVictimFingerprint = 0;
+        mnVictimIndex       = 0;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline void cuckoo_filter<T, Hash, Allocator>::swap(this_type& x)
+    {
+        mBuckets.swap(x.mBuckets);
+        eastl::swap(mnBucketCount, x.mnBucketCount);
+        eastl::swap(mnFingerprintBitCount, x.mnFingerprintBitCount);
+        eastl::swap(mnBucketByteCount, x.mnBucketByteCount);
+        eastl::swap(mnSize, x.mnSize);
+        eastl::swap(mnVictimFingerprint, x.mnVictimFingerprint);
+        eastl::swap(mnVictimIndex, x.mnVictimIndex);
+        eastl::swap(mnRandom, x.mnRandom);
+        eastl::swap(mHash, x.mHash);
+    }
+
+
+    /// DoGetLocation
+    ///
+    /// The first bucket comes from the low 32 bits of the hash, scaled to
+    /// the bucket count with a multiply instead of a division, and the
+    /// fingerprint from the high bits. Fingerprint 0 marks an empty slot, so
+    /// it's mapped to 1.
+    ///
+    template <typename T, typename Hash, typename Allocator>
+    inline void cuckoo_filter<T, Hash, Allocator>::DoGetLocation(const value_type& value, uint32_t& nFingerprint, uint32_t& nIndex) const
+    {
+        const uint64_t h = hash_mix((uint64_t)mHash(value));
+
+        nIndex       = (uint32_t)(((h & 0xffffffffu) * mnBucketCount) >> 32);
+        nFingerprint = (uint32_t)(h >> (64 - mnFingerprintBitCount));
+        if(nFingerprint == 0)
+            nFingerprint = 1;
+    }
+
+
+    /// DoGetAltIndex
+    ///
+    /// Returns (g - nIndex) modulo the bucket count, where g is a hash of
+    /// the fingerprint in [0, bucket count), so that applying this twice
+    /// gives back the original bucket.
+    ///
+    template <typename T, typename Hash, typename Allocator>
+    inline uint32_t cuckoo_filter<T, Hash, Allocator>::DoGetAltIndex(uint32_t nIndex, uint32_t nFingerprint) const
+    {
+        const uint32_t g = (uint32_t)(((uint64_t)(nFingerprint * 0x5bd1e995u) * mnBucketCount) >> 32);
+        return (g >= nIndex) ? (g - nIndex) : (g + mnBucketCount - nIndex);
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline uint64_t cuckoo_filter<T, Hash, Allocator>::DoReadBucket(uint32_t nIndex) const
+    {
+        const uint8_t* const p = mBuckets.data() + ((size_t)nIndex * mnBucketByteCount);
+        uint64_t bucket;
+
+        #if defined(EA_SYSTEM_LITTLE_ENDIAN)
+            memcpy(&bucket, p, sizeof(bucket));
+            if(mnBucketByteCount < 8)
+                bucket &= (UINT64_C(1) << (mnBucketByteCount * 8)) - 1;
+        #else
+            bucket = 0;
+            for(uint32_t i = 0; i < mnBucketByteCount; ++i)
+                bucket |= (uint64_t)p[i] << (i * 8);
+        #endif
+
+        return bucket;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline void cuckoo_filter<T, Hash, Allocator>::DoWriteBucket(uint32_t nIndex, uint64_t bucket)
+    {
+        uint8_t* const p = mBuckets.data() + ((size_t)nIndex * mnBucketByteCount);
+
+        for(uint32_t i = 0; i < mnBucketByteCount; ++i)
+            p[i] = (uint8_t)(bucket >> (i * 8));
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline uint64_t cuckoo_filter<T, Hash, Allocator>::DoLaneLowBits() const
+    {
+        const uint32_t f = mnFingerprintBitCount;
+        return 1 | (UINT64_C(1) << f) | (UINT64_C(1) << (2 * f)) | (UINT64_C(1) << (3 * f));
+    }
+
+
+    /// DoBucketHas
+    ///
+    /// After the xor a slot holding nFingerprint is zero, and the usual
+    /// has-zero-lane test finds it: subtracting 1 from each lane borrows out
+    /// of the top bit only for a lane that was zero (or, harmlessly, for a
+    /// lane above one that was).
+    ///
+    template <typename T, typename Hash, typename Allocator>
+    inline bool cuckoo_filter<T, Hash, Allocator>::DoBucketHas(uint64_t bucket, uint32_t nFingerprint) const
+    {
+        const uint64_t low  = DoLaneLowBits();
+        const uint64_t high = low << (mnFingerprintBitCount - 1);
+        const uint64_t x    = bucket ^ (low * nFingerprint);
+
+        return ((x - low) & ~x & high) != 0;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    bool cuckoo_filter<T, Hash, Allocator>::DoInsertIntoBucket(uint32_t nIndex, uint32_t nFingerprint)
+    {
+        const uint32_t f      = mnFingerprintBitCount;
+        const uint64_t nMask  = (UINT64_C(1) << f) - 1;
+        const uint64_t bucket = DoReadBucket(nIndex);
+
+        for(uint32_t i = 0; i < kSlotCount; ++i)
+        {
+            if(((bucket >> (i * f)) & nMask) == 0)
+            {
+                DoWriteBucket(nIndex, bucket | ((uint64_t)nFingerprint << (i * f)));
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    bool cuckoo_filter<T, Hash, Allocator>::DoRemoveFromBucket(uint32_t nIndex, uint32_t nFingerprint)
+    {
+        const uint32_t f      = mnFingerprintBitCount;
+        const uint64_t nMask  = (UINT64_C(1) << f) - 1;
+        const uint64_t bucket = DoReadBucket(nIndex);
+
+        for(uint32_t i = 0; i < kSlotCount; ++i)
+        {
+            if(((bucket >> (i * f)) & nMask) == nFingerprint)
+            {
+                DoWriteBucket(nIndex, bucket & ~(nMask << (i * f)));
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+
+    /// DoInsert
+    ///
+    /// Tries both buckets, then kicks a random fingerprint out of one of them
+    /// to its alternate bucket, and so on. If that doesn't end in an empty
+    /// slot, the fingerprint left over goes into the stash. The filter never
+    /// loses a fingerprint; it just refuses inserts while the stash is full.
+    ///
+    template <typename T, typename Hash, typename Allocator>
+    bool cuckoo_filter<T, Hash, Allocator>::DoInsert(uint32_t nIndex, uint32_t nFingerprint)
+    {
+        EASTL_ASSERT(mnFingerprintBitCount != 0); // The filter must be sized by the constructor or reset.
+
+        if(mnVictimFingerprint)
+            return false;
+
+        const uint32_t nAltIndex = DoGetAltIndex(nIndex, nFingerprint);
+
+        if(DoInsertIntoBucket(nIndex, nFingerprint) || DoInsertIntoBucket(nAltIndex, nFingerprint))
+        {
+            ++mnSize;
+            return true;
+        }
+
+        const uint32_t f     = mnFingerprintBitCount;
+        const uint64_t nMask = (UINT64_C(1) << f) - 1;
+
+        mnRandom = (mnRandom * 1664525u) + 1013904223u;
+        if(mnRandom & 0x80000000u)
+            nIndex = nAltIndex;
+
+        for(int n = 0; n < kMaxKickCount; ++n)
+        {
+            mnRandom = (mnRandom * 1664525u) + 1013904223u;
+
+            const uint32_t nShift = (mnRandom >> 30) * f;
+            const uint64_t bucket = DoReadBucket(nIndex);
+            const uint32_t nKicked = (uint32_t)((bucket >> nShift) & nMask);
+
+            DoWriteBucket(nIndex, (bucket & ~(nMask << nShift)) | ((uint64_t)nFingerprint << nShift));
+            nFingerprint = nKicked;
+            nIndex       = DoGetAltIndex(nIndex, nFingerprint);
+
+            if(DoInsertIntoBucket(nIndex, nFingerprint))
+            {
+                ++mnSize;
+                return true;
+            }
+        }
+
+        mnVictimFingerprint = nFingerprint;
+        mnVictimIndex       = nIndex;
+        ++mnSize;
+        return true;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline bool cuckoo_filter<T, Hash, Allocator>::DoContains(uint32_t nIndex, uint32_t nFingerprint) const
+    {
+        if(!mnFingerprintBitCount)
+            return false;
+
+        const uint32_t nAltIndex = DoGetAltIndex(nIndex, nFingerprint);
+
+        if(mnVictimFingerprint && (mnVictimFingerprint == nFingerprint) &&
+           ((mnVictimIndex == nIndex) || (mnVictimIndex == nAltIndex)))
+            return true;
+
+        return DoBucketHas(DoReadBucket(nIndex), nFingerprint) || DoBucketHas(DoReadBucket(nAltIndex), nFingerprint);
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline bool cuckoo_filter<T, Hash, Allocator>::insert(const value_type& value)
+    {
+        uint32_t nFingerprint, nIndex;
+
+        DoGetLocation(value, nFingerprint, nIndex);
+        return DoInsert(nIndex, nFingerprint);
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline bool cuckoo_filter<T, Hash, Allocator>::contains(const value_type& value) const
+    {
+        uint32_t nFingerprint, nIndex;
+
+        DoGetLocation(value, nFingerprint, nIndex);
+        return DoContains(nIndex, nFingerprint);
+    }
+
+
+    /// remove
+    ///
+    /// Removing frees a slot, so a stashed fingerprint is moved back into
+    /// the buckets, which lets inserts succeed again.
+    ///
+    template <typename T, typename Hash, typename Allocator>
+    bool cuckoo_filter<T, Hash, Allocator>::remove(const value_type& value)
+    {
+        if(!mnFingerprintBitCount)
+            return false;
+
+        uint32_t nFingerprint, nIndex;
+
+        DoGetLocation(value, nFingerprint, nIndex);
+
+        const uint32_t nAltIndex = DoGetAltIndex(nIndex, nFingerprint);
+
+        if(DoRemoveFromBucket(nIndex, nFingerprint) || DoRemoveFromBucket(nAltIndex, nFingerprint))
+        {
+            --mnSize;
+
+            if(mnVictimFingerprint)
+            {
+                const uint32_t nVictimFingerprint = mnVictimFingerprint;
+
+                mnVictimFingerprint = 0;
+                --mnSize;
+                DoInsert(mnVictimIndex, nVictimFingerprint);
+            }
+
+            return true;
+        }
+
+        if(mnVictimFingerprint && (mnVictimFingerprint == nFingerprint) &&
+           ((mnVictimIndex == nIndex) || (mnVictimIndex == nAltIndex)))
+        {
+            mnVictimFingerprint = 0;
+            --mnSize;
+            return true;
+        }
+
+        return false;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    template <typename InputIterator>
+    typename cuckoo_filter<T, Hash, Allocator>::size_type
+    cuckoo_filter<T, Hash, Allocator>::insert(InputIterator first, InputIterator last)
+    {
+        uint32_t  fingerprints[kBatchSize];
+        uint32_t  indexes[kBatchSize];
+        size_type nInserted = 0;
+
+        while(first != last)
+        {
+            size_type n = 0;
+
+            for(; (n < kBatchSize) && (first != last); ++first, ++n)
+            {
+                DoGetLocation(*first, fingerprints[n], indexes[n]);
+                EASTL_PREFETCH(mBuckets.data() + ((size_t)indexes[n] * mnBucketByteCount));
+                EASTL_PREFETCH(mBuckets.data() + ((size_t)DoGetAltIndex(indexes[n], fingerprints[n]) * mnBucketByteCount));
+            }
+
+            for(size_type i = 0; i < n; ++i)
+            {
+                if(!DoInsert(indexes[i], fingerprints[i]))
+                    return nInserted;
+                ++nInserted;
+            }
+        }
+
+        return nInserted;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    template <typename InputIterator, typename OutputIterator>
+    OutputIterator cuckoo_filter<T, Hash, Allocator>::contains(InputIterator first, InputIterator last, OutputIterator result) const
+    {
+        uint32_t fingerprints[kBatchSize];
+        uint32_t indexes[kBatchSize];
+
+        while(first != last)
+        {
+            size_type n = 0;
+
+            for(; (n < kBatchSize) && (first != last); ++first, ++n)
+            {
+                DoGetLocation(*first, fingerprints[n], indexes[n]);
+                EASTL_PREFETCH(mBuckets.data() + ((size_t)indexes[n] * mnBucketByteCount)); // Prefetching the second bucket too measured slower.
+            }
+
+            for(size_type i = 0; i < n; ++i, ++result)
+                *result = DoContains(indexes[i], fingerprints[i]);
+        }
+
+        return result;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline typename cuckoo_filter<T, Hash, Allocator>::size_type
+    cuckoo_filter<T, Hash, Allocator>::size() const
+    {
+        return mnSize;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline typename cuckoo_filter<T, Hash, Allocator>::size_type
+    cuckoo_filter<T, Hash, Allocator>::capacity() const
+    {
+        return mnFingerprintBitCount ? (bucket_count() * kSlotCount) : 0;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline typename cuckoo_filter<T, Hash, Allocator>::size_type
+    cuckoo_filter<T, Hash, Allocator>::bucket_count() const
+    {
+        return mnBucketCount;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline typename cuckoo_filter<T, Hash, Allocator>::size_type
+    cuckoo_filter<T, Hash, Allocator>::fingerprint_bit_count() const
+    {
+        return mnFingerprintBitCount;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline typename cuckoo_filter<T, Hash, Allocator>::size_type
+    cuckoo_filter<T, Hash, Allocator>::size_in_bytes() const
+    {
+        return (size_type)(sizeof(*this) + mBuckets.capacity());
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline double cuckoo_filter<T, Hash, Allocator>::load_factor() const
+    {
+        return mnFingerprintBitCount ? ((double)mnSize / capacity()) : 0.0;
+    }
+
+
+    /// false_positive_rate
+    ///
+    /// A query compares against the 8 slots of its two buckets, each of
+    /// which is occupied with probability load_factor() and then matches
+    /// with probability 1 / (2^f - 1).
+    ///
+    template <typename T, typename Hash, typename Allocator>
+    inline double cuckoo_filter<T, Hash, Allocator>::false_positive_rate() const
+    {
+        if(!mnFingerprintBitCount)
+            return 0.0;
+
+        const double fMatch = 1.0 / (double)((UINT64_C(1) << mnFingerprintBitCount) - 1);
+        return 1.0 - pow(1.0 - (fMatch * load_factor()), 2.0 * kSlotCount);
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    bool cuckoo_filter<T, Hash, Allocator>::validate() const
+    {
+        if(!mnFingerprintBitCount)
+            return mBuckets.empty() && (mnSize == 0);
+
+        if((mnFingerprintBitCount & 1) || (mnFingerprintBitCount < kMinFingerprintBitCount) ||
+           (mnFingerprintBitCount > kMaxFingerprintBitCount) || (mBuckets.size() != ((size_t)bucket_count() * mnBucketByteCount) + 8))
+            return false;
+
+        const uint32_t f     = mnFingerprintBitCount;
+        const uint64_t nMask = (UINT64_C(1) << f) - 1;
+        size_type      nCount = mnVictimFingerprint ? 1 : 0;
+
+        for(uint32_t b = 0; b < mnBucketCount; ++b)
+        {
+            const uint64_t bucket = DoReadBucket(b);
+
+            for(uint32_t i = 0; i < kSlotCount; ++i)
+                nCount += ((bucket >> (i * f)) & nMask) ? 1 : 0;
+        }
+
+        return nCount == mnSize;
+    }
+
+
+    template <typename T, typename Hash, typename Allocator>
+    inline void swap(cuckoo_filter<T, Hash, Allocator>& a, cuckoo_filter<T, Hash, Allocator>& b)
+    {
+        a.swap(b);
+    }
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
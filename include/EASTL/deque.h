@@ -0,0 +1,1919 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/deque.h
+//
+// Implements a double-ended queue built from fixed-size subarrays.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// deque is much like the C++ std::deque class. It stores its elements in
+// subarrays of kDequeSubarraySize elements each, which are tracked by a
+// pointer array kept centered in its allocation. Thus:
+//    - push_front, push_back, pop_front and pop_back are O(1) and never move
+//      existing elements. A subarray is allocated or freed once every
+//      kDequeSubarraySize pushes or pops at an end, rather than once per
+//      element as with list.
+//    - Random access is O(1): an iterator knows its subarray.
+//    - Insertion and erasure in the middle move the elements on whichever
+//      side of the position is shorter.
+//    - Pointers and references to elements stay valid across push and pop at
+//      either end (except to the popped elements). Iterators are invalidated
+//      by any insertion.
+//
+// The primary distinctions between this deque and std::deque are:
+//    - deque supports debug memory naming natively.
+//    - deque::size_type is defined as eastl_size_t instead of size_t.
+//    - The subarray size is a template parameter rather than an
+//      implementation detail.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_DEQUE_H
+#define EASTL_DEQUE_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/allocator.h>
+#include <EASTL/type_traits.h>
+#include <EASTL/iterator.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/memory.h>
+
+#ifdef _MSC_VER
+    #pragma warning(push, 0)
+    #include <new>
+    #include <stddef.h>
+    #include <string.h>
+    #pragma warning(pop)
+#else
+    #include <new>
+    #include <stddef.h>
+    #include <string.h>
+#endif
+
+#if EASTL_EXCEPTIONS_ENABLED
+    #ifdef _MSC_VER
+        #pragma warning(push, 0)
+    #endif
+    #include <stdexcept> // std::out_of_range
+    #ifdef _MSC_VER
+        #pragma warning(pop)
+    #endif
+#endif
+
+#ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
+    #include <utility> // std::move
+#endif
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable: 4530)  // C++ exception handler used, but unwind semantics are not enabled. Specify /EHsc
+    #pragma warning(disable: 4345)  // Behavior change: an object of POD type constructed with an initializer of the form () will be default-initialized
+    #pragma warning(disable: 4127)  // Conditional expression is constant
+#endif
+
+
+namespace eastl
+{
+
+    /// EASTL_DEQUE_DEFAULT_NAME
+    ///
+    /// Defines a default container name in the absence of a user-provided name.
+    ///
+    #ifndef EASTL_DEQUE_DEFAULT_NAME
+        #define EASTL_DEQUE_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " deque" // Unless the user overrides something, this is "EASTL deque".
+    #endif
+
+
+    /// EASTL_DEQUE_DEFAULT_ALLOCATOR
+    ///
+    #ifndef EASTL_DEQUE_DEFAULT_ALLOCATOR
+        #define EASTL_DEQUE_DEFAULT_ALLOCATOR allocator_type(EASTL_DEQUE_DEFAULT_NAME)
+    #endif
+
+
+    /// EASTL_DEQUE_DEFAULT_SUBARRAY_SIZE
+    ///
+    /// Defines the default number of elements per subarray, which is chosen
+    /// so that small types get subarrays of a few hundred bytes.
+    ///
+    #ifndef EASTL_DEQUE_DEFAULT_SUBARRAY_SIZE
+        #define EASTL_DEQUE_DEFAULT_SUBARRAY_SIZE(T) ((sizeof(T) <= 4) ? 64 : ((sizeof(T) <= 8) ? 32 : ((sizeof(T) <= 16) ? 16 : ((sizeof(T) <= 32) ? 8 : 4))))
+    #endif
+
+
+
+    /// DequeIterator
+    ///
+    /// An iterator refers to an element and to the pointer array entry of the
+    /// subarray which holds it, and caches the bounds of that subarray.
+    /// mpCurrent is always in [mpBegin, mpEnd); the container makes sure that
+    /// there is an allocated subarray for its end iterator to refer to.
+    ///
+    template <typename T, typename Pointer, typename Reference, unsigned kDequeSubarraySize>
+    struct DequeIterator
+    {
+        typedef DequeIterator<T, Pointer, Reference, kDequeSubarraySize>  this_type;
+        typedef DequeIterator<T, T*, T&, kDequeSubarraySize>              iterator;
+        typedef DequeIterator<T, const T*, const T&, kDequeSubarraySize>  const_iterator;
+        typedef ptrdiff_t                                                 difference_type;
+        typedef T                                                         value_type;
+        typedef Pointer                                                   pointer;
+        typedef Reference                                                 reference;
+        typedef EASTL_ITC_NS::random_access_iterator_tag                  iterator_category;
+
+    public:
+        T*  mpCurrent;          // The element we refer to.
+        T*  mpBegin;            // The beginning of the subarray holding mpCurrent.
+        T*  mpEnd;              // The end of the subarray holding mpCurrent.
+        T** mpCurrentArrayPtr;  // The pointer array entry for that subarray.
+
+    public:
+        DequeIterator();
+        DequeIterator(T** pCurrentArrayPtr, T* pCurrent);
+        DequeIterator(const iterator& x);
+
+        this_type& operator=(const iterator& x);
+
+        reference operator*() const;
+        pointer   operator->() const;
+
+        this_type& operator++();
+        this_type  operator++(int);
+
+        this_type& operator--();
+        this_type  operator--(int);
+
+        this_type& operator+=(difference_type n);
+        this_type& operator-=(difference_type n);
+
+        this_type operator+(difference_type n) const;
+        this_type operator-(difference_type n) const;
+
+        reference operator[](difference_type n) const;
+
+        void SetSubarray(T** pCurrentArrayPtr);
+
+    }; // DequeIterator
+
+
+
+
+    /// DequeBase
+    ///
+    /// See VectorBase (class vector) for an explanation of why we
+    /// create this separate base class.
+    ///
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    struct DequeBase
+    {
+        typedef T                                                        value_type;
+        typedef Allocator                                                allocator_type;
+        typedef eastl_size_t                                             size_type;     // See config.h for the definition of eastl_size_t, which defaults to uint32_t.
+        typedef ptrdiff_t                                                difference_type;
+        typedef DequeIterator<T, T*, T&, kDequeSubarraySize>             iterator;
+        typedef DequeIterator<T, const T*, const T&, kDequeSubarraySize> const_iterator;
+
+        static const size_type npos     = (size_type)-1;      /// 'npos' means non-valid position or simply non-position.
+        static const size_type kMaxSize = (size_type)-2;      /// -1 is reserved for 'npos'. It also happens to be slightly beneficial that kMaxSize is a value less than -1, as it helps us deal with potential integer wraparound issues.
+
+        enum
+        {
+            kMinPtrArraySize = 8,                     /// A new empty deque has a pointer array of this size.
+            kSubarraySize    = kDequeSubarraySize,
+            kAlignment       = EASTL_ALIGN_OF(T),
+            kAlignmentOffset = 0
+        };
+
+        EASTL_CT_ASSERT(kDequeSubarraySize > 0);
+
+        enum Side
+        {
+            kSideFront,
+            kSideBack
+        };
+
+    protected:
+        T**            mpPtrArray;        // Array of pointers to subarrays. The subarrays from mItBegin's to mItEnd's are allocated.
+        size_type      mnPtrArraySize;    // Number of entries in mpPtrArray.
+        iterator       mItBegin;
+        iterator       mItEnd;
+        allocator_type mAllocator;        // To do: Use base class optimization to make this go away.
+
+    public:
+        DequeBase(const allocator_type& allocator);
+        DequeBase(size_type n, const allocator_type& allocator);
+       ~DequeBase();
+
+        allocator_type& get_allocator();
+        void            set_allocator(const allocator_type& allocator);
+
+    protected:
+        T*       DoAllocateSubarray();
+        void     DoFreeSubarray(T* p);
+        void     DoFreeSubarrays(T** pBegin, T** pEnd);
+
+        T**      DoAllocatePtrArray(size_type n);
+        void     DoFreePtrArray(T** pp, size_t n);
+
+        iterator DoReallocSubarray(size_type nAdditionalCapacity, Side side);
+        void     DoReallocPtrArray(size_type nAdditionalCapacity, Side side);
+
+        void     DoInit(size_type n);
+
+    }; // DequeBase
+
+
+
+
+    /// deque
+    ///
+    /// Implements a double-ended queue. See the top of this file for a
+    /// description.
+    ///
+    template <typename T, typename Allocator = EASTLAllocatorType, unsigned kDequeSubarraySize = EASTL_DEQUE_DEFAULT_SUBARRAY_SIZE(T)>
+    class deque : public DequeBase<T, Allocator, kDequeSubarraySize>
+    {
+        typedef DequeBase<T, Allocator, kDequeSubarraySize>   base_type;
+        typedef deque<T, Allocator, kDequeSubarraySize>       this_type;
+
+    public:
+        typedef T                                             value_type;
+        typedef T*                                            pointer;
+        typedef const T*                                      const_pointer;
+        typedef T&                                            reference;
+        typedef const T&                                      const_reference;
+        typedef typename base_type::iterator                  iterator;
+        typedef typename base_type::const_iterator            const_iterator;
+        typedef eastl::reverse_iterator<iterator>             reverse_iterator;
+        typedef eastl::reverse_iterator<const_iterator>       const_reverse_iterator;
+        typedef typename base_type::size_type                 size_type;
+        typedef typename base_type::difference_type           difference_type;
+        typedef typename base_type::allocator_type            allocator_type;
+
+        using base_type::kSideFront;
+        using base_type::kSideBack;
+        using base_type::kSubarraySize;
+        using base_type::mpPtrArray;
+        using base_type::mnPtrArraySize;
+        using base_type::mItBegin;
+        using base_type::mItEnd;
+        using base_type::mAllocator;
+        using base_type::npos;
+        using base_type::DoAllocateSubarray;
+        using base_type::DoFreeSubarray;
+        using base_type::DoFreeSubarrays;
+        using base_type::DoReallocSubarray;
+        using base_type::DoReallocPtrArray;
+
+    public:
+        deque();
+        explicit deque(const allocator_type& allocator);
+        explicit deque(size_type n, const allocator_type& allocator = EASTL_DEQUE_DEFAULT_ALLOCATOR);
+        deque(size_type n, const value_type& value, const allocator_type& allocator = EASTL_DEQUE_DEFAULT_ALLOCATOR);
+        deque(const this_type& x);
+
+        template <typename InputIterator>
+        deque(InputIterator first, InputIterator last); // allocator arg removed because VC7.1 fails on the default arg. To do: Make a second version of this function without a default arg.
+
+        #ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
+            deque(this_type&& x);
+            this_type& operator=(this_type&& x);
+            void push_front(value_type&& value);
+            void push_back(value_type&& value);
+        #endif
+
+       ~deque();
+
+        this_type& operator=(const this_type& x);
+        void swap(this_type& x);
+
+        void assign(size_type n, const value_type& value);
+
+        template <typename InputIterator>
+        void assign(InputIterator first, InputIterator last);
+
+        iterator       begin();
+        const_iterator begin() const;
+
+        iterator       end();
+        const_iterator end() const;
+
+        reverse_iterator       rbegin();
+        const_reverse_iterator rbegin() const;
+
+        reverse_iterator       rend();
+        const_reverse_iterator rend() const;
+
+        bool      empty() const;
+        size_type size() const;
+
+        void resize(size_type n, const value_type& value);
+        void resize(size_type n);
+
+        reference       operator[](size_type n);
+        const_reference operator[](size_type n) const;
+
+        reference       at(size_type n);
+        const_reference at(size_type n) const;
+
+        reference       front();
+        const_reference front() const;
+
+        reference       back();
+        const_reference back() const;
+
+        void      push_front(const value_type& value);
+        reference push_front();
+
+        void      push_back(const value_type& value);
+        reference push_back();
+
+        void      pop_front();
+        void      pop_back();
+
+        iterator insert(iterator position, const value_type& value);
+        void     insert(iterator position, size_type n, const value_type& value);
+
+        template <typename InputIterator>
+        void insert(iterator position, InputIterator first, InputIterator last);
+
+        iterator erase(iterator position);
+        iterator erase(iterator first, iterator last);
+
+        void clear();
+
+        bool validate() const;
+        int  validate_iterator(const_iterator i) const;
+
+    protected:
+        template <typename Integer>
+        void DoInit(Integer n, Integer value, true_type);
+
+        template <typename InputIterator>
+        void DoInit(InputIterator first, InputIterator last, false_type);
+
+        template <typename InputIterator>
+        void DoInitFromIterator(InputIterator first, InputIterator last, EASTL_ITC_NS::input_iterator_tag);
+
+        template <typename ForwardIterator>
+        void DoInitFromIterator(ForwardIterator first, ForwardIterator last, EASTL_ITC_NS::forward_iterator_tag);
+
+        void DoFillInit(const value_type& value);
+
+        template <typename Integer>
+        void DoAssign(Integer n, Integer value, true_type);
+
+        template <typename InputIterator>
+        void DoAssign(InputIterator first, InputIterator last, false_type);
+
+        void DoAssignValues(size_type n, const value_type& value);
+
+        template <typename Integer>
+        void DoInsert(iterator position, Integer n, Integer value, true_type);
+
+        template <typename InputIterator>
+        void DoInsert(iterator position, InputIterator first, InputIterator last, false_type);
+
+        template <typename InputIterator>
+        void DoInsertFromIterator(iterator position, InputIterator first, InputIterator last, EASTL_ITC_NS::input_iterator_tag);
+
+        template <typename ForwardIterator>
+        void DoInsertFromIterator(iterator position, ForwardIterator first, ForwardIterator last, EASTL_ITC_NS::forward_iterator_tag);
+
+        void DoInsertValues(iterator position, size_type n, const value_type& value);
+
+        void DoDestroyRange(iterator first, iterator last);
+        void DoSwap(this_type& x);
+
+    }; // class deque
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // DequeIterator
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename T, typename Pointer, typename Reference, unsigned kDequeSubarraySize>
+    inline DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::DequeIterator()
+        : mpCurrent(NULL), mpBegin(NULL), mpEnd(NULL), mpCurrentArrayPtr(NULL)
+    {
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, unsigned kDequeSubarraySize>
+    inline DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::DequeIterator(T** pCurrentArrayPtr, T* pCurrent)
+        : mpCurrent(pCurrent), mpBegin(*pCurrentArrayPtr), mpEnd(*pCurrentArrayPtr + kDequeSubarraySize), mpCurrentArrayPtr(pCurrentArrayPtr)
+    {
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, unsigned kDequeSubarraySize>
+    inline DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::DequeIterator(const iterator& x)
+        : mpCurrent(x.mpCurrent), mpBegin(x.mpBegin), mpEnd(x.mpEnd), mpCurrentArrayPtr(x.mpCurrentArrayPtr)
+    {
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, unsigned kDequeSubarraySize>
+    inline typename DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::this_type&
+    DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::operator=(const iterator& x)
+    {
+        mpCurrent         = x.mpCurrent;
+        mpBegin           = x.mpBegin;
+        mpEnd             = x.mpEnd;
+        mpCurrentArrayPtr = x.mpCurrentArrayPtr;
+        return *this;
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, unsigned kDequeSubarraySize>
+    inline typename DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::reference
+    DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::operator*() const
+    {
+        return *mpCurrent;
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, unsigned kDequeSubarraySize>
+    inline typename DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::pointer
+    DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::operator->() const
+    {
+        return mpCurrent;
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, unsigned kDequeSubarraySize>
+    inline typename DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::this_type&
+    DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::operator++()
+    {
+        if(EASTL_UNLIKELY(++mpCurrent == mpEnd))
+        {
+            SetSubarray(mpCurrentArrayPtr + 1);
+            mpCurrent = mpBegin;
+        }
+        return *this;
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, unsigned kDequeSubarraySize>
+    inline typename DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::this_type
+    DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::operator++(int)
+    {
+        const this_type temp(*this);
+        operator++();
+        return temp;
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, unsigned kDequeSubarraySize>
+    inline typename DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::this_type&
+    DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::operator--()
+    {
+        if(EASTL_UNLIKELY(mpCurrent == mpBegin))
+        {
+            SetSubarray(mpCurrentArrayPtr - 1);
+            mpCurrent = mpEnd;
+        }
+        --mpCurrent;
+        return *this;
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, unsigned kDequeSubarraySize>
+    inline typename DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::this_type
+    DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::operator--(int)
+    {
+        const this_type temp(*this);
+        operator--();
+        return temp;
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, unsigned kDequeSubarraySize>
+    typename DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::this_type&
+    DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::operator+=(difference_type n)
+    {
+        const difference_type nSubarraySize = (difference_type)kDequeSubarraySize;
+        const difference_type nOffset       = (mpCurrent - mpBegin) + n;
+
+        if((nOffset >= 0) && (nOffset < nSubarraySize)) // If we stay within the current subarray...
+            mpCurrent += n;
+        else
+        {
+            const difference_type nSubarrayOffset = (nOffset >= 0) ? (nOffset / nSubarraySize)
+                                                                   : -((-nOffset - 1) / nSubarraySize) - 1;
+            SetSubarray(mpCurrentArrayPtr + nSubarrayOffset);
+            mpCurrent = mpBegin + (nOffset - (nSubarrayOffset * nSubarraySize));
+        }
+
+        return *this;
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, unsigned kDequeSubarraySize>
+    inline typename DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::this_type&
+    DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::operator-=(difference_type n)
+    {
+        return operator+=(-n);
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, unsigned kDequeSubarraySize>
+    inline typename DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::this_type
+    DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::operator+(difference_type n) const
+    {
+        return this_type(*this).operator+=(n);
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, unsigned kDequeSubarraySize>
+    inline typename DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::this_type
+    DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::operator-(difference_type n) const
+    {
+        return this_type(*this).operator+=(-n);
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, unsigned kDequeSubarraySize>
+    inline typename DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::reference
+    DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::operator[](difference_type n) const
+    {
+        return *(*this + n);
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, unsigned kDequeSubarraySize>
+    inline void DequeIterator<T, Pointer, Reference, kDequeSubarraySize>::SetSubarray(T** pCurrentArrayPtr)
+    {
+        mpCurrentArrayPtr = pCurrentArrayPtr;
+        mpBegin           = *pCurrentArrayPtr;
+        mpEnd             = mpBegin + kDequeSubarraySize;
+    }
+
+
+    // The C++ defect report #179 requires that we support comparisons between const and non-const iterators.
+    // Thus we provide additional template paremeters here to support this. The defect report does not
+    // require us to support comparisons between reverse_iterators and const_reverse_iterators.
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, unsigned kDequeSubarraySize>
+    inline bool operator==(const DequeIterator<T, PointerA, ReferenceA, kDequeSubarraySize>& a,
+                           const DequeIterator<T, PointerB, ReferenceB, kDequeSubarraySize>& b)
+    {
+        return a.mpCurrent == b.mpCurrent;
+    }
+
+
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, unsigned kDequeSubarraySize>
+    inline bool operator!=(const DequeIterator<T, PointerA, ReferenceA, kDequeSubarraySize>& a,
+                           const DequeIterator<T, PointerB, ReferenceB, kDequeSubarraySize>& b)
+    {
+        return a.mpCurrent != b.mpCurrent;
+    }
+
+
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, unsigned kDequeSubarraySize>
+    inline bool operator<(const DequeIterator<T, PointerA, ReferenceA, kDequeSubarraySize>& a,
+                          const DequeIterator<T, PointerB, ReferenceB, kDequeSubarraySize>& b)
+    {
+        return (a.mpCurrentArrayPtr == b.mpCurrentArrayPtr) ? (a.mpCurrent < b.mpCurrent) : (a.mpCurrentArrayPtr < b.mpCurrentArrayPtr);
+    }
+
+
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, unsigned kDequeSubarraySize>
+    inline bool operator>(const DequeIterator<T, PointerA, ReferenceA, kDequeSubarraySize>& a,
+                          const DequeIterator<T, PointerB, ReferenceB, kDequeSubarraySize>& b)
+    {
+        return b < a;
+    }
+
+
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, unsigned kDequeSubarraySize>
+    inline bool operator<=(const DequeIterator<T, PointerA, ReferenceA, kDequeSubarraySize>& a,
+                           const DequeIterator<T, PointerB, ReferenceB, kDequeSubarraySize>& b)
+    {
+        return !(b < a);
+    }
+
+
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, unsigned kDequeSubarraySize>
+    inline bool operator>=(const DequeIterator<T, PointerA, ReferenceA, kDequeSubarraySize>& a,
+                           const DequeIterator<T, PointerB, ReferenceB, kDequeSubarraySize>& b)
+    {
+        return !(a < b);
+    }
+
+
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, unsigned kDequeSubarraySize>
+    inline typename DequeIterator<T, PointerA, ReferenceA, kDequeSubarraySize>::difference_type
+    operator-(const DequeIterator<T, PointerA, ReferenceA, kDequeSubarraySize>& a,
+              const DequeIterator<T, PointerB, ReferenceB, kDequeSubarraySize>& b)
+    {
+        typedef typename DequeIterator<T, PointerA, ReferenceA, kDequeSubarraySize>::difference_type difference_type;
+
+        return ((difference_type)kDequeSubarraySize * (a.mpCurrentArrayPtr - b.mpCurrentArrayPtr))
+               + (a.mpCurrent - a.mpBegin) - (b.mpCurrent - b.mpBegin);
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, unsigned kDequeSubarraySize>
+    inline DequeIterator<T, Pointer, Reference, kDequeSubarraySize>
+    operator+(ptrdiff_t n, const DequeIterator<T, Pointer, Reference, kDequeSubarraySize>& x)
+    {
+        return x + n;
+    }
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // DequeBase
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline DequeBase<T, Allocator, kDequeSubarraySize>::DequeBase(const allocator_type& allocator)
+        : mpPtrArray(NULL),
+          mnPtrArraySize(0),
+          mItBegin(),
+          mItEnd(),
+          mAllocator(allocator)
+    {
+        // It is assumed here that the deque subclass will init us when/as needed.
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline DequeBase<T, Allocator, kDequeSubarraySize>::DequeBase(size_type n, const allocator_type& allocator)
+        : mpPtrArray(NULL),
+          mnPtrArraySize(0),
+          mItBegin(),
+          mItEnd(),
+          mAllocator(allocator)
+    {
+        DoInit(n);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    DequeBase<T, Allocator, kDequeSubarraySize>::~DequeBase()
+    {
+        if(mpPtrArray)
+        {
+            DoFreeSubarrays(mItBegin.mpCurrentArrayPtr, mItEnd.mpCurrentArrayPtr + 1);
+            DoFreePtrArray(mpPtrArray, mnPtrArraySize);
+        }
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename DequeBase<T, Allocator, kDequeSubarraySize>::allocator_type&
+    DequeBase<T, Allocator, kDequeSubarraySize>::get_allocator()
+    {
+        return mAllocator;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline void DequeBase<T, Allocator, kDequeSubarraySize>::set_allocator(const allocator_type& allocator)
+    {
+        mAllocator = allocator;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline T* DequeBase<T, Allocator, kDequeSubarraySize>::DoAllocateSubarray()
+    {
+        T* p = (T*)allocate_memory(mAllocator, kDequeSubarraySize * sizeof(T), kAlignment, kAlignmentOffset);
+
+        #if EASTL_DEBUG
+            memset((void*)p, 0, kDequeSubarraySize * sizeof(T));
+        #endif
+
+        return p;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline void DequeBase<T, Allocator, kDequeSubarraySize>::DoFreeSubarray(T* p)
+    {
+        if(p)
+            EASTLFree(mAllocator, p, kDequeSubarraySize * sizeof(T));
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline void DequeBase<T, Allocator, kDequeSubarraySize>::DoFreeSubarrays(T** pBegin, T** pEnd)
+    {
+        while(pBegin < pEnd)
+            DoFreeSubarray(*pBegin++);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline T** DequeBase<T, Allocator, kDequeSubarraySize>::DoAllocatePtrArray(size_type n)
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(n >= 0x80000000))
+                EASTL_FAIL_MSG("deque::DoAllocatePtrArray -- improbably large request.");
+        #endif
+
+        T** pp = (T**)allocate_memory(mAllocator, n * sizeof(T*), EASTL_ALIGN_OF(T*), 0);
+
+        #if EASTL_DEBUG
+            memset((void*)pp, 0, n * sizeof(T*));
+        #endif
+
+        return pp;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline void DequeBase<T, Allocator, kDequeSubarraySize>::DoFreePtrArray(T** pp, size_t n)
+    {
+        if(pp)
+            EASTLFree(mAllocator, pp, n * sizeof(T*));
+    }
+
+
+    // Makes sure that nAdditionalCapacity elements can be added on the given
+    // side without allocating, allocating subarrays (and growing the pointer
+    // array) as needed. Returns what mItBegin or mItEnd would become if that
+    // many elements were added; it is up to the caller to construct them.
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    typename DequeBase<T, Allocator, kDequeSubarraySize>::iterator
+    DequeBase<T, Allocator, kDequeSubarraySize>::DoReallocSubarray(size_type nAdditionalCapacity, Side side)
+    {
+        if(side == kSideFront)
+        {
+            const size_type nCurrentAdditionalCapacity = (size_type)(mItBegin.mpCurrent - mItBegin.mpBegin);
+
+            if(EASTL_UNLIKELY(nCurrentAdditionalCapacity < nAdditionalCapacity))
+            {
+                const difference_type nSubarrayIncrease = (difference_type)(((nAdditionalCapacity - nCurrentAdditionalCapacity) + kDequeSubarraySize - 1) / kDequeSubarraySize);
+                difference_type i;
+
+                if(nSubarrayIncrease > (mItBegin.mpCurrentArrayPtr - mpPtrArray)) // If there are not enough pointers in front of the current (first) one...
+                    DoReallocPtrArray((size_type)(nSubarrayIncrease - (mItBegin.mpCurrentArrayPtr - mpPtrArray)), kSideFront);
+
+                #if EASTL_EXCEPTIONS_ENABLED
+                    try
+                    {
+                #endif
+                        for(i = 1; i <= nSubarrayIncrease; ++i)
+                            mItBegin.mpCurrentArrayPtr[-i] = DoAllocateSubarray();
+                #if EASTL_EXCEPTIONS_ENABLED
+                    }
+                    catch(...)
+                    {
+                        for(difference_type j = 1; j < i; ++j)
+                            DoFreeSubarray(mItBegin.mpCurrentArrayPtr[-j]);
+                        throw;
+                    }
+                #endif
+            }
+
+            return mItBegin - (difference_type)nAdditionalCapacity;
+        }
+        else // else kSideBack
+        {
+            // The end iterator must refer to an allocated subarray, so the
+            // last slot of the last subarray doesn't count as capacity.
+            const size_type nCurrentAdditionalCapacity = (size_type)((mItEnd.mpEnd - 1) - mItEnd.mpCurrent);
+
+            if(EASTL_UNLIKELY(nCurrentAdditionalCapacity < nAdditionalCapacity))
+            {
+                const difference_type nSubarrayIncrease = (difference_type)(((nAdditionalCapacity - nCurrentAdditionalCapacity) + kDequeSubarraySize - 1) / kDequeSubarraySize);
+                const difference_type nUnusedPtrCountAtBack = ((mpPtrArray + mnPtrArraySize) - mItEnd.mpCurrentArrayPtr) - 1;
+                difference_type i;
+
+                if(nSubarrayIncrease > nUnusedPtrCountAtBack) // If there are not enough pointers after the current (last) one...
+                    DoReallocPtrArray((size_type)(nSubarrayIncrease - nUnusedPtrCountAtBack), kSideBack);
+
+                #if EASTL_EXCEPTIONS_ENABLED
+                    try
+                    {
+                #endif
+                        for(i = 1; i <= nSubarrayIncrease; ++i)
+                            mItEnd.mpCurrentArrayPtr[i] = DoAllocateSubarray();
+                #if EASTL_EXCEPTIONS_ENABLED
+                    }
+                    catch(...)
+                    {
+                        for(difference_type j = 1; j < i; ++j)
+                            DoFreeSubarray(mItEnd.mpCurrentArrayPtr[j]);
+                        throw;
+                    }
+                #endif
+            }
+
+            return mItEnd + (difference_type)nAdditionalCapacity;
+        }
+    }
+
+
+    // Makes room for nAdditionalCapacity more subarray pointers on the given
+    // side. If the other side has enough unused pointers, the used ones are
+    // moved over; otherwise the pointer array is reallocated. Subarrays and
+    // elements never move, so only the iterators' array pointers change.
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    void DequeBase<T, Allocator, kDequeSubarraySize>::DoReallocPtrArray(size_type nAdditionalCapacity, Side side)
+    {
+        const size_type nUnusedPtrCountAtFront = (size_type)(mItBegin.mpCurrentArrayPtr - mpPtrArray);
+        const size_type nUsedPtrCount          = (size_type)(mItEnd.mpCurrentArrayPtr - mItBegin.mpCurrentArrayPtr) + 1;
+        const size_t    nUsedPtrSpace          = nUsedPtrCount * sizeof(void*);
+        const size_type nUnusedPtrCountAtEnd   = (mnPtrArraySize - nUnusedPtrCountAtFront) - nUsedPtrCount;
+        T**             pPtrArrayBegin;
+
+        if((side == kSideBack) && (nAdditionalCapacity <= nUnusedPtrCountAtFront)) // If we can take advantage of unused pointers at the front...
+        {
+            // Move the used pointers toward the front, by half the unused space if that's more
+            // than requested, so that a FIFO use pattern doesn't do this on every subarray.
+            if(nAdditionalCapacity < (nUnusedPtrCountAtFront / 2))
+                nAdditionalCapacity = (nUnusedPtrCountAtFront / 2);
+
+            pPtrArrayBegin = mpPtrArray + (nUnusedPtrCountAtFront - nAdditionalCapacity);
+            memmove(pPtrArrayBegin, mItBegin.mpCurrentArrayPtr, nUsedPtrSpace);
+        }
+        else if((side == kSideFront) && (nAdditionalCapacity <= nUnusedPtrCountAtEnd)) // If we can take advantage of unused pointers at the end...
+        {
+            if(nAdditionalCapacity < (nUnusedPtrCountAtEnd / 2))
+                nAdditionalCapacity = (nUnusedPtrCountAtEnd / 2);
+
+            pPtrArrayBegin = mItBegin.mpCurrentArrayPtr + nAdditionalCapacity;
+            memmove(pPtrArrayBegin, mItBegin.mpCurrentArrayPtr, nUsedPtrSpace);
+        }
+        else
+        {
+            // Grow geometrically and keep the used pointers roughly centered.
+            const size_type nNewPtrArraySize = mnPtrArraySize + eastl::max_alt(mnPtrArraySize, nAdditionalCapacity) + 2;
+            T** const       pNewPtrArray     = DoAllocatePtrArray(nNewPtrArraySize);
+
+            pPtrArrayBegin = pNewPtrArray + (nUnusedPtrCountAtFront + ((side == kSideFront) ? nAdditionalCapacity : 0));
+
+            if(mpPtrArray)
+                memcpy(pPtrArrayBegin, mItBegin.mpCurrentArrayPtr, nUsedPtrSpace);
+
+            DoFreePtrArray(mpPtrArray, mnPtrArraySize);
+
+            mpPtrArray     = pNewPtrArray;
+            mnPtrArraySize = nNewPtrArraySize;
+        }
+
+        mItBegin.SetSubarray(pPtrArrayBegin);
+        mItEnd.SetSubarray((pPtrArrayBegin + nUsedPtrCount) - 1);
+    }
+
+
+    // Allocates the pointer array and the subarrays for n elements, and sets
+    // mItBegin and mItEnd accordingly. The elements are left unconstructed.
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    void DequeBase<T, Allocator, kDequeSubarraySize>::DoInit(size_type n)
+    {
+        const size_type nNewPtrArraySize = (size_type)((n / kDequeSubarraySize) + 1); // Always have at least one, even if n is zero.
+
+        mnPtrArraySize = eastl::max_alt((size_type)kMinPtrArraySize, (size_type)(nNewPtrArraySize + 2));
+        mpPtrArray     = DoAllocatePtrArray(mnPtrArraySize);
+
+        T** const pPtrArrayBegin = mpPtrArray + ((mnPtrArraySize - nNewPtrArraySize) / 2); // Try to place it in the middle.
+        T** const pPtrArrayEnd   = pPtrArrayBegin + nNewPtrArraySize;
+        T**       pPtrArrayCurrent = pPtrArrayBegin;
+
+        #if EASTL_EXCEPTIONS_ENABLED
+            try
+            {
+                try
+                {
+        #endif
+                    while(pPtrArrayCurrent < pPtrArrayEnd)
+                        *pPtrArrayCurrent++ = DoAllocateSubarray();
+        #if EASTL_EXCEPTIONS_ENABLED
+                }
+                catch(...)
+                {
+                    DoFreeSubarrays(pPtrArrayBegin, pPtrArrayCurrent);
+                    throw;
+                }
+            }
+            catch(...)
+            {
+                DoFreePtrArray(mpPtrArray, mnPtrArraySize);
+                mpPtrArray     = NULL;
+                mnPtrArraySize = 0;
+                throw;
+            }
+        #endif
+
+        mItBegin.SetSubarray(pPtrArrayBegin);
+        mItBegin.mpCurrent = mItBegin.mpBegin;
+
+        mItEnd.SetSubarray(pPtrArrayEnd - 1);
+        mItEnd.mpCurrent = mItEnd.mpBegin + (difference_type)(n % kDequeSubarraySize);
+    }
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // deque
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline deque<T, Allocator, kDequeSubarraySize>::deque()
+        : base_type(0, allocator_type(EASTL_DEQUE_DEFAULT_NAME))
+    {
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline deque<T, Allocator, kDequeSubarraySize>::deque(const allocator_type& allocator)
+        : base_type(0, allocator)
+    {
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline deque<T, Allocator, kDequeSubarraySize>::deque(size_type n, const allocator_type& allocator)
+        : base_type(n, allocator)
+    {
+        DoFillInit(value_type());
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline deque<T, Allocator, kDequeSubarraySize>::deque(size_type n, const value_type& value, const allocator_type& allocator)
+        : base_type(n, allocator)
+    {
+        DoFillInit(value);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline deque<T, Allocator, kDequeSubarraySize>::deque(const this_type& x)
+        : base_type(x.size(), x.mAllocator)
+    {
+        eastl::uninitialized_copy(x.mItBegin, x.mItEnd, mItBegin);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    template <typename InputIterator>
+    inline deque<T, Allocator, kDequeSubarraySize>::deque(InputIterator first, InputIterator last)
+        : base_type(EASTL_DEQUE_DEFAULT_ALLOCATOR)
+    {
+        DoInit(first, last, is_integral<InputIterator>());
+    }
+
+
+    #ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
+        template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+        inline deque<T, Allocator, kDequeSubarraySize>::deque(this_type&& x)
+            : base_type(0, x.mAllocator)
+        {
+            DoSwap(x);
+        }
+
+
+        template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+        inline typename deque<T, Allocator, kDequeSubarraySize>::this_type&
+        deque<T, Allocator, kDequeSubarraySize>::operator=(this_type&& x)
+        {
+            swap(x);
+            return *this;
+        }
+
+
+        template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+        inline void deque<T, Allocator, kDequeSubarraySize>::push_front(value_type&& value)
+        {
+            if(EASTL_LIKELY(mItBegin.mpCurrent != mItBegin.mpBegin))
+                ::new(mItBegin.mpCurrent - 1) value_type(std::move(value));
+            else
+            {
+                DoReallocSubarray(1, kSideFront);
+                ::new(mItBegin.mpCurrentArrayPtr[-1] + (kDequeSubarraySize - 1)) value_type(std::move(value));
+            }
+            --mItBegin;
+        }
+
+
+        template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+        inline void deque<T, Allocator, kDequeSubarraySize>::push_back(value_type&& value)
+        {
+            if(EASTL_LIKELY((mItEnd.mpCurrent + 1) != mItEnd.mpEnd))
+                ::new(mItEnd.mpCurrent++) value_type(std::move(value));
+            else
+            {
+                DoReallocSubarray(1, kSideBack);
+                ::new(mItEnd.mpCurrent) value_type(std::move(value));
+                ++mItEnd;
+            }
+        }
+    #endif
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    deque<T, Allocator, kDequeSubarraySize>::~deque()
+    {
+        DoDestroyRange(mItBegin, mItEnd);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    typename deque<T, Allocator, kDequeSubarraySize>::this_type&
+    deque<T, Allocator, kDequeSubarraySize>::operator=(const this_type& x)
+    {
+        if(&x != this) // If not assigning to self...
+        {
+            // If (EASTL_ALLOCATOR_COPY_ENABLED == 1) and the current contents are allocated by an
+            // allocator that's unequal to x's allocator, we need to reallocate our elements with
+            // our current allocator and reallocate it with x's allocator. If the allocators are
+            // equal then we can use a more optimal algorithm that doesn't reallocate our elements
+            // but instead can copy them in place.
+
+            #if EASTL_ALLOCATOR_COPY_ENABLED
+                bool bSlowerPathwayRequired = (mAllocator != x.mAllocator);
+            #else
+                bool bSlowerPathwayRequired = false;
+            #endif
+
+            if(bSlowerPathwayRequired)
+            {
+                clear();
+
+                #if EASTL_ALLOCATOR_COPY_ENABLED
+                    mAllocator = x.mAllocator;
+                #endif
+            }
+
+            assign(x.begin(), x.end());
+        }
+
+        return *this;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline void deque<T, Allocator, kDequeSubarraySize>::swap(this_type& x)
+    {
+        if(mAllocator == x.mAllocator) // If allocators are equivalent...
+            DoSwap(x);
+        else // else swap the contents.
+        {
+            const this_type temp(*this); // Can't call eastl::swap because that would
+            *this = x;                   // itself call this member swap function.
+            x     = temp;
+        }
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline void deque<T, Allocator, kDequeSubarraySize>::assign(size_type n, const value_type& value)
+    {
+        DoAssignValues(n, value);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    template <typename InputIterator>
+    inline void deque<T, Allocator, kDequeSubarraySize>::assign(InputIterator first, InputIterator last)
+    {
+        DoAssign(first, last, is_integral<InputIterator>());
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename deque<T, Allocator, kDequeSubarraySize>::iterator
+    deque<T, Allocator, kDequeSubarraySize>::begin()
+    {
+        return mItBegin;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename deque<T, Allocator, kDequeSubarraySize>::const_iterator
+    deque<T, Allocator, kDequeSubarraySize>::begin() const
+    {
+        return mItBegin;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename deque<T, Allocator, kDequeSubarraySize>::iterator
+    deque<T, Allocator, kDequeSubarraySize>::end()
+    {
+        return mItEnd;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename deque<T, Allocator, kDequeSubarraySize>::const_iterator
+    deque<T, Allocator, kDequeSubarraySize>::end() const
+    {
+        return mItEnd;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename deque<T, Allocator, kDequeSubarraySize>::reverse_iterator
+    deque<T, Allocator, kDequeSubarraySize>::rbegin()
+    {
+        return reverse_iterator(mItEnd);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename deque<T, Allocator, kDequeSubarraySize>::const_reverse_iterator
+    deque<T, Allocator, kDequeSubarraySize>::rbegin() const
+    {
+        return const_reverse_iterator(mItEnd);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename deque<T, Allocator, kDequeSubarraySize>::reverse_iterator
+    deque<T, Allocator, kDequeSubarraySize>::rend()
+    {
+        return reverse_iterator(mItBegin);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename deque<T, Allocator, kDequeSubarraySize>::const_reverse_iterator
+    deque<T, Allocator, kDequeSubarraySize>::rend() const
+    {
+        return const_reverse_iterator(mItBegin);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline bool deque<T, Allocator, kDequeSubarraySize>::empty() const
+    {
+        return mItBegin.mpCurrent == mItEnd.mpCurrent;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename deque<T, Allocator, kDequeSubarraySize>::size_type
+    deque<T, Allocator, kDequeSubarraySize>::size() const
+    {
+        return (size_type)(mItEnd - mItBegin);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline void deque<T, Allocator, kDequeSubarraySize>::resize(size_type n, const value_type& value)
+    {
+        const size_type nSizeCurrent = size();
+
+        if(n > nSizeCurrent) // We expect that more often than not, resizes will be upsizes.
+            insert(mItEnd, n - nSizeCurrent, value);
+        else
+            erase(mItBegin + (difference_type)n, mItEnd);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline void deque<T, Allocator, kDequeSubarraySize>::resize(size_type n)
+    {
+        resize(n, value_type());
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename deque<T, Allocator, kDequeSubarraySize>::reference
+    deque<T, Allocator, kDequeSubarraySize>::operator[](size_type n)
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(n >= size()))
+                EASTL_FAIL_MSG("deque::operator[] -- out of range");
+        #endif
+
+        return mItBegin[(difference_type)n];
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename deque<T, Allocator, kDequeSubarraySize>::const_reference
+    deque<T, Allocator, kDequeSubarraySize>::operator[](size_type n) const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(n >= size()))
+                EASTL_FAIL_MSG("deque::operator[] -- out of range");
+        #endif
+
+        return mItBegin[(difference_type)n];
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename deque<T, Allocator, kDequeSubarraySize>::reference
+    deque<T, Allocator, kDequeSubarraySize>::at(size_type n)
+    {
+        #if EASTL_EXCEPTIONS_ENABLED
+            if(n >= size())
+                throw std::out_of_range("deque::at -- out of range");
+        #elif EASTL_ASSERT_ENABLED
+            if(n >= size())
+                EASTL_FAIL_MSG("deque::at -- out of range");
+        #endif
+
+        return mItBegin[(difference_type)n];
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename deque<T, Allocator, kDequeSubarraySize>::const_reference
+    deque<T, Allocator, kDequeSubarraySize>::at(size_type n) const
+    {
+        #if EASTL_EXCEPTIONS_ENABLED
+            if(n >= size())
+                throw std::out_of_range("deque::at -- out of range");
+        #elif EASTL_ASSERT_ENABLED
+            if(n >= size())
+                EASTL_FAIL_MSG("deque::at -- out of range");
+        #endif
+
+        return mItBegin[(difference_type)n];
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename deque<T, Allocator, kDequeSubarraySize>::reference
+    deque<T, Allocator, kDequeSubarraySize>::front()
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(empty()))
+                EASTL_FAIL_MSG("deque::front -- empty deque");
+        #endif
+
+        return *mItBegin;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename deque<T, Allocator, kDequeSubarraySize>::const_reference
+    deque<T, Allocator, kDequeSubarraySize>::front() const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(empty()))
+                EASTL_FAIL_MSG("deque::front -- empty deque");
+        #endif
+
+        return *mItBegin;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename deque<T, Allocator, kDequeSubarraySize>::reference
+    deque<T, Allocator, kDequeSubarraySize>::back()
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(empty()))
+                EASTL_FAIL_MSG("deque::back -- empty deque");
+        #endif
+
+        return *(mItEnd - 1);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename deque<T, Allocator, kDequeSubarraySize>::const_reference
+    deque<T, Allocator, kDequeSubarraySize>::back() const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(empty()))
+                EASTL_FAIL_MSG("deque::back -- empty deque");
+        #endif
+
+        return *(mItEnd - 1);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline void deque<T, Allocator, kDequeSubarraySize>::push_front(const value_type& value)
+    {
+        // Growing never moves elements, so value may refer to one of ours.
+        if(EASTL_LIKELY(mItBegin.mpCurrent != mItBegin.mpBegin))
+            ::new(mItBegin.mpCurrent - 1) value_type(value);
+        else
+        {
+            DoReallocSubarray(1, kSideFront);
+            ::new(mItBegin.mpCurrentArrayPtr[-1] + (kDequeSubarraySize - 1)) value_type(value);
+        }
+        --mItBegin;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename deque<T, Allocator, kDequeSubarraySize>::reference
+    deque<T, Allocator, kDequeSubarraySize>::push_front()
+    {
+        if(EASTL_UNLIKELY(mItBegin.mpCurrent == mItBegin.mpBegin))
+            DoReallocSubarray(1, kSideFront);
+        ::new(&*(mItBegin - 1)) value_type();
+        return *--mItBegin;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline void deque<T, Allocator, kDequeSubarraySize>::push_back(const value_type& value)
+    {
+        // Growing never moves elements, so value may refer to one of ours.
+        if(EASTL_LIKELY((mItEnd.mpCurrent + 1) != mItEnd.mpEnd))
+            ::new(mItEnd.mpCurrent++) value_type(value);
+        else
+        {
+            DoReallocSubarray(1, kSideBack);
+            ::new(mItEnd.mpCurrent) value_type(value);
+            ++mItEnd;
+        }
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline typename deque<T, Allocator, kDequeSubarraySize>::reference
+    deque<T, Allocator, kDequeSubarraySize>::push_back()
+    {
+        if(EASTL_UNLIKELY((mItEnd.mpCurrent + 1) == mItEnd.mpEnd))
+            DoReallocSubarray(1, kSideBack);
+        ::new(mItEnd.mpCurrent) value_type();
+        return *mItEnd++;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline void deque<T, Allocator, kDequeSubarraySize>::pop_front()
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(empty()))
+                EASTL_FAIL_MSG("deque::pop_front -- empty deque");
+        #endif
+
+        if(EASTL_LIKELY((mItBegin.mpCurrent + 1) != mItBegin.mpEnd))
+            (mItBegin.mpCurrent++)->~value_type();
+        else
+        {
+            // The end iterator is never at the end of a subarray, so this
+            // isn't the last subarray and we can free it.
+            mItBegin.mpCurrent->~value_type();
+            DoFreeSubarray(mItBegin.mpBegin);
+            mItBegin.SetSubarray(mItBegin.mpCurrentArrayPtr + 1);
+            mItBegin.mpCurrent = mItBegin.mpBegin;
+        }
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline void deque<T, Allocator, kDequeSubarraySize>::pop_back()
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(empty()))
+                EASTL_FAIL_MSG("deque::pop_back -- empty deque");
+        #endif
+
+        if(EASTL_LIKELY(mItEnd.mpCurrent != mItEnd.mpBegin))
+            (--mItEnd.mpCurrent)->~value_type();
+        else
+        {
+            DoFreeSubarray(mItEnd.mpBegin);
+            mItEnd.SetSubarray(mItEnd.mpCurrentArrayPtr - 1);
+            mItEnd.mpCurrent = mItEnd.mpEnd - 1;
+            mItEnd.mpCurrent->~value_type();
+        }
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    typename deque<T, Allocator, kDequeSubarraySize>::iterator
+    deque<T, Allocator, kDequeSubarraySize>::insert(iterator position, const value_type& value)
+    {
+        if(position.mpCurrent == mItEnd.mpCurrent)
+        {
+            push_back(value);
+            return mItEnd - 1;
+        }
+        else if(position.mpCurrent == mItBegin.mpCurrent)
+        {
+            push_front(value);
+            return mItBegin;
+        }
+
+        const difference_type i = position - mItBegin;
+        DoInsertValues(position, 1, value);
+        return mItBegin + i;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline void deque<T, Allocator, kDequeSubarraySize>::insert(iterator position, size_type n, const value_type& value)
+    {
+        DoInsertValues(position, n, value);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    template <typename InputIterator>
+    inline void deque<T, Allocator, kDequeSubarraySize>::insert(iterator position, InputIterator first, InputIterator last)
+    {
+        DoInsert(position, first, last, is_integral<InputIterator>());
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    typename deque<T, Allocator, kDequeSubarraySize>::iterator
+    deque<T, Allocator, kDequeSubarraySize>::erase(iterator position)
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(!(validate_iterator(position) & isf_can_dereference)))
+                EASTL_FAIL_MSG("deque::erase -- invalid iterator");
+        #endif
+
+        iterator itNext(position);
+        ++itNext;
+
+        const difference_type i = position - mItBegin;
+
+        if(i < (difference_type)(size() / 2)) // Should we move the front entries forward or the back entries backward? We divide the range in half.
+        {
+            eastl::copy_backward(mItBegin, position, itNext);
+            pop_front();
+        }
+        else
+        {
+            eastl::copy(itNext, mItEnd, position);
+            pop_back();
+        }
+
+        return mItBegin + i;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    typename deque<T, Allocator, kDequeSubarraySize>::iterator
+    deque<T, Allocator, kDequeSubarraySize>::erase(iterator first, iterator last)
+    {
+        if((first.mpCurrent == mItBegin.mpCurrent) && (last.mpCurrent == mItEnd.mpCurrent)) // If erasing everything...
+        {
+            clear();
+            return mItEnd;
+        }
+
+        const difference_type n = last - first;
+        const difference_type i = first - mItBegin;
+
+        if(i < (difference_type)((size() - n) / 2)) // Should we move the front entries forward or the back entries backward? We divide the range in half.
+        {
+            const iterator itNewBegin(mItBegin + n);
+
+            eastl::copy_backward(mItBegin, first, last);
+            DoDestroyRange(mItBegin, itNewBegin);
+            DoFreeSubarrays(mItBegin.mpCurrentArrayPtr, itNewBegin.mpCurrentArrayPtr);
+            mItBegin = itNewBegin;
+        }
+        else
+        {
+            const iterator itNewEnd(mItEnd - n);
+
+            eastl::copy(last, mItEnd, first);
+            DoDestroyRange(itNewEnd, mItEnd);
+            DoFreeSubarrays(itNewEnd.mpCurrentArrayPtr + 1, mItEnd.mpCurrentArrayPtr + 1);
+            mItEnd = itNewEnd;
+        }
+
+        return mItBegin + i;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    void deque<T, Allocator, kDequeSubarraySize>::clear()
+    {
+        // Keep the first subarray, which is where we'd allocate it again anyway.
+        DoDestroyRange(mItBegin, mItEnd);
+        DoFreeSubarrays(mItBegin.mpCurrentArrayPtr + 1, mItEnd.mpCurrentArrayPtr + 1);
+        mItEnd = mItBegin;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline bool deque<T, Allocator, kDequeSubarraySize>::validate() const
+    {
+        if(!mpPtrArray)
+            return false;
+        if((mItBegin.mpCurrentArrayPtr < mpPtrArray) || (mItEnd.mpCurrentArrayPtr >= (mpPtrArray + mnPtrArraySize)))
+            return false;
+        if(mItEnd < mItBegin)
+            return false;
+        if((mItBegin.mpCurrent < mItBegin.mpBegin) || (mItBegin.mpCurrent >= mItBegin.mpEnd))
+            return false;
+        if((mItEnd.mpCurrent < mItEnd.mpBegin) || (mItEnd.mpCurrent >= mItEnd.mpEnd))
+            return false;
+        return true;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline int deque<T, Allocator, kDequeSubarraySize>::validate_iterator(const_iterator i) const
+    {
+        if((i.mpCurrentArrayPtr >= mItBegin.mpCurrentArrayPtr) && (i.mpCurrentArrayPtr <= mItEnd.mpCurrentArrayPtr) &&
+           (i.mpBegin == *i.mpCurrentArrayPtr) && (i >= mItBegin) && (i <= mItEnd))
+        {
+            if(i == mItEnd)
+                return (isf_valid | isf_current);
+            return (isf_valid | isf_current | isf_can_dereference);
+        }
+
+        return isf_none;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    template <typename Integer>
+    inline void deque<T, Allocator, kDequeSubarraySize>::DoInit(Integer n, Integer value, true_type)
+    {
+        base_type::DoInit((size_type)n);
+        DoFillInit((value_type)value);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    template <typename InputIterator>
+    inline void deque<T, Allocator, kDequeSubarraySize>::DoInit(InputIterator first, InputIterator last, false_type)
+    {
+        typedef typename eastl::iterator_traits<InputIterator>::iterator_category IC;
+        DoInitFromIterator(first, last, IC());
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    template <typename InputIterator>
+    inline void deque<T, Allocator, kDequeSubarraySize>::DoInitFromIterator(InputIterator first, InputIterator last, EASTL_ITC_NS::input_iterator_tag)
+    {
+        base_type::DoInit(0);
+
+        for(; first != last; ++first)
+            push_back(*first);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    template <typename ForwardIterator>
+    inline void deque<T, Allocator, kDequeSubarraySize>::DoInitFromIterator(ForwardIterator first, ForwardIterator last, EASTL_ITC_NS::forward_iterator_tag)
+    {
+        base_type::DoInit((size_type)eastl::distance(first, last));
+        eastl::uninitialized_copy(first, last, mItBegin);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    void deque<T, Allocator, kDequeSubarraySize>::DoFillInit(const value_type& value)
+    {
+        // Fill subarray by subarray, which lets uninitialized_fill work on plain pointers.
+        T** pPtrArrayCurrent = mItBegin.mpCurrentArrayPtr;
+
+        #if EASTL_EXCEPTIONS_ENABLED
+            try
+            {
+        #endif
+                while(pPtrArrayCurrent < mItEnd.mpCurrentArrayPtr)
+                {
+                    eastl::uninitialized_fill(*pPtrArrayCurrent, *pPtrArrayCurrent + kDequeSubarraySize, value);
+                    ++pPtrArrayCurrent;
+                }
+                eastl::uninitialized_fill(mItEnd.mpBegin, mItEnd.mpCurrent, value);
+        #if EASTL_EXCEPTIONS_ENABLED
+            }
+            catch(...)
+            {
+                for(iterator it(mItBegin); it.mpCurrentArrayPtr < pPtrArrayCurrent; ++it)
+                    it->~value_type();
+                throw;
+            }
+        #endif
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    template <typename Integer>
+    inline void deque<T, Allocator, kDequeSubarraySize>::DoAssign(Integer n, Integer value, true_type)
+    {
+        DoAssignValues((size_type)n, (value_type)value);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    template <typename InputIterator>
+    void deque<T, Allocator, kDequeSubarraySize>::DoAssign(InputIterator first, InputIterator last, false_type)
+    {
+        // We assign over the existing elements front to back. A range within
+        // ourselves is never read from behind the element being written, so
+        // this also handles d.assign(d.begin() + i, d.begin() + j).
+        iterator it(mItBegin);
+
+        for(; (it != mItEnd) && (first != last); ++it, ++first)
+            *it = *first;
+
+        if(first == last)
+            erase(it, mItEnd);
+        else
+            insert(mItEnd, first, last);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    void deque<T, Allocator, kDequeSubarraySize>::DoAssignValues(size_type n, const value_type& value)
+    {
+        const size_type nSizeCurrent = size();
+
+        // If value is one of our elements, it is only ever assigned to itself
+        // before we are done reading it, and inserting at the end doesn't move it.
+        if(n > nSizeCurrent)
+        {
+            eastl::fill(mItBegin, mItEnd, value);
+            insert(mItEnd, n - nSizeCurrent, value);
+        }
+        else
+        {
+            const iterator itEnd(mItBegin + (difference_type)n);
+
+            eastl::fill(mItBegin, itEnd, value);
+            erase(itEnd, mItEnd);
+        }
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    template <typename Integer>
+    inline void deque<T, Allocator, kDequeSubarraySize>::DoInsert(iterator position, Integer n, Integer value, true_type)
+    {
+        DoInsertValues(position, (size_type)n, (value_type)value);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    template <typename InputIterator>
+    inline void deque<T, Allocator, kDequeSubarraySize>::DoInsert(iterator position, InputIterator first, InputIterator last, false_type)
+    {
+        typedef typename eastl::iterator_traits<InputIterator>::iterator_category IC;
+        DoInsertFromIterator(position, first, last, IC());
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    template <typename InputIterator>
+    void deque<T, Allocator, kDequeSubarraySize>::DoInsertFromIterator(iterator position, InputIterator first, InputIterator last, EASTL_ITC_NS::input_iterator_tag)
+    {
+        if(position.mpCurrent == mItEnd.mpCurrent)
+        {
+            for(; first != last; ++first)
+                push_back(*first);
+        }
+        else
+        {
+            // We can't count the input ahead of time, so we read it into a
+            // temporary first.
+            const this_type temp(first, last);
+            DoInsertFromIterator(position, temp.begin(), temp.end(), EASTL_ITC_NS::random_access_iterator_tag());
+        }
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    template <typename ForwardIterator>
+    void deque<T, Allocator, kDequeSubarraySize>::DoInsertFromIterator(iterator position, ForwardIterator first, ForwardIterator last, EASTL_ITC_NS::forward_iterator_tag)
+    {
+        const size_type n = (size_type)eastl::distance(first, last);
+
+        if(position.mpCurrent == mItBegin.mpCurrent)
+        {
+            const iterator itNewBegin(DoReallocSubarray(n, kSideFront));
+            eastl::uninitialized_copy(first, last, itNewBegin);
+            mItBegin = itNewBegin;
+        }
+        else if(position.mpCurrent == mItEnd.mpCurrent)
+        {
+            const iterator itNewEnd(DoReallocSubarray(n, kSideBack));
+            eastl::uninitialized_copy(first, last, mItEnd);
+            mItEnd = itNewEnd;
+        }
+        else
+        {
+            const difference_type nInsertionIndex = position - mItBegin;
+            const size_type       nSize           = size();
+
+            if(nInsertionIndex < (difference_type)(nSize / 2)) // If the insertion index is in the front half of the deque... grow the deque at the front.
+            {
+                const iterator itNewBegin(DoReallocSubarray(n, kSideFront));
+                const iterator itOldBegin(mItBegin);
+                const iterator itPosition(mItBegin + nInsertionIndex); // We need to reset this value because the reallocation above can invalidate iterators.
+
+                if(nInsertionIndex >= (difference_type)n) // If the newly inserted items will be entirely within the old area...
+                {
+                    iterator itUCopyEnd(mItBegin + (difference_type)n);
+
+                    eastl::uninitialized_copy(mItBegin, itUCopyEnd, itNewBegin); // This can throw.
+                    itUCopyEnd = eastl::copy(itUCopyEnd, itPosition, itOldBegin); // Recycle 'itUCopyEnd' to mean something else.
+                    eastl::copy(first, last, itUCopyEnd);
+                }
+                else // Else the newly inserted items are going within the newly allocated area at the front.
+                {
+                    ForwardIterator mid(first);
+
+                    eastl::advance(mid, (difference_type)n - nInsertionIndex);
+                    eastl::uninitialized_copy(mItBegin, itPosition, itNewBegin); // This can throw.
+                    eastl::uninitialized_copy(first, mid, itNewBegin + nInsertionIndex);
+                    eastl::copy(mid, last, itOldBegin);
+                }
+
+                mItBegin = itNewBegin;
+            }
+            else
+            {
+                const iterator        itNewEnd(DoReallocSubarray(n, kSideBack));
+                const iterator        itOldEnd(mItEnd);
+                const difference_type nPushedCount = (difference_type)nSize - nInsertionIndex;
+                const iterator        itPosition(mItEnd - nPushedCount); // We need to reset this value because the reallocation above can invalidate iterators.
+
+                if(nPushedCount > (difference_type)n) // If the newly inserted items will be entirely within the old area...
+                {
+                    const iterator itUCopyEnd(mItEnd - (difference_type)n);
+
+                    eastl::uninitialized_copy(itUCopyEnd, mItEnd, mItEnd); // This can throw.
+                    eastl::copy_backward(itPosition, itUCopyEnd, itOldEnd);
+                    eastl::copy(first, last, itPosition);
+                }
+                else // Else the newly inserted items are going within the newly allocated area at the back.
+                {
+                    ForwardIterator mid(first);
+
+                    eastl::advance(mid, nPushedCount);
+                    const iterator itUCopyEnd(eastl::uninitialized_copy(mid, last, mItEnd)); // This can throw.
+                    eastl::uninitialized_copy(itPosition, mItEnd, itUCopyEnd);
+                    eastl::copy(first, mid, itPosition);
+                }
+
+                mItEnd = itNewEnd;
+            }
+        }
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    void deque<T, Allocator, kDequeSubarraySize>::DoInsertValues(iterator position, size_type n, const value_type& value)
+    {
+        if(position.mpCurrent == mItBegin.mpCurrent)
+        {
+            // Growing never moves elements, so value stays valid even if it is one of ours.
+            const iterator itNewBegin(DoReallocSubarray(n, kSideFront));
+            eastl::uninitialized_fill(itNewBegin, mItBegin, value);
+            mItBegin = itNewBegin;
+        }
+        else if(position.mpCurrent == mItEnd.mpCurrent)
+        {
+            const iterator itNewEnd(DoReallocSubarray(n, kSideBack));
+            eastl::uninitialized_fill(mItEnd, itNewEnd, value);
+            mItEnd = itNewEnd;
+        }
+        else
+        {
+            // Shifting elements would change value if it is one of ours, so copy it.
+            const value_type      valueSaved(value);
+            const difference_type nInsertionIndex = position - mItBegin;
+            const size_type       nSize           = size();
+
+            if(nInsertionIndex < (difference_type)(nSize / 2)) // If the insertion index is in the front half of the deque... grow the deque at the front.
+            {
+                const iterator itNewBegin(DoReallocSubarray(n, kSideFront));
+                const iterator itOldBegin(mItBegin);
+                const iterator itPosition(mItBegin + nInsertionIndex); // We need to reset this value because the reallocation above can invalidate iterators.
+
+                if(nInsertionIndex >= (difference_type)n) // If the newly inserted items will be entirely within the old area...
+                {
+                    iterator itUCopyEnd(mItBegin + (difference_type)n);
+
+                    eastl::uninitialized_copy(mItBegin, itUCopyEnd, itNewBegin); // This can throw.
+                    itUCopyEnd = eastl::copy(itUCopyEnd, itPosition, itOldBegin); // Recycle 'itUCopyEnd' to mean something else.
+                    eastl::fill(itUCopyEnd, itPosition, valueSaved);
+                }
+                else // Else the newly inserted items are going within the newly allocated area at the front.
+                {
+                    eastl::uninitialized_copy(mItBegin, itPosition, itNewBegin); // This can throw.
+                    eastl::uninitialized_fill(itNewBegin + nInsertionIndex, mItBegin, valueSaved);
+                    eastl::fill(itOldBegin, itPosition, valueSaved);
+                }
+
+                mItBegin = itNewBegin;
+            }
+            else
+            {
+                const iterator        itNewEnd(DoReallocSubarray(n, kSideBack));
+                const iterator        itOldEnd(mItEnd);
+                const difference_type nPushedCount = (difference_type)nSize - nInsertionIndex;
+                const iterator        itPosition(mItEnd - nPushedCount); // We need to reset this value because the reallocation above can invalidate iterators.
+
+                if(nPushedCount > (difference_type)n) // If the newly inserted items will be entirely within the old area...
+                {
+                    const iterator itUCopyEnd(mItEnd - (difference_type)n);
+
+                    eastl::uninitialized_copy(itUCopyEnd, mItEnd, mItEnd); // This can throw.
+                    eastl::copy_backward(itPosition, itUCopyEnd, itOldEnd);
+                    eastl::fill(itPosition, itPosition + (difference_type)n, valueSaved);
+                }
+                else // Else the newly inserted items are going within the newly allocated area at the back.
+                {
+                    const iterator itUCopyEnd(mItEnd + ((difference_type)n - nPushedCount));
+
+                    eastl::uninitialized_fill(mItEnd, itUCopyEnd, valueSaved); // This can throw.
+                    eastl::uninitialized_copy(itPosition, mItEnd, itUCopyEnd);
+                    eastl::fill(itPosition, itOldEnd, valueSaved);
+                }
+
+                mItEnd = itNewEnd;
+            }
+        }
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline void deque<T, Allocator, kDequeSubarraySize>::DoDestroyRange(iterator first, iterator last)
+    {
+        if(!has_trivial_destructor<value_type>::value)
+        {
+            for(; first != last; ++first)
+                first->~value_type();
+        }
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline void deque<T, Allocator, kDequeSubarraySize>::DoSwap(this_type& x)
+    {
+        eastl::swap(mpPtrArray,     x.mpPtrArray);
+        eastl::swap(mnPtrArraySize, x.mnPtrArraySize);
+        eastl::swap(mItBegin,       x.mItBegin);
+        eastl::swap(mItEnd,         x.mItEnd);
+    }
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // global operators
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline bool operator==(const deque<T, Allocator, kDequeSubarraySize>& a, const deque<T, Allocator, kDequeSubarraySize>& b)
+    {
+        return ((a.size() == b.size()) && equal(a.begin(), a.end(), b.begin()));
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline bool operator!=(const deque<T, Allocator, kDequeSubarraySize>& a, const deque<T, Allocator, kDequeSubarraySize>& b)
+    {
+        return ((a.size() != b.size()) || !equal(a.begin(), a.end(), b.begin()));
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline bool operator<(const deque<T, Allocator, kDequeSubarraySize>& a, const deque<T, Allocator, kDequeSubarraySize>& b)
+    {
+        return lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline bool operator>(const deque<T, Allocator, kDequeSubarraySize>& a, const deque<T, Allocator, kDequeSubarraySize>& b)
+    {
+        return b < a;
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline bool operator<=(const deque<T, Allocator, kDequeSubarraySize>& a, const deque<T, Allocator, kDequeSubarraySize>& b)
+    {
+        return !(b < a);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline bool operator>=(const deque<T, Allocator, kDequeSubarraySize>& a, const deque<T, Allocator, kDequeSubarraySize>& b)
+    {
+        return !(a < b);
+    }
+
+
+    template <typename T, typename Allocator, unsigned kDequeSubarraySize>
+    inline void swap(deque<T, Allocator, kDequeSubarraySize>& a, deque<T, Allocator, kDequeSubarraySize>& b)
+    {
+        a.swap(b);
+    }
+
+
+} // namespace eastl
+
+
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+
+#endif // Header include guard
@@ -0,0 +1,290 @@
+#ifndef EASTL_EYTZINGER_MAP_H
+#define EASTL_EYTZINGER_MAP_H
+
+#include <EASTL/internal/config.h>
+
+#include <EASTL/allocator.h>
+#include <EASTL/bitset.h>
+#include <EASTL/functional.h>
+#include <EASTL/iterator.h>
+#include <EASTL/utility.h>
+#include <EASTL/vector.h>
+#include <EASTL/vector_map.h>
+
+
+namespace eastl {
+
+namespace detail {
+
+// Nodes of an Eytzinger layout are numbered 1..n in breadth first order:
+// node k has the children 2k and 2k+1 and is stored at index k-1. Node 0
+// stands for the end. These walk the nodes in order.
+template<class SizeType>
+SizeType eytzinger_first(SizeType const n) {
+  SizeType k = n? 1 : 0;
+  while(2 * k <= n && k) k *= 2;
+  return k;
+}
+template<class SizeType>
+SizeType eytzinger_last(SizeType const n) {
+  SizeType k = n? 1 : 0;
+  while(2 * k + 1 <= n && k) k = 2 * k + 1;
+  return k;
+}
+template<class SizeType>
+SizeType eytzinger_next(SizeType k, SizeType const n) {
+  if(2 * k + 1 <= n) {
+    // Leftmost node of the right subtree.
+    k = 2 * k + 1;
+    while(2 * k <= n) k *= 2;
+    return k;
+  }
+  // Climb while k is a right child, then once more.
+  return k >> (::eastl::GetFirstBit(~k) + 1);
+}
+template<class SizeType>
+SizeType eytzinger_prev(SizeType k, SizeType const n) {
+  if(k == 0) return eytzinger_last(n);
+  if(2 * k <= n) {
+    // Rightmost node of the left subtree.
+    k = 2 * k;
+    while(2 * k + 1 <= n) k = 2 * k + 1;
+    return k;
+  }
+  // Climb while k is a left child, then once more.
+  return k >> (::eastl::GetFirstBit(k) + 1);
+}
+
+template<class T, class SizeType>
+class eytzinger_iterator {
+ public:
+  typedef EASTL_ITC_NS::bidirectional_iterator_tag iterator_category;
+  typedef T value_type;
+  typedef ptrdiff_t difference_type;
+  typedef T const* pointer;
+  typedef T const& reference;
+
+  eytzinger_iterator() : m_base(NULL), m_node(0), m_size(0) {}
+  eytzinger_iterator(T const* const base, SizeType const node, SizeType const size)
+      : m_base(base), m_node(node), m_size(size) {}
+
+  reference operator*() const { return m_base[m_node - 1]; }
+  pointer operator->() const { return m_base + (m_node - 1); }
+
+  eytzinger_iterator& operator++() { m_node = eytzinger_next(m_node, m_size); return *this; }
+  eytzinger_iterator operator++(int) { eytzinger_iterator const tmp(*this); ++*this; return tmp; }
+  eytzinger_iterator& operator--() { m_node = eytzinger_prev(m_node, m_size); return *this; }
+  eytzinger_iterator operator--(int) { eytzinger_iterator const tmp(*this); --*this; return tmp; }
+
+  bool operator==(eytzinger_iterator const& rhs) const { return m_node == rhs.m_node; }
+  bool operator!=(eytzinger_iterator const& rhs) const { return m_node != rhs.m_node; }
+
+  /// Index of the element in the underlying layout.
+  SizeType index() const { return m_node - 1; }
+ private:
+  T const* m_base;
+  SizeType m_node;
+  SizeType m_size;
+}; // class eytzinger_iterator
+
+} // namespace detail
+
+/// eytzinger_map
+///
+/// An immutable sorted map for large, read-mostly lookup tables. The
+/// elements are stored in a single vector in Eytzinger (breadth first)
+/// order, so the first steps of every search share a few hot cache lines
+/// and the later ones are prefetched: each step of the search prefetches
+/// the cache line holding the descendants a few levels down, and the
+/// descent has no data dependent branch.
+///
+/// Iteration is in key order, walking the implicit tree (amortized O(1)
+/// per step, though not sequential in memory). The map is built once from
+/// a range; it has no insert or erase, and elements are read only.
+template<class K, class V, class C = ::eastl::less<K>, class A = EASTLAllocatorType>
+class eytzinger_map {
+ public:
+  typedef K key_type;
+  typedef V mapped_type;
+  typedef ::eastl::pair<key_type, mapped_type> value_type;
+  typedef C key_compare;
+  typedef A allocator_type;
+
+  typedef ::eastl::vector<value_type, allocator_type> base_type;
+
+  typedef typename base_type::size_type size_type;
+  typedef typename base_type::difference_type difference_type;
+
+  typedef detail::eytzinger_iterator<value_type, size_type> const_iterator;
+  typedef const_iterator iterator;
+  typedef ::eastl::reverse_iterator<const_iterator> const_reverse_iterator;
+  typedef const_reverse_iterator reverse_iterator;
+
+  typedef typename base_type::const_reference reference;
+  typedef typename base_type::const_reference const_reference;
+  typedef typename base_type::const_pointer pointer;
+  typedef typename base_type::const_pointer const_pointer;
+ private:
+  base_type m_base;
+  detail::compare_impl<value_type, key_compare> m_cmp;
+ public:
+  explicit eytzinger_map(key_compare const& cmp = key_compare(), allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
+      : m_base(alloc), m_cmp(cmp) {}
+  /// Equivalent elements are dropped, keeping the first, as in vector_map.
+  template<class InputIterator>
+  eytzinger_map(InputIterator first, InputIterator last,
+                key_compare const& cmp = key_compare(),
+                allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
+      : m_base(alloc), m_cmp(cmp)
+  { assign(first, last, false); }
+  /// Builds from an already sorted and unique range, such as a vector_map.
+  template<class InputIterator>
+  eytzinger_map(sorted_unique_t, InputIterator first, InputIterator last,
+                key_compare const& cmp = key_compare(),
+                allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
+      : m_base(alloc), m_cmp(cmp)
+  { assign(first, last, true); }
+
+  const_iterator begin() const { return make_iterator(detail::eytzinger_first(size())); }
+  const_iterator end() const { return make_iterator(0); }
+  const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+  const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+  bool empty() const { return m_base.empty(); }
+  size_type size() const { return m_base.size(); }
+  size_type max_size() { return base_type::kMaxSize; }
+
+  void swap(eytzinger_map& other) {
+    m_base.swap(other.m_base);
+    m_cmp.swap(other.m_cmp);
+  }
+
+  allocator_type& get_allocator() { return m_base.get_allocator(); }
+
+  key_compare key_comp() const { return static_cast<key_compare>(m_cmp); }
+
+  const_iterator find(key_type const& k) const {
+    const_iterator const i(lower_bound(k));
+    return (i != end() && m_cmp(k, i->first))? end() : i;
+  }
+  size_type count(key_type const& k) const { return find(k) != end()? 1 : 0; }
+
+  const_iterator lower_bound(key_type const& k) const { return search_lower_bound(k, m_cmp); }
+  const_iterator upper_bound(key_type const& k) const { return search_upper_bound(k, m_cmp); }
+  ::eastl::pair<const_iterator, const_iterator> equal_range(key_type const& k) const {
+    const_iterator const i(lower_bound(k));
+    const_iterator j(i);
+    if(i != end() && !m_cmp(k, i->first)) ++j;
+    return ::eastl::make_pair(i, j);
+  }
+
+  /// Transparent lookup, as with vector_map.
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type find(U const& u) const {
+    const_iterator const i(lower_bound(u));
+    return (i != end() && key_comp()(u, i->first))? end() : i;
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, size_type>::type count(U const& u) const {
+    return find(u) != end()? 1 : 0;
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type lower_bound(U const& u) const {
+    return search_lower_bound(u, key_comp());
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type upper_bound(U const& u) const {
+    return search_upper_bound(u, key_comp());
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, ::eastl::pair<const_iterator, const_iterator> >::type equal_range(U const& u) const {
+    const_iterator const i(lower_bound(u));
+    const_iterator j(i);
+    if(i != end() && !key_comp()(u, i->first)) ++j;
+    return ::eastl::make_pair(i, j);
+  }
+
+  /// The elements in storage (Eytzinger) order.
+  base_type const& base() const { return m_base; }
+
+  bool validate() const {
+    for(const_iterator i(begin()), j(i); i != end(); j = i++)
+      if(j != i && !m_cmp(*j, *i)) return false;
+    return true;
+  }
+ private:
+  const_iterator make_iterator(size_type const node) const
+  { return const_iterator(m_base.data(), node, size()); }
+
+  // The descendants of node k some levels down are adjacent: the m nodes
+  // [mk, mk+m) for m = 2^levels. m is chosen so that they fit in a cache
+  // line, which the search prefetches that many steps before it needs it.
+  enum {
+    kPrefetchNodes = sizeof(value_type) <= 4? 16 : sizeof(value_type) <= 8? 8 :
+                     sizeof(value_type) <= 16? 4 : sizeof(value_type) <= 32? 2 : 1
+  };
+
+  // Computed without pointer arithmetic since the address may be past the end.
+  void const* prefetch_address(size_type const node) const {
+    return reinterpret_cast<void const*>(reinterpret_cast<uintptr_t>(m_base.data()) +
+                                         (node * kPrefetchNodes - 1) * sizeof(value_type));
+  }
+
+  // cmp compares a key with k in either order: m_cmp for a key_type, or
+  // a transparent key_compare for anything it compares keys with.
+  template<class U, class Compare2>
+  const_iterator search_lower_bound(U const& k, Compare2 const& cmp) const {
+    value_type const* const p = m_base.data();
+    size_type const n = size();
+    size_type i = 1;
+    while(i <= n) {
+      EASTL_PREFETCH(prefetch_address(i));
+      i = 2 * i + size_type(cmp(p[i - 1].first, k)); // right if p[i] < k
+    }
+    // The answer is the last node where the search went left.
+    return make_iterator(i >> (::eastl::GetFirstBit(~i) + 1));
+  }
+  template<class U, class Compare2>
+  const_iterator search_upper_bound(U const& k, Compare2 const& cmp) const {
+    value_type const* const p = m_base.data();
+    size_type const n = size();
+    size_type i = 1;
+    while(i <= n) {
+      EASTL_PREFETCH(prefetch_address(i));
+      i = 2 * i + size_type(!cmp(k, p[i - 1].first)); // right if p[i] <= k
+    }
+    return make_iterator(i >> (::eastl::GetFirstBit(~i) + 1));
+  }
+
+  template<class InputIterator>
+  void assign(InputIterator first, InputIterator last, bool const is_sorted_unique) {
+    base_type sorted(m_base.get_allocator());
+    sorted.insert(sorted.end(), first, last);
+    detail::merge_sorted_tail(sorted, 0, m_cmp, is_sorted_unique, true);
+
+    // Lay the sorted elements out by walking the nodes in order.
+    size_type const n = sorted.size();
+    m_base.assign(sorted.begin(), sorted.end());
+    size_type k = detail::eytzinger_first(n);
+    for(size_type i = 0; i < n; ++i, k = detail::eytzinger_next(k, n))
+      m_base[k - 1] = sorted[i];
+  }
+}; // class eytzinger_map
+
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator==(eytzinger_map<Key, T, Compare, Allocator> const& lhs,
+                       eytzinger_map<Key, T, Compare, Allocator> const& rhs)
+{ return lhs.base() == rhs.base(); }
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator!=(eytzinger_map<Key, T, Compare, Allocator> const& lhs,
+                       eytzinger_map<Key, T, Compare, Allocator> const& rhs)
+{ return lhs.base() != rhs.base(); }
+
+template<class Key, class T, class Compare, class Allocator>
+void swap(eytzinger_map<Key, T, Compare, Allocator>& lhs,
+          eytzinger_map<Key, T, Compare, Allocator>& rhs)
+{ lhs.swap(rhs); }
+
+} // namespace eastl
+
+#endif // EASTL_EYTZINGER_MAP_H
@@ -68,6 +68,19 @@ namespace eastl
 
 
 
+    /// string_local_size
+    ///
+    /// A fixed_string keeps its characters in its own buffer, so the local
+    /// buffer of the basic_string it derives from would go unused.
+    ///
+    template <size_t nodeSize, size_t nodeCount, size_t nodeAlignment, size_t nodeAlignmentOffset, bool bEnableOverflow, typename Allocator>
+    struct string_local_size<fixed_vector_allocator<nodeSize, nodeCount, nodeAlignment, nodeAlignmentOffset, bEnableOverflow, Allocator> >
+    {
+        static const size_t value = 0;
+    };
+
+
+
     /// fixed_string
     ///
     /// A fixed_string with bEnableOverflow == true is identical to a regular 
@@ -262,6 +262,50 @@ namespace eastl
 
 
 
+    ///////////////////////////////////////////////////////////////////////
+    // is_transparent_comparison
+    //
+    // A comparison or hash functor that declares a nested is_transparent type
+    // promises that it accepts arguments other than the container's key_type
+    // (e.g. less<string> compares a string against a string_view or a char
+    // pointer). Containers use this trait to enable find, count, lower_bound
+    // and equal_range overloads that take such arguments without first
+    // constructing a key_type.
+    //
+    // Example usage:
+    //    struct StringLess { typedef int is_transparent; bool operator()(string_view a, string_view b) const; };
+    //    is_transparent_comparison<StringLess>::value == true
+    //
+    template <typename T>
+    struct is_transparent_comparison_helper
+    {
+        template <typename U> static yes_type Test(typename U::is_transparent*);
+        template <typename U> static no_type  Test(...);
+
+        static const bool value = (sizeof(Test<T>(0)) == sizeof(yes_type));
+    };
+
+    template <typename T>
+    struct is_transparent_comparison : public integral_constant<bool, is_transparent_comparison_helper<T>::value>{};
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // enable_if_transparent
+    //
+    // Defines 'type' as Result if Compare (and Compare2, if given) is 
+    // transparent. It's used for the return type of the container member
+    // function templates that take a U which isn't the key_type. Naming U
+    // makes the return type depend on the function's own template parameter,
+    // so the function is dropped from overload resolution instead of being an 
+    // error when the container is instantiated with a comparison that isn't
+    // transparent.
+    //
+    template <typename Compare, typename U, typename Result, typename Compare2 = Compare>
+    struct enable_if_transparent 
+        : public enable_if<is_transparent_comparison<Compare>::value && is_transparent_comparison<Compare2>::value, Result>{};
+
+
+
 
     /// unary_negate
     ///
@@ -820,6 +864,26 @@ namespace eastl
         { size_t operator()(long double val) const { return static_cast<size_t>(val); } };
 
 
+    /// hash_mix
+    ///
+    /// Mixes the bits of a hash value so that every bit of the result depends
+    /// on every bit of the input (this is the MurmurHash3 finalizer). The hash
+    /// specializations above return integers unchanged, which suits a hashtable
+    /// with a prime bucket count, but not structures like bloom_filter and
+    /// cuckoo_filter that take an index and a fingerprint from different bits
+    /// of the hash.
+    ///
+    inline uint64_t hash_mix(uint64_t x)
+    {
+        x ^= x >> 33;
+        x *= UINT64_C(0xff51afd7ed558ccd);
+        x ^= x >> 33;
+        x *= UINT64_C(0xc4ceb9fe1a85ec53);
+        x ^= x >> 33;
+        return x;
+    }
+
+
     ///////////////////////////////////////////////////////////////////////////
     // string hashes
     //
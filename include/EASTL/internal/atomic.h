@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/internal/atomic.h
+//
+// Implements the few atomic operations EASTL needs for reference counts,
+// spin locks and lazily allocated arrays.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL doesn't depend on <atomic> or a threading library, so shared
+// representations such as string_cow's count their references with these
+// wrappers around the compiler's intrinsics. Increment and decrement are
+// full barriers, so a thread which decrements a count to zero sees every
+// other thread's accesses made before its own decrement and may free the
+// object. AtomicLoadAcquire lets a thread which finds a count of one
+// modify the object, having seen the accesses of the threads which
+// released their references. AtomicCompareAndSwap is also a full barrier,
+// and with AtomicStoreRelease and ThreadYield makes a spin lock.
+//
+// Example usage:
+//    if(AtomicDecrement(&pRep->mnRefCount) == 0)
+//        FreeRep(pRep);
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_INTERNAL_ATOMIC_H
+#define EASTL_INTERNAL_ATOMIC_H
+
+
+#include <EASTL/internal/config.h>
+
+#if defined(_MSC_VER)
+    #pragma warning(push, 0)
+    #include <intrin.h>
+    #pragma warning(pop)
+#endif
+
+#if defined(EA_PLATFORM_WINDOWS)
+    extern "C" __declspec(dllimport) int __stdcall SwitchToThread(); // From <windows.h>, which is too large to include here.
+#elif defined(EA_PLATFORM_UNIX)
+    #include <sched.h>
+#endif
+
+
+
+namespace eastl
+{
+
+    /// AtomicIncrement
+    ///
+    /// Adds one to *p and returns the new value.
+    ///
+    inline int32_t AtomicIncrement(volatile int32_t* p)
+    {
+        #if defined(_MSC_VER)
+            return (int32_t)_InterlockedIncrement((volatile long*)p);
+        #else
+            return __sync_add_and_fetch(p, 1);
+        #endif
+    }
+
+
+    /// AtomicDecrement
+    ///
+    /// Subtracts one from *p and returns the new value.
+    ///
+    inline int32_t AtomicDecrement(volatile int32_t* p)
+    {
+        #if defined(_MSC_VER)
+            return (int32_t)_InterlockedDecrement((volatile long*)p);
+        #else
+            return __sync_sub_and_fetch(p, 1);
+        #endif
+    }
+
+
+    /// AtomicLoadAcquire
+    ///
+    /// Returns *p, ordered before any memory access which follows it.
+    ///
+    inline int32_t AtomicLoadAcquire(const volatile int32_t* p)
+    {
+        #if defined(__ATOMIC_ACQUIRE) // GCC 4.7+ and Clang.
+            return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+        #elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+            const int32_t n = *p; // x86 loads are acquires; the barrier stops the compiler reordering.
+            _ReadWriteBarrier();
+            return n;
+        #elif defined(_MSC_VER)
+            return (int32_t)_InterlockedCompareExchange((volatile long*)p, 0, 0);
+        #else
+            return __sync_fetch_and_add(const_cast<volatile int32_t*>(p), 0);
+        #endif
+    }
+
+
+    /// AtomicStoreRelease
+    ///
+    /// Sets *p to n, ordered after any memory access which precedes it.
+    ///
+    inline void AtomicStoreRelease(volatile int32_t* p, int32_t n)
+    {
+        #if defined(__ATOMIC_RELEASE)
+            __atomic_store_n(p, n, __ATOMIC_RELEASE);
+        #elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+            _ReadWriteBarrier(); // x86 stores are releases.
+            *p = n;
+        #elif defined(_MSC_VER)
+            _InterlockedExchange((volatile long*)p, (long)n);
+        #else
+            __sync_synchronize();
+            *p = n;
+        #endif
+    }
+
+
+    /// AtomicCompareAndSwap
+    ///
+    /// Sets *p to desired if it equals expected, and returns whether it did.
+    ///
+    inline bool AtomicCompareAndSwap(volatile int32_t* p, int32_t expected, int32_t desired)
+    {
+        #if defined(_MSC_VER)
+            return _InterlockedCompareExchange((volatile long*)p, (long)desired, (long)expected) == (long)expected;
+        #else
+            return __sync_bool_compare_and_swap(p, expected, desired);
+        #endif
+    }
+
+    template <typename T>
+    inline bool AtomicCompareAndSwap(T* volatile* p, T* expected, T* desired)
+    {
+        #if defined(_MSC_VER)
+            return _InterlockedCompareExchangePointer((void* volatile*)p, (void*)desired, (void*)expected) == (void*)expected;
+        #else
+            return __sync_bool_compare_and_swap(p, expected, desired);
+        #endif
+    }
+
+
+    /// AtomicLoadAcquire
+    ///
+    /// Returns the pointer *p, ordered before any memory access which follows it.
+    ///
+    template <typename T>
+    inline T* AtomicLoadAcquire(T* const volatile* p)
+    {
+        #if defined(__ATOMIC_ACQUIRE)
+            return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+        #elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+            T* const pResult = *p;
+            _ReadWriteBarrier();
+            return pResult;
+        #elif defined(_MSC_VER)
+            return (T*)_InterlockedCompareExchangePointer((void* volatile*)p, NULL, NULL);
+        #else
+            return __sync_val_compare_and_swap(const_cast<T* volatile*>(p), (T*)NULL, (T*)NULL);
+        #endif
+    }
+
+
+    /// ThreadYield
+    ///
+    /// Lets another thread run, so that a spin lock whose holder was preempted
+    /// doesn't spin for the rest of its time slice. Does nothing on platforms
+    /// without a scheduler call.
+    ///
+    inline void ThreadYield()
+    {
+        #if defined(EA_PLATFORM_WINDOWS)
+            SwitchToThread();
+        #elif defined(EA_PLATFORM_UNIX)
+            sched_yield();
+        #endif
+    }
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -0,0 +1,490 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/internal/char_search.h
+//
+// Implements the character search loops used by basic_string,
+// basic_string_view and find_first_of.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Each function here is a template written as a plain loop, plus a non-
+// template overload for char which examines a whole SIMD register of
+// characters per step where EASTL_SSE2 or EASTL_AVX2 is enabled. Calls
+// with char pointers pick the overload; calling the template explicitly,
+// as in CharFind<char>(...), gets the plain loop.
+//    - CharFind:           memchr. Tests four registers of characters per
+//                          step until one holds a match.
+//    - CharFindLast:       memrchr, likewise backwards.
+//    - CharSearch:         finds a substring. Candidate positions are those
+//                          where both the first and last characters of the
+//                          pattern match, found a register at a time; only
+//                          those are compared with memcmp.
+//    - CharFindFirstOf:    strpbrk, and its complement CharFindFirstNotOf.
+//                          With EASTL_SSSE3 the set is held as a table of
+//                          256 bits indexed by a character's two nibbles,
+//                          which pshufb looks up for a register of
+//                          characters at once. Otherwise sets of up to 16
+//                          characters are compared one set character per
+//                          instruction, and larger ones with a bool table.
+// Ranges shorter than a register use the plain loop. Longer ones finish
+// with a final register ending exactly at the end of the range, which
+// overlaps characters already examined, rather than with a scalar tail.
+//
+// The choice is made at compile time from the instruction sets the
+// compiler is generating code for; build with -mavx2 (or /arch:AVX2) to
+// get the 32 character versions.
+//
+// Example usage:
+//    const char* pComma = eastl::CharFind(pLine, pLineEnd, ',');
+//    const char* pSpace = eastl::CharFindFirstOf(pLine, pLineEnd, " \t\r\n", " \t\r\n" + 4);
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_INTERNAL_CHAR_SEARCH_H
+#define EASTL_INTERNAL_CHAR_SEARCH_H
+
+
+#include <EASTL/internal/config.h>
+#include <stddef.h>
+#include <string.h>
+
+#if EASTL_SSE2 && defined(_MSC_VER)
+    #pragma warning(push, 0)
+    #include <intrin.h>
+    #pragma warning(pop)
+#endif
+
+#if EASTL_AVX2
+    #include <immintrin.h>
+#elif EASTL_SSSE3
+    #include <tmmintrin.h>
+#elif EASTL_SSE2
+    #include <emmintrin.h>
+#endif
+
+
+
+namespace eastl
+{
+
+    /// CharFind
+    ///
+    /// Returns the first position in [p, pEnd) holding c, or pEnd.
+    ///
+    template <typename T>
+    inline const T* CharFind(const T* p, const T* pEnd, T c)
+    {
+        for(; p != pEnd; ++p)
+        {
+            if(*p == c)
+                return p;
+        }
+        return pEnd;
+    }
+
+
+    /// CharFindLast
+    ///
+    /// Returns the last position in [pBegin, pEnd) holding c, or pEnd.
+    ///
+    template <typename T>
+    inline const T* CharFindLast(const T* pBegin, const T* pEnd, T c)
+    {
+        for(const T* p = pEnd; p != pBegin; )
+        {
+            if(*--p == c)
+                return p;
+        }
+        return pEnd;
+    }
+
+
+    /// CharSearch
+    ///
+    /// Returns the first position in [p1Begin, p1End) at which [p2Begin, p2End)
+    /// occurs, or p1End. An empty pattern is found at p1Begin.
+    ///
+    template <typename T>
+    const T* CharSearch(const T* p1Begin, const T* p1End, const T* p2Begin, const T* p2End)
+    {
+        const ptrdiff_t n = (p2End - p2Begin);
+
+        if(n == 0)
+            return p1Begin;
+
+        while((p1End - p1Begin) >= n)
+        {
+            const T* const pLast = (p1End - (n - 1));
+
+            p1Begin = CharFind<T>(p1Begin, pLast, *p2Begin);
+            if(p1Begin == pLast)
+                break;
+
+            ptrdiff_t i = 1;
+            while((i < n) && (p1Begin[i] == p2Begin[i]))
+                ++i;
+            if(i == n)
+                return p1Begin;
+
+            ++p1Begin;
+        }
+        return p1End;
+    }
+
+
+    /// CharFindFirstOf
+    ///
+    /// Returns the first position in [p1Begin, p1End) holding any of the
+    /// characters in [p2Begin, p2End), or p1End.
+    ///
+    template <typename T>
+    const T* CharFindFirstOf(const T* p1Begin, const T* p1End, const T* p2Begin, const T* p2End)
+    {
+        for(; p1Begin != p1End; ++p1Begin)
+        {
+            for(const T* pTemp = p2Begin; pTemp != p2End; ++pTemp)
+            {
+                if(*p1Begin == *pTemp)
+                    return p1Begin;
+            }
+        }
+        return p1End;
+    }
+
+
+    /// CharFindFirstNotOf
+    ///
+    /// Returns the first position in [p1Begin, p1End) holding none of the
+    /// characters in [p2Begin, p2End), or p1End.
+    ///
+    template <typename T>
+    const T* CharFindFirstNotOf(const T* p1Begin, const T* p1End, const T* p2Begin, const T* p2End)
+    {
+        for(; p1Begin != p1End; ++p1Begin)
+        {
+            const T* pTemp;
+            for(pTemp = p2Begin; pTemp != p2End; ++pTemp)
+            {
+                if(*p1Begin == *pTemp)
+                    break;
+            }
+            if(pTemp == p2End)
+                return p1Begin;
+        }
+        return p1End;
+    }
+
+
+
+    #if EASTL_SSE2
+
+        namespace Internal
+        {
+            // A register of characters, and the operations on it the searches need.
+            // Comparisons return a bit per character, with the first character's
+            // in bit 0.
+            #if EASTL_AVX2
+                typedef __m256i char_block;
+
+                const ptrdiff_t kCharBlockSize = 32;
+                const uint32_t  kCharBlockMask = 0xffffffff;
+
+                inline char_block CharBlockLoad(const char* p)                 { return _mm256_loadu_si256((const __m256i*)p); }
+                inline char_block CharBlockSplat(char c)                       { return _mm256_set1_epi8(c); }
+                inline char_block CharBlockCompare(char_block a, char_block b) { return _mm256_cmpeq_epi8(a, b); }
+                inline char_block CharBlockOr(char_block a, char_block b)      { return _mm256_or_si256(a, b); }
+                inline uint32_t   CharBlockMask(char_block a)                  { return (uint32_t)_mm256_movemask_epi8(a); }
+            #else
+                typedef __m128i char_block;
+
+                const ptrdiff_t kCharBlockSize = 16;
+                const uint32_t  kCharBlockMask = 0xffff;
+
+                inline char_block CharBlockLoad(const char* p)                 { return _mm_loadu_si128((const __m128i*)p); }
+                inline char_block CharBlockSplat(char c)                       { return _mm_set1_epi8(c); }
+                inline char_block CharBlockCompare(char_block a, char_block b) { return _mm_cmpeq_epi8(a, b); }
+                inline char_block CharBlockOr(char_block a, char_block b)      { return _mm_or_si128(a, b); }
+                inline uint32_t   CharBlockMask(char_block a)                  { return (uint32_t)_mm_movemask_epi8(a); }
+            #endif
+
+            inline uint32_t CharBlockEqual(char_block a, char_block b) { return CharBlockMask(CharBlockCompare(a, b)); }
+
+            // Returns whether any of the four blocks from p holds c (splatted in v).
+            inline bool CharBlockAny4(const char* p, char_block v)
+            {
+                const char_block m01 = CharBlockOr(CharBlockCompare(CharBlockLoad(p),                      v),
+                                                   CharBlockCompare(CharBlockLoad(p +     kCharBlockSize), v));
+                const char_block m23 = CharBlockOr(CharBlockCompare(CharBlockLoad(p + 2 * kCharBlockSize), v),
+                                                   CharBlockCompare(CharBlockLoad(p + 3 * kCharBlockSize), v));
+                return CharBlockMask(CharBlockOr(m01, m23)) != 0;
+            }
+
+            // The index of the lowest and highest set bits of a nonzero mask.
+            inline ptrdiff_t CharBlockFirst(uint32_t mask)
+            {
+                #if defined(_MSC_VER)
+                    unsigned long n;
+                    _BitScanForward(&n, mask);
+                    return (ptrdiff_t)n;
+                #else
+                    return (ptrdiff_t)__builtin_ctz(mask);
+                #endif
+            }
+
+            inline ptrdiff_t CharBlockLast(uint32_t mask)
+            {
+                #if defined(_MSC_VER)
+                    unsigned long n;
+                    _BitScanReverse(&n, mask);
+                    return (ptrdiff_t)n;
+                #else
+                    return (ptrdiff_t)(31 - __builtin_clz(mask));
+                #endif
+            }
+
+
+            #if EASTL_SSSE3
+
+                // CharClass
+                // A set of characters as 256 bits. Character u is bit ((u >> 4) & 7) of
+                // byte (u & 15) of mLow if u < 128 and of mHigh otherwise, so that a
+                // character's low nibble selects its byte with a shuffle, and its high
+                // nibble selects the bit and the table with another.
+                struct CharClass
+                {
+                    char_block mLow;
+                    char_block mHigh;
+
+                    CharClass(const char* p, const char* pEnd)
+                    {
+                        unsigned char low[16]  = { 0 };
+                        unsigned char high[16] = { 0 };
+
+                        for(; p != pEnd; ++p)
+                        {
+                            const unsigned char u = (unsigned char)*p;
+                            (u & 0x80 ? high : low)[u & 0x0f] |= (unsigned char)(1 << ((u >> 4) & 7));
+                        }
+
+                        #if EASTL_AVX2
+                            mLow  = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)low));
+                            mHigh = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)high));
+                        #else
+                            mLow  = _mm_loadu_si128((const __m128i*)low);
+                            mHigh = _mm_loadu_si128((const __m128i*)high);
+                        #endif
+                    }
+
+                    uint32_t Match(char_block v) const
+                    {
+                        #if EASTL_AVX2
+                            const __m256i nibble  = _mm256_set1_epi8(0x0f);
+                            const __m256i bits    = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+                                                                     1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+                            const __m256i lo      = _mm256_and_si256(v, nibble);
+                            const __m256i hi      = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble);
+                            const __m256i bHigh   = _mm256_cmpgt_epi8(hi, _mm256_set1_epi8(7));
+                            const __m256i row     = _mm256_or_si256(_mm256_and_si256(bHigh, _mm256_shuffle_epi8(mHigh, lo)),
+                                                                    _mm256_andnot_si256(bHigh, _mm256_shuffle_epi8(mLow, lo)));
+                            const __m256i bit     = _mm256_shuffle_epi8(bits, hi);
+                            return CharBlockEqual(_mm256_and_si256(row, bit), bit);
+                        #else
+                            const __m128i nibble  = _mm_set1_epi8(0x0f);
+                            const __m128i bits    = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+                            const __m128i lo      = _mm_and_si128(v, nibble);
+                            const __m128i hi      = _mm_and_si128(_mm_srli_epi16(v, 4), nibble);
+                            const __m128i bHigh   = _mm_cmpgt_epi8(hi, _mm_set1_epi8(7));
+                            const __m128i row     = _mm_or_si128(_mm_and_si128(bHigh, _mm_shuffle_epi8(mHigh, lo)),
+                                                                 _mm_andnot_si128(bHigh, _mm_shuffle_epi8(mLow, lo)));
+                            const __m128i bit     = _mm_shuffle_epi8(bits, hi);
+                            return CharBlockEqual(_mm_and_si128(row, bit), bit);
+                        #endif
+                    }
+                };
+
+                const ptrdiff_t kCharClassMaxSize = 256;
+
+            #else
+
+                // CharClass
+                // A set of up to kCharClassMaxSize characters, compared one at a time.
+                const ptrdiff_t kCharClassMaxSize = 16;
+
+                struct CharClass
+                {
+                    char_block mChar[kCharClassMaxSize];
+                    ptrdiff_t  mSize;
+
+                    CharClass(const char* p, const char* pEnd)
+                        : mSize(pEnd - p)
+                    {
+                        for(ptrdiff_t i = 0; i < mSize; ++i)
+                            mChar[i] = _mm_set1_epi8(p[i]);
+                    }
+
+                    uint32_t Match(char_block v) const
+                    {
+                        __m128i result = _mm_cmpeq_epi8(v, mChar[0]);
+                        for(ptrdiff_t i = 1; i < mSize; ++i)
+                            result = _mm_or_si128(result, _mm_cmpeq_epi8(v, mChar[i]));
+                        return (uint32_t)_mm_movemask_epi8(result);
+                    }
+                };
+
+            #endif
+
+
+            // CharFindClass
+            // Returns the first position in [p, pEnd) whose membership of the
+            // set is the opposite of bNot, where (pEnd - p) >= kCharBlockSize.
+            inline const char* CharFindClass(const char* p, const char* pEnd, const CharClass& charClass, bool bNot)
+            {
+                const uint32_t flip = bNot ? kCharBlockMask : 0;
+                uint32_t mask;
+
+                for(; (pEnd - p) > kCharBlockSize; p += kCharBlockSize)
+                {
+                    if((mask = (charClass.Match(CharBlockLoad(p)) ^ flip)) != 0)
+                        return p + CharBlockFirst(mask);
+                }
+
+                p    = (pEnd - kCharBlockSize);
+                mask = (charClass.Match(CharBlockLoad(p)) ^ flip);
+                return mask ? (p + CharBlockFirst(mask)) : pEnd;
+            }
+
+            // CharFindTable
+            // As CharFindClass, for sets too large for CharClass.
+            inline const char* CharFindTable(const char* p1Begin, const char* p1End, const char* p2Begin, const char* p2End, bool bNot)
+            {
+                bool table[256] = { false };
+
+                for(; p2Begin != p2End; ++p2Begin)
+                    table[(unsigned char)*p2Begin] = true;
+
+                for(; p1Begin != p1End; ++p1Begin)
+                {
+                    if(table[(unsigned char)*p1Begin] != bNot)
+                        return p1Begin;
+                }
+                return p1End;
+            }
+
+        } // namespace Internal
+
+
+
+        inline const char* CharFind(const char* p, const char* pEnd, char c)
+        {
+            using namespace Internal;
+
+            if((pEnd - p) < kCharBlockSize)
+                return CharFind<char>(p, pEnd, c);
+
+            const char_block v = CharBlockSplat(c);
+            uint32_t mask;
+
+            // Skip four blocks at a time while none holds c, then find it a block at a time.
+            while(((pEnd - p) > (4 * kCharBlockSize)) && !CharBlockAny4(p, v))
+                p += (4 * kCharBlockSize);
+
+            for(; (pEnd - p) > kCharBlockSize; p += kCharBlockSize)
+            {
+                if((mask = CharBlockEqual(CharBlockLoad(p), v)) != 0)
+                    return p + CharBlockFirst(mask);
+            }
+
+            p    = (pEnd - kCharBlockSize);
+            mask = CharBlockEqual(CharBlockLoad(p), v);
+            return mask ? (p + CharBlockFirst(mask)) : pEnd;
+        }
+
+
+        inline const char* CharFindLast(const char* pBegin, const char* pEnd, char c)
+        {
+            using namespace Internal;
+
+            if((pEnd - pBegin) < kCharBlockSize)
+                return CharFindLast<char>(pBegin, pEnd, c);
+
+            const char_block v = CharBlockSplat(c);
+            const char*      p = pEnd;
+            uint32_t         mask;
+
+            while(((p - pBegin) > (4 * kCharBlockSize)) && !CharBlockAny4(p - (4 * kCharBlockSize), v))
+                p -= (4 * kCharBlockSize);
+
+            while((p - pBegin) > kCharBlockSize)
+            {
+                p -= kCharBlockSize;
+                if((mask = CharBlockEqual(CharBlockLoad(p), v)) != 0)
+                    return p + CharBlockLast(mask);
+            }
+
+            mask = CharBlockEqual(CharBlockLoad(pBegin), v);
+            return mask ? (pBegin + CharBlockLast(mask)) : pEnd;
+        }
+
+
+        inline const char* CharSearch(const char* p1Begin, const char* p1End, const char* p2Begin, const char* p2End)
+        {
+            using namespace Internal;
+
+            const ptrdiff_t n = (p2End - p2Begin);
+
+            if(n <= 1)
+                return n ? CharFind(p1Begin, p1End, *p2Begin) : p1Begin;
+            if((p1End - p1Begin) < (kCharBlockSize + n - 1))
+                return CharSearch<char>(p1Begin, p1End, p2Begin, p2End);
+
+            const char_block vFirst = CharBlockSplat(p2Begin[0]);
+            const char_block vLast  = CharBlockSplat(p2Begin[n - 1]);
+            const char*      p      = p1Begin;
+
+            // Each step tests the kCharBlockSize positions from p, reading as far as the
+            // last character of a pattern at the last of them.
+            for(; (p1End - p) >= (kCharBlockSize + n - 1); p += kCharBlockSize)
+            {
+                uint32_t mask = CharBlockEqual(CharBlockLoad(p), vFirst) & CharBlockEqual(CharBlockLoad(p + n - 1), vLast);
+
+                for(; mask; mask &= (mask - 1))
+                {
+                    const char* const pCandidate = (p + CharBlockFirst(mask));
+
+                    if(memcmp(pCandidate + 1, p2Begin + 1, (size_t)(n - 2)) == 0)
+                        return pCandidate;
+                }
+            }
+
+            return CharSearch<char>(p, p1End, p2Begin, p2End);
+        }
+
+
+        inline const char* CharFindFirstOf(const char* p1Begin, const char* p1End, const char* p2Begin, const char* p2End)
+        {
+            using namespace Internal;
+
+            if(((p1End - p1Begin) < kCharBlockSize) || (p2Begin == p2End))
+                return CharFindFirstOf<char>(p1Begin, p1End, p2Begin, p2End);
+            if((p2End - p2Begin) > kCharClassMaxSize)
+                return CharFindTable(p1Begin, p1End, p2Begin, p2End, false);
+            return CharFindClass(p1Begin, p1End, CharClass(p2Begin, p2End), false);
+        }
+
+
+        inline const char* CharFindFirstNotOf(const char* p1Begin, const char* p1End, const char* p2Begin, const char* p2End)
+        {
+            using namespace Internal;
+
+            if(((p1End - p1Begin) < kCharBlockSize) || (p2Begin == p2End))
+                return CharFindFirstNotOf<char>(p1Begin, p1End, p2Begin, p2End);
+            if((p2End - p2Begin) > kCharClassMaxSize)
+                return CharFindTable(p1Begin, p1End, p2Begin, p2End, true);
+            return CharFindClass(p1Begin, p1End, CharClass(p2Begin, p2End), true);
+        }
+
+    #endif // EASTL_SSE2
+
+} // namespace eastl
+
+
+#endif // Header include guard
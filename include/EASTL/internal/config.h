@@ -722,6 +722,27 @@ namespace eastl
 
 
 
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_BITSET_INTRINSICS_ENABLED
+//
+// Defined as 0 or 1. Default is 1 for GCC 3.4+, Clang and VC++ 2005+.
+// Controls whether the bit counting and scanning functions in bitset.h
+// (BitsetCountBits, GetFirstBit, GetLastBit) use compiler intrinsics such
+// as __builtin_ctzll and _BitScanForward64 instead of portable code.
+// Population count uses the popcnt instruction only if the compiler is
+// generating code for it (e.g. -mpopcnt or /arch:AVX), as the library
+// call it otherwise becomes is slower than the portable code.
+//
+#ifndef EASTL_BITSET_INTRINSICS_ENABLED
+    #if (defined(__GNUC__) && (((__GNUC__ * 100) + __GNUC_MINOR__) >= 304) && !defined(__SNC__)) || defined(__clang__) || (defined(_MSC_VER) && (_MSC_VER >= 1400))
+        #define EASTL_BITSET_INTRINSICS_ENABLED 1
+    #else
+        #define EASTL_BITSET_INTRINSICS_ENABLED 0
+    #endif
+#endif
+
+
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // EASTL_LIST_SIZE_CACHE
@@ -974,6 +995,70 @@ namespace eastl
 
 
 
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_PREFETCH
+//
+// Defined as a macro which hints to the processor that the memory at the
+// given address will soon be read, so that it can start loading it into
+// the cache. The address need not be valid; prefetching doesn't fault.
+// Defined as nothing for compilers which have no prefetch intrinsic.
+//
+// Example usage:
+//    EASTL_PREFETCH(pNode->mpNext);
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef EASTL_PREFETCH
+    #if defined(__GNUC__) && (__GNUC__ >= 3)
+        #define EASTL_PREFETCH(p) __builtin_prefetch((const void*)(p))
+    #elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+        #include <xmmintrin.h>
+        #define EASTL_PREFETCH(p) _mm_prefetch((const char*)(p), _MM_HINT_T0)
+    #else
+        #define EASTL_PREFETCH(p)
+    #endif
+#endif
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_SSE2 / EASTL_SSSE3 / EASTL_AVX2
+//
+// Defined as 0 or 1. Specify whether code may use the SSE2, SSSE3 and AVX2
+// instruction sets through <emmintrin.h>, <tmmintrin.h> and <immintrin.h>.
+// They are enabled when the compiler is generating code for them anyway
+// (e.g. SSE2 is part of every x86-64 target, SSSE3 needs -mssse3 and AVX2
+// needs -mavx2 or /arch:AVX2). Code using them must also have a portable
+// fallback.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef EASTL_SSE2
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define EASTL_SSE2 1
+    #else
+        #define EASTL_SSE2 0
+    #endif
+#endif
+
+#ifndef EASTL_SSSE3
+    #if defined(__SSSE3__) || defined(__AVX2__)
+        #define EASTL_SSSE3 1
+    #else
+        #define EASTL_SSSE3 0
+    #endif
+#endif
+
+#ifndef EASTL_AVX2
+    #if defined(__AVX2__)
+        #define EASTL_AVX2 1
+    #else
+        #define EASTL_AVX2 0
+    #endif
+#endif
+
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // EASTL_MINMAX_ENABLED
 //
@@ -1181,6 +1266,21 @@ typedef EASTL_SSIZE_T eastl_ssize_t; // Signed version of eastl_size_t. Concept
     #define EASTLAllocatorType eastl::allocator
 #endif
 
+// EASTL_ALLOCATOR_USABLE_SIZE
+//
+// Evaluates to the number of usable bytes in the block p, which was returned 
+// by the default allocator for a request of n bytes. It is used to implement 
+// allocator::allocate_at_least, which lets containers use all of the space 
+// the heap actually hands back. By default we know nothing of the heap behind 
+// operator new[] and so simply return n. If your operator new[] is implemented 
+// with a heap that reports block sizes you can define this accordingly, 
+// for example for glibc's malloc: 
+//     #define EASTL_ALLOCATOR_USABLE_SIZE(p, n) malloc_usable_size(p)
+//
+#ifndef EASTL_ALLOCATOR_USABLE_SIZE
+    #define EASTL_ALLOCATOR_USABLE_SIZE(p, n) (n)
+#endif
+
 #ifndef EASTLAllocatorDefault
     // EASTLAllocatorDefault returns the default allocator instance. This is not a global 
     // allocator which implements all container allocations but is the allocator that is 
@@ -1195,6 +1195,16 @@ namespace eastl
                 mOverflowAllocator.deallocate(p, n); // Can't do this to our own allocation.
         }
 
+        allocation_result allocate_at_least(size_t n, int /*flags*/ = 0)
+        {
+            return allocate_memory_at_least(mOverflowAllocator, n, 1, 0);
+        }
+
+        allocation_result allocate_at_least(size_t n, size_t alignment, size_t offset, int /*flags*/ = 0)
+        {
+            return allocate_memory_at_least(mOverflowAllocator, n, alignment, offset);
+        }
+
         const char* get_name() const
         {
             return mOverflowAllocator.get_name();
@@ -1259,6 +1269,20 @@ namespace eastl
         {
         }
 
+        allocation_result allocate_at_least(size_t /*n*/, int /*flags*/ = 0)
+        {
+            EASTL_ASSERT(false);
+            allocation_result result = { NULL, 0 };
+            return result;
+        }
+
+        allocation_result allocate_at_least(size_t /*n*/, size_t /*alignment*/, size_t /*offset*/, int /*flags*/ = 0)
+        {
+            EASTL_ASSERT(false);
+            allocation_result result = { NULL, 0 };
+            return result;
+        }
+
         const char* get_name() const
         {
             return EASTL_FIXED_POOL_DEFAULT_NAME;
@@ -1288,6 +1312,14 @@ namespace eastl
     // global operators
     ///////////////////////////////////////////////////////////////////////
 
+    template <size_t nodeSize, size_t nodeCount, size_t nodeAlignment, size_t nodeAlignmentOffset, bool bEnableOverflow, typename Allocator>
+    inline allocation_result allocate_memory_at_least(fixed_vector_allocator<nodeSize, nodeCount, nodeAlignment, nodeAlignmentOffset, bEnableOverflow, Allocator>& a, 
+                                                      size_t n, size_t alignment, size_t alignmentOffset)
+    {
+        return Internal::allocate_at_least_member(a, n, alignment, alignmentOffset);
+    }
+
+
     template <size_t nodeSize, size_t nodeCount, size_t nodeAlignment, size_t nodeAlignmentOffset, bool bEnableOverflow, typename Allocator>
     inline bool operator==(const fixed_vector_allocator<nodeSize, nodeCount, nodeAlignment, nodeAlignmentOffset, bEnableOverflow, Allocator>& a, 
                            const fixed_vector_allocator<nodeSize, nodeCount, nodeAlignment, nodeAlignmentOffset, bEnableOverflow, Allocator>& b)
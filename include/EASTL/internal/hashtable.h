@@ -998,6 +998,31 @@ namespace eastl
         eastl::pair<iterator, iterator>             equal_range(const key_type& k);
         eastl::pair<const_iterator, const_iterator> equal_range(const key_type& k) const;
 
+        /// Transparent lookup. If both the hash function and key_eq declare is_transparent
+        /// (as hash<string> and equal_to<string> do), these accept any type which they accept,
+        /// such as a string_view or a char pointer for a table of strings, without constructing
+        /// a key_type. The hash of such a value must equal the hash of the keys it compares
+        /// equal to. As with find_as, this assumes the default range hashing.
+        ///
+        /// Example usage:
+        ///     hash_map<string, int> keywords;
+        ///     keywords.find(string_view(pToken, nTokenLength));
+        ///
+        template <typename U>
+        typename enable_if_transparent<H1, U, iterator, Equal>::type find(const U& u);
+
+        template <typename U>
+        typename enable_if_transparent<H1, U, const_iterator, Equal>::type find(const U& u) const;
+
+        template <typename U>
+        typename enable_if_transparent<H1, U, size_type, Equal>::type count(const U& u) const;
+
+        template <typename U>
+        typename enable_if_transparent<H1, U, eastl::pair<iterator, iterator>, Equal>::type equal_range(const U& u);
+
+        template <typename U>
+        typename enable_if_transparent<H1, U, eastl::pair<const_iterator, const_iterator>, Equal>::type equal_range(const U& u) const;
+
     public:
         bool validate() const;
         int  validate_iterator(const_iterator i) const;
@@ -1025,6 +1050,9 @@ namespace eastl
 
         node_type* DoFindNode(node_type* pNode, hash_code_t c) const;
 
+        template <typename U>
+        node_type** DoGetBucket(const U& u) const;
+
     }; // class hashtable
 
 
@@ -1604,6 +1632,113 @@ namespace eastl
 
 
 
+    template <typename K, typename V, typename A, typename EK, typename Eq,
+              typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+    template <typename U>
+    inline typename enable_if_transparent<H1, U, typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::iterator, Eq>::type
+    hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::find(const U& u)
+    {
+        node_type** const pBucket = DoGetBucket(u);
+        node_type*  const pNode   = DoFindNode(*pBucket, u, key_eq());
+
+        return pNode ? iterator(pNode, pBucket) : iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
+    }
+
+
+
+    template <typename K, typename V, typename A, typename EK, typename Eq,
+              typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+    template <typename U>
+    inline typename enable_if_transparent<H1, U, typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::const_iterator, Eq>::type
+    hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::find(const U& u) const
+    {
+        node_type** const pBucket = DoGetBucket(u);
+        node_type*  const pNode   = DoFindNode(*pBucket, u, key_eq());
+
+        return pNode ? const_iterator(pNode, pBucket) : const_iterator(mpBucketArray + mnBucketCount); // iterator(mpBucketArray + mnBucketCount) == end()
+    }
+
+
+
+    template <typename K, typename V, typename A, typename EK, typename Eq,
+              typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+    template <typename U>
+    typename enable_if_transparent<H1, U, typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::size_type, Eq>::type
+    hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::count(const U& u) const
+    {
+        size_type result = 0;
+
+        for(node_type* pNode = *DoGetBucket(u); pNode; pNode = pNode->mpNext)
+        {
+            if(key_eq()(mExtractKey(pNode->mValue), u))
+                ++result;
+        }
+        return result;
+    }
+
+
+
+    template <typename K, typename V, typename A, typename EK, typename Eq,
+              typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+    template <typename U>
+    typename enable_if_transparent<H1, U, eastl::pair<typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::iterator,
+                                                      typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::iterator>, Eq>::type
+    hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::equal_range(const U& u)
+    {
+        node_type** const head  = DoGetBucket(u);
+        node_type*  const pNode = DoFindNode(*head, u, key_eq());
+
+        if(pNode)
+        {
+            node_type* p1 = pNode->mpNext;
+
+            for(; p1; p1 = p1->mpNext)
+            {
+                if(!key_eq()(mExtractKey(p1->mValue), u))
+                    break;
+            }
+
+            iterator first(pNode, head);
+            iterator last(p1, head);
+
+            if(!p1)
+                last.increment_bucket();
+
+            return eastl::pair<iterator, iterator>(first, last);
+        }
+
+        return eastl::pair<iterator, iterator>(iterator(mpBucketArray + mnBucketCount),  // iterator(mpBucketArray + mnBucketCount) == end()
+                                               iterator(mpBucketArray + mnBucketCount));
+    }
+
+
+
+    template <typename K, typename V, typename A, typename EK, typename Eq,
+              typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+    template <typename U>
+    inline typename enable_if_transparent<H1, U, eastl::pair<typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::const_iterator,
+                                                             typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::const_iterator>, Eq>::type
+    hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::equal_range(const U& u) const
+    {
+        typedef hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU> hashtable_type;
+        const eastl::pair<iterator, iterator> range(const_cast<hashtable_type*>(this)->equal_range(u));
+        return eastl::pair<const_iterator, const_iterator>(range.first, range.second);
+    }
+
+
+
+    template <typename K, typename V, typename A, typename EK, typename Eq,
+              typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
+    template <typename U>
+    inline typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::node_type**
+    hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::DoGetBucket(const U& u) const
+    {
+        const hash_code_t c = (hash_code_t)hash_function()(u);
+        return mpBucketArray + bucket_index(c, (uint32_t)mnBucketCount);
+    }
+
+
+
     template <typename K, typename V, typename A, typename EK, typename Eq,
               typename H1, typename H2, typename H, typename RP, bool bC, bool bM, bool bU>
     inline typename hashtable<K, V, A, EK, Eq, H1, H2, H, RP, bC, bM, bU>::node_type* 
@@ -40,6 +40,7 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <EASTL/internal/config.h>
 #include <EASTL/type_traits.h>
+#include <EASTL/functional.h>
 #include <EASTL/allocator.h>
 #include <EASTL/iterator.h>
 #include <EASTL/utility.h>
@@ -486,6 +487,59 @@ namespace eastl
         iterator       upper_bound(const key_type& key);
         const_iterator upper_bound(const key_type& key) const;
 
+        /// Transparent lookup. If Compare declares is_transparent (as less<string> does),
+        /// these accept any type which Compare can compare with key_type, such as a string_view
+        /// or a char pointer for a tree of strings, without constructing a key_type.
+        ///
+        /// Example usage:
+        ///     set<string> strings;
+        ///     strings.find(string_view(pToken, nTokenLength));
+        ///
+        template <typename U>
+        typename enable_if_transparent<Compare, U, iterator>::type find(const U& u)
+            { return find_as(u, mCompare); }
+
+        template <typename U>
+        typename enable_if_transparent<Compare, U, const_iterator>::type find(const U& u) const
+            { return find_as(u, mCompare); }
+
+        template <typename U>
+        typename enable_if_transparent<Compare, U, iterator>::type lower_bound(const U& u)
+            { return iterator(DoLowerBound(u)); }
+
+        template <typename U>
+        typename enable_if_transparent<Compare, U, const_iterator>::type lower_bound(const U& u) const
+            { return const_iterator(const_cast<this_type*>(this)->DoLowerBound(u)); }
+
+        template <typename U>
+        typename enable_if_transparent<Compare, U, iterator>::type upper_bound(const U& u)
+            { return iterator(DoUpperBound(u)); }
+
+        template <typename U>
+        typename enable_if_transparent<Compare, U, const_iterator>::type upper_bound(const U& u) const
+            { return const_iterator(const_cast<this_type*>(this)->DoUpperBound(u)); }
+
+        template <typename U>
+        typename enable_if_transparent<Compare, U, size_type>::type count(const U& u) const
+        {
+            const eastl::pair<node_type*, node_type*> range(const_cast<this_type*>(this)->DoEqualRange(u));
+            return (size_type)eastl::distance(const_iterator(range.first), const_iterator(range.second));
+        }
+
+        template <typename U>
+        typename enable_if_transparent<Compare, U, eastl::pair<iterator, iterator> >::type equal_range(const U& u)
+        {
+            const eastl::pair<node_type*, node_type*> range(DoEqualRange(u));
+            return eastl::pair<iterator, iterator>(iterator(range.first), iterator(range.second));
+        }
+
+        template <typename U>
+        typename enable_if_transparent<Compare, U, eastl::pair<const_iterator, const_iterator> >::type equal_range(const U& u) const
+        {
+            const eastl::pair<node_type*, node_type*> range(const_cast<this_type*>(this)->DoEqualRange(u));
+            return eastl::pair<const_iterator, const_iterator>(const_iterator(range.first), const_iterator(range.second));
+        }
+
         bool validate() const;
         int  validate_iterator(const_iterator i) const;
 
@@ -517,6 +571,15 @@ namespace eastl
         iterator DoInsertValueImpl(node_type* pNodeParent, const value_type& value, bool bForceToLeft);
         iterator DoInsertKeyImpl(node_type* pNodeParent, const key_type& key, bool bForceToLeft);
 
+        template <typename U>
+        node_type* DoLowerBound(const U& u);
+
+        template <typename U>
+        node_type* DoUpperBound(const U& u);
+
+        template <typename U>
+        eastl::pair<node_type*, node_type*> DoEqualRange(const U& u);
+
     }; // rbtree
 
 
@@ -1505,6 +1568,41 @@ namespace eastl
     template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
     typename rbtree<K, V, C, A, E, bM, bU>::iterator
     rbtree<K, V, C, A, E, bM, bU>::lower_bound(const key_type& key)
+    {
+        return iterator(DoLowerBound(key));
+    }
+
+
+    template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+    inline typename rbtree<K, V, C, A, E, bM, bU>::const_iterator
+    rbtree<K, V, C, A, E, bM, bU>::lower_bound(const key_type& key) const
+    {
+        typedef rbtree<K, V, C, A, E, bM, bU> rbtree_type;
+        return const_iterator(const_cast<rbtree_type*>(this)->lower_bound(key));
+    }
+
+
+    template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+    typename rbtree<K, V, C, A, E, bM, bU>::iterator
+    rbtree<K, V, C, A, E, bM, bU>::upper_bound(const key_type& key)
+    {
+        return iterator(DoUpperBound(key));
+    }
+
+
+    template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+    inline typename rbtree<K, V, C, A, E, bM, bU>::const_iterator
+    rbtree<K, V, C, A, E, bM, bU>::upper_bound(const key_type& key) const
+    {
+        typedef rbtree<K, V, C, A, E, bM, bU> rbtree_type;
+        return const_iterator(const_cast<rbtree_type*>(this)->upper_bound(key));
+    }
+
+
+    template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
+    template <typename U>
+    typename rbtree<K, V, C, A, E, bM, bU>::node_type*
+    rbtree<K, V, C, A, E, bM, bU>::DoLowerBound(const U& u)
     {
         extract_key extractKey;
 
@@ -1513,34 +1611,26 @@ namespace eastl
 
         while(EASTL_LIKELY(pCurrent)) // Do a walk down the tree.
         {
-            if(EASTL_LIKELY(!mCompare(extractKey(pCurrent->mValue), key))) // If pCurrent is >= key...
+            if(EASTL_LIKELY(!mCompare(extractKey(pCurrent->mValue), u))) // If pCurrent is >= u...
             {
                 pRangeEnd = pCurrent;
                 pCurrent  = (node_type*)pCurrent->mpNodeLeft;
             }
             else
             {
-                EASTL_VALIDATE_COMPARE(!mCompare(key, extractKey(pCurrent->mValue))); // Validate that the compare function is sane.
+                EASTL_VALIDATE_COMPARE(!mCompare(u, extractKey(pCurrent->mValue))); // Validate that the compare function is sane.
                 pCurrent  = (node_type*)pCurrent->mpNodeRight;
             }
         }
 
-        return iterator(pRangeEnd);
-    }
-
-
-    template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
-    inline typename rbtree<K, V, C, A, E, bM, bU>::const_iterator
-    rbtree<K, V, C, A, E, bM, bU>::lower_bound(const key_type& key) const
-    {
-        typedef rbtree<K, V, C, A, E, bM, bU> rbtree_type;
-        return const_iterator(const_cast<rbtree_type*>(this)->lower_bound(key));
+        return pRangeEnd;
     }
 
 
     template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
-    typename rbtree<K, V, C, A, E, bM, bU>::iterator
-    rbtree<K, V, C, A, E, bM, bU>::upper_bound(const key_type& key)
+    template <typename U>
+    typename rbtree<K, V, C, A, E, bM, bU>::node_type*
+    rbtree<K, V, C, A, E, bM, bU>::DoUpperBound(const U& u)
     {
         extract_key extractKey;
 
@@ -1549,9 +1639,9 @@ namespace eastl
 
         while(EASTL_LIKELY(pCurrent)) // Do a walk down the tree.
         {
-            if(EASTL_LIKELY(mCompare(key, extractKey(pCurrent->mValue)))) // If key is < pCurrent...
+            if(EASTL_LIKELY(mCompare(u, extractKey(pCurrent->mValue)))) // If u is < pCurrent...
             {
-                EASTL_VALIDATE_COMPARE(!mCompare(extractKey(pCurrent->mValue), key)); // Validate that the compare function is sane.
+                EASTL_VALIDATE_COMPARE(!mCompare(extractKey(pCurrent->mValue), u)); // Validate that the compare function is sane.
                 pRangeEnd = pCurrent;
                 pCurrent  = (node_type*)pCurrent->mpNodeLeft;
             }
@@ -1559,16 +1649,27 @@ namespace eastl
                 pCurrent  = (node_type*)pCurrent->mpNodeRight;
         }
 
-        return iterator(pRangeEnd);
+        return pRangeEnd;
     }
 
 
     template <typename K, typename V, typename C, typename A, typename E, bool bM, bool bU>
-    inline typename rbtree<K, V, C, A, E, bM, bU>::const_iterator
-    rbtree<K, V, C, A, E, bM, bU>::upper_bound(const key_type& key) const
+    template <typename U>
+    eastl::pair<typename rbtree<K, V, C, A, E, bM, bU>::node_type*, typename rbtree<K, V, C, A, E, bM, bU>::node_type*>
+    rbtree<K, V, C, A, E, bM, bU>::DoEqualRange(const U& u)
     {
-        typedef rbtree<K, V, C, A, E, bM, bU> rbtree_type;
-        return const_iterator(const_cast<rbtree_type*>(this)->upper_bound(key));
+        node_type* const pLower = DoLowerBound(u);
+
+        if(bU) // If keys are unique, the range has at most one element and we can avoid a second walk down the tree.
+        {
+            extract_key extractKey;
+
+            if((pLower != &mAnchor) && !mCompare(u, extractKey(pLower->mValue)))
+                return eastl::pair<node_type*, node_type*>(pLower, (node_type*)RBTreeIncrement(pLower));
+            return eastl::pair<node_type*, node_type*>(pLower, pLower);
+        }
+
+        return eastl::pair<node_type*, node_type*>(pLower, DoUpperBound(u));
     }
 
 
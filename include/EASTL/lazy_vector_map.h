@@ -0,0 +1,273 @@
+#ifndef EASTL_LAZY_VECTOR_MAP_H
+#define EASTL_LAZY_VECTOR_MAP_H
+
+#include <EASTL/internal/config.h>
+
+#include <EASTL/algorithm.h>
+#include <EASTL/allocator.h>
+#include <EASTL/functional.h>
+#include <EASTL/utility.h>
+#include <EASTL/vector.h>
+#include <EASTL/vector_map.h>
+
+
+namespace eastl {
+
+/// lazy_vector_map
+///
+/// A vector_map which defers sorting: insert appends to an unsorted tail in
+/// amortized O(1), and the first read (find, lower_bound, iteration, size...)
+/// sorts the tail and merges it into the sorted elements in O(n log n).
+/// Once flushed, the layout is that of vector_map, a single sorted vector.
+///
+/// Of several elements with equivalent keys, the one inserted first is
+/// kept, as with vector_map. Appending keys in increasing order never
+/// builds up a tail.
+///
+/// Reads through a const lazy_vector_map also flush, so concurrent const
+/// access is only safe after an explicit flush().
+template<class K, class V, class C = ::eastl::less<K>, class A = EASTLAllocatorType>
+class lazy_vector_map {
+ public:
+  typedef K key_type;
+  typedef V mapped_type;
+  typedef ::eastl::pair<key_type, mapped_type> value_type;
+  typedef C key_compare;
+  typedef A allocator_type;
+
+  typedef ::eastl::vector<value_type, allocator_type> base_type;
+ private:
+  mutable base_type m_base;
+  mutable typename base_type::size_type m_sorted; // [0, m_sorted) of m_base is sorted and unique
+  detail::compare_impl<typename base_type::value_type, key_compare> m_cmp;
+ public:
+  typedef typename base_type::iterator iterator;
+  typedef typename base_type::const_iterator const_iterator;
+  typedef typename base_type::reverse_iterator reverse_iterator;
+  typedef typename base_type::const_reverse_iterator const_reverse_iterator;
+
+  typedef typename base_type::size_type size_type;
+  typedef typename base_type::difference_type difference_type;
+
+  typedef typename base_type::reference reference;
+  typedef typename base_type::const_reference const_reference;
+  typedef typename base_type::pointer pointer;
+  typedef typename base_type::const_pointer const_pointer;
+
+  static const size_type kMaxSize = base_type::kMaxSize;
+
+  explicit lazy_vector_map(key_compare const& cmp = key_compare(), allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
+      : m_base(alloc), m_sorted(0), m_cmp(cmp) {}
+  template<class InputIterator>
+  lazy_vector_map(InputIterator first, InputIterator last,
+                  key_compare const& cmp = key_compare(),
+                  allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
+      : m_base(alloc), m_sorted(0), m_cmp(cmp)
+  { insert(first, last); }
+  template<class InputIterator>
+  lazy_vector_map(sorted_unique_t, InputIterator first, InputIterator last,
+                  key_compare const& cmp = key_compare(),
+                  allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
+      : m_base(alloc), m_sorted(0), m_cmp(cmp)
+  { insert(sorted_unique, first, last); }
+
+  lazy_vector_map& operator =(lazy_vector_map const& rhs) {
+    lazy_vector_map(rhs).swap(*this);
+    return *this;
+  }
+
+  /// Sorts and merges the pending elements. Every read does this implicitly.
+  void flush() const {
+    if(m_sorted != m_base.size()) {
+      detail::merge_sorted_tail(m_base, m_sorted, m_cmp, false, true);
+      m_sorted = m_base.size();
+    }
+  }
+  /// Number of elements inserted since the last flush, duplicates included.
+  size_type pending() const { return m_base.size() - m_sorted; }
+
+  iterator begin() { flush(); return m_base.begin(); }
+  iterator end() { flush(); return m_base.end(); }
+  reverse_iterator rbegin() { flush(); return m_base.rbegin(); }
+  reverse_iterator rend() { flush(); return m_base.rend(); }
+
+  const_iterator begin() const { flush(); return m_base.begin(); }
+  const_iterator end() const { flush(); return m_base.end(); }
+  const_reverse_iterator rbegin() const { flush(); return m_base.rbegin(); }
+  const_reverse_iterator rend() const { flush(); return m_base.rend(); }
+
+  void clear() { m_base.clear(); m_sorted = 0; }
+  void reserve(size_type const n) { m_base.reserve(n); }
+
+  bool empty() const { return m_base.empty(); }
+  size_type size() const { flush(); return m_base.size(); }
+  size_type max_size() { return base_type::kMaxSize; }
+
+  mapped_type& operator[](key_type const& key) {
+    iterator const i(lower_bound(key));
+    if(i == m_base.end() || m_cmp(key, i->first)) {
+      ++m_sorted;
+      return m_base.insert(i, value_type(key, mapped_type()))->second;
+    }
+    return i->second;
+  }
+
+  void insert(value_type const& val) {
+    bool const in_order = m_sorted == m_base.size() &&
+                          (m_base.empty() || m_cmp(m_base.back(), val));
+    m_base.push_back(val);
+    if(in_order) ++m_sorted;
+  }
+  template<class InputIterator>
+  void insert(InputIterator first, InputIterator const last)
+  { m_base.insert(m_base.end(), first, last); }
+  template<class InputIterator>
+  void insert(sorted_unique_t, InputIterator first, InputIterator const last) {
+    flush();
+    size_type const n = m_base.size();
+    m_base.insert(m_base.end(), first, last);
+    detail::merge_sorted_tail(m_base, n, m_cmp, true, true);
+    m_sorted = m_base.size();
+  }
+
+  void erase(iterator const pos) { flush(); m_base.erase(pos); --m_sorted; }
+  void erase(iterator const first, iterator const last) {
+    flush();
+    m_base.erase(first, last);
+    m_sorted = m_base.size();
+  }
+  size_type erase(key_type const& k) {
+    iterator const i(find(k));
+    if(i == m_base.end()) return 0;
+    else { erase(i); return 1; }
+  }
+
+  void swap(lazy_vector_map& other) {
+    m_base.swap(other.m_base);
+    ::eastl::swap(m_sorted, other.m_sorted);
+    m_cmp.swap(other.m_cmp);
+  }
+
+  allocator_type& get_allocator() { return m_base.get_allocator(); }
+  void set_allocator(allocator_type const& alloc) { m_base.set_allocator(alloc); }
+
+  key_compare key_comp() const { return static_cast<key_compare>(m_cmp); }
+
+  iterator find(key_type const& k) {
+    iterator const i(lower_bound(k));
+    return (i != m_base.end() && m_cmp(k, i->first))? m_base.end() : i;
+  }
+  const_iterator find(key_type const& k) const {
+    const_iterator const i(lower_bound(k));
+    return (i != m_base.end() && m_cmp(k, i->first))? const_iterator(m_base.end()) : i;
+  }
+  size_type count(key_type const& k) const { return find(k) != m_base.end()? 1 : 0; }
+  iterator lower_bound(key_type const& k) {
+    flush();
+    return ::eastl::lower_bound(m_base.begin(), m_base.end(), k, m_cmp);
+  }
+  const_iterator lower_bound(key_type const& k) const {
+    flush();
+    return ::eastl::lower_bound(m_base.begin(), m_base.end(), k, m_cmp);
+  }
+  iterator upper_bound(key_type const& k) {
+    flush();
+    return ::eastl::upper_bound(m_base.begin(), m_base.end(), k, m_cmp);
+  }
+  const_iterator upper_bound(key_type const& k) const {
+    flush();
+    return ::eastl::upper_bound(m_base.begin(), m_base.end(), k, m_cmp);
+  }
+
+  ::eastl::pair<iterator, iterator> equal_range(key_type const& k) {
+    flush();
+    return ::eastl::equal_range(m_base.begin(), m_base.end(), k, m_cmp);
+  }
+  ::eastl::pair<const_iterator, const_iterator> equal_range(key_type const& k) const {
+    flush();
+    return ::eastl::equal_range(m_base.begin(), m_base.end(), k, m_cmp);
+  }
+
+  /// Transparent lookup, as with vector_map.
+  template<class U>
+  typename enable_if_transparent<key_compare, U, iterator>::type find(U const& u) {
+    iterator const i(lower_bound(u));
+    return (i != m_base.end() && key_comp()(u, i->first))? m_base.end() : i;
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type find(U const& u) const {
+    const_iterator const i(lower_bound(u));
+    return (i != m_base.end() && key_comp()(u, i->first))? const_iterator(m_base.end()) : i;
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, size_type>::type count(U const& u) const {
+    return find(u) != m_base.end()? 1 : 0;
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, iterator>::type lower_bound(U const& u) {
+    flush();
+    return ::eastl::lower_bound(m_base.begin(), m_base.end(), u, detail::transparent_key_compare<value_type, U, key_compare>(key_comp()));
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type lower_bound(U const& u) const {
+    flush();
+    return ::eastl::lower_bound(m_base.begin(), m_base.end(), u, detail::transparent_key_compare<value_type, U, key_compare>(key_comp()));
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, iterator>::type upper_bound(U const& u) {
+    flush();
+    return ::eastl::upper_bound(m_base.begin(), m_base.end(), u, detail::transparent_key_compare<value_type, U, key_compare>(key_comp()));
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type upper_bound(U const& u) const {
+    flush();
+    return ::eastl::upper_bound(m_base.begin(), m_base.end(), u, detail::transparent_key_compare<value_type, U, key_compare>(key_comp()));
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, ::eastl::pair<iterator, iterator> >::type equal_range(U const& u) {
+    flush();
+    return ::eastl::equal_range(m_base.begin(), m_base.end(), u, detail::transparent_key_compare<value_type, U, key_compare>(key_comp()));
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, ::eastl::pair<const_iterator, const_iterator> >::type equal_range(U const& u) const {
+    flush();
+    return ::eastl::equal_range(m_base.begin(), m_base.end(), u, detail::transparent_key_compare<value_type, U, key_compare>(key_comp()));
+  }
+
+  /// The underlying sorted vector.
+  base_type const& base() const { flush(); return m_base; }
+}; // class lazy_vector_map
+
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator==(lazy_vector_map<Key, T, Compare, Allocator> const& lhs,
+                       lazy_vector_map<Key, T, Compare, Allocator> const& rhs)
+{ return lhs.base() == rhs.base(); }
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator!=(lazy_vector_map<Key, T, Compare, Allocator> const& lhs,
+                       lazy_vector_map<Key, T, Compare, Allocator> const& rhs)
+{ return lhs.base() != rhs.base(); }
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator<(lazy_vector_map<Key, T, Compare, Allocator> const& lhs,
+                      lazy_vector_map<Key, T, Compare, Allocator> const& rhs)
+{ return lhs.base() <  rhs.base(); }
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator>(lazy_vector_map<Key, T, Compare, Allocator> const& lhs,
+                      lazy_vector_map<Key, T, Compare, Allocator> const& rhs)
+{ return lhs.base() > rhs.base(); }
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator>=(lazy_vector_map<Key, T, Compare, Allocator> const& lhs,
+                       lazy_vector_map<Key, T, Compare, Allocator> const& rhs)
+{ return lhs.base() >= rhs.base(); }
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator<=(lazy_vector_map<Key, T, Compare, Allocator> const& lhs,
+                       lazy_vector_map<Key, T, Compare, Allocator> const& rhs)
+{ return lhs.base() <= rhs.base(); }
+
+template<class Key, class T, class Compare, class Allocator>
+void swap(lazy_vector_map<Key, T, Compare, Allocator>& lhs,
+          lazy_vector_map<Key, T, Compare, Allocator>& rhs)
+{ lhs.swap(rhs); }
+
+} // namespace eastl
+
+#endif // EASTL_LAZY_VECTOR_MAP_H
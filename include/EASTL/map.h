@@ -124,6 +124,8 @@ namespace eastl
         using base_type::find;
         using base_type::lower_bound;
         using base_type::upper_bound;
+        using base_type::count;
+        using base_type::equal_range;
         using base_type::mCompare;
 
         #if !defined(__GNUC__) || (__GNUC__ >= 3) // GCC 2.x has a bug which we work around.
@@ -212,6 +214,8 @@ namespace eastl
         using base_type::find;
         using base_type::lower_bound;
         using base_type::upper_bound;
+        using base_type::count;
+        using base_type::equal_range;
         using base_type::mCompare;
 
         #if !defined(__GNUC__) || (__GNUC__ >= 3) // GCC 2.x has a bug which we work around.
@@ -0,0 +1,159 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/mmap_allocator.h
+//
+// Implements an allocator which gets its memory directly from the operating
+// system's virtual memory manager (mmap on Unix-like platforms) and which
+// supports resizing blocks via page remapping (mremap on Linux).
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// mmap_allocator is intended for very large containers (e.g. a vector of
+// many millions of records). Every allocation is rounded up to a whole number
+// of pages, so it is a poor choice for small containers.
+//
+// The primary benefit of this allocator is that it implements reallocate()
+// (see allocator_can_reallocate in allocator.h). Containers such as vector
+// use this to grow storage of trivially relocatable types without holding
+// both the old and the new block at the same time and without copying every
+// byte from one to the other. On Linux this is implemented via mremap, which
+// moves page table entries instead of memory. On other platforms it falls
+// back to the C runtime realloc, which in practice does the same thing for
+// large blocks on many heaps.
+//
+// Example usage:
+//     struct Record { ... };
+//     EASTL_DECLARE_TRIVIAL_RELOCATE(Record);
+//
+//     eastl::vector<Record, eastl::mmap_allocator> records;
+//     records.reserve(100000000); // Later growth beyond this is done in place.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_MMAP_ALLOCATOR_H
+#define EASTL_MMAP_ALLOCATOR_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/allocator.h>
+#include <stddef.h>
+
+
+namespace eastl
+{
+
+    /// EASTL_MMAP_ALLOCATOR_DEFAULT_NAME
+    ///
+    /// Defines a default allocator name in the absence of a user-provided name.
+    ///
+    #ifndef EASTL_MMAP_ALLOCATOR_DEFAULT_NAME
+        #define EASTL_MMAP_ALLOCATOR_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " mmap_allocator" // Unless the user overrides something, this is "EASTL mmap_allocator".
+    #endif
+
+
+    /// mmap_allocator
+    ///
+    /// Implements the EASTL allocator interface plus reallocate().
+    /// All instances are equivalent, as they allocate from the same system heap.
+    /// allocate and reallocate return NULL when the system can't supply the 
+    /// pages; a failed reallocate leaves the original block intact.
+    ///
+    class EASTL_API mmap_allocator
+    {
+    public:
+        typedef eastl_size_t size_type;
+
+        EASTL_ALLOCATOR_EXPLICIT mmap_allocator(const char* pName = EASTL_NAME_VAL(EASTL_MMAP_ALLOCATOR_DEFAULT_NAME));
+        mmap_allocator(const mmap_allocator& x);
+        mmap_allocator(const mmap_allocator& x, const char* pName);
+
+        mmap_allocator& operator=(const mmap_allocator& x);
+
+        void* allocate(size_t n, int flags = 0);
+        void* allocate(size_t n, size_t alignment, size_t offset, int flags = 0);
+        void* reallocate(void* p, size_t prevSize, size_t n, int flags = 0);
+        void  deallocate(void* p, size_t n);
+
+        const char* get_name() const;
+        void        set_name(const char* pName);
+
+        static size_t get_page_size();
+
+    protected:
+        #if EASTL_NAME_ENABLED
+            const char* mpName; // Debug name, used to track memory.
+        #endif
+    };
+
+    inline bool operator==(const mmap_allocator&, const mmap_allocator&) { return true;  }
+    inline bool operator!=(const mmap_allocator&, const mmap_allocator&) { return false; }
+
+    template <>
+    struct allocator_can_reallocate<mmap_allocator> : public true_type{};
+
+    inline size_t allocator_usable_size(const mmap_allocator&, size_t n)
+    {
+        const size_t nPageSize = mmap_allocator::get_page_size();
+        return (n + (nPageSize - 1)) & ~(nPageSize - 1); // Blocks are made of whole pages.
+    }
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // mmap_allocator
+    ///////////////////////////////////////////////////////////////////////
+
+    inline mmap_allocator::mmap_allocator(const char* EASTL_NAME(pName))
+    {
+        #if EASTL_NAME_ENABLED
+            mpName = pName ? pName : EASTL_MMAP_ALLOCATOR_DEFAULT_NAME;
+        #endif
+    }
+
+
+    inline mmap_allocator::mmap_allocator(const mmap_allocator& EASTL_NAME(x))
+    {
+        #if EASTL_NAME_ENABLED
+            mpName = x.mpName;
+        #endif
+    }
+
+
+    inline mmap_allocator::mmap_allocator(const mmap_allocator&, const char* EASTL_NAME(pName))
+    {
+        #if EASTL_NAME_ENABLED
+            mpName = pName ? pName : EASTL_MMAP_ALLOCATOR_DEFAULT_NAME;
+        #endif
+    }
+
+
+    inline mmap_allocator& mmap_allocator::operator=(const mmap_allocator& EASTL_NAME(x))
+    {
+        #if EASTL_NAME_ENABLED
+            mpName = x.mpName;
+        #endif
+        return *this;
+    }
+
+
+    inline const char* mmap_allocator::get_name() const
+    {
+        #if EASTL_NAME_ENABLED
+            return mpName;
+        #else
+            return EASTL_MMAP_ALLOCATOR_DEFAULT_NAME;
+        #endif
+    }
+
+
+    inline void mmap_allocator::set_name(const char* EASTL_NAME(pName))
+    {
+        #if EASTL_NAME_ENABLED
+            mpName = pName;
+        #endif
+    }
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -0,0 +1,240 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/queue.h
+//
+// Implements a FIFO container adaptor, much like the C++ std::queue class.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_QUEUE_H
+#define EASTL_QUEUE_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/deque.h>
+
+
+namespace eastl
+{
+
+    /// queue
+    ///
+    /// Adapts a container which supports front, back, push_back and
+    /// pop_front into a first-in first-out queue. The default is deque,
+    /// which does one allocation per subarray of elements rather than one
+    /// per element as list does.
+    ///
+    template <typename T, typename Container = eastl::deque<T> >
+    class queue
+    {
+    public:
+        typedef queue<T, Container>                  this_type;
+        typedef Container                            container_type;
+        typedef typename Container::size_type        size_type;
+        typedef typename Container::value_type       value_type;
+        typedef typename Container::reference        reference;
+        typedef typename Container::const_reference  const_reference;
+
+    public:               // Public so that the global comparison operators can get at it.
+        container_type c; // The C++ standard names the underlying container 'c'.
+
+    public:
+        queue();
+        explicit queue(const container_type& x);
+
+        bool      empty() const;
+        size_type size() const;
+
+        reference       front();
+        const_reference front() const;
+
+        reference       back();
+        const_reference back() const;
+
+        void push(const value_type& value);
+
+        #ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
+            void push(value_type&& value);
+        #endif
+
+        void pop();
+
+        void swap(this_type& x);
+
+        container_type&       get_container();
+        const container_type& get_container() const;
+
+    }; // class queue
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // queue
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename T, typename Container>
+    inline queue<T, Container>::queue()
+        : c()
+    {
+    }
+
+
+    template <typename T, typename Container>
+    inline queue<T, Container>::queue(const Container& x)
+        : c(x)
+    {
+    }
+
+
+    template <typename T, typename Container>
+    inline bool queue<T, Container>::empty() const
+    {
+        return c.empty();
+    }
+
+
+    template <typename T, typename Container>
+    inline typename queue<T, Container>::size_type
+    queue<T, Container>::size() const
+    {
+        return c.size();
+    }
+
+
+    template <typename T, typename Container>
+    inline typename queue<T, Container>::reference
+    queue<T, Container>::front()
+    {
+        return c.front();
+    }
+
+
+    template <typename T, typename Container>
+    inline typename queue<T, Container>::const_reference
+    queue<T, Container>::front() const
+    {
+        return c.front();
+    }
+
+
+    template <typename T, typename Container>
+    inline typename queue<T, Container>::reference
+    queue<T, Container>::back()
+    {
+        return c.back();
+    }
+
+
+    template <typename T, typename Container>
+    inline typename queue<T, Container>::const_reference
+    queue<T, Container>::back() const
+    {
+        return c.back();
+    }
+
+
+    template <typename T, typename Container>
+    inline void queue<T, Container>::push(const value_type& value)
+    {
+        c.push_back(value);
+    }
+
+
+    #ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
+        template <typename T, typename Container>
+        inline void queue<T, Container>::push(value_type&& value)
+        {
+            c.push_back(std::move(value));
+        }
+    #endif
+
+
+    template <typename T, typename Container>
+    inline void queue<T, Container>::pop()
+    {
+        c.pop_front();
+    }
+
+
+    template <typename T, typename Container>
+    inline void queue<T, Container>::swap(this_type& x)
+    {
+        eastl::swap(c, x.c);
+    }
+
+
+    template <typename T, typename Container>
+    inline typename queue<T, Container>::container_type&
+    queue<T, Container>::get_container()
+    {
+        return c;
+    }
+
+
+    template <typename T, typename Container>
+    inline const typename queue<T, Container>::container_type&
+    queue<T, Container>::get_container() const
+    {
+        return c;
+    }
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // global operators
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename T, typename Container>
+    inline bool operator==(const queue<T, Container>& a, const queue<T, Container>& b)
+    {
+        return (a.c == b.c);
+    }
+
+
+    template <typename T, typename Container>
+    inline bool operator!=(const queue<T, Container>& a, const queue<T, Container>& b)
+    {
+        return !(a.c == b.c);
+    }
+
+
+    template <typename T, typename Container>
+    inline bool operator<(const queue<T, Container>& a, const queue<T, Container>& b)
+    {
+        return (a.c < b.c);
+    }
+
+
+    template <typename T, typename Container>
+    inline bool operator>(const queue<T, Container>& a, const queue<T, Container>& b)
+    {
+        return (b.c < a.c);
+    }
+
+
+    template <typename T, typename Container>
+    inline bool operator<=(const queue<T, Container>& a, const queue<T, Container>& b)
+    {
+        return !(b.c < a.c);
+    }
+
+
+    template <typename T, typename Container>
+    inline bool operator>=(const queue<T, Container>& a, const queue<T, Container>& b)
+    {
+        return !(a.c < b.c);
+    }
+
+
+    template <typename T, typename Container>
+    inline void swap(queue<T, Container>& a, queue<T, Container>& b)
+    {
+        a.swap(b);
+    }
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
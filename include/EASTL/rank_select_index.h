@@ -0,0 +1,469 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/rank_select_index.h
+//
+// Implements constant-time rank and select queries over a bitset or bitvector.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// rank_select_index is an auxiliary index over an array of bits that it
+// doesn't own, such as the words of a bitset or bitvector. It answers:
+//    - rank1(i):   the number of set bits before position i.
+//    - select1(k): the position of the k-th set bit, counting from 0.
+// in constant time, where bitset::count and find_next would have to scan.
+//
+// The bits are divided into superblocks of 4096 bits, each divided into
+// eight blocks of 512 bits. Each superblock stores the number of set bits
+// before it, and the number of set bits before each of its blocks relative
+// to the superblock, which fits 16 bits. So rank1 is two table lookups
+// plus popcounts over at most one block, and the tables cost about 4% of
+// the bits (5% where eastl_size_t is 64 bits).
+//
+// For select1, the index also samples the superblock of every 8192nd set
+// bit, costing at most 0.4% more. select1 finds its superblock with a
+// binary search between two samples, then scans the eight block counts,
+// at most one block of words, and selects within the final word.
+//
+// The index refers to the bits it was built over, so they must outlive it,
+// and it must be rebuilt after they change. The bits past the size in the
+// last word are ignored.
+//
+// Example usage:
+//    eastl::bitvector<> present(nDocumentCount);
+//    ...
+//    eastl::rank_select_index<> index(present);
+//    size_t nDenseId = index.rank1(nDocumentId); // Maps sparse ids to 0, 1, 2...
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_RANK_SELECT_INDEX_H
+#define EASTL_RANK_SELECT_INDEX_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/bitset.h>
+#include <EASTL/bitvector.h>
+#include <EASTL/vector.h>
+
+#if EASTL_BITSET_INTRINSICS_ENABLED && defined(__BMI2__) && (EA_PLATFORM_WORD_SIZE == 8)
+    #include <immintrin.h>
+    #define EASTL_RANK_SELECT_PDEP 1
+#else
+    #define EASTL_RANK_SELECT_PDEP 0
+#endif
+
+
+namespace eastl
+{
+
+    /// EASTL_RANK_SELECT_INDEX_DEFAULT_NAME
+    ///
+    /// Defines a default container name in the absence of a user-provided name.
+    ///
+    #ifndef EASTL_RANK_SELECT_INDEX_DEFAULT_NAME
+        #define EASTL_RANK_SELECT_INDEX_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " rank_select_index" // Unless the user overrides something, this is "EASTL rank_select_index".
+    #endif
+
+
+    /// EASTL_RANK_SELECT_INDEX_DEFAULT_ALLOCATOR
+    ///
+    #ifndef EASTL_RANK_SELECT_INDEX_DEFAULT_ALLOCATOR
+        #define EASTL_RANK_SELECT_INDEX_DEFAULT_ALLOCATOR allocator_type(EASTL_RANK_SELECT_INDEX_DEFAULT_NAME)
+    #endif
+
+
+
+    /// BitsetSelectBit
+    ///
+    /// Returns the position of the k-th set bit of x, counting from 0.
+    /// There must be more than k set bits. With BMI2 this is a pdep;
+    /// otherwise we halve the word down to a byte with popcounts, and clear
+    /// the lowest bits of that byte.
+    ///
+    inline uint32_t BitsetSelectBit(BitsetWordType x, uint32_t k)
+    {
+        #if EASTL_RANK_SELECT_PDEP
+            return (uint32_t)__builtin_ctzll(_pdep_u64(UINT64_C(1) << k, x));
+        #else
+            uint32_t n = 0;
+
+            for(uint32_t nHalf = kBitsPerWord / 2; nHalf >= 8; nHalf /= 2)
+            {
+                const uint32_t nLowCount = BitsetCountBits(x & ((static_cast<BitsetWordType>(1) << nHalf) - 1));
+
+                if(k >= nLowCount)
+                {
+                    k -= nLowCount;
+                    x >>= nHalf;
+                    n  += nHalf;
+                }
+            }
+
+            for(; k; --k)
+                x &= (x - 1);
+            return n + GetFirstBit(x);
+        #endif
+    }
+
+
+
+    /// rank_select_index
+    ///
+    /// Implements constant-time rank and select over an array of bits. See
+    /// the top of this file for a description.
+    ///
+    template <typename Allocator = EASTLAllocatorType>
+    class rank_select_index
+    {
+    public:
+        typedef rank_select_index<Allocator>                this_type;
+        typedef BitsetWordType                              word_type;
+        typedef eastl_size_t                                size_type;
+        typedef Allocator                                   allocator_type;
+
+        enum
+        {
+            kBlockBitCount         = 512,
+            kBlocksPerSuperblock   = 8,
+            kSuperblockBitCount    = kBlockBitCount * kBlocksPerSuperblock,
+            kWordsPerBlock         = kBlockBitCount / kBitsPerWord,
+            kWordsPerSuperblock    = kSuperblockBitCount / kBitsPerWord,
+            kSelectSampleRate      = 8192   // Every kSelectSampleRate-th set bit is sampled.
+        };
+
+        struct Superblock
+        {
+            size_type mnRank;                              // Set bits before this superblock.
+            uint16_t  mnBlockRank[kBlocksPerSuperblock];   // Set bits before each block, from the start of this superblock.
+        };
+
+    public:
+        rank_select_index();
+        explicit rank_select_index(const allocator_type& allocator);
+        rank_select_index(const word_type* pWords, size_type nBitCount, const allocator_type& allocator = EASTL_RANK_SELECT_INDEX_DEFAULT_ALLOCATOR);
+
+        template <size_t N>
+        explicit rank_select_index(const bitset<N>& x, const allocator_type& allocator = EASTL_RANK_SELECT_INDEX_DEFAULT_ALLOCATOR);
+
+        template <typename BitvectorAllocator>
+        explicit rank_select_index(const bitvector<BitvectorAllocator>& x, const allocator_type& allocator = EASTL_RANK_SELECT_INDEX_DEFAULT_ALLOCATOR);
+
+        void build(const word_type* pWords, size_type nBitCount);
+
+        template <size_t N>
+        void build(const bitset<N>& x);
+
+        template <typename BitvectorAllocator>
+        void build(const bitvector<BitvectorAllocator>& x);
+
+        void clear();
+        void swap(this_type& x);
+
+        size_type size() const;          // Number of bits indexed.
+        size_type count() const;         // Number of set bits.
+        size_type size_in_bytes() const; // Memory used by the index, not counting the bits.
+
+        size_type rank1(size_type i) const;   // Set bits in [0, i), where i <= size().
+        size_type rank0(size_type i) const;   // Clear bits in [0, i).
+        size_type select1(size_type k) const; // Position of the k-th set bit, counting from 0, or size() if k >= count().
+
+        bool validate() const;
+
+    protected:
+        typedef vector<Superblock, Allocator> superblock_vector_type;
+        typedef vector<size_type, Allocator>  sample_vector_type;
+
+        const word_type*       mpWords;
+        size_type              mnSize;
+        size_type              mnCount;
+        superblock_vector_type mSuperblocks;   // One more than there are superblocks, with the total count.
+        sample_vector_type     mSelectSamples; // The superblock of set bits 0, kSelectSampleRate, 2 * kSelectSampleRate...
+
+        word_type DoGetWord(size_type iWord) const;
+
+    }; // class rank_select_index
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // rank_select_index
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename Allocator>
+    inline rank_select_index<Allocator>::rank_select_index()
+        : mpWords(NULL),
+          mnSize(0),
+          mnCount(0),
+          mSuperblocks(EASTL_RANK_SELECT_INDEX_DEFAULT_ALLOCATOR),
+          mSelectSamples(EASTL_RANK_SELECT_INDEX_DEFAULT_ALLOCATOR)
+    {
+    }
+
+
+    template <typename Allocator>
+    inline rank_select_index<Allocator>::rank_select_index(const allocator_type& allocator)
+        : mpWords(NULL),
+          mnSize(0),
+          mnCount(0),
+          mSuperblocks(allocator),
+          mSelectSamples(allocator)
+    {
+    }
+
+
+    template <typename Allocator>
+    inline rank_select_index<Allocator>::rank_select_index(const word_type* pWords, size_type nBitCount, const allocator_type& allocator)
+        : mpWords(NULL),
+          mnSize(0),
+          mnCount(0),
+          mSuperblocks(allocator),
+          mSelectSamples(allocator)
+    {
+        build(pWords, nBitCount);
+    }
+
+
+    template <typename Allocator>
+    template <size_t N>
+    inline rank_select_index<Allocator>::rank_select_index(const bitset<N>& x, const allocator_type& allocator)
+        : mpWords(NULL),
+          mnSize(0),
+          mnCount(0),
+          mSuperblocks(allocator),
+          mSelectSamples(allocator)
+    {
+        build(x);
+    }
+
+
+    template <typename Allocator>
+    template <typename BitvectorAllocator>
+    inline rank_select_index<Allocator>::rank_select_index(const bitvector<BitvectorAllocator>& x, const allocator_type& allocator)
+        : mpWords(NULL),
+          mnSize(0),
+          mnCount(0),
+          mSuperblocks(allocator),
+          mSelectSamples(allocator)
+    {
+        build(x);
+    }
+
+
+    template <typename Allocator>
+    template <size_t N>
+    inline void rank_select_index<Allocator>::build(const bitset<N>& x)
+    {
+        build(x.data(), (size_type)N);
+    }
+
+
+    template <typename Allocator>
+    template <typename BitvectorAllocator>
+    inline void rank_select_index<Allocator>::build(const bitvector<BitvectorAllocator>& x)
+    {
+        build(x.data(), (size_type)x.size());
+    }
+
+
+    template <typename Allocator>
+    void rank_select_index<Allocator>::build(const word_type* pWords, size_type nBitCount)
+    {
+        const size_type nSuperblockCount = (nBitCount + (kSuperblockBitCount - 1)) / kSuperblockBitCount;
+
+        mpWords = pWords;
+        mnSize  = nBitCount;
+        mSuperblocks.resize(nSuperblockCount + 1);
+        mSelectSamples.clear();
+
+        size_type nRank       = 0;
+        size_type nNextSample = 0; // The next set bit to sample.
+
+        for(size_type s = 0; s < nSuperblockCount; ++s)
+        {
+            Superblock& superblock = mSuperblocks[s];
+            uint32_t    nRelative  = 0;
+
+            superblock.mnRank = nRank;
+
+            for(size_type b = 0, iWord = s * kWordsPerSuperblock; b < kBlocksPerSuperblock; ++b)
+            {
+                superblock.mnBlockRank[b] = (uint16_t)nRelative;
+                for(size_type iWordEnd = iWord + kWordsPerBlock; iWord < iWordEnd; ++iWord)
+                    nRelative += BitsetCountBits(DoGetWord(iWord));
+            }
+
+            nRank += nRelative;
+            for(; nNextSample < nRank; nNextSample += kSelectSampleRate)
+                mSelectSamples.push_back(s);
+        }
+
+        mSuperblocks[nSuperblockCount].mnRank = nRank;
+        memset(mSuperblocks[nSuperblockCount].mnBlockRank, 0, sizeof(mSuperblocks[nSuperblockCount].mnBlockRank));
+        mnCount = nRank;
+    }
+
+
+    /// DoGetWord
+    ///
+    /// Returns the word at iWord, with the bits past mnSize cleared, and
+    /// zero for the words past the end of the bits, which the last
+    /// superblock may cover.
+    ///
+    template <typename Allocator>
+    inline typename rank_select_index<Allocator>::word_type
+    rank_select_index<Allocator>::DoGetWord(size_type iWord) const
+    {
+        const uint64_t nFirstBit = (uint64_t)iWord * kBitsPerWord; // 64 bits, as the last superblock can reach past 2^32 bits.
+
+        if((nFirstBit + kBitsPerWord) <= mnSize)
+            return mpWords[iWord];
+        if(nFirstBit >= mnSize)
+            return 0;
+        return mpWords[iWord] & ((static_cast<word_type>(1) << (uint32_t)(mnSize - nFirstBit)) - 1);
+    }
+
+
+    template <typename Allocator>
+    inline void rank_select_index<Allocator>::clear()
+    {
+        mpWords = NULL;
+        mnSize  = 0;
+        mnCount = 0;
+        mSuperblocks.clear();
+        mSelectSamples.clear();
+    }
+
+
+    template <typename Allocator>
+    inline void rank_select_index<Allocator>::swap(this_type& x)
+    {
+        eastl::swap(mpWords, x.mpWords);
+        eastl::swap(mnSize, x.mnSize);
+        eastl::swap(mnCount, x.mnCount);
+        mSuperblocks.swap(x.mSuperblocks);
+        mSelectSamples.swap(x.mSelectSamples);
+    }
+
+
+    template <typename Allocator>
+    inline typename rank_select_index<Allocator>::size_type
+    rank_select_index<Allocator>::size() const
+    {
+        return mnSize;
+    }
+
+
+    template <typename Allocator>
+    inline typename rank_select_index<Allocator>::size_type
+    rank_select_index<Allocator>::count() const
+    {
+        return mnCount;
+    }
+
+
+    template <typename Allocator>
+    inline typename rank_select_index<Allocator>::size_type
+    rank_select_index<Allocator>::size_in_bytes() const
+    {
+        return (size_type)((mSuperblocks.capacity() * sizeof(Superblock)) + (mSelectSamples.capacity() * sizeof(size_type)));
+    }
+
+
+    template <typename Allocator>
+    inline typename rank_select_index<Allocator>::size_type
+    rank_select_index<Allocator>::rank1(size_type i) const
+    {
+        EASTL_ASSERT(i <= mnSize);
+
+        const Superblock& superblock = mSuperblocks[i / kSuperblockBitCount];
+        const size_type   iBlock     = i / kBlockBitCount;
+        const size_type   iWordEnd   = i >> kBitsPerWordShift;
+        size_type         nRank      = superblock.mnRank + superblock.mnBlockRank[iBlock % kBlocksPerSuperblock];
+
+        for(size_type iWord = iBlock * kWordsPerBlock; iWord < iWordEnd; ++iWord)
+            nRank += BitsetCountBits(mpWords[iWord]);
+        if(i & kBitsPerWordMask)
+            nRank += BitsetCountBits(mpWords[iWordEnd] & ((static_cast<word_type>(1) << (i & kBitsPerWordMask)) - 1));
+
+        return nRank;
+    }
+
+
+    template <typename Allocator>
+    inline typename rank_select_index<Allocator>::size_type
+    rank_select_index<Allocator>::rank0(size_type i) const
+    {
+        return i - rank1(i);
+    }
+
+
+    template <typename Allocator>
+    typename rank_select_index<Allocator>::size_type
+    rank_select_index<Allocator>::select1(size_type k) const
+    {
+        if(k >= mnCount)
+            return mnSize;
+
+        // Find the last superblock that starts at or before the k-th set
+        // bit, between the superblocks of the samples around it.
+        const size_type iSample = k / kSelectSampleRate;
+        size_type       nLow    = mSelectSamples[iSample];
+        size_type       nHigh   = ((iSample + 1) < mSelectSamples.size()) ? (mSelectSamples[iSample + 1] + 1) : (mSuperblocks.size() - 1);
+
+        while((nHigh - nLow) > 1)
+        {
+            const size_type nMid = (nLow + nHigh) / 2;
+            if(mSuperblocks[nMid].mnRank <= k)
+                nLow = nMid;
+            else
+                nHigh = nMid;
+        }
+
+        const Superblock& superblock = mSuperblocks[nLow];
+        uint32_t          nRest      = (uint32_t)(k - superblock.mnRank);
+        size_type         b          = 1;
+
+        while((b < kBlocksPerSuperblock) && (superblock.mnBlockRank[b] <= nRest))
+            ++b;
+        nRest -= superblock.mnBlockRank[--b];
+
+        size_type iWord = (nLow * kWordsPerSuperblock) + (b * kWordsPerBlock);
+        for(uint32_t n; nRest >= (n = BitsetCountBits(mpWords[iWord])); ++iWord)
+            nRest -= n;
+
+        return (iWord << kBitsPerWordShift) + BitsetSelectBit(mpWords[iWord], nRest);
+    }
+
+
+    template <typename Allocator>
+    bool rank_select_index<Allocator>::validate() const
+    {
+        if(mSuperblocks.empty())
+            return (mnSize == 0) && (mnCount == 0);
+
+        if((mSuperblocks.size() != (((mnSize + (kSuperblockBitCount - 1)) / kSuperblockBitCount) + 1)) ||
+           (mSuperblocks.back().mnRank != mnCount) ||
+           (mSelectSamples.size() != ((mnCount + (kSelectSampleRate - 1)) / kSelectSampleRate)))
+            return false;
+
+        for(size_type s = 1; s < mSuperblocks.size(); ++s)
+        {
+            if(mSuperblocks[s].mnRank < mSuperblocks[s - 1].mnRank)
+                return false;
+        }
+
+        return true;
+    }
+
+
+    template <typename Allocator>
+    inline void swap(rank_select_index<Allocator>& a, rank_select_index<Allocator>& b)
+    {
+        a.swap(b);
+    }
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -0,0 +1,2067 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/roaring_bitmap.h
+//
+// Implements a compressed set of uint32_t values.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// roaring_bitmap stores a set of uint32_t values the way Roaring bitmaps do:
+// the values are split into chunks of 65536 by their high 16 bits, and each
+// non-empty chunk keeps its low 16 bits in whichever container suits it:
+//    - an array container, a sorted array of up to 4096 uint16_t values.
+//    - a bitset container, 65536 bits in BitsetWordType words (see bitset.h),
+//      used when a chunk has more than 4096 values.
+//    - a run container, a sorted array of (start, length - 1) pairs, used
+//      after run_optimize or add_range when that is smaller than the above.
+// So a sparse set costs about two bytes per value, a dense one about one bit
+// per value, and the set operations work a chunk at a time: array against
+// array by merging, anything against a bitset by words, using SSE2 or AVX2
+// when available (see BitsetCombineWords).
+//
+// The intersection and union of two run containers are runs; the other
+// set operations leave their results as arrays or bitsets. Call
+// run_optimize to turn chunks that are mostly ranges into run containers.
+//
+// serialize writes the portable Roaring format that the C, C++, Java and Go
+// Roaring libraries read and write (see RoaringFormatSpec), little-endian
+// on any platform. deserialize checks its input and rejects malformed data.
+//
+// Example usage:
+//    eastl::roaring_bitmap<> a, b;
+//    a.add_range(0, 1000000);
+//    b.add(5);
+//    b.add(2000000);
+//    a &= b;                         // a is { 5 }
+//
+//    eastl::vector<uint8_t> buffer(a.serialized_size());
+//    a.serialize(buffer.data());
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_ROARING_BITMAP_H
+#define EASTL_ROARING_BITMAP_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/bitset.h>
+#include <EASTL/vector.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/allocator.h>
+#include <string.h>
+
+
+namespace eastl
+{
+
+    /// EASTL_ROARING_BITMAP_DEFAULT_NAME
+    ///
+    /// Defines a default container name in the absence of a user-provided name.
+    ///
+    #ifndef EASTL_ROARING_BITMAP_DEFAULT_NAME
+        #define EASTL_ROARING_BITMAP_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " roaring_bitmap" // Unless the user overrides something, this is "EASTL roaring_bitmap".
+    #endif
+
+
+    /// EASTL_ROARING_BITMAP_DEFAULT_ALLOCATOR
+    ///
+    #ifndef EASTL_ROARING_BITMAP_DEFAULT_ALLOCATOR
+        #define EASTL_ROARING_BITMAP_DEFAULT_ALLOCATOR allocator_type(EASTL_ROARING_BITMAP_DEFAULT_NAME)
+    #endif
+
+
+    const uint32_t kRoaringArrayMax  = 4096;                // Largest array container. Bigger chunks are bitsets.
+    const uint32_t kRoaringWordCount = 65536 / kBitsPerWord; // Words in a bitset container.
+
+
+
+    /// RoaringContainer
+    ///
+    /// One chunk of a roaring_bitmap: the values whose high 16 bits are
+    /// mnKey, stored by their low 16 bits. It is a plain struct so that the
+    /// bitmap's vector of containers can copy it around as bytes when it
+    /// grows; the roaring_bitmap allocates and frees mpData.
+    ///
+    struct RoaringContainer
+    {
+        enum Type
+        {
+            kTypeArray,
+            kTypeBitset,
+            kTypeRun
+        };
+
+        void*    mpData;        // array: sorted values. run: (start, length - 1) pairs. bitset: kRoaringWordCount words.
+        uint32_t mnCardinality; // Number of values, from 1 to 65536. Empty containers are removed.
+        uint32_t mnSize;        // array: number of values. run: number of runs. bitset: unused.
+        uint32_t mnCapacity;    // Size of mpData, in uint16_t units.
+        uint16_t mnKey;
+        uint8_t  mnType;
+
+        uint16_t*             Values()       { return static_cast<uint16_t*>(mpData); }
+        const uint16_t*       Values() const { return static_cast<const uint16_t*>(mpData); }
+        BitsetWordType*       Words()        { return static_cast<BitsetWordType*>(mpData); }
+        const BitsetWordType* Words()  const { return static_cast<const BitsetWordType*>(mpData); }
+    };
+
+
+
+    /// RoaringBitmapIterator
+    ///
+    /// A forward iterator over the values of a roaring_bitmap, in increasing
+    /// order. The values are computed, so they are returned by value.
+    ///
+    struct RoaringBitmapIterator
+    {
+        typedef RoaringBitmapIterator                  this_type;
+        typedef uint32_t                               value_type;
+        typedef ptrdiff_t                              difference_type;
+        typedef const uint32_t*                        pointer;
+        typedef uint32_t                               reference;
+        typedef EASTL_ITC_NS::forward_iterator_tag     iterator_category;
+
+    public:
+        const RoaringContainer* mpContainer;
+        const RoaringContainer* mpContainerEnd;
+        uint32_t                mnPosition; // array: value index. run: run index. bitset: word index.
+        uint32_t                mnValue;    // The current value, or 0 at the end.
+        BitsetWordType          mWord;      // bitset: the bits of the current word that we haven't visited yet.
+
+    public:
+        RoaringBitmapIterator()
+            : mpContainer(NULL), mpContainerEnd(NULL), mnPosition(0), mnValue(0), mWord(0) { }
+
+        RoaringBitmapIterator(const RoaringContainer* pContainer, const RoaringContainer* pContainerEnd)
+            : mpContainer(pContainer), mpContainerEnd(pContainerEnd), mnPosition(0), mnValue(0), mWord(0)
+        {
+            if(mpContainer != mpContainerEnd)
+                DoBegin();
+        }
+
+        reference operator*() const
+            { return mnValue; }
+
+        this_type& operator++()
+        {
+            const uint32_t nHigh = mnValue & 0xffff0000;
+
+            switch(mpContainer->mnType)
+            {
+                case RoaringContainer::kTypeArray:
+                    if(++mnPosition < mpContainer->mnSize)
+                    {
+                        mnValue = nHigh | mpContainer->Values()[mnPosition];
+                        return *this;
+                    }
+                    break;
+
+                case RoaringContainer::kTypeRun:
+                {
+                    const uint16_t* const pRun = mpContainer->Values() + (mnPosition * 2);
+
+                    if((mnValue & 0xffff) < (uint32_t)(pRun[0] + pRun[1]))
+                    {
+                        ++mnValue;
+                        return *this;
+                    }
+                    if(++mnPosition < mpContainer->mnSize)
+                    {
+                        mnValue = nHigh | pRun[2];
+                        return *this;
+                    }
+                    break;
+                }
+
+                default:
+                    mWord &= (mWord - 1); // Clear the lowest set bit.
+                    if(DoSkipZeroWords())
+                        return *this;
+                    break;
+            }
+
+            if(++mpContainer != mpContainerEnd)
+                DoBegin();
+            else
+                mnValue = 0;
+            return *this;
+        }
+
+        this_type operator++(int)
+            { const this_type temp(*this); operator++(); return temp; }
+
+        bool operator==(const this_type& x) const
+            { return (mpContainer == x.mpContainer) && (mnValue == x.mnValue); }
+
+        bool operator!=(const this_type& x) const
+            { return (mpContainer != x.mpContainer) || (mnValue != x.mnValue); }
+
+    protected:
+        void DoBegin()
+        {
+            mnPosition = 0;
+            mnValue    = (uint32_t)mpContainer->mnKey << 16;
+
+            if(mpContainer->mnType == RoaringContainer::kTypeBitset)
+            {
+                mWord = mpContainer->Words()[0];
+                DoSkipZeroWords();
+            }
+            else
+                mnValue |= mpContainer->Values()[0];
+        }
+
+        // Moves to the lowest remaining bit of a bitset container, if any.
+        bool DoSkipZeroWords()
+        {
+            while(!mWord)
+            {
+                if(++mnPosition == kRoaringWordCount)
+                    return false;
+                mWord = mpContainer->Words()[mnPosition];
+            }
+            mnValue = (mnValue & 0xffff0000) | ((mnPosition << kBitsPerWordShift) + GetFirstBit(mWord));
+            return true;
+        }
+
+    }; // RoaringBitmapIterator
+
+
+
+
+    /// roaring_bitmap
+    ///
+    /// Implements a compressed set of uint32_t values. See the top of this
+    /// file for a description.
+    ///
+    template <typename Allocator = EASTLAllocatorType>
+    class roaring_bitmap
+    {
+    public:
+        typedef roaring_bitmap<Allocator>                   this_type;
+        typedef uint32_t                                    value_type;
+        typedef eastl_size_t                                size_type;
+        typedef Allocator                                   allocator_type;
+        typedef RoaringContainer                            container_type;
+        typedef vector<RoaringContainer, Allocator>         container_vector_type;
+        typedef RoaringBitmapIterator                       const_iterator;
+        typedef RoaringBitmapIterator                       iterator; // The values can't be modified in place.
+
+        enum
+        {
+            kSerialCookieNoRuns = 12346, // The first word of a serialized bitmap without run containers.
+            kSerialCookie       = 12347, // The low 16 bits of the first word of one with run containers.
+            kNoOffsetThreshold  = 4      // Serialized bitmaps with run containers only have offsets if they have this many containers.
+        };
+
+    public:
+        roaring_bitmap();
+        explicit roaring_bitmap(const allocator_type& allocator);
+        roaring_bitmap(const this_type& x);
+
+        template <typename InputIterator>
+        roaring_bitmap(InputIterator first, InputIterator last, const allocator_type& allocator = EASTL_ROARING_BITMAP_DEFAULT_ALLOCATOR);
+
+       ~roaring_bitmap();
+
+        this_type& operator=(const this_type& x);
+        void       swap(this_type& x);
+
+        allocator_type& get_allocator();
+        void            set_allocator(const allocator_type& allocator);
+
+        const_iterator begin() const;
+        const_iterator end() const;
+
+        bool      empty() const;
+        uint64_t  cardinality() const;                    // Number of values, which can be up to 2^32.
+        size_type container_count() const;
+        size_type size_in_bytes() const;                  // Memory used by the bitmap, including this object.
+
+        bool contains(uint32_t x) const;
+        bool add(uint32_t x);                             // Returns true if x wasn't already in the bitmap.
+        void add_range(uint64_t first, uint64_t last);    // Adds [first, last), where last can be up to 2^32.
+        bool remove(uint32_t x);                          // Returns true if x was in the bitmap.
+        void clear();
+
+        template <typename InputIterator>
+        void add(InputIterator first, InputIterator last);
+
+        bool run_optimize();                              // Returns true if any run containers are left.
+
+        uint32_t minimum() const;                         // The bitmap must not be empty.
+        uint32_t maximum() const;
+        uint64_t rank(uint32_t x) const;                  // Number of values <= x.
+        bool     select(uint64_t k, uint32_t& value) const; // Sets value to the k-th smallest value, counting from 0.
+
+        this_type& operator&=(const this_type& x);
+        this_type& operator|=(const this_type& x);
+        this_type& operator^=(const this_type& x);
+        this_type& and_not(const this_type& x);           // Removes the values of x.
+
+        bool operator==(const this_type& x) const;
+        bool operator!=(const this_type& x) const;
+
+        size_type serialized_size() const;
+        size_type serialize(void* pDestination) const;    // Writes serialized_size() bytes and returns that.
+        size_type deserialize(const void* pSource, size_type nSize); // Returns the number of bytes read, or 0 if the data is malformed.
+
+        bool validate() const;
+
+    protected:
+        enum Op
+        {
+            kOpAnd,
+            kOpOr,
+            kOpXor,
+            kOpAndNot
+        };
+
+        allocator_type        mAllocator;
+        container_vector_type mContainers; // Sorted by mnKey.
+
+    protected:
+        size_type DoLowerBound(uint16_t nKey) const;
+        void      DoCombine(const this_type& x, Op op);
+        bool      DoCombineContainers(RoaringContainer& a, const RoaringContainer& b, Op op);
+
+        static bool     DoContains(const RoaringContainer& c, uint16_t v);
+        static uint32_t DoRunUpperBound(const RoaringContainer& c, uint16_t v);
+        static uint32_t DoRank(const RoaringContainer& c, uint16_t v);
+        static uint16_t DoSelect(const RoaringContainer& c, uint32_t k);
+        static uint32_t DoCountRuns(const RoaringContainer& c);
+        static void     DoLoadWords(const RoaringContainer& c, BitsetWordType* pWords);
+        static bool     DoEqual(const RoaringContainer& a, const RoaringContainer& b);
+        static uint32_t DoPayloadSize(const RoaringContainer& c);
+
+        bool DoAdd(RoaringContainer& c, uint16_t v);
+        bool DoRemove(RoaringContainer& c, uint16_t v);
+        void DoRunInsert(RoaringContainer& c, uint32_t nIndex, uint16_t nStart, uint16_t nLength);
+
+        uint16_t*       DoAllocateValues(uint32_t n);
+        BitsetWordType* DoAllocateWords();
+        void            DoFreeData(RoaringContainer& c);
+        void            DoFreeAll();
+        void            DoReserve(RoaringContainer& c, uint32_t n);
+        void            DoSetData(RoaringContainer& c, void* pData, uint32_t nCapacity, uint8_t nType, uint32_t nSize);
+        RoaringContainer DoCopy(const RoaringContainer& c);
+
+        void DoToBitset(RoaringContainer& c);
+        void DoToRuns(RoaringContainer& c, uint32_t nRunCount);
+        void DoNormalize(RoaringContainer& c);
+
+        const uint8_t* DoReadContainer(RoaringContainer& c, const uint8_t* p, const uint8_t* pEnd, bool bRun);
+
+    }; // class roaring_bitmap
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // Word helpers
+    ///////////////////////////////////////////////////////////////////////
+
+    /// RoaringRangeOp
+    ///
+    /// Does w = op(w, mask) for the bits [nFirst, nLast] of a bitset
+    /// container, where op is a BitsetOrOp (set), BitsetAndNotOp (clear) or
+    /// BitsetXorOp (flip).
+    ///
+    template <typename Op>
+    inline void RoaringRangeOp(BitsetWordType* pWords, uint32_t nFirst, uint32_t nLast, Op op)
+    {
+        const uint32_t       iFirst    = nFirst >> kBitsPerWordShift;
+        const uint32_t       iLast     = nLast  >> kBitsPerWordShift;
+        const BitsetWordType nAll      = ~static_cast<BitsetWordType>(0);
+        const BitsetWordType firstMask = nAll << (nFirst & kBitsPerWordMask);
+        const BitsetWordType lastMask  = nAll >> (kBitsPerWordMask - (nLast & kBitsPerWordMask));
+
+        if(iFirst == iLast)
+            pWords[iFirst] = op(pWords[iFirst], firstMask & lastMask);
+        else
+        {
+            pWords[iFirst] = op(pWords[iFirst], firstMask);
+            for(uint32_t i = iFirst + 1; i < iLast; ++i)
+                pWords[i] = op(pWords[i], nAll);
+            pWords[iLast] = op(pWords[iLast], lastMask);
+        }
+    }
+
+
+    /// RoaringCountWords
+    ///
+    inline uint32_t RoaringCountWords(const BitsetWordType* pWords)
+    {
+        uint32_t n = 0;
+        for(uint32_t i = 0; i < kRoaringWordCount; ++i)
+            n += BitsetCountBits(pWords[i]);
+        return n;
+    }
+
+
+    /// RoaringNextBit
+    ///
+    /// Returns the first bit at or after i of a bitset container that is set
+    /// (if bSet) or clear (if !bSet), or 65536 if there is none.
+    ///
+    inline uint32_t RoaringNextBit(const BitsetWordType* pWords, uint32_t i, bool bSet)
+    {
+        if(i >= 65536)
+            return 65536;
+
+        const BitsetWordType nFlip = bSet ? 0 : ~static_cast<BitsetWordType>(0);
+        uint32_t       iWord = i >> kBitsPerWordShift;
+        BitsetWordType w     = (pWords[iWord] ^ nFlip) & (~static_cast<BitsetWordType>(0) << (i & kBitsPerWordMask));
+
+        while(!w)
+        {
+            if(++iWord == kRoaringWordCount)
+                return 65536;
+            w = pWords[iWord] ^ nFlip;
+        }
+        return (iWord << kBitsPerWordShift) + GetFirstBit(w);
+    }
+
+
+    inline uint8_t* RoaringWrite16(uint8_t* p, uint32_t x)
+    {
+        p[0] = (uint8_t)x;
+        p[1] = (uint8_t)(x >> 8);
+        return p + 2;
+    }
+
+    inline uint8_t* RoaringWrite32(uint8_t* p, uint32_t x)
+    {
+        p[0] = (uint8_t)x;
+        p[1] = (uint8_t)(x >> 8);
+        p[2] = (uint8_t)(x >> 16);
+        p[3] = (uint8_t)(x >> 24);
+        return p + 4;
+    }
+
+    inline uint32_t RoaringRead16(const uint8_t* p)
+        { return (uint32_t)p[0] | ((uint32_t)p[1] << 8); }
+
+    inline uint32_t RoaringRead32(const uint8_t* p)
+        { return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // roaring_bitmap
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename Allocator>
+    inline roaring_bitmap<Allocator>::roaring_bitmap()
+        : mAllocator(EASTL_ROARING_BITMAP_DEFAULT_NAME),
+          mContainers(mAllocator)
+    {
+    }
+
+
+    template <typename Allocator>
+    inline roaring_bitmap<Allocator>::roaring_bitmap(const allocator_type& allocator)
+        : mAllocator(allocator),
+          mContainers(allocator)
+    {
+    }
+
+
+    template <typename Allocator>
+    inline roaring_bitmap<Allocator>::roaring_bitmap(const this_type& x)
+        : mAllocator(x.mAllocator),
+          mContainers(x.mAllocator)
+    {
+        mContainers.reserve(x.mContainers.size());
+        for(size_type i = 0, iEnd = x.mContainers.size(); i < iEnd; ++i)
+            mContainers.push_back(DoCopy(x.mContainers[i]));
+    }
+
+
+    template <typename Allocator>
+    template <typename InputIterator>
+    inline roaring_bitmap<Allocator>::roaring_bitmap(InputIterator first, InputIterator last, const allocator_type& allocator)
+        : mAllocator(allocator),
+          mContainers(allocator)
+    {
+        add(first, last);
+    }
+
+
+    template <typename Allocator>
+    inline roaring_bitmap<Allocator>::~roaring_bitmap()
+    {
+        DoFreeAll();
+    }
+
+
+    template <typename Allocator>
+    inline typename roaring_bitmap<Allocator>::this_type&
+    roaring_bitmap<Allocator>::operator=(const this_type& x)
+    {
+        if(&x != this)
+        {
+            this_type temp(mAllocator); // We keep our allocator, as the other EASTL containers do.
+
+            temp.mContainers.reserve(x.mContainers.size());
+            for(size_type i = 0, iEnd = x.mContainers.size(); i < iEnd; ++i)
+                temp.mContainers.push_back(temp.DoCopy(x.mContainers[i]));
+            swap(temp);
+        }
+        return *this;
+    }
+
+
+    template <typename Allocator>
+    inline void roaring_bitmap<Allocator>::swap(this_type& x)
+    {
+        eastl::swap(mAllocator, x.mAllocator);
+        mContainers.swap(x.mContainers);
+    }
+
+
+    template <typename Allocator>
+    inline typename roaring_bitmap<Allocator>::allocator_type&
+    roaring_bitmap<Allocator>::get_allocator()
+    {
+        return mAllocator;
+    }
+
+
+    template <typename Allocator>
+    inline void roaring_bitmap<Allocator>::set_allocator(const allocator_type& allocator)
+    {
+        EASTL_ASSERT(mContainers.empty()); // The containers' data must be freed with the allocator that made it.
+        mAllocator = allocator;
+    }
+
+
+    template <typename Allocator>
+    inline typename roaring_bitmap<Allocator>::const_iterator
+    roaring_bitmap<Allocator>::begin() const
+    {
+        return const_iterator(mContainers.begin(), mContainers.end());
+    }
+
+
+    template <typename Allocator>
+    inline typename roaring_bitmap<Allocator>::const_iterator
+    roaring_bitmap<Allocator>::end() const
+    {
+        return const_iterator(mContainers.end(), mContainers.end());
+    }
+
+
+    template <typename Allocator>
+    inline bool roaring_bitmap<Allocator>::empty() const
+    {
+        return mContainers.empty();
+    }
+
+
+    template <typename Allocator>
+    inline uint64_t roaring_bitmap<Allocator>::cardinality() const
+    {
+        uint64_t n = 0;
+        for(size_type i = 0, iEnd = mContainers.size(); i < iEnd; ++i)
+            n += mContainers[i].mnCardinality;
+        return n;
+    }
+
+
+    template <typename Allocator>
+    inline typename roaring_bitmap<Allocator>::size_type
+    roaring_bitmap<Allocator>::container_count() const
+    {
+        return mContainers.size();
+    }
+
+
+    template <typename Allocator>
+    inline typename roaring_bitmap<Allocator>::size_type
+    roaring_bitmap<Allocator>::size_in_bytes() const
+    {
+        size_type n = (size_type)(sizeof(*this) + (mContainers.capacity() * sizeof(RoaringContainer)));
+        for(size_type i = 0, iEnd = mContainers.size(); i < iEnd; ++i)
+            n += mContainers[i].mnCapacity * (size_type)sizeof(uint16_t);
+        return n;
+    }
+
+
+    template <typename Allocator>
+    inline typename roaring_bitmap<Allocator>::size_type
+    roaring_bitmap<Allocator>::DoLowerBound(uint16_t nKey) const
+    {
+        size_type nLow = 0, nHigh = mContainers.size();
+
+        if(nHigh && (mContainers[nHigh - 1].mnKey < nKey)) // Values are often added in increasing order.
+            return nHigh;
+
+        while(nLow < nHigh)
+        {
+            const size_type nMid = (nLow + nHigh) / 2;
+            if(mContainers[nMid].mnKey < nKey)
+                nLow = nMid + 1;
+            else
+                nHigh = nMid;
+        }
+        return nLow;
+    }
+
+
+    template <typename Allocator>
+    bool roaring_bitmap<Allocator>::contains(uint32_t x) const
+    {
+        const uint16_t  nKey = (uint16_t)(x >> 16);
+        const size_type i    = DoLowerBound(nKey);
+
+        return (i < mContainers.size()) && (mContainers[i].mnKey == nKey) && DoContains(mContainers[i], (uint16_t)x);
+    }
+
+
+    template <typename Allocator>
+    bool roaring_bitmap<Allocator>::add(uint32_t x)
+    {
+        const uint16_t  nKey = (uint16_t)(x >> 16);
+        const size_type i    = DoLowerBound(nKey);
+
+        if((i == mContainers.size()) || (mContainers[i].mnKey != nKey))
+        {
+            RoaringContainer& c = *mContainers.insert(mContainers.begin() + i, RoaringContainer());
+
+            c.mnKey  = nKey;
+            c.mnType = RoaringContainer::kTypeArray;
+            DoReserve(c, 1);
+            c.Values()[0]   = (uint16_t)x;
+            c.mnSize        = 1;
+            c.mnCardinality = 1;
+            return true;
+        }
+
+        return DoAdd(mContainers[i], (uint16_t)x);
+    }
+
+
+    template <typename Allocator>
+    template <typename InputIterator>
+    inline void roaring_bitmap<Allocator>::add(InputIterator first, InputIterator last)
+    {
+        for(; first != last; ++first)
+            add((uint32_t)*first);
+    }
+
+
+    template <typename Allocator>
+    void roaring_bitmap<Allocator>::add_range(uint64_t first, uint64_t last)
+    {
+        EASTL_ASSERT(last <= (UINT64_C(1) << 32));
+
+        if(first >= last)
+            return;
+
+        const uint32_t nFirstKey = (uint32_t)(first >> 16);
+        const uint32_t nLastKey  = (uint32_t)((last - 1) >> 16);
+
+        for(uint32_t nKey = nFirstKey; nKey <= nLastKey; ++nKey)
+        {
+            const uint32_t  nLow  = (nKey == nFirstKey) ? (uint32_t)(first & 0xffff) : 0;
+            const uint32_t  nHigh = (nKey == nLastKey) ? (uint32_t)((last - 1) & 0xffff) : 0xffff;
+            const size_type i     = DoLowerBound((uint16_t)nKey);
+
+            if((i < mContainers.size()) && (mContainers[i].mnKey == nKey) && ((nLow != 0) || (nHigh != 0xffff)))
+            {
+                RoaringContainer& c = mContainers[i];
+
+                DoToBitset(c);
+                RoaringRangeOp(c.Words(), nLow, nHigh, BitsetOrOp());
+                c.mnCardinality = RoaringCountWords(c.Words());
+                DoNormalize(c);
+            }
+            else
+            {
+                // A new chunk, or one that the range fills: it becomes a single run.
+                if((i == mContainers.size()) || (mContainers[i].mnKey != nKey))
+                    mContainers.insert(mContainers.begin() + i, RoaringContainer());
+
+                RoaringContainer& c = mContainers[i];
+
+                DoFreeData(c);
+                c.mnKey  = (uint16_t)nKey;
+                c.mnSize = 0;
+                c.mnType = RoaringContainer::kTypeRun;
+                DoReserve(c, 2);
+                c.Values()[0]   = (uint16_t)nLow;
+                c.Values()[1]   = (uint16_t)(nHigh - nLow);
+                c.mnSize        = 1;
+                c.mnCardinality = nHigh - nLow + 1;
+            }
+        }
+    }
+
+
+    template <typename Allocator>
+    bool roaring_bitmap<Allocator>::remove(uint32_t x)
+    {
+        const uint16_t  nKey = (uint16_t)(x >> 16);
+        const size_type i    = DoLowerBound(nKey);
+
+        if((i == mContainers.size()) || (mContainers[i].mnKey != nKey) || !DoRemove(mContainers[i], (uint16_t)x))
+            return false;
+
+        if(!mContainers[i].mnCardinality)
+        {
+            DoFreeData(mContainers[i]);
+            mContainers.erase(mContainers.begin() + i);
+        }
+        return true;
+    }
+
+
+    template <typename Allocator>
+    inline void roaring_bitmap<Allocator>::clear()
+    {
+        DoFreeAll();
+        mContainers.clear();
+    }
+
+
+    template <typename Allocator>
+    bool roaring_bitmap<Allocator>::run_optimize()
+    {
+        bool bHasRuns = false;
+
+        for(size_type i = 0, iEnd = mContainers.size(); i < iEnd; ++i)
+        {
+            RoaringContainer& c = mContainers[i];
+
+            const uint32_t nRunCount  = DoCountRuns(c);
+            const uint32_t nRunBytes  = 2 + (4 * nRunCount);
+            const uint32_t nElseBytes = (c.mnCardinality <= kRoaringArrayMax) ? (2 * c.mnCardinality) : (kRoaringWordCount * sizeof(BitsetWordType));
+
+            if(nRunBytes < nElseBytes)
+            {
+                if(c.mnType != RoaringContainer::kTypeRun)
+                    DoToRuns(c, nRunCount);
+                bHasRuns = true;
+            }
+            else if(c.mnType == RoaringContainer::kTypeRun)
+                DoNormalize(c);
+        }
+
+        return bHasRuns;
+    }
+
+
+    template <typename Allocator>
+    inline uint32_t roaring_bitmap<Allocator>::minimum() const
+    {
+        EASTL_ASSERT(!mContainers.empty());
+        return ((uint32_t)mContainers.front().mnKey << 16) | DoSelect(mContainers.front(), 0);
+    }
+
+
+    template <typename Allocator>
+    uint32_t roaring_bitmap<Allocator>::maximum() const
+    {
+        EASTL_ASSERT(!mContainers.empty());
+
+        const RoaringContainer& c = mContainers.back();
+        const uint32_t nHigh      = (uint32_t)c.mnKey << 16;
+
+        switch(c.mnType)
+        {
+            case RoaringContainer::kTypeArray:
+                return nHigh | c.Values()[c.mnSize - 1];
+
+            case RoaringContainer::kTypeRun:
+                return nHigh | (uint32_t)(c.Values()[(c.mnSize * 2) - 2] + c.Values()[(c.mnSize * 2) - 1]);
+
+            default:
+            {
+                uint32_t i = kRoaringWordCount - 1;
+                while(!c.Words()[i])
+                    --i;
+                return nHigh | ((i << kBitsPerWordShift) + GetLastBit(c.Words()[i]));
+            }
+        }
+    }
+
+
+    template <typename Allocator>
+    uint64_t roaring_bitmap<Allocator>::rank(uint32_t x) const
+    {
+        const uint16_t nKey = (uint16_t)(x >> 16);
+        uint64_t       n    = 0;
+
+        for(size_type i = 0, iEnd = mContainers.size(); (i < iEnd) && (mContainers[i].mnKey <= nKey); ++i)
+        {
+            if(mContainers[i].mnKey < nKey)
+                n += mContainers[i].mnCardinality;
+            else
+                n += DoRank(mContainers[i], (uint16_t)x);
+        }
+
+        return n;
+    }
+
+
+    template <typename Allocator>
+    bool roaring_bitmap<Allocator>::select(uint64_t k, uint32_t& value) const
+    {
+        for(size_type i = 0, iEnd = mContainers.size(); i < iEnd; ++i)
+        {
+            const RoaringContainer& c = mContainers[i];
+
+            if(k < c.mnCardinality)
+            {
+                value = ((uint32_t)c.mnKey << 16) | DoSelect(c, (uint32_t)k);
+                return true;
+            }
+            k -= c.mnCardinality;
+        }
+
+        return false;
+    }
+
+
+    template <typename Allocator>
+    inline typename roaring_bitmap<Allocator>::this_type&
+    roaring_bitmap<Allocator>::operator&=(const this_type& x)
+    {
+        DoCombine(x, kOpAnd);
+        return *this;
+    }
+
+
+    template <typename Allocator>
+    inline typename roaring_bitmap<Allocator>::this_type&
+    roaring_bitmap<Allocator>::operator|=(const this_type& x)
+    {
+        DoCombine(x, kOpOr);
+        return *this;
+    }
+
+
+    template <typename Allocator>
+    inline typename roaring_bitmap<Allocator>::this_type&
+    roaring_bitmap<Allocator>::operator^=(const this_type& x)
+    {
+        DoCombine(x, kOpXor);
+        return *this;
+    }
+
+
+    template <typename Allocator>
+    inline typename roaring_bitmap<Allocator>::this_type&
+    roaring_bitmap<Allocator>::and_not(const this_type& x)
+    {
+        DoCombine(x, kOpAndNot);
+        return *this;
+    }
+
+
+    template <typename Allocator>
+    bool roaring_bitmap<Allocator>::operator==(const this_type& x) const
+    {
+        if(mContainers.size() != x.mContainers.size())
+            return false;
+
+        for(size_type i = 0, iEnd = mContainers.size(); i < iEnd; ++i)
+        {
+            if(!DoEqual(mContainers[i], x.mContainers[i]))
+                return false;
+        }
+
+        return true;
+    }
+
+
+    template <typename Allocator>
+    inline bool roaring_bitmap<Allocator>::operator!=(const this_type& x) const
+    {
+        return !operator==(x);
+    }
+
+
+    template <typename Allocator>
+    void roaring_bitmap<Allocator>::DoCombine(const this_type& x, Op op)
+    {
+        if(&x == this)
+        {
+            if((op == kOpXor) || (op == kOpAndNot))
+                clear();
+            return;
+        }
+
+        const size_type nSize  = mContainers.size();
+        const size_type nSizeX = x.mContainers.size();
+
+        container_vector_type result(mAllocator);
+        result.reserve((op == kOpAnd) ? eastl::min_alt(nSize, nSizeX) : (op == kOpAndNot) ? nSize : (nSize + nSizeX));
+
+        // Our containers are either moved to result, combined into result
+        // or freed; the containers of x are copied into result.
+        size_type i = 0, j = 0;
+
+        while((i < nSize) && (j < nSizeX))
+        {
+            RoaringContainer&       a = mContainers[i];
+            const RoaringContainer& b = x.mContainers[j];
+
+            if(a.mnKey < b.mnKey)
+            {
+                if(op == kOpAnd)
+                    DoFreeData(a);
+                else
+                    result.push_back(a);
+                ++i;
+            }
+            else if(b.mnKey < a.mnKey)
+            {
+                if((op == kOpOr) || (op == kOpXor))
+                    result.push_back(DoCopy(b));
+                ++j;
+            }
+            else
+            {
+                if(DoCombineContainers(a, b, op))
+                    result.push_back(a);
+                ++i;
+                ++j;
+            }
+        }
+
+        for(; i < nSize; ++i)
+        {
+            if(op == kOpAnd)
+                DoFreeData(mContainers[i]);
+            else
+                result.push_back(mContainers[i]);
+        }
+
+        if((op == kOpOr) || (op == kOpXor))
+        {
+            for(; j < nSizeX; ++j)
+                result.push_back(DoCopy(x.mContainers[j]));
+        }
+
+        mContainers.swap(result); // result now holds containers whose data we moved or freed, so it is simply dropped.
+    }
+
+
+    /// DoCombineContainers
+    ///
+    /// Sets a to op(a, b), where a and b have the same key. Returns false if
+    /// the result is empty, in which case a's data has been freed.
+    ///
+    template <typename Allocator>
+    bool roaring_bitmap<Allocator>::DoCombineContainers(RoaringContainer& a, const RoaringContainer& b, Op op)
+    {
+        if(((op == kOpAnd) || (op == kOpAndNot)) && (a.mnType == RoaringContainer::kTypeArray))
+        {
+            // The result is a subset of the array, so we filter it in place.
+            uint16_t* const       pValues = a.Values();
+            const bool            bKeep   = (op == kOpAnd);
+            uint32_t              n       = 0;
+
+            if(b.mnType == RoaringContainer::kTypeArray)
+            {
+                const uint16_t* pB    = b.Values();
+                const uint16_t* pBEnd = pB + b.mnSize;
+
+                for(uint32_t i = 0; i < a.mnSize; ++i)
+                {
+                    while((pB != pBEnd) && (*pB < pValues[i]))
+                        ++pB;
+                    if(((pB != pBEnd) && (*pB == pValues[i])) == bKeep)
+                        pValues[n++] = pValues[i];
+                }
+            }
+            else
+            {
+                for(uint32_t i = 0; i < a.mnSize; ++i)
+                {
+                    if(DoContains(b, pValues[i]) == bKeep)
+                        pValues[n++] = pValues[i];
+                }
+            }
+
+            a.mnSize = a.mnCardinality = n;
+        }
+        else if((op == kOpAnd) && (b.mnType == RoaringContainer::kTypeArray))
+        {
+            // The result is a subset of b's array.
+            uint16_t* const pValues = DoAllocateValues(b.mnSize);
+            uint32_t        n       = 0;
+
+            for(uint32_t i = 0; i < b.mnSize; ++i)
+            {
+                if(DoContains(a, b.Values()[i]))
+                    pValues[n++] = b.Values()[i];
+            }
+
+            DoSetData(a, pValues, b.mnSize, RoaringContainer::kTypeArray, n);
+            a.mnCardinality = n;
+        }
+        else if((a.mnType == RoaringContainer::kTypeRun) && (b.mnType == RoaringContainer::kTypeRun) && ((op == kOpAnd) || (op == kOpOr)))
+        {
+            // Intersection or union of two run containers: the result is runs too.
+            const uint32_t  nCapacity = (a.mnSize + b.mnSize) * 2;
+            uint16_t* const pRuns     = DoAllocateValues(nCapacity);
+            const uint16_t* pA = a.Values(), *pAEnd = pA + (a.mnSize * 2);
+            const uint16_t* pB = b.Values(), *pBEnd = pB + (b.mnSize * 2);
+            uint32_t        n  = 0, nCardinality = 0;
+
+            if(op == kOpAnd)
+            {
+                while((pA != pAEnd) && (pB != pBEnd))
+                {
+                    const uint32_t nALast = (uint32_t)pA[0] + pA[1];
+                    const uint32_t nBLast = (uint32_t)pB[0] + pB[1];
+                    const uint32_t nFirst = eastl::max_alt(pA[0], pB[0]);
+                    const uint32_t nLast  = eastl::min_alt(nALast, nBLast);
+
+                    if(nFirst <= nLast)
+                    {
+                        pRuns[n * 2]       = (uint16_t)nFirst;
+                        pRuns[(n * 2) + 1] = (uint16_t)(nLast - nFirst);
+                        nCardinality += nLast - nFirst + 1;
+                        ++n;
+                    }
+
+                    if(nALast < nBLast)
+                        pA += 2;
+                    else
+                        pB += 2;
+                }
+            }
+            else
+            {
+                // Take the runs in order of their start, extending the last
+                // run instead when they overlap or touch it.
+                while((pA != pAEnd) || (pB != pBEnd))
+                {
+                    const uint16_t*& pNext  = ((pB == pBEnd) || ((pA != pAEnd) && (pA[0] <= pB[0]))) ? pA : pB;
+                    const uint32_t   nFirst = pNext[0];
+                    const uint32_t   nLast  = nFirst + pNext[1];
+
+                    pNext += 2;
+
+                    if(n && (nFirst <= ((uint32_t)pRuns[(n * 2) - 2] + pRuns[(n * 2) - 1] + 1)))
+                        pRuns[(n * 2) - 1] = (uint16_t)(eastl::max_alt((uint32_t)pRuns[(n * 2) - 2] + pRuns[(n * 2) - 1], nLast) - pRuns[(n * 2) - 2]);
+                    else
+                    {
+                        pRuns[n * 2]       = (uint16_t)nFirst;
+                        pRuns[(n * 2) + 1] = (uint16_t)(nLast - nFirst);
+                        ++n;
+                    }
+                }
+
+                for(uint32_t i = 0; i < n; ++i)
+                    nCardinality += (uint32_t)pRuns[(i * 2) + 1] + 1;
+            }
+
+            DoSetData(a, pRuns, nCapacity, RoaringContainer::kTypeRun, n);
+            a.mnCardinality = nCardinality;
+        }
+        else if((a.mnType == RoaringContainer::kTypeArray) && (b.mnType == RoaringContainer::kTypeArray) && ((a.mnSize + b.mnSize) <= kRoaringArrayMax))
+        {
+            // Union or symmetric difference of two small arrays: merge them.
+            const uint32_t  nCapacity = a.mnSize + b.mnSize;
+            uint16_t* const pValues   = DoAllocateValues(nCapacity);
+            const uint16_t* pA = a.Values(), *pAEnd = pA + a.mnSize;
+            const uint16_t* pB = b.Values(), *pBEnd = pB + b.mnSize;
+            uint32_t        n  = 0;
+
+            while((pA != pAEnd) && (pB != pBEnd))
+            {
+                if(*pA < *pB)
+                    pValues[n++] = *pA++;
+                else if(*pB < *pA)
+                    pValues[n++] = *pB++;
+                else
+                {
+                    if(op == kOpOr)
+                        pValues[n++] = *pA;
+                    ++pA;
+                    ++pB;
+                }
+            }
+            while(pA != pAEnd)
+                pValues[n++] = *pA++;
+            while(pB != pBEnd)
+                pValues[n++] = *pB++;
+
+            DoSetData(a, pValues, nCapacity, RoaringContainer::kTypeArray, n);
+            a.mnCardinality = n;
+        }
+        else
+        {
+            // Everything else is done on a's bits.
+            DoToBitset(a);
+            BitsetWordType* const pWords = a.Words();
+
+            if(b.mnType == RoaringContainer::kTypeBitset)
+            {
+                switch(op)
+                {
+                    case kOpAnd:    BitsetCombineWords(pWords, b.Words(), kRoaringWordCount, BitsetAndOp());    break;
+                    case kOpOr:     BitsetCombineWords(pWords, b.Words(), kRoaringWordCount, BitsetOrOp());     break;
+                    case kOpXor:    BitsetCombineWords(pWords, b.Words(), kRoaringWordCount, BitsetXorOp());    break;
+                    case kOpAndNot: BitsetCombineWords(pWords, b.Words(), kRoaringWordCount, BitsetAndNotOp()); break;
+                }
+            }
+            else if(b.mnType == RoaringContainer::kTypeArray) // op is not kOpAnd, which is handled above.
+            {
+                for(uint32_t i = 0; i < b.mnSize; ++i)
+                {
+                    const uint32_t       v    = b.Values()[i];
+                    const BitsetWordType mask = static_cast<BitsetWordType>(1) << (v & kBitsPerWordMask);
+                    BitsetWordType&      w    = pWords[v >> kBitsPerWordShift];
+
+                    if(op == kOpOr)
+                        w |= mask;
+                    else if(op == kOpXor)
+                        w ^= mask;
+                    else
+                        w &= ~mask;
+                }
+            }
+            else
+            {
+                const uint16_t* const pRuns = b.Values();
+                uint32_t              nNext = 0; // For kOpAnd, the first value after the previous run.
+
+                for(uint32_t i = 0; i < b.mnSize; ++i)
+                {
+                    const uint32_t nStart = pRuns[i * 2];
+                    const uint32_t nLast  = nStart + pRuns[(i * 2) + 1];
+
+                    switch(op)
+                    {
+                        case kOpAnd:
+                            if(nNext < nStart)
+                                RoaringRangeOp(pWords, nNext, nStart - 1, BitsetAndNotOp());
+                            nNext = nLast + 1;
+                            break;
+
+                        case kOpOr:     RoaringRangeOp(pWords, nStart, nLast, BitsetOrOp());     break;
+                        case kOpXor:    RoaringRangeOp(pWords, nStart, nLast, BitsetXorOp());    break;
+                        case kOpAndNot: RoaringRangeOp(pWords, nStart, nLast, BitsetAndNotOp()); break;
+                    }
+                }
+
+                if((op == kOpAnd) && (nNext < 65536))
+                    RoaringRangeOp(pWords, nNext, 65535, BitsetAndNotOp());
+            }
+
+            a.mnCardinality = RoaringCountWords(pWords);
+            if(a.mnCardinality)
+                DoNormalize(a);
+        }
+
+        if(!a.mnCardinality)
+        {
+            DoFreeData(a);
+            return false;
+        }
+        return true;
+    }
+
+
+    template <typename Allocator>
+    typename roaring_bitmap<Allocator>::size_type
+    roaring_bitmap<Allocator>::serialized_size() const
+    {
+        const size_type nCount   = mContainers.size();
+        bool            bHasRuns = false;
+        size_type       n        = 0;
+
+        for(size_type i = 0; i < nCount; ++i)
+        {
+            bHasRuns = bHasRuns || (mContainers[i].mnType == RoaringContainer::kTypeRun);
+            n += DoPayloadSize(mContainers[i]);
+        }
+
+        n += bHasRuns ? (4 + ((nCount + 7) / 8)) : 8; // Cookie, and the run flags or container count.
+        n += 4 * nCount;                              // Keys and cardinalities.
+        if(!bHasRuns || (nCount >= kNoOffsetThreshold))
+            n += 4 * nCount;                          // Offsets.
+        return n;
+    }
+
+
+    template <typename Allocator>
+    typename roaring_bitmap<Allocator>::size_type
+    roaring_bitmap<Allocator>::serialize(void* pDestination) const
+    {
+        const size_type nCount   = mContainers.size();
+        bool            bHasRuns = false;
+        uint8_t*        p        = static_cast<uint8_t*>(pDestination);
+
+        for(size_type i = 0; i < nCount; ++i)
+            bHasRuns = bHasRuns || (mContainers[i].mnType == RoaringContainer::kTypeRun);
+
+        if(bHasRuns)
+        {
+            p = RoaringWrite32(p, kSerialCookie | ((uint32_t)(nCount - 1) << 16));
+            memset(p, 0, (nCount + 7) / 8);
+            for(size_type i = 0; i < nCount; ++i)
+            {
+                if(mContainers[i].mnType == RoaringContainer::kTypeRun)
+                    p[i / 8] |= (uint8_t)(1 << (i % 8));
+            }
+            p += (nCount + 7) / 8;
+        }
+        else
+        {
+            p = RoaringWrite32(p, kSerialCookieNoRuns);
+            p = RoaringWrite32(p, (uint32_t)nCount);
+        }
+
+        for(size_type i = 0; i < nCount; ++i)
+        {
+            p = RoaringWrite16(p, mContainers[i].mnKey);
+            p = RoaringWrite16(p, mContainers[i].mnCardinality - 1);
+        }
+
+        if(!bHasRuns || (nCount >= kNoOffsetThreshold))
+        {
+            uint32_t nOffset = (uint32_t)((p - static_cast<uint8_t*>(pDestination)) + (4 * nCount));
+            for(size_type i = 0; i < nCount; ++i)
+            {
+                p = RoaringWrite32(p, nOffset);
+                nOffset += DoPayloadSize(mContainers[i]);
+            }
+        }
+
+        for(size_type i = 0; i < nCount; ++i)
+        {
+            const RoaringContainer& c = mContainers[i];
+
+            if(c.mnType == RoaringContainer::kTypeBitset)
+            {
+                for(uint32_t w = 0; w < kRoaringWordCount; ++w)
+                {
+                    for(uint32_t b = 0; b < sizeof(BitsetWordType); ++b)
+                        *p++ = (uint8_t)(c.Words()[w] >> (b * 8));
+                }
+            }
+            else
+            {
+                const uint32_t nValueCount = (c.mnType == RoaringContainer::kTypeRun) ? (c.mnSize * 2) : c.mnSize;
+
+                if(c.mnType == RoaringContainer::kTypeRun)
+                    p = RoaringWrite16(p, c.mnSize);
+                for(uint32_t v = 0; v < nValueCount; ++v)
+                    p = RoaringWrite16(p, c.Values()[v]);
+            }
+        }
+
+        return (size_type)(p - static_cast<uint8_t*>(pDestination));
+    }
+
+
+    template <typename Allocator>
+    typename roaring_bitmap<Allocator>::size_type
+    roaring_bitmap<Allocator>::deserialize(const void* pSource, size_type nSize)
+    {
+        const uint8_t* const pBegin    = static_cast<const uint8_t*>(pSource);
+        const uint8_t* const pEnd      = pBegin + nSize;
+        const uint8_t*       p         = pBegin;
+        const uint8_t*       pRunFlags = NULL;
+        uint32_t             nCount;
+
+        clear();
+
+        if(nSize < 4)
+            return 0;
+
+        const uint32_t nCookie = RoaringRead32(p);
+        p += 4;
+
+        if((nCookie & 0xffff) == kSerialCookie)
+        {
+            nCount    = (nCookie >> 16) + 1;
+            pRunFlags = p;
+            if((size_type)(pEnd - p) < ((nCount + 7) / 8))
+                return 0;
+            p += (nCount + 7) / 8;
+        }
+        else if((nCookie == kSerialCookieNoRuns) && ((pEnd - p) >= 4))
+        {
+            nCount = RoaringRead32(p);
+            p += 4;
+            if(nCount > 65536)
+                return 0;
+        }
+        else
+            return 0;
+
+        const uint8_t* const pHeaders = p;
+        if((size_type)(pEnd - p) < (4 * nCount))
+            return 0;
+        p += 4 * nCount;
+
+        if(!pRunFlags || (nCount >= kNoOffsetThreshold)) // The containers follow each other, so we don't need the offsets.
+        {
+            if((size_type)(pEnd - p) < (4 * nCount))
+                return 0;
+            p += 4 * nCount;
+        }
+
+        mContainers.reserve(nCount);
+
+        for(uint32_t i = 0; i < nCount; ++i)
+        {
+            RoaringContainer c = RoaringContainer();
+            c.mnKey         = (uint16_t)RoaringRead16(pHeaders + (4 * i));
+            c.mnCardinality = RoaringRead16(pHeaders + (4 * i) + 2) + 1;
+
+            const bool bRun = pRunFlags && ((pRunFlags[i / 8] >> (i % 8)) & 1);
+
+            if(!mContainers.empty() && (c.mnKey <= mContainers.back().mnKey))
+                p = NULL;
+            else
+                p = DoReadContainer(c, p, pEnd, bRun);
+
+            if(!p)
+            {
+                DoFreeData(c);
+                clear();
+                return 0;
+            }
+            mContainers.push_back(c);
+        }
+
+        return (size_type)(p - pBegin);
+    }
+
+
+    /// DoReadContainer
+    ///
+    /// Reads the data of c, whose key and cardinality are set, from the
+    /// serialized bytes at p. Returns the end of the data, or NULL if it is
+    /// malformed or truncated.
+    ///
+    template <typename Allocator>
+    const uint8_t* roaring_bitmap<Allocator>::DoReadContainer(RoaringContainer& c, const uint8_t* p, const uint8_t* pEnd, bool bRun)
+    {
+        if(bRun)
+        {
+            if((pEnd - p) < 2)
+                return NULL;
+
+            const uint32_t nRunCount = RoaringRead16(p);
+            p += 2;
+            if((uint32_t)(pEnd - p) < (4 * nRunCount))
+                return NULL;
+
+            c.mnType = RoaringContainer::kTypeRun;
+            DoReserve(c, nRunCount * 2);
+
+            uint32_t nNext = 0, nTotal = 0; // nNext is the first value after the previous run.
+            for(uint32_t i = 0; i < nRunCount; ++i, p += 4)
+            {
+                const uint32_t nStart  = RoaringRead16(p);
+                const uint32_t nLength = RoaringRead16(p + 2);
+
+                if(((i != 0) && (nStart <= nNext)) || ((nStart + nLength) > 65535))
+                    return NULL;
+                c.Values()[i * 2]       = (uint16_t)nStart;
+                c.Values()[(i * 2) + 1] = (uint16_t)nLength;
+                nNext   = nStart + nLength + 1;
+                nTotal += nLength + 1;
+            }
+
+            c.mnSize = nRunCount;
+            return (nTotal == c.mnCardinality) ? p : NULL;
+        }
+        else if(c.mnCardinality <= kRoaringArrayMax)
+        {
+            if((uint32_t)(pEnd - p) < (2 * c.mnCardinality))
+                return NULL;
+
+            c.mnType = RoaringContainer::kTypeArray;
+            DoReserve(c, c.mnCardinality);
+
+            for(uint32_t i = 0; i < c.mnCardinality; ++i, p += 2)
+            {
+                c.Values()[i] = (uint16_t)RoaringRead16(p);
+                if((i != 0) && (c.Values()[i] <= c.Values()[i - 1]))
+                    return NULL;
+            }
+
+            c.mnSize = c.mnCardinality;
+            return p;
+        }
+        else
+        {
+            if((uint32_t)(pEnd - p) < (kRoaringWordCount * sizeof(BitsetWordType)))
+                return NULL;
+
+            DoSetData(c, DoAllocateWords(), kRoaringWordCount * (sizeof(BitsetWordType) / sizeof(uint16_t)), RoaringContainer::kTypeBitset, 0);
+
+            for(uint32_t w = 0; w < kRoaringWordCount; ++w)
+            {
+                BitsetWordType x = 0;
+                for(uint32_t b = 0; b < sizeof(BitsetWordType); ++b)
+                    x |= static_cast<BitsetWordType>(*p++) << (b * 8);
+                c.Words()[w] = x;
+            }
+
+            return (RoaringCountWords(c.Words()) == c.mnCardinality) ? p : NULL;
+        }
+    }
+
+
+    template <typename Allocator>
+    bool roaring_bitmap<Allocator>::validate() const
+    {
+        for(size_type i = 0, iEnd = mContainers.size(); i < iEnd; ++i)
+        {
+            const RoaringContainer& c = mContainers[i];
+
+            if(!c.mnCardinality || ((i != 0) && (c.mnKey <= mContainers[i - 1].mnKey)))
+                return false;
+
+            switch(c.mnType)
+            {
+                case RoaringContainer::kTypeArray:
+                    if((c.mnSize != c.mnCardinality) || (c.mnSize > kRoaringArrayMax) || (c.mnSize > c.mnCapacity))
+                        return false;
+                    for(uint32_t j = 1; j < c.mnSize; ++j)
+                    {
+                        if(c.Values()[j] <= c.Values()[j - 1])
+                            return false;
+                    }
+                    break;
+
+                case RoaringContainer::kTypeBitset:
+                    if((c.mnCardinality <= kRoaringArrayMax) || (RoaringCountWords(c.Words()) != c.mnCardinality))
+                        return false;
+                    break;
+
+                case RoaringContainer::kTypeRun:
+                {
+                    uint32_t nTotal = 0;
+
+                    if(!c.mnSize || ((c.mnSize * 2) > c.mnCapacity))
+                        return false;
+                    for(uint32_t j = 0; j < c.mnSize; ++j)
+                    {
+                        const uint32_t nStart = c.Values()[j * 2];
+                        const uint32_t nLast  = nStart + c.Values()[(j * 2) + 1];
+
+                        if((nLast > 65535) || ((j != 0) && (nStart <= (uint32_t)(c.Values()[(j * 2) - 2] + c.Values()[(j * 2) - 1] + 1))))
+                            return false; // Runs must be separated by at least one missing value.
+                        nTotal += nLast - nStart + 1;
+                    }
+                    if(nTotal != c.mnCardinality)
+                        return false;
+                    break;
+                }
+
+                default:
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+
+    template <typename Allocator>
+    bool roaring_bitmap<Allocator>::DoContains(const RoaringContainer& c, uint16_t v)
+    {
+        switch(c.mnType)
+        {
+            case RoaringContainer::kTypeArray:
+            {
+                const uint16_t* const pEnd = c.Values() + c.mnSize;
+                const uint16_t* const pPos = eastl::lower_bound(c.Values(), pEnd, v);
+                return (pPos != pEnd) && (*pPos == v);
+            }
+
+            case RoaringContainer::kTypeBitset:
+                return (c.Words()[v >> kBitsPerWordShift] & (static_cast<BitsetWordType>(1) << (v & kBitsPerWordMask))) != 0;
+
+            default:
+            {
+                const uint32_t n = DoRunUpperBound(c, v);
+                return n && ((uint32_t)(v - c.Values()[(n * 2) - 2]) <= c.Values()[(n * 2) - 1]);
+            }
+        }
+    }
+
+
+    /// DoRunUpperBound
+    ///
+    /// Returns the number of runs of the run container c that start at or
+    /// before v. So v can only be in the run before that.
+    ///
+    template <typename Allocator>
+    uint32_t roaring_bitmap<Allocator>::DoRunUpperBound(const RoaringContainer& c, uint16_t v)
+    {
+        const uint16_t* const pRuns = c.Values();
+        uint32_t nLow = 0, nHigh = c.mnSize;
+
+        while(nLow < nHigh)
+        {
+            const uint32_t nMid = (nLow + nHigh) / 2;
+            if(pRuns[nMid * 2] <= v)
+                nLow = nMid + 1;
+            else
+                nHigh = nMid;
+        }
+        return nLow;
+    }
+
+
+    template <typename Allocator>
+    uint32_t roaring_bitmap<Allocator>::DoRank(const RoaringContainer& c, uint16_t v)
+    {
+        switch(c.mnType)
+        {
+            case RoaringContainer::kTypeArray:
+                return (uint32_t)(eastl::upper_bound(c.Values(), c.Values() + c.mnSize, v) - c.Values());
+
+            case RoaringContainer::kTypeBitset:
+            {
+                const uint32_t iWord = (uint32_t)v >> kBitsPerWordShift;
+                uint32_t       n     = 0;
+
+                for(uint32_t i = 0; i < iWord; ++i)
+                    n += BitsetCountBits(c.Words()[i]);
+                return n + BitsetCountBits(c.Words()[iWord] & (~static_cast<BitsetWordType>(0) >> (kBitsPerWordMask - (v & kBitsPerWordMask))));
+            }
+
+            default:
+            {
+                const uint32_t nRuns = DoRunUpperBound(c, v);
+                uint32_t       n     = 0;
+
+                for(uint32_t i = 0; i < nRuns; ++i)
+                    n += (uint32_t)c.Values()[(i * 2) + 1] + 1;
+                if(nRuns) // The last of these runs may go past v.
+                    n -= c.Values()[(nRuns * 2) - 1] - eastl::min_alt((uint32_t)c.Values()[(nRuns * 2) - 1], (uint32_t)(v - c.Values()[(nRuns * 2) - 2]));
+                return n;
+            }
+        }
+    }
+
+
+    template <typename Allocator>
+    uint16_t roaring_bitmap<Allocator>::DoSelect(const RoaringContainer& c, uint32_t k)
+    {
+        EASTL_ASSERT(k < c.mnCardinality);
+
+        switch(c.mnType)
+        {
+            case RoaringContainer::kTypeArray:
+                return c.Values()[k];
+
+            case RoaringContainer::kTypeBitset:
+            {
+                for(uint32_t i = 0; ; ++i)
+                {
+                    BitsetWordType w = c.Words()[i];
+                    const uint32_t n = BitsetCountBits(w);
+
+                    if(k < n)
+                    {
+                        for(; k; --k)
+                            w &= (w - 1);
+                        return (uint16_t)((i << kBitsPerWordShift) + GetFirstBit(w));
+                    }
+                    k -= n;
+                }
+            }
+
+            default:
+            {
+                for(uint32_t i = 0; ; ++i)
+                {
+                    const uint32_t nLength = c.Values()[(i * 2) + 1];
+
+                    if(k <= nLength)
+                        return (uint16_t)(c.Values()[i * 2] + k);
+                    k -= nLength + 1;
+                }
+            }
+        }
+    }
+
+
+    template <typename Allocator>
+    uint32_t roaring_bitmap<Allocator>::DoCountRuns(const RoaringContainer& c)
+    {
+        switch(c.mnType)
+        {
+            case RoaringContainer::kTypeArray:
+            {
+                uint32_t n = 1;
+                for(uint32_t i = 1; i < c.mnSize; ++i)
+                {
+                    if(c.Values()[i] != (uint16_t)(c.Values()[i - 1] + 1))
+                        ++n;
+                }
+                return n;
+            }
+
+            case RoaringContainer::kTypeBitset:
+            {
+                // A run starts at each set bit whose lower neighbor is clear.
+                BitsetWordType nCarry = 0;
+                uint32_t       n      = 0;
+
+                for(uint32_t i = 0; i < kRoaringWordCount; ++i)
+                {
+                    const BitsetWordType w = c.Words()[i];
+                    n += BitsetCountBits(w & ~((w << 1) | nCarry));
+                    nCarry = w >> kBitsPerWordMask;
+                }
+                return n;
+            }
+
+            default:
+                return c.mnSize;
+        }
+    }
+
+
+    /// DoLoadWords
+    ///
+    /// Writes the values of c as kRoaringWordCount words of bits.
+    ///
+    template <typename Allocator>
+    void roaring_bitmap<Allocator>::DoLoadWords(const RoaringContainer& c, BitsetWordType* pWords)
+    {
+        if(c.mnType == RoaringContainer::kTypeBitset)
+        {
+            memcpy(pWords, c.Words(), kRoaringWordCount * sizeof(BitsetWordType));
+            return;
+        }
+
+        memset(pWords, 0, kRoaringWordCount * sizeof(BitsetWordType));
+
+        if(c.mnType == RoaringContainer::kTypeArray)
+        {
+            for(uint32_t i = 0; i < c.mnSize; ++i)
+                pWords[c.Values()[i] >> kBitsPerWordShift] |= static_cast<BitsetWordType>(1) << (c.Values()[i] & kBitsPerWordMask);
+        }
+        else
+        {
+            for(uint32_t i = 0; i < c.mnSize; ++i)
+                RoaringRangeOp(pWords, c.Values()[i * 2], (uint32_t)c.Values()[i * 2] + c.Values()[(i * 2) + 1], BitsetOrOp());
+        }
+    }
+
+
+    template <typename Allocator>
+    bool roaring_bitmap<Allocator>::DoEqual(const RoaringContainer& a, const RoaringContainer& b)
+    {
+        if((a.mnKey != b.mnKey) || (a.mnCardinality != b.mnCardinality))
+            return false;
+
+        if(a.mnType == b.mnType)
+        {
+            if(a.mnType == RoaringContainer::kTypeBitset)
+                return memcmp(a.Words(), b.Words(), kRoaringWordCount * sizeof(BitsetWordType)) == 0;
+            if(a.mnType == RoaringContainer::kTypeArray)
+                return memcmp(a.Values(), b.Values(), a.mnSize * sizeof(uint16_t)) == 0;
+            return (a.mnSize == b.mnSize) && (memcmp(a.Values(), b.Values(), a.mnSize * 2 * sizeof(uint16_t)) == 0); // Runs are never adjacent, so they are unique.
+        }
+
+        // Containers of different types can still hold the same values.
+
+        BitsetWordType wordsA[kRoaringWordCount];
+        BitsetWordType wordsB[kRoaringWordCount];
+
+        DoLoadWords(a, wordsA);
+        DoLoadWords(b, wordsB);
+        return memcmp(wordsA, wordsB, sizeof(wordsA)) == 0;
+    }
+
+
+    /// DoPayloadSize
+    ///
+    /// Returns the serialized size of the data of c.
+    ///
+    template <typename Allocator>
+    inline uint32_t roaring_bitmap<Allocator>::DoPayloadSize(const RoaringContainer& c)
+    {
+        switch(c.mnType)
+        {
+            case RoaringContainer::kTypeArray:  return 2 * c.mnSize;
+            case RoaringContainer::kTypeBitset: return kRoaringWordCount * sizeof(BitsetWordType);
+            default:                            return 2 + (4 * c.mnSize);
+        }
+    }
+
+
+    template <typename Allocator>
+    bool roaring_bitmap<Allocator>::DoAdd(RoaringContainer& c, uint16_t v)
+    {
+        if(c.mnType == RoaringContainer::kTypeArray)
+        {
+            uint16_t* const pBegin = c.Values();
+            uint16_t* const pEnd   = pBegin + c.mnSize;
+            uint16_t* const pPos   = (pEnd[-1] < v) ? pEnd : eastl::lower_bound(pBegin, pEnd, v);
+
+            if((pPos != pEnd) && (*pPos == v))
+                return false;
+
+            if(c.mnSize < kRoaringArrayMax)
+            {
+                const uint32_t nIndex = (uint32_t)(pPos - pBegin);
+
+                DoReserve(c, c.mnSize + 1);
+                memmove(c.Values() + nIndex + 1, c.Values() + nIndex, (c.mnSize - nIndex) * sizeof(uint16_t));
+                c.Values()[nIndex] = v;
+                ++c.mnSize;
+                ++c.mnCardinality;
+                return true;
+            }
+
+            DoToBitset(c);
+        }
+
+        if(c.mnType == RoaringContainer::kTypeBitset)
+        {
+            BitsetWordType&      w    = c.Words()[v >> kBitsPerWordShift];
+            const BitsetWordType mask = static_cast<BitsetWordType>(1) << (v & kBitsPerWordMask);
+
+            if(w & mask)
+                return false;
+            w |= mask;
+            ++c.mnCardinality;
+            return true;
+        }
+
+        // Run container: extend the neighboring runs if we can, else add a run.
+        const uint32_t n = DoRunUpperBound(c, v);
+        uint16_t*      pRuns;
+
+        if(n)
+        {
+            pRuns = c.Values();
+            const uint32_t nOffset = (uint32_t)(v - pRuns[(n * 2) - 2]);
+
+            if(nOffset <= pRuns[(n * 2) - 1])
+                return false;
+
+            if(nOffset == (uint32_t)pRuns[(n * 2) - 1] + 1)
+            {
+                ++pRuns[(n * 2) - 1];
+                if((n < c.mnSize) && (pRuns[n * 2] == v + 1)) // Merge with the next run.
+                {
+                    pRuns[(n * 2) - 1] = (uint16_t)(pRuns[(n * 2) - 1] + pRuns[(n * 2) + 1] + 1);
+                    memmove(pRuns + (n * 2), pRuns + (n * 2) + 2, (c.mnSize - n - 1) * 2 * sizeof(uint16_t));
+                    --c.mnSize;
+                }
+                ++c.mnCardinality;
+                return true;
+            }
+        }
+
+        pRuns = c.Values();
+        if((n < c.mnSize) && (pRuns[n * 2] == v + 1))
+        {
+            pRuns[n * 2] = v;
+            ++pRuns[(n * 2) + 1];
+        }
+        else
+            DoRunInsert(c, n, v, 0);
+
+        ++c.mnCardinality;
+        return true;
+    }
+
+
+    template <typename Allocator>
+    bool roaring_bitmap<Allocator>::DoRemove(RoaringContainer& c, uint16_t v)
+    {
+        switch(c.mnType)
+        {
+            case RoaringContainer::kTypeArray:
+            {
+                uint16_t* const pEnd = c.Values() + c.mnSize;
+                uint16_t* const pPos = eastl::lower_bound(c.Values(), pEnd, v);
+
+                if((pPos == pEnd) || (*pPos != v))
+                    return false;
+                memmove(pPos, pPos + 1, (size_t)(pEnd - pPos - 1) * sizeof(uint16_t));
+                --c.mnSize;
+                break;
+            }
+
+            case RoaringContainer::kTypeBitset:
+            {
+                BitsetWordType&      w    = c.Words()[v >> kBitsPerWordShift];
+                const BitsetWordType mask = static_cast<BitsetWordType>(1) << (v & kBitsPerWordMask);
+
+                if(!(w & mask))
+                    return false;
+                w &= ~mask;
+                if(--c.mnCardinality == kRoaringArrayMax)
+                    DoNormalize(c);
+                return true;
+            }
+
+            default:
+            {
+                const uint32_t n = DoRunUpperBound(c, v);
+                if(!n)
+                    return false;
+
+                uint16_t* const pRun    = c.Values() + (n * 2) - 2;
+                const uint32_t  nStart  = pRun[0];
+                const uint32_t  nLength = pRun[1];
+
+                if((uint32_t)(v - nStart) > nLength)
+                    return false;
+
+                if(!nLength)
+                {
+                    memmove(pRun, pRun + 2, (c.mnSize - n) * 2 * sizeof(uint16_t));
+                    --c.mnSize;
+                }
+                else if(v == nStart)
+                {
+                    ++pRun[0];
+                    --pRun[1];
+                }
+                else if(v == nStart + nLength)
+                    --pRun[1];
+                else // Split the run in two.
+                {
+                    pRun[1] = (uint16_t)(v - nStart - 1);
+                    DoRunInsert(c, n, (uint16_t)(v + 1), (uint16_t)(nStart + nLength - v - 1));
+                }
+                break;
+            }
+        }
+
+        --c.mnCardinality;
+        return true;
+    }
+
+
+    template <typename Allocator>
+    void roaring_bitmap<Allocator>::DoRunInsert(RoaringContainer& c, uint32_t nIndex, uint16_t nStart, uint16_t nLength)
+    {
+        DoReserve(c, (c.mnSize + 1) * 2);
+
+        uint16_t* const pRun = c.Values() + (nIndex * 2);
+        memmove(pRun + 2, pRun, (c.mnSize - nIndex) * 2 * sizeof(uint16_t));
+        pRun[0] = nStart;
+        pRun[1] = nLength;
+        ++c.mnSize;
+    }
+
+
+    template <typename Allocator>
+    inline uint16_t* roaring_bitmap<Allocator>::DoAllocateValues(uint32_t n)
+    {
+        return static_cast<uint16_t*>(allocate_memory(mAllocator, n * sizeof(uint16_t), EASTL_ALIGN_OF(BitsetWordType), 0));
+    }
+
+
+    template <typename Allocator>
+    inline BitsetWordType* roaring_bitmap<Allocator>::DoAllocateWords()
+    {
+        return static_cast<BitsetWordType*>(allocate_memory(mAllocator, kRoaringWordCount * sizeof(BitsetWordType), EASTL_ALIGN_OF(BitsetWordType), 0));
+    }
+
+
+    template <typename Allocator>
+    inline void roaring_bitmap<Allocator>::DoFreeData(RoaringContainer& c)
+    {
+        if(c.mpData)
+            EASTLFree(mAllocator, c.mpData, c.mnCapacity * sizeof(uint16_t));
+        c.mpData     = NULL;
+        c.mnCapacity = 0;
+    }
+
+
+    template <typename Allocator>
+    inline void roaring_bitmap<Allocator>::DoFreeAll()
+    {
+        for(size_type i = 0, iEnd = mContainers.size(); i < iEnd; ++i)
+            DoFreeData(mContainers[i]);
+    }
+
+
+    /// DoReserve
+    ///
+    /// Makes room for n uint16_t values in an array or run container,
+    /// doubling its capacity so that repeated adds take amortized constant
+    /// time.
+    ///
+    template <typename Allocator>
+    void roaring_bitmap<Allocator>::DoReserve(RoaringContainer& c, uint32_t n)
+    {
+        if(n > c.mnCapacity)
+        {
+            const uint32_t  nUsed     = (c.mnType == RoaringContainer::kTypeRun) ? (c.mnSize * 2) : c.mnSize;
+            const uint32_t  nCapacity = eastl::max_alt(n, eastl::min_alt(c.mnCapacity * 2, (uint32_t)65536));
+            uint16_t* const pValues   = DoAllocateValues(nCapacity);
+
+            if(nUsed)
+                memcpy(pValues, c.Values(), nUsed * sizeof(uint16_t));
+            DoFreeData(c);
+            c.mpData     = pValues;
+            c.mnCapacity = nCapacity;
+        }
+    }
+
+
+    /// DoSetData
+    ///
+    /// Replaces the data of c, freeing the old data.
+    ///
+    template <typename Allocator>
+    inline void roaring_bitmap<Allocator>::DoSetData(RoaringContainer& c, void* pData, uint32_t nCapacity, uint8_t nType, uint32_t nSize)
+    {
+        DoFreeData(c);
+        c.mpData     = pData;
+        c.mnCapacity = nCapacity;
+        c.mnType     = nType;
+        c.mnSize     = nSize;
+    }
+
+
+    template <typename Allocator>
+    RoaringContainer roaring_bitmap<Allocator>::DoCopy(const RoaringContainer& c)
+    {
+        RoaringContainer result(c);
+
+        result.mnCapacity = (c.mnType == RoaringContainer::kTypeBitset) ? c.mnCapacity : (c.mnType == RoaringContainer::kTypeRun) ? (c.mnSize * 2) : c.mnSize;
+        result.mpData     = DoAllocateValues(result.mnCapacity);
+        memcpy(result.mpData, c.mpData, result.mnCapacity * sizeof(uint16_t));
+        return result;
+    }
+
+
+    template <typename Allocator>
+    void roaring_bitmap<Allocator>::DoToBitset(RoaringContainer& c)
+    {
+        if(c.mnType != RoaringContainer::kTypeBitset)
+        {
+            BitsetWordType* const pWords = DoAllocateWords();
+
+            DoLoadWords(c, pWords);
+            DoSetData(c, pWords, kRoaringWordCount * (sizeof(BitsetWordType) / sizeof(uint16_t)), RoaringContainer::kTypeBitset, 0);
+        }
+    }
+
+
+    template <typename Allocator>
+    void roaring_bitmap<Allocator>::DoToRuns(RoaringContainer& c, uint32_t nRunCount)
+    {
+        uint16_t* const pRuns = DoAllocateValues(nRunCount * 2);
+        uint32_t        n     = 0;
+
+        if(c.mnType == RoaringContainer::kTypeArray)
+        {
+            for(uint32_t i = 0; i < c.mnSize; ++i)
+            {
+                if(n && ((uint32_t)(pRuns[(n * 2) - 2] + pRuns[(n * 2) - 1] + 1) == c.Values()[i]))
+                    ++pRuns[(n * 2) - 1];
+                else
+                {
+                    pRuns[n * 2]       = c.Values()[i];
+                    pRuns[(n * 2) + 1] = 0;
+                    ++n;
+                }
+            }
+        }
+        else
+        {
+            for(uint32_t nStart = RoaringNextBit(c.Words(), 0, true); nStart < 65536; ++n)
+            {
+                const uint32_t nEnd = RoaringNextBit(c.Words(), nStart, false);
+
+                pRuns[n * 2]       = (uint16_t)nStart;
+                pRuns[(n * 2) + 1] = (uint16_t)(nEnd - nStart - 1);
+                nStart = RoaringNextBit(c.Words(), nEnd, true);
+            }
+        }
+
+        EASTL_ASSERT(n == nRunCount);
+        DoSetData(c, pRuns, nRunCount * 2, RoaringContainer::kTypeRun, nRunCount);
+    }
+
+
+    /// DoNormalize
+    ///
+    /// Turns c into an array if it has up to kRoaringArrayMax values, else
+    /// into a bitset.
+    ///
+    template <typename Allocator>
+    void roaring_bitmap<Allocator>::DoNormalize(RoaringContainer& c)
+    {
+        if(c.mnCardinality > kRoaringArrayMax)
+            DoToBitset(c);
+        else if(c.mnType != RoaringContainer::kTypeArray)
+        {
+            uint16_t* const pValues = DoAllocateValues(c.mnCardinality);
+            uint32_t        n       = 0;
+
+            if(c.mnType == RoaringContainer::kTypeBitset)
+            {
+                for(uint32_t i = 0; i < kRoaringWordCount; ++i)
+                {
+                    for(BitsetWordType w = c.Words()[i]; w; w &= (w - 1))
+                        pValues[n++] = (uint16_t)((i << kBitsPerWordShift) + GetFirstBit(w));
+                }
+            }
+            else
+            {
+                for(uint32_t i = 0; i < c.mnSize; ++i)
+                {
+                    for(uint32_t v = c.Values()[i * 2], vEnd = v + c.Values()[(i * 2) + 1]; v <= vEnd; ++v)
+                        pValues[n++] = (uint16_t)v;
+                }
+            }
+
+            DoSetData(c, pValues, c.mnCardinality, RoaringContainer::kTypeArray, n);
+        }
+    }
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // global operators
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename Allocator>
+    inline roaring_bitmap<Allocator> operator&(const roaring_bitmap<Allocator>& a, const roaring_bitmap<Allocator>& b)
+    {
+        return roaring_bitmap<Allocator>(a) &= b;
+    }
+
+    template <typename Allocator>
+    inline roaring_bitmap<Allocator> operator|(const roaring_bitmap<Allocator>& a, const roaring_bitmap<Allocator>& b)
+    {
+        return roaring_bitmap<Allocator>(a) |= b;
+    }
+
+    template <typename Allocator>
+    inline roaring_bitmap<Allocator> operator^(const roaring_bitmap<Allocator>& a, const roaring_bitmap<Allocator>& b)
+    {
+        return roaring_bitmap<Allocator>(a) ^= b;
+    }
+
+    template <typename Allocator>
+    inline void swap(roaring_bitmap<Allocator>& a, roaring_bitmap<Allocator>& b)
+    {
+        a.swap(b);
+    }
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
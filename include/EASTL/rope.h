@@ -0,0 +1,1262 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/rope.h
+//
+// Implements basic_rope, a string built by concatenating shared, immutable
+// chunks of chars.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Building a large string by repeatedly appending to a basic_string copies
+// its chars each time the capacity grows, and prepending or inserting moves
+// everything after the insertion point. A rope instead holds a binary tree
+// whose leaves are chunks of chars and whose inner nodes concatenate two
+// subtrees. Nodes are never modified once built, and are reference counted
+// with atomic operations, so ropes share them freely, including between
+// threads:
+//    - Copying a rope, or appending or prepending one rope to another, is
+//      O(1) and copies no chars.
+//    - Appending or prepending chars copies only them, into a new leaf.
+//      Chars short enough are instead merged with the adjacent short leaf,
+//      so building a rope a few chars at a time doesn't make a leaf each.
+//    - substr is O(log n) and shares the chars of the rope, except those of
+//      short leaves at its ends, which it copies.
+//    - operator[] is O(log n).
+//    - chunk_begin and chunk_end iterate over the leaves as string views,
+//      which is what a scatter-gather write such as writev needs.
+//    - flatten copies the chars into a basic_string with one allocation.
+//
+// Appending to the end of a rope over and over makes a deep tree, so each
+// concatenation checks the depth against the number of leaves, and when
+// the depth reaches about twice the ideal, rebuilds the unbalanced part of
+// the tree, reusing its balanced subtrees whole (see Boehm, Atkinson and
+// Plass, "Ropes: an Alternative to Strings"). The cost of rebuilding is
+// spread over the concatenations which made the tree deep, so appending
+// stays O(1) amortized.
+//
+// Ropes share nodes only when their allocators compare equal, as the rope
+// which releases the last reference frees the node. Otherwise appending or
+// assigning a rope copies its chars into a single leaf.
+//
+// Example usage:
+//    eastl::rope response(header);
+//    for(eastl_size_t i = 0; i < items.size(); ++i)
+//        response += items[i].mJson;                   // Each appended rope is shared, not copied.
+//    response.prepend(statusLine);
+//
+//    eastl::vector<iovec> iov;
+//    for(eastl::rope::chunk_iterator it = response.chunk_begin(); it != response.chunk_end(); ++it)
+//    {
+//        iovec v = { (void*)(*it).data(), (*it).size() };
+//        iov.push_back(v);
+//    }
+//    writev(fd, iov.data(), (int)iov.size());
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_ROPE_H
+#define EASTL_ROPE_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/internal/atomic.h>
+#include <EASTL/iterator.h>
+#include <EASTL/string.h>
+#include <EASTL/string_view.h>
+#include <stddef.h>
+#include <string.h>
+
+
+namespace eastl
+{
+
+    /// EASTL_ROPE_DEFAULT_NAME
+    ///
+    /// Defines a default container name in the absence of a user-provided name.
+    ///
+    #ifndef EASTL_ROPE_DEFAULT_NAME
+        #define EASTL_ROPE_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " rope" // Unless the user overrides something, this is "EASTL rope".
+    #endif
+
+
+    /// EASTL_ROPE_DEFAULT_ALLOCATOR
+    ///
+    #ifndef EASTL_ROPE_DEFAULT_ALLOCATOR
+        #define EASTL_ROPE_DEFAULT_ALLOCATOR allocator_type(EASTL_ROPE_DEFAULT_NAME)
+    #endif
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// basic_rope
+    ///
+    /// Implements a string as a balanced tree of shared, immutable chunks.
+    ///
+    template <typename T, typename Allocator = EASTLAllocatorType>
+    class basic_rope
+    {
+    public:
+        typedef basic_rope<T, Allocator>                        this_type;
+        typedef basic_string<T, Allocator>                      string_type;
+        typedef basic_string_view<T>                            view_type;
+        typedef T                                               value_type;
+        typedef const T&                                        const_reference;
+        typedef eastl_size_t                                    size_type;
+        typedef ptrdiff_t                                       difference_type;
+        typedef Allocator                                       allocator_type;
+
+        static const size_type npos     = (size_type)-1;
+        static const size_type kMaxSize = (size_type)-2;
+
+        enum
+        {
+            kShortLeafSize = 128,   // Chars appended to, or taken by substr from, a leaf are copied into a new leaf if it would be no longer than this.
+            kMaxDepth      = 64     // The deepest a tree may be. A balanced tree of 2^32 leaves is about 48 deep.
+        };
+
+    protected:
+        // Node
+        // The part common to leaves and concatenations. A leaf has depth 0, and
+        // a concatenation one more than the deeper of its subtrees.
+        struct Node
+        {
+            volatile int32_t mnRefCount;
+            uint32_t         mnDepth;
+            size_type        mnSize;            // The number of chars.
+            size_type        mnLeafCount;
+        };
+
+        struct Leaf : public Node
+        {
+            const value_type* mpChars;
+            Leaf*             mpOwner;          // The leaf whose block holds the chars, which this holds a reference to, or NULL if they follow this leaf.
+        };
+
+        struct Concat : public Node
+        {
+            Node* mpLeft;
+            Node* mpRight;
+        };
+
+        Node*          mpRoot;                  // NULL if the rope is empty.
+        allocator_type mAllocator;
+
+    public:
+        /// chunk_iterator
+        ///
+        /// Iterates over the leaves of a rope in order, giving the chars of each
+        /// as a view. It is invalidated when the rope is modified or destroyed.
+        ///
+        class chunk_iterator
+        {
+        public:
+            typedef EASTL_ITC_NS::forward_iterator_tag  iterator_category;
+            typedef view_type                           value_type;
+            typedef ptrdiff_t                           difference_type;
+            typedef const view_type*                    pointer;
+            typedef view_type                           reference;
+
+            chunk_iterator();
+
+            reference       operator*() const;
+            chunk_iterator& operator++();
+            chunk_iterator  operator++(int);
+
+            bool operator==(const chunk_iterator& x) const;
+            bool operator!=(const chunk_iterator& x) const;
+
+        protected:
+            friend class basic_rope;
+
+            const Leaf* mpLeaf;                 // NULL at the end.
+            size_type   mnIndex;                // The number of leaves before this one. A rope may hold the same leaf more than once.
+            uint32_t    mnStackSize;
+            const Node* mStack[kMaxDepth];      // The right subtrees still to visit, the next one last.
+
+            void DoPushLeft(const Node* pNode);
+        };
+
+    public:
+        // Constructor, destructor
+        basic_rope();
+        explicit basic_rope(const allocator_type& allocator);
+        EASTL_STRING_EXPLICIT basic_rope(const value_type* p, const allocator_type& allocator = EASTL_ROPE_DEFAULT_ALLOCATOR);
+        basic_rope(const value_type* p, size_type n, const allocator_type& allocator = EASTL_ROPE_DEFAULT_ALLOCATOR);
+        explicit basic_rope(const view_type& x, const allocator_type& allocator = EASTL_ROPE_DEFAULT_ALLOCATOR);
+        explicit basic_rope(const string_type& x);
+        basic_rope(const this_type& x);
+#ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
+        basic_rope(this_type&& x);
+#endif
+       ~basic_rope();
+
+        // Allocator
+        const allocator_type& get_allocator() const;
+        allocator_type&       get_allocator();
+
+        // Assignment. Assigning a basic_rope shares its nodes.
+        this_type& operator=(const this_type& x);
+#ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
+        this_type& operator=(this_type&& x);
+#endif
+        this_type& operator=(const value_type* p);
+        this_type& operator=(const view_type& x);
+
+        void swap(this_type& x);
+
+        // Read access
+        bool      empty() const;
+        size_type size() const;
+        size_type length() const;
+        size_type chunk_count() const;  // The number of chunks chunk_begin iterates over, such as to size an iovec array.
+
+        const_reference operator[](size_type n) const;
+        const_reference at(size_type n) const;
+        const_reference front() const;
+        const_reference back() const;
+
+        chunk_iterator chunk_begin() const;
+        chunk_iterator chunk_end() const;
+
+        this_type   substr(size_type position = 0, size_type n = npos) const;
+        size_type   copy(value_type* p, size_type n, size_type position = 0) const;
+        string_type flatten() const;    // A basic_string holding a copy of the chars, using this rope's allocator.
+
+        // Modification
+        this_type& append(const this_type& x);
+        this_type& append(const view_type& x);
+        this_type& append(const value_type* p, size_type n);
+        this_type& append(const value_type* p);
+
+        this_type& prepend(const this_type& x);
+        this_type& prepend(const view_type& x);
+
+        this_type& operator+=(const this_type& x);
+        this_type& operator+=(const view_type& x);
+        this_type& operator+=(const value_type* p);
+        this_type& operator+=(value_type c);
+
+        void clear();
+
+    protected:
+        Node*    DoShare(const this_type& x);
+        Leaf*    DoAllocateLeaf(size_type n);
+        Leaf*    DoMakeLeaf(const view_type& x);
+        Leaf*    DoMakeSubLeaf(const Leaf* pLeaf, size_type position, size_type n);
+        Leaf*    DoMergeLeaves(const Node* pLeft, const Node* pRight);
+        Node*    DoMakeConcat(Node* pLeft, Node* pRight);
+        Node*    DoConcat(Node* pLeft, Node* pRight);
+        Node*    DoSubstr(const Node* pNode, size_type position, size_type n);
+        Node*    DoRebalance(Node* pNode);
+        void     DoAddToForest(Node* pNode, Node** pForest);
+        void     DoRelease(Node* pNode);
+        void     ThrowLengthException() const;
+        void     ThrowRangeException() const;
+
+        static void      DoAddRef(const Node* pNode);
+        static size_type DoCopy(const Node* pNode, size_type position, size_type n, value_type* p);
+        static size_type DoMinLeafCount(uint32_t nDepth);
+
+    }; // basic_rope
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // chunk_iterator
+    ///////////////////////////////////////////////////////////////////////////////
+
+    template <typename T, typename Allocator>
+    inline basic_rope<T, Allocator>::chunk_iterator::chunk_iterator()
+        : mpLeaf(NULL),
+          mnIndex(0),
+          mnStackSize(0)
+    {
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::chunk_iterator::reference
+    basic_rope<T, Allocator>::chunk_iterator::operator*() const
+    {
+        return view_type(mpLeaf->mpChars, mpLeaf->mnSize);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::chunk_iterator&
+    basic_rope<T, Allocator>::chunk_iterator::operator++()
+    {
+        ++mnIndex;
+        if(mnStackSize)
+            DoPushLeft(mStack[--mnStackSize]);
+        else
+            mpLeaf = NULL;
+        return *this;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::chunk_iterator
+    basic_rope<T, Allocator>::chunk_iterator::operator++(int)
+    {
+        chunk_iterator temp(*this);
+        ++*this;
+        return temp;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline bool basic_rope<T, Allocator>::chunk_iterator::operator==(const chunk_iterator& x) const
+    {
+        return mnIndex == x.mnIndex;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline bool basic_rope<T, Allocator>::chunk_iterator::operator!=(const chunk_iterator& x) const
+    {
+        return mnIndex != x.mnIndex;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline void basic_rope<T, Allocator>::chunk_iterator::DoPushLeft(const Node* pNode)
+    {
+        while(pNode->mnDepth)
+        {
+            EASTL_ASSERT(mnStackSize < (uint32_t)kMaxDepth);
+            mStack[mnStackSize++] = static_cast<const Concat*>(pNode)->mpRight;
+            pNode = static_cast<const Concat*>(pNode)->mpLeft;
+        }
+        mpLeaf = static_cast<const Leaf*>(pNode);
+    }
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // basic_rope
+    ///////////////////////////////////////////////////////////////////////////////
+
+    template <typename T, typename Allocator>
+    inline basic_rope<T, Allocator>::basic_rope()
+        : mpRoot(NULL),
+          mAllocator(EASTL_ROPE_DEFAULT_NAME)
+    {
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_rope<T, Allocator>::basic_rope(const allocator_type& allocator)
+        : mpRoot(NULL),
+          mAllocator(allocator)
+    {
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_rope<T, Allocator>::basic_rope(const value_type* p, const allocator_type& allocator)
+        : mpRoot(NULL),
+          mAllocator(allocator)
+    {
+        append(p);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_rope<T, Allocator>::basic_rope(const value_type* p, size_type n, const allocator_type& allocator)
+        : mpRoot(NULL),
+          mAllocator(allocator)
+    {
+        append(p, n);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_rope<T, Allocator>::basic_rope(const view_type& x, const allocator_type& allocator)
+        : mpRoot(NULL),
+          mAllocator(allocator)
+    {
+        append(x);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_rope<T, Allocator>::basic_rope(const string_type& x)
+        : mpRoot(NULL),
+          mAllocator(x.get_allocator())
+    {
+        append(x.data(), x.size());
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_rope<T, Allocator>::basic_rope(const this_type& x)
+        : mpRoot(x.mpRoot),
+          mAllocator(x.mAllocator)
+    {
+        if(mpRoot)
+            DoAddRef(mpRoot);
+    }
+
+
+#ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
+    template <typename T, typename Allocator>
+    inline basic_rope<T, Allocator>::basic_rope(this_type&& x)
+        : mpRoot(x.mpRoot),
+          mAllocator(x.mAllocator)
+    {
+        x.mpRoot = NULL;
+    }
+#endif
+
+
+    template <typename T, typename Allocator>
+    inline basic_rope<T, Allocator>::~basic_rope()
+    {
+        DoRelease(mpRoot);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline const typename basic_rope<T, Allocator>::allocator_type&
+    basic_rope<T, Allocator>::get_allocator() const
+    {
+        return mAllocator;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::allocator_type&
+    basic_rope<T, Allocator>::get_allocator()
+    {
+        return mAllocator;
+    }
+
+
+    template <typename T, typename Allocator>
+    typename basic_rope<T, Allocator>::this_type&
+    basic_rope<T, Allocator>::operator=(const this_type& x)
+    {
+        if(mpRoot != x.mpRoot)
+        {
+            Node* const pRoot = DoShare(x);
+            DoRelease(mpRoot);
+            mpRoot = pRoot;
+        }
+        return *this;
+    }
+
+
+#ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::this_type&
+    basic_rope<T, Allocator>::operator=(this_type&& x)
+    {
+        if(mAllocator == x.mAllocator)
+            eastl::swap(mpRoot, x.mpRoot);
+        else
+            operator=(static_cast<const this_type&>(x));
+        return *this;
+    }
+#endif
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::this_type&
+    basic_rope<T, Allocator>::operator=(const value_type* p)
+    {
+        return operator=(view_type(p));
+    }
+
+
+    template <typename T, typename Allocator>
+    typename basic_rope<T, Allocator>::this_type&
+    basic_rope<T, Allocator>::operator=(const view_type& x)
+    {
+        Node* const pRoot = x.empty() ? NULL : DoMakeLeaf(x); // Made first, as x may view this rope's chars.
+        DoRelease(mpRoot);
+        mpRoot = pRoot;
+        return *this;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline void basic_rope<T, Allocator>::swap(this_type& x)
+    {
+        eastl::swap(mpRoot, x.mpRoot);
+        eastl::swap(mAllocator, x.mAllocator);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline bool basic_rope<T, Allocator>::empty() const
+    {
+        return mpRoot == NULL;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::size_type
+    basic_rope<T, Allocator>::size() const
+    {
+        return mpRoot ? mpRoot->mnSize : 0;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::size_type
+    basic_rope<T, Allocator>::length() const
+    {
+        return size();
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::size_type
+    basic_rope<T, Allocator>::chunk_count() const
+    {
+        return mpRoot ? mpRoot->mnLeafCount : 0;
+    }
+
+
+    template <typename T, typename Allocator>
+    typename basic_rope<T, Allocator>::const_reference
+    basic_rope<T, Allocator>::operator[](size_type n) const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(n >= size()))
+                EASTL_FAIL_MSG("basic_rope::operator[] -- out of range");
+        #endif
+
+        const Node* pNode = mpRoot;
+
+        while(pNode->mnDepth)
+        {
+            const Concat* const pConcat = static_cast<const Concat*>(pNode);
+
+            if(n < pConcat->mpLeft->mnSize)
+                pNode = pConcat->mpLeft;
+            else
+            {
+                n    -= pConcat->mpLeft->mnSize;
+                pNode = pConcat->mpRight;
+            }
+        }
+
+        return static_cast<const Leaf*>(pNode)->mpChars[n];
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::const_reference
+    basic_rope<T, Allocator>::at(size_type n) const
+    {
+        #if EASTL_STRING_OPT_RANGE_ERRORS
+            if(EASTL_UNLIKELY(n >= size()))
+                ThrowRangeException();
+        #endif
+
+        return operator[](n);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::const_reference
+    basic_rope<T, Allocator>::front() const
+    {
+        return operator[](0);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::const_reference
+    basic_rope<T, Allocator>::back() const
+    {
+        return operator[](size() - 1);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::chunk_iterator
+    basic_rope<T, Allocator>::chunk_begin() const
+    {
+        chunk_iterator it;
+        if(mpRoot)
+            it.DoPushLeft(mpRoot);
+        return it;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::chunk_iterator
+    basic_rope<T, Allocator>::chunk_end() const
+    {
+        chunk_iterator it;
+        it.mnIndex = chunk_count();
+        return it;
+    }
+
+
+    template <typename T, typename Allocator>
+    typename basic_rope<T, Allocator>::this_type
+    basic_rope<T, Allocator>::substr(size_type position, size_type n) const
+    {
+        #if EASTL_STRING_OPT_RANGE_ERRORS
+            if(EASTL_UNLIKELY(position > size()))
+                ThrowRangeException();
+        #endif
+
+        this_type result(mAllocator);
+        result.mpRoot = result.DoSubstr(mpRoot, position, eastl::min_alt(n, size() - position));
+        return result;
+    }
+
+
+    template <typename T, typename Allocator>
+    typename basic_rope<T, Allocator>::size_type
+    basic_rope<T, Allocator>::copy(value_type* p, size_type n, size_type position) const
+    {
+        #if EASTL_STRING_OPT_RANGE_ERRORS
+            if(EASTL_UNLIKELY(position > size()))
+                ThrowRangeException();
+        #endif
+
+        n = eastl::min_alt(n, size() - position);
+        return n ? DoCopy(mpRoot, position, n, p) : 0;
+    }
+
+
+    template <typename T, typename Allocator>
+    typename basic_rope<T, Allocator>::string_type
+    basic_rope<T, Allocator>::flatten() const
+    {
+        string_type result(mAllocator);
+
+        result.reserve(size());
+        for(chunk_iterator it = chunk_begin(), itEnd = chunk_end(); it != itEnd; ++it)
+        {
+            const view_type v(*it);
+            result.append(v.data(), v.data() + v.size());
+        }
+
+        return result;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::this_type&
+    basic_rope<T, Allocator>::append(const this_type& x)
+    {
+        mpRoot = DoConcat(mpRoot, DoShare(x));
+        return *this;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::this_type&
+    basic_rope<T, Allocator>::append(const view_type& x)
+    {
+        if(!x.empty())
+            mpRoot = DoConcat(mpRoot, DoMakeLeaf(x));
+        return *this;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::this_type&
+    basic_rope<T, Allocator>::append(const value_type* p, size_type n)
+    {
+        return append(view_type(p, n));
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::this_type&
+    basic_rope<T, Allocator>::append(const value_type* p)
+    {
+        return append(view_type(p));
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::this_type&
+    basic_rope<T, Allocator>::prepend(const this_type& x)
+    {
+        mpRoot = DoConcat(DoShare(x), mpRoot);
+        return *this;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::this_type&
+    basic_rope<T, Allocator>::prepend(const view_type& x)
+    {
+        if(!x.empty())
+            mpRoot = DoConcat(DoMakeLeaf(x), mpRoot);
+        return *this;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::this_type&
+    basic_rope<T, Allocator>::operator+=(const this_type& x)
+    {
+        return append(x);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::this_type&
+    basic_rope<T, Allocator>::operator+=(const view_type& x)
+    {
+        return append(x);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::this_type&
+    basic_rope<T, Allocator>::operator+=(const value_type* p)
+    {
+        return append(view_type(p));
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::this_type&
+    basic_rope<T, Allocator>::operator+=(value_type c)
+    {
+        return append(view_type(&c, 1));
+    }
+
+
+    template <typename T, typename Allocator>
+    inline void basic_rope<T, Allocator>::clear()
+    {
+        DoRelease(mpRoot);
+        mpRoot = NULL;
+    }
+
+
+    // DoShare
+    // Returns x's root with a reference added, or if the nodes can't be shared
+    // because the allocators differ, a new leaf holding a copy of x's chars.
+    template <typename T, typename Allocator>
+    typename basic_rope<T, Allocator>::Node*
+    basic_rope<T, Allocator>::DoShare(const this_type& x)
+    {
+        if(!x.mpRoot)
+            return NULL;
+
+        if(mAllocator == x.mAllocator)
+        {
+            DoAddRef(x.mpRoot);
+            return x.mpRoot;
+        }
+
+        Leaf* const pLeaf = DoAllocateLeaf(x.size());
+        DoCopy(x.mpRoot, 0, x.size(), const_cast<value_type*>(pLeaf->mpChars));
+        return pLeaf;
+    }
+
+
+    template <typename T, typename Allocator>
+    typename basic_rope<T, Allocator>::Leaf*
+    basic_rope<T, Allocator>::DoAllocateLeaf(size_type n)
+    {
+        Leaf* const pLeaf = (Leaf*)EASTLAlloc(mAllocator, sizeof(Leaf) + (size_t)n * sizeof(value_type));
+
+        pLeaf->mnRefCount  = 1;
+        pLeaf->mnDepth     = 0;
+        pLeaf->mnSize      = n;
+        pLeaf->mnLeafCount = 1;
+        pLeaf->mpChars     = (const value_type*)(pLeaf + 1);
+        pLeaf->mpOwner     = NULL;
+        return pLeaf;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::Leaf*
+    basic_rope<T, Allocator>::DoMakeLeaf(const view_type& x)
+    {
+        Leaf* const pLeaf = DoAllocateLeaf(x.size());
+        memcpy(const_cast<value_type*>(pLeaf->mpChars), x.data(), (size_t)x.size() * sizeof(value_type));
+        return pLeaf;
+    }
+
+
+    // DoMakeSubLeaf
+    // Returns a leaf holding n chars of pLeaf from position, which shares
+    // pLeaf's chars unless it is short enough to copy.
+    template <typename T, typename Allocator>
+    typename basic_rope<T, Allocator>::Leaf*
+    basic_rope<T, Allocator>::DoMakeSubLeaf(const Leaf* pLeaf, size_type position, size_type n)
+    {
+        if(n <= (size_type)kShortLeafSize)
+            return DoMakeLeaf(view_type(pLeaf->mpChars + position, n));
+
+        Leaf* const pOwner = pLeaf->mpOwner ? pLeaf->mpOwner : const_cast<Leaf*>(pLeaf);
+        Leaf* const pSub   = (Leaf*)EASTLAlloc(mAllocator, sizeof(Leaf));
+
+        DoAddRef(pOwner);
+        pSub->mnRefCount  = 1;
+        pSub->mnDepth     = 0;
+        pSub->mnSize      = n;
+        pSub->mnLeafCount = 1;
+        pSub->mpChars     = pLeaf->mpChars + position;
+        pSub->mpOwner     = pOwner;
+        return pSub;
+    }
+
+
+    template <typename T, typename Allocator>
+    typename basic_rope<T, Allocator>::Leaf*
+    basic_rope<T, Allocator>::DoMergeLeaves(const Node* pLeft, const Node* pRight)
+    {
+        const Leaf* const pLeftLeaf  = static_cast<const Leaf*>(pLeft);
+        const Leaf* const pRightLeaf = static_cast<const Leaf*>(pRight);
+        Leaf* const       pLeaf      = DoAllocateLeaf(pLeft->mnSize + pRight->mnSize);
+        value_type* const pChars     = const_cast<value_type*>(pLeaf->mpChars);
+
+        memcpy(pChars, pLeftLeaf->mpChars, (size_t)pLeft->mnSize * sizeof(value_type));
+        memcpy(pChars + pLeft->mnSize, pRightLeaf->mpChars, (size_t)pRight->mnSize * sizeof(value_type));
+        return pLeaf;
+    }
+
+
+    // DoMakeConcat
+    // Returns a new concatenation of pLeft and pRight, taking their references.
+    // Either may be NULL, in which case the other is returned.
+    template <typename T, typename Allocator>
+    typename basic_rope<T, Allocator>::Node*
+    basic_rope<T, Allocator>::DoMakeConcat(Node* pLeft, Node* pRight)
+    {
+        if(!pLeft)
+            return pRight;
+        if(!pRight)
+            return pLeft;
+
+        Concat* const pConcat = (Concat*)EASTLAlloc(mAllocator, sizeof(Concat));
+
+        pConcat->mnRefCount  = 1;
+        pConcat->mnDepth     = eastl::max_alt(pLeft->mnDepth, pRight->mnDepth) + 1;
+        pConcat->mnSize      = pLeft->mnSize + pRight->mnSize;
+        pConcat->mnLeafCount = pLeft->mnLeafCount + pRight->mnLeafCount;
+        pConcat->mpLeft      = pLeft;
+        pConcat->mpRight     = pRight;
+        return pConcat;
+    }
+
+
+    // DoConcat
+    // Returns the concatenation of pLeft and pRight, taking their references.
+    // A short leaf is merged with the short leaf next to it, if any, rather
+    // than concatenated. The result is rebalanced if it is much deeper than
+    // its leaf count needs.
+    template <typename T, typename Allocator>
+    typename basic_rope<T, Allocator>::Node*
+    basic_rope<T, Allocator>::DoConcat(Node* pLeft, Node* pRight)
+    {
+        if(!pLeft)
+            return pRight;
+        if(!pRight)
+            return pLeft;
+
+        #if EASTL_STRING_OPT_LENGTH_ERRORS
+            if(EASTL_UNLIKELY(pRight->mnSize > (kMaxSize - pLeft->mnSize)))
+                ThrowLengthException();
+        #endif
+
+        Node* pResult = NULL;
+
+        if(!pLeft->mnDepth && !pRight->mnDepth)
+        {
+            if((pLeft->mnSize + pRight->mnSize) <= (size_type)kShortLeafSize)
+                pResult = DoMergeLeaves(pLeft, pRight);
+        }
+        else if(!pRight->mnDepth && (pRight->mnSize <= (size_type)kShortLeafSize))
+        {
+            Concat* const pConcat = static_cast<Concat*>(pLeft);
+
+            if(!pConcat->mpRight->mnDepth && ((pConcat->mpRight->mnSize + pRight->mnSize) <= (size_type)kShortLeafSize))
+            {
+                DoAddRef(pConcat->mpLeft);
+                pResult = DoMakeConcat(pConcat->mpLeft, DoMergeLeaves(pConcat->mpRight, pRight));
+            }
+        }
+        else if(!pLeft->mnDepth && (pLeft->mnSize <= (size_type)kShortLeafSize))
+        {
+            Concat* const pConcat = static_cast<Concat*>(pRight);
+
+            if(!pConcat->mpLeft->mnDepth && ((pLeft->mnSize + pConcat->mpLeft->mnSize) <= (size_type)kShortLeafSize))
+            {
+                DoAddRef(pConcat->mpRight);
+                pResult = DoMakeConcat(DoMergeLeaves(pLeft, pConcat->mpLeft), pConcat->mpRight);
+            }
+        }
+
+        if(pResult) // If merged, the result is no deeper than pLeft or pRight.
+        {
+            DoRelease(pLeft);
+            DoRelease(pRight);
+            return pResult;
+        }
+
+        pResult = DoMakeConcat(pLeft, pRight);
+
+        // Rebalance when the depth is about twice the least possible for the leaf
+        // count, or more. Trees up to 16 deep are left as they are.
+        if((pResult->mnDepth > (uint32_t)kMaxDepth) ||
+           ((pResult->mnDepth >= 16) && (pResult->mnLeafCount < DoMinLeafCount(pResult->mnDepth / 2))))
+        {
+            pResult = DoRebalance(pResult);
+        }
+
+        return pResult;
+    }
+
+
+    // DoSubstr
+    // Returns a tree holding n chars of pNode from position, sharing its
+    // subtrees which lie wholly within the range.
+    template <typename T, typename Allocator>
+    typename basic_rope<T, Allocator>::Node*
+    basic_rope<T, Allocator>::DoSubstr(const Node* pNode, size_type position, size_type n)
+    {
+        if(n == 0)
+            return NULL;
+
+        if((position == 0) && (n == pNode->mnSize))
+        {
+            DoAddRef(pNode);
+            return const_cast<Node*>(pNode);
+        }
+
+        if(!pNode->mnDepth)
+            return DoMakeSubLeaf(static_cast<const Leaf*>(pNode), position, n);
+
+        const Concat* const pConcat = static_cast<const Concat*>(pNode);
+        const size_type     nLeft   = pConcat->mpLeft->mnSize;
+
+        if((position + n) <= nLeft)
+            return DoSubstr(pConcat->mpLeft, position, n);
+        if(position >= nLeft)
+            return DoSubstr(pConcat->mpRight, position - nLeft, n);
+
+        Node* const pLeft = DoSubstr(pConcat->mpLeft, position, nLeft - position);
+        return DoConcat(pLeft, DoSubstr(pConcat->mpRight, 0, (position + n) - nLeft));
+    }
+
+
+    // DoRebalance
+    // Returns a balanced tree with the leaves of pNode, taking its reference.
+    // Subtrees are added in order to a forest whose slot i holds a tree of
+    // DoMinLeafCount(i) to DoMinLeafCount(i + 1) leaves, concatenating the
+    // smaller trees already there with each tree added. Subtrees which are
+    // already nearly balanced are added whole rather than taken apart.
+    template <typename T, typename Allocator>
+    typename basic_rope<T, Allocator>::Node*
+    basic_rope<T, Allocator>::DoRebalance(Node* pNode)
+    {
+        Node* forest[kMaxDepth];
+        memset(forest, 0, sizeof(forest));
+
+        DoAddToForest(pNode, forest);
+        DoRelease(pNode);
+
+        Node* pResult = NULL;
+        for(int i = 0; i < kMaxDepth; ++i)
+        {
+            if(forest[i])
+                pResult = DoMakeConcat(forest[i], pResult);
+        }
+
+        return pResult;
+    }
+
+
+    template <typename T, typename Allocator>
+    void basic_rope<T, Allocator>::DoAddToForest(Node* pNode, Node** pForest)
+    {
+        if((pNode->mnDepth >= 2) && (pNode->mnLeafCount < DoMinLeafCount(pNode->mnDepth - 2)))
+        {
+            DoAddToForest(static_cast<Concat*>(pNode)->mpLeft, pForest);
+            DoAddToForest(static_cast<Concat*>(pNode)->mpRight, pForest);
+            return;
+        }
+
+        DoAddRef(pNode);
+
+        Node* pTooSmall = NULL; // The concatenation of the trees in the slots below pNode's.
+        int   i         = 0;
+
+        for(; pNode->mnLeafCount >= DoMinLeafCount(i + 1); ++i)
+        {
+            if(pForest[i])
+            {
+                pTooSmall  = DoMakeConcat(pForest[i], pTooSmall);
+                pForest[i] = NULL;
+            }
+        }
+
+        Node* pInsert = DoMakeConcat(pTooSmall, pNode);
+
+        for(;; ++i)
+        {
+            if(pForest[i])
+            {
+                pInsert    = DoMakeConcat(pForest[i], pInsert);
+                pForest[i] = NULL;
+            }
+
+            if((pInsert->mnLeafCount < DoMinLeafCount(i + 1)) || (i == (kMaxDepth - 1)))
+            {
+                pForest[i] = pInsert;
+                return;
+            }
+        }
+    }
+
+
+    template <typename T, typename Allocator>
+    void basic_rope<T, Allocator>::DoRelease(Node* pNode)
+    {
+        // Releases left subtrees recursively, and right subtrees and owners in
+        // this loop, so the recursion is no deeper than the tree.
+        while(pNode && (AtomicDecrement(&pNode->mnRefCount) == 0))
+        {
+            Node*  pNext;
+            size_t nSize;
+
+            if(pNode->mnDepth)
+            {
+                DoRelease(static_cast<Concat*>(pNode)->mpLeft);
+                pNext = static_cast<Concat*>(pNode)->mpRight;
+                nSize = sizeof(Concat);
+            }
+            else
+            {
+                pNext = static_cast<Leaf*>(pNode)->mpOwner;
+                nSize = pNext ? sizeof(Leaf) : (sizeof(Leaf) + (size_t)pNode->mnSize * sizeof(value_type));
+            }
+
+            EASTLFree(mAllocator, pNode, nSize);
+            pNode = pNext;
+        }
+    }
+
+
+    template <typename T, typename Allocator>
+    inline void basic_rope<T, Allocator>::DoAddRef(const Node* pNode)
+    {
+        AtomicIncrement(&const_cast<Node*>(pNode)->mnRefCount);
+    }
+
+
+    template <typename T, typename Allocator>
+    typename basic_rope<T, Allocator>::size_type
+    basic_rope<T, Allocator>::DoCopy(const Node* pNode, size_type position, size_type n, value_type* p)
+    {
+        while(pNode->mnDepth)
+        {
+            const Concat* const pConcat = static_cast<const Concat*>(pNode);
+            const size_type     nLeft   = pConcat->mpLeft->mnSize;
+
+            if(position >= nLeft)
+            {
+                position -= nLeft;
+                pNode     = pConcat->mpRight;
+            }
+            else if((position + n) <= nLeft)
+                pNode = pConcat->mpLeft;
+            else
+            {
+                const size_type nCopied = DoCopy(pConcat->mpLeft, position, nLeft - position, p);
+                return nCopied + DoCopy(pConcat->mpRight, 0, n - nCopied, p + nCopied);
+            }
+        }
+
+        memcpy(p, static_cast<const Leaf*>(pNode)->mpChars + position, (size_t)n * sizeof(value_type));
+        return n;
+    }
+
+
+    // DoMinLeafCount
+    // Returns the least leaf count of a balanced tree of depth nDepth, the
+    // Fibonacci number F(nDepth + 2).
+    template <typename T, typename Allocator>
+    inline typename basic_rope<T, Allocator>::size_type
+    basic_rope<T, Allocator>::DoMinLeafCount(uint32_t nDepth)
+    {
+        static const uint32_t kMinLeafCount[46] =
+        {
+                     1,          2,          3,          5,          8,         13,         21,         34,
+                    55,         89,        144,        233,        377,        610,        987,       1597,
+                  2584,       4181,       6765,      10946,      17711,      28657,      46368,      75025,
+                121393,     196418,     317811,     514229,     832040,    1346269,    2178309,    3524578,
+               5702887,    9227465,   14930352,   24157817,   39088169,   63245986,  102334155,  165580141,
+             267914296,  433494437,  701408733, 1134903170, 1836311903, 2971215073u
+        };
+
+        return (nDepth < 46) ? (size_type)kMinLeafCount[nDepth] : (size_type)-1;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline void basic_rope<T, Allocator>::ThrowLengthException() const
+    {
+        #if EASTL_EXCEPTIONS_ENABLED
+            throw std::length_error("basic_rope -- length_error");
+        #elif EASTL_ASSERT_ENABLED
+            EASTL_FAIL_MSG("basic_rope -- length_error");
+        #endif
+    }
+
+
+    template <typename T, typename Allocator>
+    inline void basic_rope<T, Allocator>::ThrowRangeException() const
+    {
+        #if EASTL_EXCEPTIONS_ENABLED
+            throw std::out_of_range("basic_rope -- out of range");
+        #elif EASTL_ASSERT_ENABLED
+            EASTL_FAIL_MSG("basic_rope -- out of range");
+        #endif
+    }
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // global operators
+    ///////////////////////////////////////////////////////////////////////////////
+
+    template <typename T, typename Allocator>
+    bool operator==(const basic_rope<T, Allocator>& a, const basic_string_view<T>& b)
+    {
+        typedef typename basic_rope<T, Allocator>::chunk_iterator chunk_iterator;
+
+        if(a.size() != b.size())
+            return false;
+
+        const T* p = b.data();
+        for(chunk_iterator it = a.chunk_begin(), itEnd = a.chunk_end(); it != itEnd; ++it)
+        {
+            const basic_string_view<T> v(*it);
+
+            if(Compare(v.data(), p, (size_t)v.size()) != 0)
+                return false;
+            p += v.size();
+        }
+
+        return true;
+    }
+
+
+    // Compares chunk by chunk, each time as many chars as remain in both current chunks.
+    template <typename T, typename Allocator>
+    bool operator==(const basic_rope<T, Allocator>& a, const basic_rope<T, Allocator>& b)
+    {
+        typedef typename basic_rope<T, Allocator>::chunk_iterator chunk_iterator;
+
+        if(a.size() != b.size())
+            return false;
+
+        chunk_iterator       itA  = a.chunk_begin();
+        chunk_iterator       itB  = b.chunk_begin();
+        const chunk_iterator endA = a.chunk_end();
+        basic_string_view<T> vA, vB;
+
+        while((itA != endA) || !vA.empty())
+        {
+            if(vA.empty())
+            {
+                vA = *itA;
+                ++itA;
+            }
+            if(vB.empty())
+            {
+                vB = *itB;
+                ++itB;
+            }
+
+            const eastl_size_t n = eastl::min_alt(vA.size(), vB.size());
+
+            if(Compare(vA.data(), vB.data(), (size_t)n) != 0)
+                return false;
+            vA.remove_prefix(n);
+            vB.remove_prefix(n);
+        }
+
+        return true;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline bool operator==(const basic_string_view<T>& a, const basic_rope<T, Allocator>& b)
+    {
+        return b == a;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline bool operator==(const basic_rope<T, Allocator>& a, const T* p)
+    {
+        return a == basic_string_view<T>(p);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline bool operator!=(const basic_rope<T, Allocator>& a, const basic_rope<T, Allocator>& b)
+    {
+        return !(a == b);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline bool operator!=(const basic_rope<T, Allocator>& a, const basic_string_view<T>& b)
+    {
+        return !(a == b);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline bool operator!=(const basic_rope<T, Allocator>& a, const T* p)
+    {
+        return !(a == basic_string_view<T>(p));
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_rope<T, Allocator> operator+(const basic_rope<T, Allocator>& a, const basic_rope<T, Allocator>& b)
+    {
+        basic_rope<T, Allocator> result(a);
+        result.append(b);
+        return result;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_rope<T, Allocator> operator+(const basic_rope<T, Allocator>& a, const basic_string_view<T>& b)
+    {
+        basic_rope<T, Allocator> result(a);
+        result.append(b);
+        return result;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline void swap(basic_rope<T, Allocator>& a, basic_rope<T, Allocator>& b)
+    {
+        a.swap(b);
+    }
+
+
+    /// rope / wrope
+    typedef basic_rope<char>    rope;
+    typedef basic_rope<wchar_t> wrope;
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
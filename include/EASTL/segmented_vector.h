@@ -0,0 +1,1322 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/segmented_vector.h
+//
+// Implements a dynamic array which stores its elements in fixed-size chunks.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// segmented_vector is a vector whose elements never move once constructed.
+// Instead of one contiguous block which is reallocated and copied as the
+// container grows, segmented_vector allocates blocks ("chunks") of ChunkSize
+// elements each and keeps a small table of pointers to them. Thus:
+//    - Pointers and references to elements stay valid until the element is
+//      removed. Iterators are invalidated by growth, as with deque.
+//    - push_back never copies existing elements. The only thing that is ever
+//      reallocated is the chunk table, which is ChunkSize times smaller.
+//    - Random access is O(1): a divide (a shift if ChunkSize is a power of
+//      two) and two loads.
+//    - Elements within a chunk are contiguous. segment_begin/segment_end
+//      expose the chunks so that hot loops can run over plain pointers, which
+//      compilers can vectorize, instead of over segmented iterators.
+//
+// Example usage:
+//    eastl::segmented_vector<Widget, 256> widgets;
+//    Widget* pWidget = &widgets.push_back(); // pWidget stays valid as widgets grows.
+//
+//    for(eastl_size_t s = 0, sEnd = widgets.segment_count(); s != sEnd; ++s)
+//    {
+//        for(Widget* p = widgets.segment_begin(s), *pEnd = widgets.segment_end(s); p != pEnd; ++p)
+//            p->Update();
+//    }
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_SEGMENTED_VECTOR_H
+#define EASTL_SEGMENTED_VECTOR_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/allocator.h>
+#include <EASTL/type_traits.h>
+#include <EASTL/iterator.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/memory.h>
+#include <EASTL/vector.h>
+
+#ifdef _MSC_VER
+    #pragma warning(push, 0)
+    #include <new>
+    #include <stddef.h>
+    #pragma warning(pop)
+#else
+    #include <new>
+    #include <stddef.h>
+#endif
+
+#if EASTL_EXCEPTIONS_ENABLED
+    #ifdef _MSC_VER
+        #pragma warning(push, 0)
+    #endif
+    #include <stdexcept> // std::out_of_range
+    #ifdef _MSC_VER
+        #pragma warning(pop)
+    #endif
+#endif
+
+#ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
+    #include <utility> // std::move, std::forward
+#endif
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable: 4530)  // C++ exception handler used, but unwind semantics are not enabled. Specify /EHsc
+    #pragma warning(disable: 4345)  // Behavior change: an object of POD type constructed with an initializer of the form () will be default-initialized
+    #pragma warning(disable: 4127)  // Conditional expression is constant
+#endif
+
+
+namespace eastl
+{
+
+    /// EASTL_SEGMENTED_VECTOR_DEFAULT_NAME
+    ///
+    /// Defines a default container name in the absence of a user-provided name.
+    ///
+    #ifndef EASTL_SEGMENTED_VECTOR_DEFAULT_NAME
+        #define EASTL_SEGMENTED_VECTOR_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " segmented_vector" // Unless the user overrides something, this is "EASTL segmented_vector".
+    #endif
+
+
+    /// EASTL_SEGMENTED_VECTOR_DEFAULT_ALLOCATOR
+    ///
+    #ifndef EASTL_SEGMENTED_VECTOR_DEFAULT_ALLOCATOR
+        #define EASTL_SEGMENTED_VECTOR_DEFAULT_ALLOCATOR allocator_type(EASTL_SEGMENTED_VECTOR_DEFAULT_NAME)
+    #endif
+
+
+    /// EASTL_SEGMENTED_VECTOR_DEFAULT_CHUNK_SIZE
+    ///
+    /// Defines the default number of elements per chunk. A power of two lets
+    /// element lookup be done with a shift and a mask.
+    ///
+    #ifndef EASTL_SEGMENTED_VECTOR_DEFAULT_CHUNK_SIZE
+        #define EASTL_SEGMENTED_VECTOR_DEFAULT_CHUNK_SIZE 64
+    #endif
+
+
+
+    /// SegmentedVectorIterator
+    ///
+    /// An iterator refers to an entry in the container's chunk table and to an
+    /// element within that chunk. The chunk table is always terminated by a
+    /// NULL entry, so the end iterator of a container whose last chunk is full
+    /// simply refers to that NULL entry.
+    ///
+    template <typename T, typename Pointer, typename Reference, eastl_size_t ChunkSize>
+    struct SegmentedVectorIterator
+    {
+        typedef SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>  this_type;
+        typedef SegmentedVectorIterator<T, T*, T&, ChunkSize>              iterator;
+        typedef SegmentedVectorIterator<T, const T*, const T&, ChunkSize>  const_iterator;
+        typedef eastl_size_t                                               size_type;     // See config.h for the definition of eastl_size_t, which defaults to uint32_t.
+        typedef ptrdiff_t                                                  difference_type;
+        typedef T                                                          value_type;
+        typedef Pointer                                                    pointer;
+        typedef Reference                                                  reference;
+        typedef EASTL_ITC_NS::random_access_iterator_tag                   iterator_category;
+
+    public:
+        T* const* mpChunk;   // The chunk table entry for the chunk we refer to.
+        T*        mpCurrent; // The element we refer to. Always in [*mpChunk, *mpChunk + ChunkSize).
+
+    public:
+        SegmentedVectorIterator();
+        SegmentedVectorIterator(T* const* pChunk, T* pCurrent);
+        SegmentedVectorIterator(const iterator& x);
+
+        reference operator*() const;
+        pointer   operator->() const;
+
+        this_type& operator++();
+        this_type  operator++(int);
+
+        this_type& operator--();
+        this_type  operator--(int);
+
+        this_type& operator+=(difference_type n);
+        this_type& operator-=(difference_type n);
+
+        this_type operator+(difference_type n) const;
+        this_type operator-(difference_type n) const;
+
+        reference operator[](difference_type n) const;
+
+    }; // SegmentedVectorIterator
+
+
+
+
+    /// SegmentedVectorBase
+    ///
+    /// See VectorBase (class vector) for an explanation of why we
+    /// create this separate base class.
+    ///
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    class SegmentedVectorBase
+    {
+    public:
+        typedef T                                   value_type;
+        typedef Allocator                           allocator_type;
+        typedef eastl_size_t                        size_type;     // See config.h for the definition of eastl_size_t, which defaults to uint32_t.
+        typedef ptrdiff_t                           difference_type;
+        typedef eastl::vector<T*, Allocator>        chunk_table_type;
+
+        enum
+        {
+            kChunkSize       = ChunkSize,
+            kAlignment       = EASTL_ALIGN_OF(T),
+            kAlignmentOffset = 0
+        };
+
+        EASTL_CT_ASSERT(ChunkSize > 0);
+
+    protected:
+        chunk_table_type mChunkTable; // Pointers to the allocated chunks, followed by a NULL entry. Empty until the first chunk is allocated.
+        size_type        mSize;
+
+    public:
+        allocator_type& get_allocator();
+        void            set_allocator(const allocator_type& allocator);
+
+    protected:
+        SegmentedVectorBase();
+        SegmentedVectorBase(const allocator_type& allocator);
+       ~SegmentedVectorBase();
+
+        size_type DoGetChunkCount() const;
+        T* const* DoGetChunkTable() const;
+
+        T*   DoAllocateChunk();
+        void DoFreeChunk(T* pChunk);
+        void DoAddChunk();
+        void DoFreeChunks(size_type nFirstChunk);
+        void DoDestroyValues(size_type nFirst);
+
+    }; // SegmentedVectorBase
+
+
+
+
+    /// segmented_vector
+    ///
+    /// Implements a dynamic array made of fixed-size chunks. See the top of
+    /// this file for a description.
+    ///
+    /// Memory usage
+    /// Each chunk holds ChunkSize elements and is allocated separately, so a
+    /// segmented_vector wastes at most one partially filled chunk plus one
+    /// pointer per chunk. Chunks are not freed when elements are removed;
+    /// use set_capacity to return unused chunks to the allocator.
+    ///
+    template <typename T, eastl_size_t ChunkSize = EASTL_SEGMENTED_VECTOR_DEFAULT_CHUNK_SIZE, typename Allocator = EASTLAllocatorType>
+    class segmented_vector : public SegmentedVectorBase<T, ChunkSize, Allocator>
+    {
+        typedef SegmentedVectorBase<T, ChunkSize, Allocator>         base_type;
+        typedef segmented_vector<T, ChunkSize, Allocator>            this_type;
+
+    public:
+        typedef T                                                    value_type;
+        typedef T*                                                   pointer;
+        typedef const T*                                             const_pointer;
+        typedef T&                                                   reference;
+        typedef const T&                                             const_reference;
+        typedef SegmentedVectorIterator<T, T*, T&, ChunkSize>             iterator;
+        typedef SegmentedVectorIterator<T, const T*, const T&, ChunkSize> const_iterator;
+        typedef eastl::reverse_iterator<iterator>                    reverse_iterator;
+        typedef eastl::reverse_iterator<const_iterator>              const_reverse_iterator;
+        typedef typename base_type::size_type                        size_type;
+        typedef typename base_type::difference_type                  difference_type;
+        typedef typename base_type::allocator_type                   allocator_type;
+
+        using base_type::kChunkSize;
+        using base_type::mChunkTable;
+        using base_type::mSize;
+        using base_type::DoGetChunkCount;
+        using base_type::DoGetChunkTable;
+        using base_type::DoAddChunk;
+        using base_type::DoFreeChunks;
+        using base_type::DoDestroyValues;
+
+        static const size_type npos     = (size_type)-1;      /// 'npos' means non-valid position or simply non-position.
+        static const size_type kMaxSize = (size_type)-2;      /// -1 is reserved for 'npos'. It also happens to be slightly beneficial that kMaxSize is a value less than -1, as it helps us deal with potential integer wraparound issues.
+
+    public:
+        segmented_vector();
+        explicit segmented_vector(const allocator_type& allocator);
+        explicit segmented_vector(size_type n, const allocator_type& allocator = EASTL_SEGMENTED_VECTOR_DEFAULT_ALLOCATOR);
+        segmented_vector(size_type n, const value_type& value, const allocator_type& allocator = EASTL_SEGMENTED_VECTOR_DEFAULT_ALLOCATOR);
+        segmented_vector(const this_type& x);
+
+        template <typename InputIterator>
+        segmented_vector(InputIterator first, InputIterator last);
+
+        #ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
+            segmented_vector(this_type&& x);
+            this_type& operator=(this_type&& x);
+            void push_back(value_type&& value);
+        #endif
+
+        this_type& operator=(const this_type& x);
+        void swap(this_type& x);
+
+        void assign(size_type n, const value_type& value);
+
+        template <typename InputIterator>
+        void assign(InputIterator first, InputIterator last);
+
+        iterator       begin();
+        const_iterator begin() const;
+
+        iterator       end();
+        const_iterator end() const;
+
+        reverse_iterator       rbegin();
+        const_reverse_iterator rbegin() const;
+
+        reverse_iterator       rend();
+        const_reverse_iterator rend() const;
+
+        bool      empty() const;
+        size_type size() const;
+        size_type capacity() const;
+
+        void resize(size_type n, const value_type& value);
+        void resize(size_type n);
+        void reserve(size_type n);
+        void set_capacity(size_type n = npos);   // Frees chunks beyond those needed to hold n elements, or allocates chunks to hold n elements. If n < size() the container is resized to n. If n == npos then the capacity is reduced to what size() requires.
+
+        reference       operator[](size_type n);
+        const_reference operator[](size_type n) const;
+
+        reference       at(size_type n);
+        const_reference at(size_type n) const;
+
+        reference       front();
+        const_reference front() const;
+
+        reference       back();
+        const_reference back() const;
+
+        void      push_back(const value_type& value);
+        reference push_back();
+        void*     push_back_uninitialized();
+
+        void      pop_back();
+
+        void      clear();
+
+        // Chunk-wise access. Segment i holds the elements [i * ChunkSize, min(size(), (i + 1) * ChunkSize)).
+        size_type     segment_count() const;
+        pointer       segment_begin(size_type i);
+        const_pointer segment_begin(size_type i) const;
+        pointer       segment_end(size_type i);
+        const_pointer segment_end(size_type i) const;
+
+        bool validate() const;
+        int  validate_iterator(const_iterator i) const;
+
+    protected:
+        template <typename Integer>
+        void DoAssign(Integer n, Integer value, true_type);
+
+        template <typename InputIterator>
+        void DoAssign(InputIterator first, InputIterator last, false_type);
+
+        T*   DoGetBackSlot();
+        T*   DoGetElement(size_type n) const;
+
+    }; // class segmented_vector
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // SegmentedVectorIterator
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename T, typename Pointer, typename Reference, eastl_size_t ChunkSize>
+    inline SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::SegmentedVectorIterator()
+        : mpChunk(NULL), mpCurrent(NULL)
+    {
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, eastl_size_t ChunkSize>
+    inline SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::SegmentedVectorIterator(T* const* pChunk, T* pCurrent)
+        : mpChunk(pChunk), mpCurrent(pCurrent)
+    {
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, eastl_size_t ChunkSize>
+    inline SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::SegmentedVectorIterator(const iterator& x)
+        : mpChunk(x.mpChunk), mpCurrent(x.mpCurrent)
+    {
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, eastl_size_t ChunkSize>
+    inline typename SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::reference
+    SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::operator*() const
+    {
+        return *mpCurrent;
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, eastl_size_t ChunkSize>
+    inline typename SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::pointer
+    SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::operator->() const
+    {
+        return mpCurrent;
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, eastl_size_t ChunkSize>
+    inline typename SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::this_type&
+    SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::operator++()
+    {
+        if(++mpCurrent == (*mpChunk + ChunkSize))
+            mpCurrent = *++mpChunk;
+        return *this;
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, eastl_size_t ChunkSize>
+    inline typename SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::this_type
+    SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::operator++(int)
+    {
+        this_type temp(*this);
+        operator++();
+        return temp;
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, eastl_size_t ChunkSize>
+    inline typename SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::this_type&
+    SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::operator--()
+    {
+        if(mpCurrent == *mpChunk)
+            mpCurrent = *--mpChunk + ChunkSize;
+        --mpCurrent;
+        return *this;
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, eastl_size_t ChunkSize>
+    inline typename SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::this_type
+    SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::operator--(int)
+    {
+        this_type temp(*this);
+        operator--();
+        return temp;
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, eastl_size_t ChunkSize>
+    typename SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::this_type&
+    SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::operator+=(difference_type n)
+    {
+        const difference_type nChunkSize = (difference_type)ChunkSize;
+        const difference_type nOffset    = (mpCurrent - *mpChunk) + n;
+
+        if((nOffset >= 0) && (nOffset < nChunkSize)) // If we stay within the current chunk...
+            mpCurrent += n;
+        else
+        {
+            const difference_type nChunkOffset = (nOffset >= 0) ? (nOffset / nChunkSize)
+                                                                : -((-nOffset - 1) / nChunkSize) - 1;
+            mpChunk  += nChunkOffset;
+            mpCurrent = *mpChunk + (nOffset - (nChunkOffset * nChunkSize));
+        }
+
+        return *this;
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, eastl_size_t ChunkSize>
+    inline typename SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::this_type&
+    SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::operator-=(difference_type n)
+    {
+        return operator+=(-n);
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, eastl_size_t ChunkSize>
+    inline typename SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::this_type
+    SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::operator+(difference_type n) const
+    {
+        return this_type(*this).operator+=(n);
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, eastl_size_t ChunkSize>
+    inline typename SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::this_type
+    SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::operator-(difference_type n) const
+    {
+        return this_type(*this).operator+=(-n);
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, eastl_size_t ChunkSize>
+    inline typename SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::reference
+    SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>::operator[](difference_type n) const
+    {
+        return *(*this + n);
+    }
+
+
+    // The C++ defect report #179 requires that we support comparisons between const and non-const iterators.
+    // Thus we provide additional template paremeters here to support this. The defect report does not
+    // require us to support comparisons between reverse_iterators and const_reverse_iterators.
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, eastl_size_t ChunkSize>
+    inline bool operator==(const SegmentedVectorIterator<T, PointerA, ReferenceA, ChunkSize>& a,
+                           const SegmentedVectorIterator<T, PointerB, ReferenceB, ChunkSize>& b)
+    {
+        return a.mpCurrent == b.mpCurrent;
+    }
+
+
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, eastl_size_t ChunkSize>
+    inline bool operator!=(const SegmentedVectorIterator<T, PointerA, ReferenceA, ChunkSize>& a,
+                           const SegmentedVectorIterator<T, PointerB, ReferenceB, ChunkSize>& b)
+    {
+        return a.mpCurrent != b.mpCurrent;
+    }
+
+
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, eastl_size_t ChunkSize>
+    inline bool operator<(const SegmentedVectorIterator<T, PointerA, ReferenceA, ChunkSize>& a,
+                          const SegmentedVectorIterator<T, PointerB, ReferenceB, ChunkSize>& b)
+    {
+        return (a.mpChunk == b.mpChunk) ? (a.mpCurrent < b.mpCurrent) : (a.mpChunk < b.mpChunk);
+    }
+
+
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, eastl_size_t ChunkSize>
+    inline bool operator>(const SegmentedVectorIterator<T, PointerA, ReferenceA, ChunkSize>& a,
+                          const SegmentedVectorIterator<T, PointerB, ReferenceB, ChunkSize>& b)
+    {
+        return b < a;
+    }
+
+
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, eastl_size_t ChunkSize>
+    inline bool operator<=(const SegmentedVectorIterator<T, PointerA, ReferenceA, ChunkSize>& a,
+                           const SegmentedVectorIterator<T, PointerB, ReferenceB, ChunkSize>& b)
+    {
+        return !(b < a);
+    }
+
+
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, eastl_size_t ChunkSize>
+    inline bool operator>=(const SegmentedVectorIterator<T, PointerA, ReferenceA, ChunkSize>& a,
+                           const SegmentedVectorIterator<T, PointerB, ReferenceB, ChunkSize>& b)
+    {
+        return !(a < b);
+    }
+
+
+    template <typename T, typename PointerA, typename ReferenceA, typename PointerB, typename ReferenceB, eastl_size_t ChunkSize>
+    inline typename SegmentedVectorIterator<T, PointerA, ReferenceA, ChunkSize>::difference_type
+    operator-(const SegmentedVectorIterator<T, PointerA, ReferenceA, ChunkSize>& a,
+              const SegmentedVectorIterator<T, PointerB, ReferenceB, ChunkSize>& b)
+    {
+        typedef typename SegmentedVectorIterator<T, PointerA, ReferenceA, ChunkSize>::difference_type difference_type;
+
+        return ((a.mpChunk - b.mpChunk) * (difference_type)ChunkSize) + (a.mpCurrent - *a.mpChunk) - (b.mpCurrent - *b.mpChunk);
+    }
+
+
+    template <typename T, typename Pointer, typename Reference, eastl_size_t ChunkSize>
+    inline SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>
+    operator+(ptrdiff_t n, const SegmentedVectorIterator<T, Pointer, Reference, ChunkSize>& x)
+    {
+        return x + n;
+    }
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // SegmentedVectorBase
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline SegmentedVectorBase<T, ChunkSize, Allocator>::SegmentedVectorBase()
+        : mChunkTable(allocator_type(EASTL_SEGMENTED_VECTOR_DEFAULT_NAME)),
+          mSize(0)
+    {
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline SegmentedVectorBase<T, ChunkSize, Allocator>::SegmentedVectorBase(const allocator_type& allocator)
+        : mChunkTable(allocator),
+          mSize(0)
+    {
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline SegmentedVectorBase<T, ChunkSize, Allocator>::~SegmentedVectorBase()
+    {
+        DoDestroyValues(0);
+        DoFreeChunks(0);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename SegmentedVectorBase<T, ChunkSize, Allocator>::allocator_type&
+    SegmentedVectorBase<T, ChunkSize, Allocator>::get_allocator()
+    {
+        return mChunkTable.get_allocator();
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline void SegmentedVectorBase<T, ChunkSize, Allocator>::set_allocator(const allocator_type& allocator)
+    {
+        mChunkTable.set_allocator(allocator);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename SegmentedVectorBase<T, ChunkSize, Allocator>::size_type
+    SegmentedVectorBase<T, ChunkSize, Allocator>::DoGetChunkCount() const
+    {
+        return mChunkTable.empty() ? 0 : (mChunkTable.size() - 1); // Don't count the NULL terminator.
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline T* const* SegmentedVectorBase<T, ChunkSize, Allocator>::DoGetChunkTable() const
+    {
+        // An empty container has no chunk table, but its iterators need a NULL terminator to refer to.
+        static T* const pEmptyChunkTable[1] = { NULL };
+
+        return mChunkTable.empty() ? pEmptyChunkTable : mChunkTable.data();
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline T* SegmentedVectorBase<T, ChunkSize, Allocator>::DoAllocateChunk()
+    {
+        return (T*)allocate_memory(mChunkTable.get_allocator(), ChunkSize * sizeof(T), kAlignment, kAlignmentOffset);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline void SegmentedVectorBase<T, ChunkSize, Allocator>::DoFreeChunk(T* pChunk)
+    {
+        EASTLFree(mChunkTable.get_allocator(), pChunk, ChunkSize * sizeof(T));
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    void SegmentedVectorBase<T, ChunkSize, Allocator>::DoAddChunk()
+    {
+        T* const pChunk = DoAllocateChunk();
+
+        #if EASTL_EXCEPTIONS_ENABLED
+            try
+            {
+        #endif
+                // A table of just the NULL terminator is valid, so the table is
+                // consistent whichever of these push_backs might throw.
+                if(mChunkTable.empty())
+                    mChunkTable.push_back(NULL);
+                mChunkTable.push_back(NULL);
+        #if EASTL_EXCEPTIONS_ENABLED
+            }
+            catch(...)
+            {
+                DoFreeChunk(pChunk);
+                throw;
+            }
+        #endif
+
+        mChunkTable[mChunkTable.size() - 2] = pChunk;
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    void SegmentedVectorBase<T, ChunkSize, Allocator>::DoFreeChunks(size_type nFirstChunk)
+    {
+        const size_type nChunkCount = DoGetChunkCount();
+
+        if(nFirstChunk < nChunkCount)
+        {
+            for(size_type i = nFirstChunk; i < nChunkCount; ++i)
+                DoFreeChunk(mChunkTable[i]);
+
+            if(nFirstChunk)
+            {
+                mChunkTable.resize(nFirstChunk + 1);
+                mChunkTable[nFirstChunk] = NULL;
+            }
+            else
+                mChunkTable.set_capacity(0);
+        }
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    void SegmentedVectorBase<T, ChunkSize, Allocator>::DoDestroyValues(size_type nFirst)
+    {
+        // Destroys the elements [nFirst, mSize) chunk by chunk and sets mSize to nFirst.
+        while(mSize > nFirst)
+        {
+            const size_type nChunk      = (mSize - 1) / ChunkSize;
+            const size_type nChunkFirst = (nChunk * ChunkSize > nFirst) ? (nChunk * ChunkSize) : nFirst;
+            T* const        pChunk      = mChunkTable[nChunk];
+
+            eastl::destruct(pChunk + (nChunkFirst - (nChunk * ChunkSize)), pChunk + (mSize - (nChunk * ChunkSize)));
+            mSize = nChunkFirst;
+        }
+    }
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // segmented_vector
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline segmented_vector<T, ChunkSize, Allocator>::segmented_vector()
+        : base_type()
+    {
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline segmented_vector<T, ChunkSize, Allocator>::segmented_vector(const allocator_type& allocator)
+        : base_type(allocator)
+    {
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline segmented_vector<T, ChunkSize, Allocator>::segmented_vector(size_type n, const allocator_type& allocator)
+        : base_type(allocator)
+    {
+        resize(n);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline segmented_vector<T, ChunkSize, Allocator>::segmented_vector(size_type n, const value_type& value, const allocator_type& allocator)
+        : base_type(allocator)
+    {
+        resize(n, value);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline segmented_vector<T, ChunkSize, Allocator>::segmented_vector(const this_type& x)
+        : base_type(const_cast<this_type&>(x).get_allocator()) // vector has no const get_allocator.
+    {
+        reserve(x.mSize);
+        DoAssign(x.begin(), x.end(), false_type());
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    template <typename InputIterator>
+    inline segmented_vector<T, ChunkSize, Allocator>::segmented_vector(InputIterator first, InputIterator last)
+        : base_type(EASTL_SEGMENTED_VECTOR_DEFAULT_ALLOCATOR)
+    {
+        DoAssign(first, last, is_integral<InputIterator>());
+    }
+
+
+    #ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
+        template <typename T, eastl_size_t ChunkSize, typename Allocator>
+        inline segmented_vector<T, ChunkSize, Allocator>::segmented_vector(this_type&& x)
+            : base_type(x.mChunkTable.get_allocator())
+        {
+            swap(x);
+        }
+
+
+        template <typename T, eastl_size_t ChunkSize, typename Allocator>
+        inline typename segmented_vector<T, ChunkSize, Allocator>::this_type&
+        segmented_vector<T, ChunkSize, Allocator>::operator=(this_type&& x)
+        {
+            if(&x != this)
+            {
+                DoDestroyValues(0);
+                DoFreeChunks(0);
+                swap(x);
+            }
+            return *this;
+        }
+
+
+        template <typename T, eastl_size_t ChunkSize, typename Allocator>
+        inline void segmented_vector<T, ChunkSize, Allocator>::push_back(value_type&& value)
+        {
+            ::new(DoGetBackSlot()) value_type(std::move(value));
+            ++mSize;
+        }
+    #endif
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::this_type&
+    segmented_vector<T, ChunkSize, Allocator>::operator=(const this_type& x)
+    {
+        if(&x != this)
+            DoAssign(x.begin(), x.end(), false_type());
+        return *this;
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline void segmented_vector<T, ChunkSize, Allocator>::swap(this_type& x)
+    {
+        // Like vector, we swap the allocators along with the contents, which
+        // makes this an O(1) operation.
+        mChunkTable.swap(x.mChunkTable);
+        eastl::swap(mSize, x.mSize);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline void segmented_vector<T, ChunkSize, Allocator>::assign(size_type n, const value_type& value)
+    {
+        DoAssign(n, value, true_type());
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    template <typename InputIterator>
+    inline void segmented_vector<T, ChunkSize, Allocator>::assign(InputIterator first, InputIterator last)
+    {
+        DoAssign(first, last, is_integral<InputIterator>());
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::iterator
+    segmented_vector<T, ChunkSize, Allocator>::begin()
+    {
+        T* const* const pChunkTable = DoGetChunkTable();
+        return iterator(pChunkTable, *pChunkTable);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::const_iterator
+    segmented_vector<T, ChunkSize, Allocator>::begin() const
+    {
+        T* const* const pChunkTable = DoGetChunkTable();
+        return const_iterator(pChunkTable, *pChunkTable);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::iterator
+    segmented_vector<T, ChunkSize, Allocator>::end()
+    {
+        T* const* const pChunk = DoGetChunkTable() + (mSize / kChunkSize);
+        return iterator(pChunk, *pChunk + (mSize % kChunkSize));
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::const_iterator
+    segmented_vector<T, ChunkSize, Allocator>::end() const
+    {
+        T* const* const pChunk = DoGetChunkTable() + (mSize / kChunkSize);
+        return const_iterator(pChunk, *pChunk + (mSize % kChunkSize));
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::reverse_iterator
+    segmented_vector<T, ChunkSize, Allocator>::rbegin()
+    {
+        return reverse_iterator(end());
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::const_reverse_iterator
+    segmented_vector<T, ChunkSize, Allocator>::rbegin() const
+    {
+        return const_reverse_iterator(end());
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::reverse_iterator
+    segmented_vector<T, ChunkSize, Allocator>::rend()
+    {
+        return reverse_iterator(begin());
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::const_reverse_iterator
+    segmented_vector<T, ChunkSize, Allocator>::rend() const
+    {
+        return const_reverse_iterator(begin());
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline bool segmented_vector<T, ChunkSize, Allocator>::empty() const
+    {
+        return (mSize == 0);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::size_type
+    segmented_vector<T, ChunkSize, Allocator>::size() const
+    {
+        return mSize;
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::size_type
+    segmented_vector<T, ChunkSize, Allocator>::capacity() const
+    {
+        return DoGetChunkCount() * kChunkSize;
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    void segmented_vector<T, ChunkSize, Allocator>::resize(size_type n, const value_type& value)
+    {
+        if(n > mSize)
+        {
+            reserve(n);
+            while(mSize < n)
+                push_back(value); // value cannot be invalidated by this, as elements never move.
+        }
+        else
+            DoDestroyValues(n);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    void segmented_vector<T, ChunkSize, Allocator>::resize(size_type n)
+    {
+        // Alternative implementation:
+        // resize(n, value_type());
+
+        if(n > mSize)
+        {
+            reserve(n);
+            while(mSize < n)
+                push_back();
+        }
+        else
+            DoDestroyValues(n);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    void segmented_vector<T, ChunkSize, Allocator>::reserve(size_type n)
+    {
+        const size_type nChunkCount = (n + (kChunkSize - 1)) / kChunkSize;
+
+        if(nChunkCount > DoGetChunkCount())
+        {
+            mChunkTable.reserve(nChunkCount + 1); // So DoAddChunk doesn't reallocate the table more than once.
+            while(DoGetChunkCount() < nChunkCount)
+                DoAddChunk();
+        }
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    void segmented_vector<T, ChunkSize, Allocator>::set_capacity(size_type n)
+    {
+        if(n == npos)
+            n = mSize;
+        else if(n < mSize)
+            DoDestroyValues(n);
+
+        const size_type nChunkCount = (n + (kChunkSize - 1)) / kChunkSize;
+
+        if(nChunkCount < DoGetChunkCount())
+        {
+            DoFreeChunks(nChunkCount);
+            if(nChunkCount)
+                mChunkTable.set_capacity();
+        }
+        else
+            reserve(n);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline T* segmented_vector<T, ChunkSize, Allocator>::DoGetElement(size_type n) const
+    {
+        return mChunkTable[n / kChunkSize] + (n % kChunkSize);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::reference
+    segmented_vector<T, ChunkSize, Allocator>::operator[](size_type n)
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(n >= mSize))
+                EASTL_FAIL_MSG("segmented_vector::operator[] -- out of range");
+        #endif
+
+        return *DoGetElement(n);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::const_reference
+    segmented_vector<T, ChunkSize, Allocator>::operator[](size_type n) const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(n >= mSize))
+                EASTL_FAIL_MSG("segmented_vector::operator[] -- out of range");
+        #endif
+
+        return *DoGetElement(n);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::reference
+    segmented_vector<T, ChunkSize, Allocator>::at(size_type n)
+    {
+        #if EASTL_EXCEPTIONS_ENABLED
+            if(EASTL_UNLIKELY(n >= mSize))
+                throw std::out_of_range("segmented_vector::at -- out of range");
+        #elif EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(n >= mSize))
+                EASTL_FAIL_MSG("segmented_vector::at -- out of range");
+        #endif
+
+        return *DoGetElement(n);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::const_reference
+    segmented_vector<T, ChunkSize, Allocator>::at(size_type n) const
+    {
+        #if EASTL_EXCEPTIONS_ENABLED
+            if(EASTL_UNLIKELY(n >= mSize))
+                throw std::out_of_range("segmented_vector::at -- out of range");
+        #elif EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(n >= mSize))
+                EASTL_FAIL_MSG("segmented_vector::at -- out of range");
+        #endif
+
+        return *DoGetElement(n);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::reference
+    segmented_vector<T, ChunkSize, Allocator>::front()
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mSize == 0)) // We don't allow the user to reference an empty container.
+                EASTL_FAIL_MSG("segmented_vector::front -- empty container");
+        #endif
+
+        return *mChunkTable[0];
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::const_reference
+    segmented_vector<T, ChunkSize, Allocator>::front() const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mSize == 0)) // We don't allow the user to reference an empty container.
+                EASTL_FAIL_MSG("segmented_vector::front -- empty container");
+        #endif
+
+        return *mChunkTable[0];
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::reference
+    segmented_vector<T, ChunkSize, Allocator>::back()
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mSize == 0)) // We don't allow the user to reference an empty container.
+                EASTL_FAIL_MSG("segmented_vector::back -- empty container");
+        #endif
+
+        return *DoGetElement(mSize - 1);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::const_reference
+    segmented_vector<T, ChunkSize, Allocator>::back() const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mSize == 0)) // We don't allow the user to reference an empty container.
+                EASTL_FAIL_MSG("segmented_vector::back -- empty container");
+        #endif
+
+        return *DoGetElement(mSize - 1);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline T* segmented_vector<T, ChunkSize, Allocator>::DoGetBackSlot()
+    {
+        // Returns the uninitialized slot at index mSize, adding a chunk if needed.
+        // The caller constructs the element there and then increments mSize.
+        const size_type nChunk = mSize / kChunkSize;
+
+        if(EASTL_UNLIKELY(nChunk == DoGetChunkCount()))
+            DoAddChunk();
+
+        return mChunkTable[nChunk] + (mSize % kChunkSize);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline void segmented_vector<T, ChunkSize, Allocator>::push_back(const value_type& value)
+    {
+        ::new(DoGetBackSlot()) value_type(value);
+        ++mSize;
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::reference
+    segmented_vector<T, ChunkSize, Allocator>::push_back()
+    {
+        T* const p = ::new(DoGetBackSlot()) value_type();
+        ++mSize;
+        return *p;
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline void* segmented_vector<T, ChunkSize, Allocator>::push_back_uninitialized()
+    {
+        void* const p = DoGetBackSlot();
+        ++mSize;
+        return p;
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline void segmented_vector<T, ChunkSize, Allocator>::pop_back()
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mSize == 0))
+                EASTL_FAIL_MSG("segmented_vector::pop_back -- empty container");
+        #endif
+
+        --mSize;
+        DoGetElement(mSize)->~value_type();
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline void segmented_vector<T, ChunkSize, Allocator>::clear()
+    {
+        DoDestroyValues(0);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::size_type
+    segmented_vector<T, ChunkSize, Allocator>::segment_count() const
+    {
+        return (mSize + (kChunkSize - 1)) / kChunkSize;
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::pointer
+    segmented_vector<T, ChunkSize, Allocator>::segment_begin(size_type i)
+    {
+        EASTL_ASSERT(i < segment_count());
+        return mChunkTable[i];
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::const_pointer
+    segmented_vector<T, ChunkSize, Allocator>::segment_begin(size_type i) const
+    {
+        EASTL_ASSERT(i < segment_count());
+        return mChunkTable[i];
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::pointer
+    segmented_vector<T, ChunkSize, Allocator>::segment_end(size_type i)
+    {
+        EASTL_ASSERT(i < segment_count());
+        const size_type nRemaining = mSize - (i * kChunkSize);
+        return mChunkTable[i] + ((nRemaining < (size_type)kChunkSize) ? nRemaining : (size_type)kChunkSize);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline typename segmented_vector<T, ChunkSize, Allocator>::const_pointer
+    segmented_vector<T, ChunkSize, Allocator>::segment_end(size_type i) const
+    {
+        EASTL_ASSERT(i < segment_count());
+        const size_type nRemaining = mSize - (i * kChunkSize);
+        return mChunkTable[i] + ((nRemaining < (size_type)kChunkSize) ? nRemaining : (size_type)kChunkSize);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    template <typename Integer>
+    inline void segmented_vector<T, ChunkSize, Allocator>::DoAssign(Integer n, Integer value, true_type)
+    {
+        const value_type temp((value_type)value); // value may refer to an element of this container.
+
+        DoDestroyValues(0);
+        resize((size_type)n, temp);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    template <typename InputIterator>
+    void segmented_vector<T, ChunkSize, Allocator>::DoAssign(InputIterator first, InputIterator last, false_type)
+    {
+        // Assign over the existing elements, then append or destroy the difference.
+        iterator       position(begin());
+        const iterator itEnd(end());
+
+        for(; (position != itEnd) && (first != last); ++position, ++first)
+            *position = *first;
+
+        if(first == last)
+            DoDestroyValues((size_type)(position - begin()));
+        else
+        {
+            for(; first != last; ++first)
+                push_back(*first);
+        }
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline bool segmented_vector<T, ChunkSize, Allocator>::validate() const
+    {
+        if(mSize > capacity())
+            return false;
+        if(!mChunkTable.empty() && (mChunkTable.back() != NULL))
+            return false;
+        for(size_type i = 0, iEnd = DoGetChunkCount(); i < iEnd; ++i)
+        {
+            if(mChunkTable[i] == NULL)
+                return false;
+        }
+        return true;
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline int segmented_vector<T, ChunkSize, Allocator>::validate_iterator(const_iterator i) const
+    {
+        const const_iterator itBegin(begin());
+
+        if((i.mpChunk >= itBegin.mpChunk) && (i.mpChunk <= (itBegin.mpChunk + DoGetChunkCount())))
+        {
+            const size_type n = (size_type)(i - itBegin);
+
+            if(n < mSize)
+                return (isf_valid | isf_current | isf_can_dereference);
+
+            if(n == mSize)
+                return (isf_valid | isf_current);
+        }
+
+        return isf_none;
+    }
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // global operators
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline bool operator==(const segmented_vector<T, ChunkSize, Allocator>& a, const segmented_vector<T, ChunkSize, Allocator>& b)
+    {
+        return ((a.size() == b.size()) && equal(a.begin(), a.end(), b.begin()));
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline bool operator!=(const segmented_vector<T, ChunkSize, Allocator>& a, const segmented_vector<T, ChunkSize, Allocator>& b)
+    {
+        return ((a.size() != b.size()) || !equal(a.begin(), a.end(), b.begin()));
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline bool operator<(const segmented_vector<T, ChunkSize, Allocator>& a, const segmented_vector<T, ChunkSize, Allocator>& b)
+    {
+        return lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline bool operator>(const segmented_vector<T, ChunkSize, Allocator>& a, const segmented_vector<T, ChunkSize, Allocator>& b)
+    {
+        return b < a;
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline bool operator<=(const segmented_vector<T, ChunkSize, Allocator>& a, const segmented_vector<T, ChunkSize, Allocator>& b)
+    {
+        return !(b < a);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline bool operator>=(const segmented_vector<T, ChunkSize, Allocator>& a, const segmented_vector<T, ChunkSize, Allocator>& b)
+    {
+        return !(a < b);
+    }
+
+
+    template <typename T, eastl_size_t ChunkSize, typename Allocator>
+    inline void swap(segmented_vector<T, ChunkSize, Allocator>& a, segmented_vector<T, ChunkSize, Allocator>& b)
+    {
+        a.swap(b);
+    }
+
+
+} // namespace eastl
+
+
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+
+#endif // Header include guard
@@ -129,6 +129,8 @@ namespace eastl
         using base_type::find;
         using base_type::lower_bound;
         using base_type::upper_bound;
+        using base_type::count;
+        using base_type::equal_range;
         using base_type::mCompare;
 
     public:
@@ -198,6 +200,8 @@ namespace eastl
         using base_type::find;
         using base_type::lower_bound;
         using base_type::upper_bound;
+        using base_type::count;
+        using base_type::equal_range;
         using base_type::mCompare;
 
     public:
@@ -44,6 +44,7 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //    heap_sort
 //    stable_sort           The implementation of this is simply mapped to merge_sort.
 //    merge
+//    inplace_merge
 //    merge_sort
 //    merge_sort_buffer
 //    nth_element
@@ -889,6 +890,103 @@ namespace eastl
     //    eastl::merge_sort<RandomAccessIterator, Allocator>(first, last, allocator);
     //}
 
+
+
+    /// inplace_merge
+    ///
+    /// Merges the consecutive sorted ranges [first, middle) and [middle, last) into
+    /// the single sorted range [first, last). The merge is stable: equivalent elements
+    /// keep their relative order and those from the first range precede those from 
+    /// the second range.
+    /// This algorithm allocates a temporary buffer for the smaller of the two ranges
+    /// via the user-supplied allocator, unless the ranges are already in order.
+    /// Note that inplace_merge requires a random access iterator, which usually means 
+    /// an array (eg. vector, deque).
+    ///
+    /// Example usage:
+    ///    intArray.insert(intArray.end(), newInts.begin(), newInts.end());
+    ///    sort(intArray.begin() + nOldSize, intArray.end());
+    ///    inplace_merge(intArray.begin(), intArray.begin() + nOldSize, intArray.end());
+    ///
+    template <typename RandomAccessIterator, typename Allocator, typename StrictWeakOrdering>
+    void inplace_merge(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, Allocator& allocator, StrictWeakOrdering compare)
+    {
+        typedef typename eastl::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+        typedef typename eastl::iterator_traits<RandomAccessIterator>::value_type      value_type;
+
+        const difference_type nCount1 = middle - first;
+        const difference_type nCount2 = last - middle;
+
+        if(nCount1 && nCount2 && compare(*middle, *(middle - 1))) // If the ranges aren't already in order...
+        {
+            const difference_type nBufferCount = (nCount2 < nCount1) ? nCount2 : nCount1;
+            value_type* const     pBuffer      = (value_type*)allocate_memory(allocator, nBufferCount * sizeof(value_type), EASTL_ALIGN_OF(value_type), 0);
+
+            if(nCount2 < nCount1)
+            {
+                // Move the second range out of the way and merge from the back.
+                eastl::uninitialized_copy(middle, last, pBuffer);
+
+                value_type*          pCurrent2 = pBuffer + nCount2;
+                RandomAccessIterator current1  = middle;
+                RandomAccessIterator result    = last;
+
+                while(pCurrent2 != pBuffer)
+                {
+                    if((current1 != first) && compare(*(pCurrent2 - 1), *(current1 - 1)))
+                    {
+                        EASTL_VALIDATE_COMPARE(!compare(*(current1 - 1), *(pCurrent2 - 1))); // Validate that the compare function is sane.
+                        *--result = *--current1;
+                    }
+                    else
+                        *--result = *--pCurrent2;
+                }
+                // Whatever remains of the first range is already in place.
+            }
+            else
+            {
+                // Move the first range out of the way and merge from the front.
+                eastl::uninitialized_copy(first, middle, pBuffer);
+
+                value_type*          pCurrent1 = pBuffer;
+                value_type* const    pEnd1     = pBuffer + nCount1;
+                RandomAccessIterator current2  = middle;
+                RandomAccessIterator result    = first;
+
+                while(pCurrent1 != pEnd1)
+                {
+                    if((current2 != last) && compare(*current2, *pCurrent1))
+                    {
+                        EASTL_VALIDATE_COMPARE(!compare(*pCurrent1, *current2)); // Validate that the compare function is sane.
+                        *result++ = *current2++;
+                    }
+                    else
+                        *result++ = *pCurrent1++;
+                }
+                // Whatever remains of the second range is already in place.
+            }
+
+            eastl::destruct(pBuffer, pBuffer + nBufferCount);
+            EASTLFree(allocator, pBuffer, nBufferCount * sizeof(value_type));
+        }
+    }
+
+    template <typename RandomAccessIterator, typename StrictWeakOrdering>
+    inline void inplace_merge(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, StrictWeakOrdering compare)
+    {
+        eastl::inplace_merge<RandomAccessIterator, EASTLAllocatorType, StrictWeakOrdering>
+                            (first, middle, last, *get_default_allocator(0), compare);
+    }
+
+    template <typename RandomAccessIterator>
+    inline void inplace_merge(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last)
+    {
+        typedef eastl::less<typename eastl::iterator_traits<RandomAccessIterator>::value_type> Less;
+
+        eastl::inplace_merge<RandomAccessIterator, EASTLAllocatorType, Less>
+                            (first, middle, last, *get_default_allocator(0), Less());
+    }
+
 } // namespace eastl
 
 
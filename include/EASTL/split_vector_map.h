@@ -0,0 +1,449 @@
+#ifndef EASTL_SPLIT_VECTOR_MAP_H
+#define EASTL_SPLIT_VECTOR_MAP_H
+
+#include <EASTL/internal/config.h>
+
+#include <EASTL/algorithm.h>
+#include <EASTL/allocator.h>
+#include <EASTL/functional.h>
+#include <EASTL/iterator.h>
+#include <EASTL/type_traits.h>
+#include <EASTL/utility.h>
+#include <EASTL/vector.h>
+#include <EASTL/vector_map.h>
+
+
+namespace eastl {
+
+template<class K, class V, class C, class A> class split_vector_map;
+
+namespace detail {
+
+// What dereferencing a split_vector_map iterator yields: references to a
+// key and its value, which live in different arrays.
+template<class K, class V>
+struct split_pair_ref {
+  K const& first;
+  V& second;
+
+  split_pair_ref(K const& key, V& value) : first(key), second(value) {}
+
+  template<class T1, class T2>
+  operator ::eastl::pair<T1, T2>() const { return ::eastl::pair<T1, T2>(first, second); }
+}; // struct split_pair_ref
+
+// What operator-> of a split_vector_map iterator yields.
+template<class Reference>
+struct split_pair_arrow {
+  split_pair_arrow(Reference const& ref) : m_ref(ref) {}
+  Reference const* operator->() const { return &m_ref; }
+ private:
+  Reference m_ref;
+}; // struct split_pair_arrow
+
+template<class K, class V, bool bConst>
+class split_iterator {
+  typedef typename ::eastl::type_select<bConst, V const, V>::type mapped_ref_type;
+ public:
+  typedef EASTL_ITC_NS::random_access_iterator_tag iterator_category;
+  typedef ::eastl::pair<K, V> value_type;
+  typedef ptrdiff_t difference_type;
+  typedef split_pair_ref<K, mapped_ref_type> reference;
+  typedef split_pair_arrow<reference> pointer;
+
+  split_iterator() : m_key(NULL), m_value(NULL) {}
+  split_iterator(K const* const key, mapped_ref_type* const value) : m_key(key), m_value(value) {}
+  split_iterator(split_iterator<K, V, false> const& x) : m_key(x.m_key), m_value(x.m_value) {}
+
+  reference operator*() const { return reference(*m_key, *m_value); }
+  pointer operator->() const { return pointer(**this); }
+  reference operator[](difference_type const n) const { return reference(m_key[n], m_value[n]); }
+
+  split_iterator& operator++() { ++m_key; ++m_value; return *this; }
+  split_iterator operator++(int) { split_iterator const tmp(*this); ++*this; return tmp; }
+  split_iterator& operator--() { --m_key; --m_value; return *this; }
+  split_iterator operator--(int) { split_iterator const tmp(*this); --*this; return tmp; }
+
+  split_iterator& operator+=(difference_type const n) { m_key += n; m_value += n; return *this; }
+  split_iterator& operator-=(difference_type const n) { m_key -= n; m_value -= n; return *this; }
+  split_iterator operator+(difference_type const n) const { return split_iterator(m_key + n, m_value + n); }
+  split_iterator operator-(difference_type const n) const { return split_iterator(m_key - n, m_value - n); }
+  difference_type operator-(split_iterator const& rhs) const { return m_key - rhs.m_key; }
+
+  bool operator==(split_iterator const& rhs) const { return m_key == rhs.m_key; }
+  bool operator!=(split_iterator const& rhs) const { return m_key != rhs.m_key; }
+  bool operator<(split_iterator const& rhs) const { return m_key < rhs.m_key; }
+  bool operator>(split_iterator const& rhs) const { return m_key > rhs.m_key; }
+  bool operator<=(split_iterator const& rhs) const { return m_key <= rhs.m_key; }
+  bool operator>=(split_iterator const& rhs) const { return m_key >= rhs.m_key; }
+ private:
+  template<class, class, bool> friend class split_iterator;
+  template<class, class, class, class> friend class ::eastl::split_vector_map;
+
+  K const* m_key;
+  mapped_ref_type* m_value;
+}; // class split_iterator
+
+} // namespace detail
+
+/// split_vector_map
+///
+/// A vector_map which keeps its keys and values in two arrays, in the same
+/// order, so that searches only touch the keys. This pays off when values
+/// are much larger than keys.
+///
+/// The interface is that of vector_map, except that iterators dereference
+/// to a proxy with first and second reference members instead of a
+/// pair<K, V>&. It converts to a pair. Reverse iterators support * but not
+/// ->. keys() and values() give access to the two arrays.
+template<class K, class V, class C = ::eastl::less<K>, class A = EASTLAllocatorType>
+class split_vector_map {
+ public:
+  typedef K key_type;
+  typedef V mapped_type;
+  typedef ::eastl::pair<key_type, mapped_type> value_type;
+  typedef C key_compare;
+  typedef A allocator_type;
+
+  typedef ::eastl::vector<key_type, allocator_type> key_container_type;
+  typedef ::eastl::vector<mapped_type, allocator_type> mapped_container_type;
+ private:
+  key_container_type m_keys;
+  mapped_container_type m_values;
+  detail::compare_impl<value_type, key_compare> m_cmp;
+ public:
+  typedef detail::split_iterator<key_type, mapped_type, false> iterator;
+  typedef detail::split_iterator<key_type, mapped_type, true> const_iterator;
+  typedef ::eastl::reverse_iterator<iterator> reverse_iterator;
+  typedef ::eastl::reverse_iterator<const_iterator> const_reverse_iterator;
+
+  typedef typename key_container_type::size_type size_type;
+  typedef typename key_container_type::difference_type difference_type;
+
+  typedef typename iterator::reference reference;
+  typedef typename const_iterator::reference const_reference;
+  typedef typename iterator::pointer pointer;
+  typedef typename const_iterator::pointer const_pointer;
+
+  static const size_type kMaxSize = key_container_type::kMaxSize;
+
+  class value_compare {
+    friend class split_vector_map;
+    key_compare const m_cmp;
+   protected:
+    value_compare(key_compare pred) : m_cmp(pred) {}
+   public:
+    bool operator()(value_type const& lhs, value_type const& rhs) const
+    { return m_cmp(lhs.first, rhs.first); }
+  }; // struct value_compare
+
+  explicit split_vector_map(key_compare const& cmp = key_compare(), allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
+      : m_keys(alloc), m_values(alloc), m_cmp(cmp) {}
+  template<class InputIterator>
+  split_vector_map(InputIterator first, InputIterator last,
+                   key_compare const& cmp = key_compare(),
+                   allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
+      : m_keys(alloc), m_values(alloc), m_cmp(cmp)
+  { insert(first, last); }
+  template<class InputIterator>
+  split_vector_map(sorted_unique_t, InputIterator first, InputIterator last,
+                   key_compare const& cmp = key_compare(),
+                   allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
+      : m_keys(alloc), m_values(alloc), m_cmp(cmp)
+  { insert(sorted_unique, first, last); }
+
+  split_vector_map& operator =(split_vector_map const& rhs) {
+    split_vector_map(rhs).swap(*this);
+    return *this;
+  }
+
+  iterator begin() { return iterator(m_keys.data(), m_values.data()); }
+  iterator end() { return begin() + difference_type(size()); }
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+
+  const_iterator begin() const { return const_iterator(m_keys.data(), m_values.data()); }
+  const_iterator end() const { return begin() + difference_type(size()); }
+  const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+  const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+  void clear() { m_keys.clear(); m_values.clear(); }
+  void reserve(size_type const n) { m_keys.reserve(n); m_values.reserve(n); }
+
+  bool empty() const { return m_keys.empty(); }
+  size_type size() const { return m_keys.size(); }
+  size_type max_size() { return kMaxSize; }
+
+  mapped_type& operator[](key_type const& key) {
+    return insert(value_type(key, mapped_type())).first->second;
+  }
+
+  ::eastl::pair<iterator, bool> insert(value_type const& val) {
+    iterator const i(lower_bound(val.first));
+
+    return (i == end() || m_cmp(val.first, *i.m_key))
+        ? ::eastl::make_pair(insert_at(i, val), true)
+        : ::eastl::make_pair(i, false)
+        ;
+  }
+  iterator insert(iterator const pos, value_type const& val) {
+    return
+        ((pos == begin() || m_cmp(pos.m_key[-1], val.first)) &&
+         (pos ==   end() || m_cmp(val.first, *pos.m_key)))
+        ? insert_at(pos, val)
+        : insert(val).first
+        ;
+  }
+  template<class InputIterator>
+  void insert(InputIterator first, InputIterator const last)
+  { insert_range(first, last, false); }
+  template<class InputIterator>
+  void insert(sorted_unique_t, InputIterator first, InputIterator const last)
+  { insert_range(first, last, true); }
+
+  void erase(iterator const pos) {
+    size_type const i = index_of(pos);
+    m_keys.erase(m_keys.begin() + i);
+    m_values.erase(m_values.begin() + i);
+  }
+  void erase(iterator const first, iterator const last) {
+    size_type const i = index_of(first), j = index_of(last);
+    m_keys.erase(m_keys.begin() + i, m_keys.begin() + j);
+    m_values.erase(m_values.begin() + i, m_values.begin() + j);
+  }
+  size_type erase(key_type const& k) {
+    iterator const i(find(k));
+    if(i == end()) return 0;
+    else { erase(i); return 1; }
+  }
+
+  void swap(split_vector_map& other) {
+    m_keys.swap(other.m_keys);
+    m_values.swap(other.m_values);
+    m_cmp.swap(other.m_cmp);
+  }
+
+  allocator_type& get_allocator() { return m_keys.get_allocator(); }
+  void set_allocator(allocator_type const& alloc) {
+    m_keys.set_allocator(alloc);
+    m_values.set_allocator(alloc);
+  }
+
+  key_compare key_comp() const { return static_cast<key_compare>(m_cmp); }
+  value_compare value_comp() const { return value_compare(m_cmp); }
+
+  /// The keys, sorted.
+  key_container_type const& keys() const { return m_keys; }
+  /// The values, in the order of their keys.
+  mapped_container_type const& values() const { return m_values; }
+
+  iterator find(key_type const& k) {
+    iterator const i(lower_bound(k));
+    return (i != end() && m_cmp(k, *i.m_key))? end() : i;
+  }
+  const_iterator find(key_type const& k) const {
+    const_iterator const i(lower_bound(k));
+    return (i != end() && m_cmp(k, *i.m_key))? end() : i;
+  }
+  size_type count(key_type const& k) const { return find(k) != end()? 1 : 0; }
+  iterator lower_bound(key_type const& k) {
+    return begin() + (::eastl::lower_bound(m_keys.begin(), m_keys.end(), k, m_cmp) - m_keys.begin());
+  }
+  const_iterator lower_bound(key_type const& k) const {
+    return begin() + (::eastl::lower_bound(m_keys.begin(), m_keys.end(), k, m_cmp) - m_keys.begin());
+  }
+  iterator upper_bound(key_type const& k) {
+    return begin() + (::eastl::upper_bound(m_keys.begin(), m_keys.end(), k, m_cmp) - m_keys.begin());
+  }
+  const_iterator upper_bound(key_type const& k) const {
+    return begin() + (::eastl::upper_bound(m_keys.begin(), m_keys.end(), k, m_cmp) - m_keys.begin());
+  }
+
+  ::eastl::pair<iterator, iterator> equal_range(key_type const& k) {
+    iterator const i(lower_bound(k));
+    return ::eastl::make_pair(i, (i != end() && !m_cmp(k, *i.m_key))? i + 1 : i);
+  }
+  ::eastl::pair<const_iterator, const_iterator> equal_range(key_type const& k) const {
+    const_iterator const i(lower_bound(k));
+    return ::eastl::make_pair(i, (i != end() && !m_cmp(k, *i.m_key))? i + 1 : i);
+  }
+
+  /// Transparent lookup, as with vector_map. The search runs over the key
+  /// vector, so key_compare compares the keys with a U directly.
+  template<class U>
+  typename enable_if_transparent<key_compare, U, iterator>::type find(U const& u) {
+    iterator const i(lower_bound(u));
+    return (i != end() && key_comp()(u, *i.m_key))? end() : i;
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type find(U const& u) const {
+    const_iterator const i(lower_bound(u));
+    return (i != end() && key_comp()(u, *i.m_key))? end() : i;
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, size_type>::type count(U const& u) const {
+    return find(u) != end()? 1 : 0;
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, iterator>::type lower_bound(U const& u) {
+    return begin() + (::eastl::lower_bound(m_keys.begin(), m_keys.end(), u, key_comp()) - m_keys.begin());
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type lower_bound(U const& u) const {
+    return begin() + (::eastl::lower_bound(m_keys.begin(), m_keys.end(), u, key_comp()) - m_keys.begin());
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, iterator>::type upper_bound(U const& u) {
+    return begin() + (::eastl::upper_bound(m_keys.begin(), m_keys.end(), u, key_comp()) - m_keys.begin());
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type upper_bound(U const& u) const {
+    return begin() + (::eastl::upper_bound(m_keys.begin(), m_keys.end(), u, key_comp()) - m_keys.begin());
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, ::eastl::pair<iterator, iterator> >::type equal_range(U const& u) {
+    iterator const i(lower_bound(u));
+    return ::eastl::make_pair(i, (i != end() && !key_comp()(u, *i.m_key))? i + 1 : i);
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, ::eastl::pair<const_iterator, const_iterator> >::type equal_range(U const& u) const {
+    const_iterator const i(lower_bound(u));
+    return ::eastl::make_pair(i, (i != end() && !key_comp()(u, *i.m_key))? i + 1 : i);
+  }
+ private:
+  size_type index_of(const_iterator const i) const { return size_type(i.m_key - m_keys.data()); }
+
+  iterator insert_at(iterator const pos, value_type const& val) {
+    size_type const i = index_of(pos);
+    m_keys.insert(m_keys.begin() + i, val.first);
+    #if EASTL_EXCEPTIONS_ENABLED
+      try {
+    #endif
+        m_values.insert(m_values.begin() + i, val.second);
+    #if EASTL_EXCEPTIONS_ENABLED
+      }
+      catch(...) {
+        m_keys.erase(m_keys.begin() + i);
+        throw;
+      }
+    #endif
+    return begin() + difference_type(i);
+  }
+
+  typedef ::eastl::vector<size_type, allocator_type> index_vector;
+
+  // Compares the keys at two indexes into m_keys.
+  struct index_compare {
+    index_compare(key_type const* keys, key_compare const& cmp) : m_keys(keys), m_cmp(cmp) {}
+    bool operator()(size_type const lhs, size_type const rhs) const { return m_cmp(m_keys[lhs], m_keys[rhs]); }
+   private:
+    key_type const* m_keys;
+    key_compare m_cmp;
+  };
+
+  // Appends the range to both vectors, then sorts and merges the indexes of
+  // the keys, as vector_map does its pairs. The resulting permutation is
+  // applied to both vectors in place by following its cycles, so every key
+  // and value is swapped into its place once and no value is copied.
+  template<class InputIterator>
+  void insert_range(InputIterator first, InputIterator const last, bool const is_sorted_unique) {
+    size_type const n = size();
+    index_vector order(get_allocator());
+    size_type kept = 0;
+    #if EASTL_EXCEPTIONS_ENABLED
+      try {
+    #endif
+        for(; first != last; ++first) {
+          m_keys.push_back((*first).first);
+          m_values.push_back((*first).second);
+        }
+        if(size() == n)
+          return;
+
+        // order[k] is the index of the element which goes to position k.
+        order.resize(size());
+        for(size_type i = 0; i < size(); ++i)
+          order[i] = i;
+        detail::merge_sorted_tail(order, n, index_compare(m_keys.data(), key_comp()), is_sorted_unique, true);
+        kept = order.size();
+
+        // The dropped duplicates go after the kept elements, in any order.
+        index_vector position(size(), size_type(-1), get_allocator());
+        for(size_type k = 0; k < kept; ++k)
+          position[order[k]] = k;
+        order.resize(size());
+        for(size_type i = 0, k = kept; i < size(); ++i)
+          if(position[i] == size_type(-1))
+            order[k++] = i;
+    #if EASTL_EXCEPTIONS_ENABLED
+      }
+      catch(...) {
+        m_keys.erase(m_keys.begin() + n, m_keys.end());
+        m_values.erase(m_values.begin() + n, m_values.end());
+        throw;
+      }
+    #endif
+
+    using ::eastl::swap;
+    for(size_type k = 0; k < order.size(); ++k) {
+      // Each step puts the element which belongs at j there and moves the one
+      // which was at k on to the next position of the cycle.
+      size_type j = k;
+      while(order[j] != k) {
+        size_type const next = order[j];
+        swap(m_keys[j], m_keys[next]);
+        swap(m_values[j], m_values[next]);
+        order[j] = j;
+        j = next;
+      }
+      order[j] = j;
+    }
+
+    m_keys.erase(m_keys.begin() + kept, m_keys.end());
+    m_values.erase(m_values.begin() + kept, m_values.end());
+  }
+}; // class split_vector_map
+
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator==(split_vector_map<Key, T, Compare, Allocator> const& lhs,
+                       split_vector_map<Key, T, Compare, Allocator> const& rhs)
+{ return lhs.keys() == rhs.keys() && lhs.values() == rhs.values(); }
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator!=(split_vector_map<Key, T, Compare, Allocator> const& lhs,
+                       split_vector_map<Key, T, Compare, Allocator> const& rhs)
+{ return !(lhs == rhs); }
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator<(split_vector_map<Key, T, Compare, Allocator> const& lhs,
+                      split_vector_map<Key, T, Compare, Allocator> const& rhs) {
+  // Compares the (key, value) pairs lexicographically, like vector_map.
+  typename split_vector_map<Key, T, Compare, Allocator>::size_type const n =
+      ::eastl::min_alt(lhs.size(), rhs.size());
+  for(typename split_vector_map<Key, T, Compare, Allocator>::size_type i = 0; i < n; ++i) {
+    if(lhs.keys()[i] < rhs.keys()[i]) return true;
+    if(rhs.keys()[i] < lhs.keys()[i]) return false;
+    if(lhs.values()[i] < rhs.values()[i]) return true;
+    if(rhs.values()[i] < lhs.values()[i]) return false;
+  }
+  return lhs.size() < rhs.size();
+}
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator>(split_vector_map<Key, T, Compare, Allocator> const& lhs,
+                      split_vector_map<Key, T, Compare, Allocator> const& rhs)
+{ return rhs < lhs; }
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator>=(split_vector_map<Key, T, Compare, Allocator> const& lhs,
+                       split_vector_map<Key, T, Compare, Allocator> const& rhs)
+{ return !(lhs < rhs); }
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator<=(split_vector_map<Key, T, Compare, Allocator> const& lhs,
+                       split_vector_map<Key, T, Compare, Allocator> const& rhs)
+{ return !(rhs < lhs); }
+
+template<class Key, class T, class Compare, class Allocator>
+void swap(split_vector_map<Key, T, Compare, Allocator>& lhs,
+          split_vector_map<Key, T, Compare, Allocator>& rhs)
+{ lhs.swap(rhs); }
+
+} // namespace eastl
+
+#endif // EASTL_SPLIT_VECTOR_MAP_H
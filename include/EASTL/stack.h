@@ -0,0 +1,220 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/stack.h
+//
+// Implements a LIFO container adaptor, much like the C++ std::stack class.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_STACK_H
+#define EASTL_STACK_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/vector.h>
+
+
+namespace eastl
+{
+
+    /// stack
+    ///
+    /// Adapts a container which supports back, push_back and pop_back into a
+    /// last-in first-out stack. Unlike std::stack, the default is vector
+    /// rather than deque, as a stack only ever grows at one end.
+    ///
+    template <typename T, typename Container = eastl::vector<T> >
+    class stack
+    {
+    public:
+        typedef stack<T, Container>                  this_type;
+        typedef Container                            container_type;
+        typedef typename Container::size_type        size_type;
+        typedef typename Container::value_type       value_type;
+        typedef typename Container::reference        reference;
+        typedef typename Container::const_reference  const_reference;
+
+    public:               // Public so that the global comparison operators can get at it.
+        container_type c; // The C++ standard names the underlying container 'c'.
+
+    public:
+        stack();
+        explicit stack(const container_type& x);
+
+        bool      empty() const;
+        size_type size() const;
+
+        reference       top();
+        const_reference top() const;
+
+        void push(const value_type& value);
+
+        #ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
+            void push(value_type&& value);
+        #endif
+
+        void pop();
+
+        void swap(this_type& x);
+
+        container_type&       get_container();
+        const container_type& get_container() const;
+
+    }; // class stack
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // stack
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename T, typename Container>
+    inline stack<T, Container>::stack()
+        : c()
+    {
+    }
+
+
+    template <typename T, typename Container>
+    inline stack<T, Container>::stack(const Container& x)
+        : c(x)
+    {
+    }
+
+
+    template <typename T, typename Container>
+    inline bool stack<T, Container>::empty() const
+    {
+        return c.empty();
+    }
+
+
+    template <typename T, typename Container>
+    inline typename stack<T, Container>::size_type
+    stack<T, Container>::size() const
+    {
+        return c.size();
+    }
+
+
+    template <typename T, typename Container>
+    inline typename stack<T, Container>::reference
+    stack<T, Container>::top()
+    {
+        return c.back();
+    }
+
+
+    template <typename T, typename Container>
+    inline typename stack<T, Container>::const_reference
+    stack<T, Container>::top() const
+    {
+        return c.back();
+    }
+
+
+    template <typename T, typename Container>
+    inline void stack<T, Container>::push(const value_type& value)
+    {
+        c.push_back(value);
+    }
+
+
+    #ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
+        template <typename T, typename Container>
+        inline void stack<T, Container>::push(value_type&& value)
+        {
+            c.push_back(std::move(value));
+        }
+    #endif
+
+
+    template <typename T, typename Container>
+    inline void stack<T, Container>::pop()
+    {
+        c.pop_back();
+    }
+
+
+    template <typename T, typename Container>
+    inline void stack<T, Container>::swap(this_type& x)
+    {
+        eastl::swap(c, x.c);
+    }
+
+
+    template <typename T, typename Container>
+    inline typename stack<T, Container>::container_type&
+    stack<T, Container>::get_container()
+    {
+        return c;
+    }
+
+
+    template <typename T, typename Container>
+    inline const typename stack<T, Container>::container_type&
+    stack<T, Container>::get_container() const
+    {
+        return c;
+    }
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // global operators
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename T, typename Container>
+    inline bool operator==(const stack<T, Container>& a, const stack<T, Container>& b)
+    {
+        return (a.c == b.c);
+    }
+
+
+    template <typename T, typename Container>
+    inline bool operator!=(const stack<T, Container>& a, const stack<T, Container>& b)
+    {
+        return !(a.c == b.c);
+    }
+
+
+    template <typename T, typename Container>
+    inline bool operator<(const stack<T, Container>& a, const stack<T, Container>& b)
+    {
+        return (a.c < b.c);
+    }
+
+
+    template <typename T, typename Container>
+    inline bool operator>(const stack<T, Container>& a, const stack<T, Container>& b)
+    {
+        return (b.c < a.c);
+    }
+
+
+    template <typename T, typename Container>
+    inline bool operator<=(const stack<T, Container>& a, const stack<T, Container>& b)
+    {
+        return !(b.c < a.c);
+    }
+
+
+    template <typename T, typename Container>
+    inline bool operator>=(const stack<T, Container>& a, const stack<T, Container>& b)
+    {
+        return !(a.c < b.c);
+    }
+
+
+    template <typename T, typename Container>
+    inline void swap(stack<T, Container>& a, stack<T, Container>& b)
+    {
+        a.swap(b);
+    }
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -60,6 +60,8 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //    - basic_string has a force_size() function, which unilaterally moves the string 
 //      end position (mpEnd) to the given location. Useful for when the user writes 
 //      into the string via some extenal means such as C strcpy or sprintf.
+//    - basic_string stores short strings in a buffer within the string object, 
+//      so that they allocate no memory. See EASTL_STRING_LOCAL_SIZE.
 ///////////////////////////////////////////////////////////////////////////////
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -100,10 +102,10 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //      the total sum of the reference count memory can exceed any memory savings 
 //      gained by the strings that share representations.  
 // 
-// The addition of a string_cow class is under consideration for this library. 
 // There are conceivably some systems which have string usage patterns which would
 // benefit from cow sharing. Such functionality is best saved for a separate string 
-// implementation so that the other string uses aren't penalized.
+// implementation so that the other string uses aren't penalized, and string_cow.h 
+// provides one: basic_string_cow, whose copies share their chars until modified.
 // 
 // References:
 //    This is a good starting HTML reference on the topic:
@@ -125,6 +127,9 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <EASTL/allocator.h>
 #include <EASTL/iterator.h>
 #include <EASTL/algorithm.h>
+#include <EASTL/string_view.h>
+#include <EASTL/charconv.h>
+#include <EASTL/internal/char_search.h>
 #ifdef __clang__
     #include <EASTL/internal/hashtable.h>
 #endif
@@ -183,12 +188,33 @@ THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // EASTL_STRING_INITIAL_CAPACITY
 //
 // As of this writing, this must be > 0. Note that an initially empty string 
-// has a capacity of zero (it allocates no memory).
+// allocates no memory; its capacity is that of the local buffer (see 
+// EASTL_STRING_LOCAL_SIZE).
 //
 const eastl_size_t EASTL_STRING_INITIAL_CAPACITY = 8;
 ///////////////////////////////////////////////////////////////////////////////
 
 
+
+///////////////////////////////////////////////////////////////////////////////
+// EASTL_STRING_LOCAL_SIZE
+//
+// Defines the size in bytes of the buffer within each basic_string object 
+// which holds short strings, including the terminating 0, so that they 
+// allocate no memory (the small string optimization). The default of 16 
+// holds up to 15 chars, 7 char16_t or 3 char32_t, and covers the large 
+// majority of strings in typical applications (names, tags, keys, numbers). 
+// A string uses the buffer whenever it fits and otherwise allocates memory 
+// as before; this isn't visible to the user except through capacity() and 
+// the pointers returned by data() and c_str() moving with the string object 
+// instead of staying with its contents on swap. This must be at least 8.
+//
+#ifndef EASTL_STRING_LOCAL_SIZE
+    #define EASTL_STRING_LOCAL_SIZE 16
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Vsnprintf8 / Vsnprintf16
 //
@@ -258,6 +284,21 @@ namespace eastl
     inline const char32_t*      GetEmptyString(char32_t)      { return gEmptyString.mEmpty32; }
 
 
+    /// string_local_size
+    ///
+    /// The size in bytes of the local buffer of a basic_string with the given
+    /// allocator, EASTL_STRING_LOCAL_SIZE unless specialized. An allocator whose
+    /// strings have storage of their own, such as that of fixed_string, can
+    /// specialize this as 0, which leaves just the one character basic_string
+    /// needs for the terminator of an empty string.
+    ///
+    template <typename Allocator>
+    struct string_local_size
+    {
+        static const size_t value = EASTL_STRING_LOCAL_SIZE;
+    };
+
+
     ///////////////////////////////////////////////////////////////////////////////
     /// basic_string
     ///
@@ -302,7 +343,8 @@ namespace eastl
         enum
         {
             kAlignment       = EASTL_ALIGN_OF(T),
-            kAlignmentOffset = 0
+            kAlignmentOffset = 0,
+            kLocalSize       = (string_local_size<Allocator>::value / sizeof(T)) ? (string_local_size<Allocator>::value / sizeof(T)) : 1  // Characters in mLocalBuffer, including the terminating 0.
         };
 
     public:
@@ -319,6 +361,7 @@ namespace eastl
         value_type*       mpEnd;        // End of string. *mpEnd is always '0', as we 0-terminate our string. mpEnd is always < mpCapacity.
         value_type*       mpCapacity;   // End of allocated space, including the space needed to store the trailing '0' char. mpCapacity is always at least mpEnd + 1.
         allocator_type    mAllocator;   // To do: Use base class optimization to make this go away.
+        value_type        mLocalBuffer[kLocalSize]; // Holds the string when it fits, in which case mpBegin == mLocalBuffer and mpCapacity == mLocalBuffer + kLocalSize.
 
     public:
         // Constructor, destructor
@@ -335,6 +378,7 @@ namespace eastl
         basic_string(const value_type* pBegin, const value_type* pEnd, const allocator_type& allocator = EASTL_BASIC_STRING_DEFAULT_ALLOCATOR);
         basic_string(CtorDoNotInitialize, size_type n, const allocator_type& allocator = EASTL_BASIC_STRING_DEFAULT_ALLOCATOR);
         basic_string(CtorSprintf, const value_type* pFormat, ...);
+        explicit basic_string(const basic_string_view<T>& x, const allocator_type& allocator = EASTL_BASIC_STRING_DEFAULT_ALLOCATOR);
 
        ~basic_string();
 
@@ -385,6 +429,9 @@ namespace eastl
         const value_type* data() const;
         const value_type* c_str() const;
 
+        // View of the chars; valid until the string is modified or destroyed.
+        operator basic_string_view<T>() const;
+
         // Element access
         reference       operator[](size_type n);
         const_reference operator[](size_type n) const;
@@ -410,6 +457,10 @@ namespace eastl
         basic_string& append_sprintf_va_list(const value_type* pFormat, va_list arguments);
         basic_string& append_sprintf(const value_type* pFormat, ...);
 
+        basic_string& append_int(long long value);              // Appends value in decimal. Unlike append_sprintf, parses no format string and writes straight into the string's capacity.
+        basic_string& append_uint(unsigned long long value);
+        basic_string& append_double(double value);              // Appends the shortest decimal which reads back as value, as eastl::to_chars writes it.
+
         void push_back(value_type c);
         void pop_back();
 
@@ -515,12 +566,15 @@ namespace eastl
     protected:
         // Helper functions for initialization/insertion operations.
         value_type* DoAllocate(size_type n);
+        value_type* DoAllocateAtLeast(size_type n, size_type& nAllocated);
         void        DoFree(value_type* p, size_type n);
         size_type   GetNewCapacity(size_type currentCapacity);
+        pointer     GetAppendSpace(size_type n);
 
         void        AllocateSelf();
         void        AllocateSelf(size_type n);
         void        DeallocateSelf();
+        bool        IsLocal() const;
         iterator    InsertInternal(iterator p, value_type c);
         void        RangeInitialize(const value_type* pBegin, const value_type* pEnd);
         void        RangeInitialize(const value_type* pBegin);
@@ -531,7 +585,6 @@ namespace eastl
 
         // Replacements for STL template functions.
         static const value_type* CharTypeStringFindEnd(const value_type* pBegin, const value_type* pEnd, value_type c);
-        static const value_type* CharTypeStringRFind(const value_type* pRBegin, const value_type* pREnd, const value_type c);
         static const value_type* CharTypeStringSearch(const value_type* p1Begin, const value_type* p1End, const value_type* p2Begin, const value_type* p2End);
         static const value_type* CharTypeStringRSearch(const value_type* p1Begin, const value_type* p1End, const value_type* p2Begin, const value_type* p2End);
         static const value_type* CharTypeStringFindFirstOf(const value_type* p1Begin, const value_type* p1End, const value_type* p2Begin, const value_type* p2End);
@@ -569,21 +622,7 @@ namespace eastl
 
 
 
-    template <typename T>
-    int Compare(const T* p1, const T* p2, size_t n)
-    {
-        for(; n > 0; ++p1, ++p2, --n)
-        {
-            if(*p1 != *p2)
-                return (*p1 < *p2) ? -1 : 1;
-        }
-        return 0;
-    }
-
-    inline int Compare(const char8_t* p1, const char8_t* p2, size_t n)
-    {
-        return memcmp(p1, p2, n);
-    }
+    // Compare and CharStrlen are defined in string_view.h.
 
     template <typename T>
     inline int CompareI(const T* p1, const T* p2, size_t n)
@@ -628,35 +667,6 @@ namespace eastl
     }
 
 
-    inline size_t CharStrlen(const char8_t* p)
-    {
-        #ifdef _MSC_VER // VC++ can implement an instrinsic here.
-            return strlen(p);
-        #else
-            const char8_t* pCurrent = p;
-            while(*pCurrent)
-                ++pCurrent;
-            return (size_t)(pCurrent - p);
-        #endif
-    }
-
-    inline size_t CharStrlen(const char16_t* p)
-    {
-        const char16_t* pCurrent = p;
-        while(*pCurrent)
-            ++pCurrent;
-        return (size_t)(pCurrent - p);
-    }
-
-    inline size_t CharStrlen(const char32_t* p)
-    {
-        const char32_t* pCurrent = p;
-        while(*pCurrent)
-            ++pCurrent;
-        return (size_t)(pCurrent - p);
-    }
-
-
     template <typename T>
     inline T* CharStringUninitializedCopy(const T* pSource, const T* pSourceEnd, T* pDestination)
     {
@@ -765,6 +775,7 @@ namespace eastl
           mpCapacity(NULL),
           mAllocator(x.mAllocator)
     {
+        AllocateSelf(); // So that x is left as a valid empty string.
         swap(x);
     }
 #endif
@@ -835,6 +846,17 @@ namespace eastl
     }
 
 
+    template <typename T, typename Allocator>
+    inline basic_string<T, Allocator>::basic_string(const basic_string_view<T>& x, const allocator_type& allocator)
+        : mpBegin(NULL),
+          mpEnd(NULL),
+          mpCapacity(NULL),
+          mAllocator(allocator)
+    {
+        RangeInitialize(x.begin(), x.end());
+    }
+
+
     // CtorDoNotInitialize exists so that we can create a version that allocates but doesn't 
     // initialize but also doesn't collide with any other constructor declaration.
     template <typename T, typename Allocator>
@@ -915,6 +937,13 @@ namespace eastl
     }
 
 
+    template <typename T, typename Allocator>
+    inline basic_string<T, Allocator>::operator basic_string_view<T>() const
+    {
+        return basic_string_view<T>(mpBegin, mpEnd);
+    }
+
+
     template <typename T, typename Allocator>
     inline typename basic_string<T, Allocator>::iterator
     basic_string<T, Allocator>::begin()
@@ -1138,14 +1167,19 @@ namespace eastl
         if(n == npos) // If the user wants to set the capacity to equal the current size... // '-1' because we pretend that we didn't allocate memory for the terminating 0.
             n = (size_type)(mpEnd - mpBegin);
         else if(n < (size_type)(mpEnd - mpBegin))
-            mpEnd = mpBegin + n;
+        {
+            mpEnd  = mpBegin + n;
+           *mpEnd  = 0; // The block may not change below, e.g. if the string is local.
+        }
 
         if(n != (size_type)((mpCapacity - mpBegin) - 1)) // If there is any capacity change...
         {
-            if(n)
+            if(n >= kLocalSize)
             {
-                pointer pNewBegin = DoAllocate(n + 1); // We need the + 1 to accomodate the trailing 0.
-                pointer pNewEnd   = pNewBegin;
+                // If we are growing then we are happy to take any excess the allocator has for us.
+                size_type nAllocatedLength = n + 1; // We need the + 1 to accomodate the trailing 0.
+                pointer   pNewBegin = (n > (size_type)((mpCapacity - mpBegin) - 1)) ? DoAllocateAtLeast(n + 1, nAllocatedLength) : DoAllocate(n + 1);
+                pointer   pNewEnd   = pNewBegin;
 
                 pNewEnd = CharStringUninitializedCopy(mpBegin, mpEnd, pNewBegin);
                *pNewEnd = 0;
@@ -1153,12 +1187,17 @@ namespace eastl
                 DeallocateSelf();
                 mpBegin    = pNewBegin;
                 mpEnd      = pNewEnd;
-                mpCapacity = pNewBegin + (n + 1);
+                mpCapacity = pNewBegin + nAllocatedLength;
             }
-            else
+            else if(!IsLocal()) // The string fits in the local buffer, and the local buffer's capacity can't change.
             {
+                value_type* const pNewEnd = CharStringUninitializedCopy(mpBegin, mpEnd, mLocalBuffer);
+               *pNewEnd = 0;
+
                 DeallocateSelf();
-                AllocateSelf();
+                mpBegin    = mLocalBuffer;
+                mpEnd      = pNewEnd;
+                mpCapacity = mLocalBuffer + kLocalSize;
             }
         }
     }
@@ -1394,7 +1433,8 @@ namespace eastl
             {
                 const size_type nLength = eastl::max_alt((size_type)GetNewCapacity(nCapacity), (size_type)(nOldSize + n)) + 1; // + 1 to accomodate the trailing 0.
 
-                pointer pNewBegin = DoAllocate(nLength);
+                size_type nAllocatedLength;
+                pointer pNewBegin = DoAllocateAtLeast(nLength, nAllocatedLength);
                 pointer pNewEnd   = pNewBegin;
 
                 pNewEnd = CharStringUninitializedCopy(mpBegin, mpEnd, pNewBegin);
@@ -1404,7 +1444,7 @@ namespace eastl
                 DeallocateSelf();
                 mpBegin    = pNewBegin;
                 mpEnd      = pNewEnd;
-                mpCapacity = pNewBegin + nLength; 
+                mpCapacity = pNewBegin + nAllocatedLength; 
             }
             else
             {
@@ -1444,7 +1484,7 @@ namespace eastl
             va_copy(argumentsSaved, arguments);
         #endif
 
-        if(mpBegin == GetEmptyString(value_type())) // We need to do this because non-standard vsnprintf implementations will otherwise overwrite gEmptyString with a non-zero char.
+        if((mpCapacity - mpEnd) == 1) // If there is room for only the terminating 0 (e.g. a full string, or an empty one with no local buffer)... We need to do this because non-standard vsnprintf implementations will otherwise overwrite it with a non-zero char.
             nReturnValue = eastl::Vsnprintf(mpEnd, 0, pFormat, arguments);
         else
             nReturnValue = eastl::Vsnprintf(mpEnd, (size_t)(mpCapacity - mpEnd), pFormat, arguments);
@@ -1499,6 +1539,33 @@ namespace eastl
     }
 
 
+    template <typename T, typename Allocator>
+    inline basic_string<T, Allocator>& basic_string<T, Allocator>::append_int(long long value)
+    {
+        mpEnd  = Internal::WriteInteger(GetAppendSpace(kMaxIntegerChars), value);
+        *mpEnd = 0;
+        return *this;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_string<T, Allocator>& basic_string<T, Allocator>::append_uint(unsigned long long value)
+    {
+        mpEnd  = Internal::WriteInteger(GetAppendSpace(kMaxIntegerChars), value);
+        *mpEnd = 0;
+        return *this;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_string<T, Allocator>& basic_string<T, Allocator>::append_double(double value)
+    {
+        mpEnd  = Internal::WriteFloat(GetAppendSpace(kMaxDoubleChars), value);
+        *mpEnd = 0;
+        return *this;
+    }
+
+
     template <typename T, typename Allocator>
     inline void basic_string<T, Allocator>::push_back(value_type c)
     {
@@ -1748,7 +1815,8 @@ namespace eastl
                 const size_type nOldCap  = (size_type)((mpCapacity - mpBegin) - 1);
                 const size_type nLength  = eastl::max_alt((size_type)GetNewCapacity(nOldCap), (size_type)(nOldSize + n)) + 1; // + 1 to accomodate the trailing 0.
 
-                iterator pNewBegin = DoAllocate(nLength);
+                size_type nAllocatedLength;
+                iterator pNewBegin = DoAllocateAtLeast(nLength, nAllocatedLength);
                 iterator pNewEnd   = pNewBegin;
 
                 pNewEnd = CharStringUninitializedCopy(mpBegin, p, pNewBegin);
@@ -1759,7 +1827,7 @@ namespace eastl
                 DeallocateSelf();
                 mpBegin    = pNewBegin;
                 mpEnd      = pNewEnd;
-                mpCapacity = pNewBegin + nLength;     
+                mpCapacity = pNewBegin + nAllocatedLength;     
             }
         }
     }
@@ -1833,7 +1901,8 @@ namespace eastl
                 else
                     nLength = eastl::max_alt((size_type)GetNewCapacity(nOldCap), (size_type)(nOldSize + n)) + 1; // + 1 to accomodate the trailing 0.
 
-                pointer pNewBegin = DoAllocate(nLength);
+                size_type nAllocatedLength;
+                pointer pNewBegin = DoAllocateAtLeast(nLength, nAllocatedLength);
                 pointer pNewEnd   = pNewBegin;
 
                 pNewEnd = CharStringUninitializedCopy(mpBegin, p,     pNewBegin);
@@ -1844,7 +1913,7 @@ namespace eastl
                 DeallocateSelf();
                 mpBegin    = pNewBegin;
                 mpEnd      = pNewEnd;
-                mpCapacity = pNewBegin + nLength; 
+                mpCapacity = pNewBegin + nAllocatedLength; 
             }
         }
     }
@@ -2098,7 +2167,8 @@ namespace eastl
                 const size_type nOldCap      = (size_type)((mpCapacity - mpBegin) - 1);
                 const size_type nNewCapacity = eastl::max_alt((size_type)GetNewCapacity(nOldCap), (size_type)(nOldSize + (nLength2 - nLength1))) + 1; // + 1 to accomodate the trailing 0.
 
-                pointer pNewBegin = DoAllocate(nNewCapacity);
+                size_type nAllocatedLength;
+                pointer pNewBegin = DoAllocateAtLeast(nNewCapacity, nAllocatedLength);
                 pointer pNewEnd   = pNewBegin;
 
                 pNewEnd = CharStringUninitializedCopy(mpBegin, pBegin1, pNewBegin);
@@ -2109,7 +2179,7 @@ namespace eastl
                 DeallocateSelf();
                 mpBegin    = pNewBegin;
                 mpEnd      = pNewEnd;
-                mpCapacity = pNewBegin + nNewCapacity; 
+                mpCapacity = pNewBegin + nAllocatedLength; 
             }
         }
         return *this;
@@ -2140,9 +2210,49 @@ namespace eastl
         if(mAllocator == x.mAllocator) // If allocators are equivalent...
         {
             // We leave mAllocator as-is.
-            eastl::swap(mpBegin,     x.mpBegin);
-            eastl::swap(mpEnd,       x.mpEnd);
-            eastl::swap(mpCapacity,  x.mpCapacity);
+            if(!IsLocal() && !x.IsLocal())
+            {
+                eastl::swap(mpBegin,     x.mpBegin);
+                eastl::swap(mpEnd,       x.mpEnd);
+                eastl::swap(mpCapacity,  x.mpCapacity);
+            }
+            else // A local string's pointers refer to its own object, so its characters must be copied to the other object.
+            {
+                value_type      localBuffer[kLocalSize];
+                const bool      bLocal = IsLocal();
+                value_type*     pBegin = mpBegin;
+                value_type*     pEnd   = mpEnd;
+                value_type*     pCapacity = mpCapacity;
+
+                if(bLocal)
+                    memcpy(localBuffer, mLocalBuffer, sizeof(localBuffer));
+
+                if(x.IsLocal())
+                {
+                    memcpy(mLocalBuffer, x.mLocalBuffer, sizeof(mLocalBuffer));
+                    mpBegin    = mLocalBuffer;
+                    mpEnd      = mLocalBuffer + (x.mpEnd - x.mpBegin);
+                    mpCapacity = mLocalBuffer + kLocalSize;
+                }
+                else
+                {
+                    mpBegin    = x.mpBegin;
+                    mpEnd      = x.mpEnd;
+                    mpCapacity = x.mpCapacity;
+                }
+
+                if(bLocal)
+                {
+                    memcpy(x.mLocalBuffer, localBuffer, sizeof(localBuffer));
+                    pEnd      = x.mLocalBuffer + (pEnd - pBegin);
+                    pBegin    = x.mLocalBuffer;
+                    pCapacity = x.mLocalBuffer + kLocalSize;
+                }
+
+                x.mpBegin    = pBegin;
+                x.mpEnd      = pEnd;
+                x.mpCapacity = pCapacity;
+            }
         }
         else // else swap the contents.
         {
@@ -2216,7 +2326,7 @@ namespace eastl
 
             if(EASTL_LIKELY((position + n) <= (size_type)(mpEnd - mpBegin))) // If the range is valid...
             {
-                const value_type* const pTemp = eastl::search(mpBegin + position, mpEnd, p, p + n);
+                const value_type* const pTemp = CharSearch(mpBegin + position, mpEnd, p, p + n);
 
                 if((pTemp != mpEnd) || (n == 0))
                     return (size_type)(pTemp - mpBegin);
@@ -2239,7 +2349,7 @@ namespace eastl
 
         if(EASTL_LIKELY(position < (size_type)(mpEnd - mpBegin))) // If the position is valid...
         {
-            const const_iterator pResult = eastl::find(mpBegin + position, mpEnd, c);
+            const const_iterator pResult = CharFind(mpBegin + position, mpEnd, c);
 
             if(pResult != mpEnd)
                 return (size_type)(pResult - mpBegin);
@@ -2310,10 +2420,10 @@ namespace eastl
         if(EASTL_LIKELY(nLength))
         {
             const value_type* const pEnd    = mpBegin + eastl::min_alt(nLength - 1, position) + 1;
-            const value_type* const pResult = CharTypeStringRFind(pEnd, mpBegin, c);
+            const value_type* const pResult = CharFindLast(mpBegin, pEnd, c);
 
-            if(pResult != mpBegin)
-                return (size_type)((pResult - 1) - mpBegin);
+            if(pResult != pEnd)
+                return (size_type)(pResult - mpBegin);
         }
         return npos;
     }
@@ -2790,7 +2900,8 @@ namespace eastl
             const size_type nOldCap  = (size_type)((mpCapacity - mpBegin) - 1);
             const size_type nLength  = eastl::max_alt((size_type)GetNewCapacity(nOldCap), (size_type)(nOldSize + 1)) + 1; // The second + 1 is to accomodate the trailing 0.
 
-            iterator pNewBegin = DoAllocate(nLength);
+            size_type nAllocatedLength;
+            iterator pNewBegin = DoAllocateAtLeast(nLength, nAllocatedLength);
             iterator pNewEnd   = pNewBegin;
 
             pNewPosition = CharStringUninitializedCopy(mpBegin, p, pNewBegin);
@@ -2803,7 +2914,7 @@ namespace eastl
             DeallocateSelf();
             mpBegin    = pNewBegin;
             mpEnd      = pNewEnd;
-            mpCapacity = pNewBegin + nLength;
+            mpCapacity = pNewBegin + nAllocatedLength;
         }
         return pNewPosition;
     }
@@ -2852,11 +2963,24 @@ namespace eastl
     inline typename basic_string<T, Allocator>::value_type*
     basic_string<T, Allocator>::DoAllocate(size_type n)
     {
-        EASTL_ASSERT(n > 1); // We want n > 1 because n == 1 is reserved for empty capacity and usage of gEmptyString.
+        EASTL_ASSERT(n > 1); // We want n > 1 because n == 1 is an empty string, which uses mLocalBuffer.
         return (value_type*)EASTLAlloc(mAllocator, n * sizeof(value_type));
     }
 
 
+    template <typename T, typename Allocator>
+    inline typename basic_string<T, Allocator>::value_type*
+    basic_string<T, Allocator>::DoAllocateAtLeast(size_type n, size_type& nAllocated)
+    {
+        // Like DoAllocate, but we learn how many characters actually fit in the 
+        // returned block (see allocate_memory_at_least), which may be more than n.
+        EASTL_ASSERT(n > 1); // We want n > 1 because n == 1 is an empty string, which uses mLocalBuffer.
+        const allocation_result result = allocate_memory_at_least(mAllocator, n * sizeof(value_type), 1, 0);
+        nAllocated = result.ptr ? (size_type)(result.count / sizeof(value_type)) : 0;
+        return (value_type*)result.ptr;
+    }
+
+
     template <typename T, typename Allocator>
     inline void basic_string<T, Allocator>::DoFree(value_type* p, size_type n)
     {
@@ -2869,17 +2993,38 @@ namespace eastl
     inline typename basic_string<T, Allocator>::size_type
     basic_string<T, Allocator>::GetNewCapacity(size_type currentCapacity) // This needs to return a value of at least currentCapacity and at least 1.
     {
-        return (currentCapacity > EASTL_STRING_INITIAL_CAPACITY) ? (2 * currentCapacity) : EASTL_STRING_INITIAL_CAPACITY;
+        // Capacities here don't count the trailing 0. Up to EASTL_STRING_INITIAL_CAPACITY 
+        // we keep returning it, as EASTL always has, so the default 2x policy grows 
+        // exactly as before (8, then 2 * capacity).
+        typedef typename allocator_growth_policy<Allocator>::type growth_policy_type;
+        if(currentCapacity <= EASTL_STRING_INITIAL_CAPACITY)
+            return EASTL_STRING_INITIAL_CAPACITY;
+        return (size_type)growth_policy_type()(mAllocator, (size_t)currentCapacity, (size_t)EASTL_STRING_INITIAL_CAPACITY, sizeof(T));
+    }
+
+
+    // Makes room for n more chars past the end, growing as append does, and returns the end.
+    template <typename T, typename Allocator>
+    inline typename basic_string<T, Allocator>::pointer
+    basic_string<T, Allocator>::GetAppendSpace(size_type n)
+    {
+        const size_type nSize     = (size_type)(mpEnd - mpBegin);
+        const size_type nCapacity = (size_type)((mpCapacity - mpBegin) - 1);
+
+        if((nSize + n) > nCapacity)
+            reserve(eastl::max_alt((size_type)GetNewCapacity(nCapacity), (size_type)(nSize + n)));
+
+        return mpEnd;
     }
 
 
     template <typename T, typename Allocator>
     inline void basic_string<T, Allocator>::AllocateSelf()
     {
-        EASTL_ASSERT(gEmptyString.mUint32 == 0);
-        mpBegin     = const_cast<value_type*>(GetEmptyString(value_type()));  // In const_cast-int this, we promise not to modify it.
-        mpEnd       = mpBegin;
-        mpCapacity  = mpBegin + 1; // When we are using gEmptyString, mpCapacity is always mpEnd + 1. This is an important distinguising characteristic.
+        mLocalBuffer[0] = 0;
+        mpBegin         = mLocalBuffer;
+        mpEnd           = mLocalBuffer;
+        mpCapacity      = mLocalBuffer + kLocalSize;
     }
 
 
@@ -2896,7 +3041,7 @@ namespace eastl
                 ThrowLengthException();
         #endif
 
-        if(n > 1)
+        if(n > kLocalSize)
         {
             mpBegin    = DoAllocate(n);
             mpEnd      = mpBegin;
@@ -2910,15 +3055,18 @@ namespace eastl
     template <typename T, typename Allocator>
     inline void basic_string<T, Allocator>::DeallocateSelf()
     {
-        // Note that we compare mpCapacity to mpEnd instead of comparing 
-        // mpBegin to &gEmptyString. This is important because we may have
-        // a case whereby one library passes a string to another library to 
-        // deallocate and the two libraries have idependent versions of gEmptyString.
-        if((mpCapacity - mpBegin) > 1) // If we are not using gEmptyString as our memory...
+        if(!IsLocal()) // If we are not using mLocalBuffer as our memory...
             DoFree(mpBegin, (size_type)(mpCapacity - mpBegin));
     }
 
 
+    template <typename T, typename Allocator>
+    inline bool basic_string<T, Allocator>::IsLocal() const
+    {
+        return mpBegin == mLocalBuffer;
+    }
+
+
     template <typename T, typename Allocator>
     inline void basic_string<T, Allocator>::ThrowLengthException() const
     {
@@ -2959,78 +3107,19 @@ namespace eastl
     const typename basic_string<T, Allocator>::value_type*
     basic_string<T, Allocator>::CharTypeStringFindEnd(const value_type* pBegin, const value_type* pEnd, value_type c)
     {
-        const value_type* pTemp = pEnd;
-        while(--pTemp >= pBegin)
-        {
-            if(*pTemp == c)
-                return pTemp;
-        }
-
-        return pEnd;
-    }
-
-
-    // CharTypeStringRFind
-    // Specialized value_type version of STL find() function in reverse.
-    template <typename T, typename Allocator>
-    const typename basic_string<T, Allocator>::value_type*
-    basic_string<T, Allocator>::CharTypeStringRFind(const value_type* pRBegin, const value_type* pREnd, const value_type c)
-    {
-        while(pRBegin > pREnd)
-        {
-            if(*(pRBegin - 1) == c)
-                return pRBegin;
-            --pRBegin;
-        }
-        return pREnd;
+        return CharFindLast(pBegin, pEnd, c);
     }
 
 
     // CharTypeStringSearch
     // Specialized value_type version of STL search() function.
-    // Purpose: find p2 within p1. Return p1End if not found or if either string is zero length.
+    // Purpose: find p2 within p1. Return p1End if not found, or p1Begin if p2 is zero length.
     template <typename T, typename Allocator>
     const typename basic_string<T, Allocator>::value_type*
     basic_string<T, Allocator>::CharTypeStringSearch(const value_type* p1Begin, const value_type* p1End, 
                                                      const value_type* p2Begin, const value_type* p2End)
     {
-        // Test for zero length strings, in which case we have a match or a failure, 
-        // but the return value is the same either way.
-        if((p1Begin == p1End) || (p2Begin == p2End))
-            return p1Begin;
-
-        // Test for a pattern of length 1.
-        if((p2Begin + 1) == p2End)
-            return eastl::find(p1Begin, p1End, *p2Begin);
-
-        // General case.
-        const value_type* pTemp;
-        const value_type* pTemp1 = (p2Begin + 1);
-        const value_type* pCurrent = p1Begin;
-
-        while(p1Begin != p1End)
-        {
-            p1Begin = eastl::find(p1Begin, p1End, *p2Begin);
-            if(p1Begin == p1End)
-                return p1End;
-
-            pTemp = pTemp1;
-            pCurrent = p1Begin; 
-            if(++pCurrent == p1End)
-                return p1End;
-
-            while(*pCurrent == *pTemp)
-            {
-                if(++pTemp == p2End)
-                    return p1Begin;
-                if(++pCurrent == p1End)
-                    return p1End;
-            }
-
-            ++p1Begin;
-        }
-
-        return p1Begin;
+        return CharSearch(p1Begin, p1End, p2Begin, p2End);
     }
 
 
@@ -3092,15 +3181,7 @@ namespace eastl
     basic_string<T, Allocator>::CharTypeStringFindFirstOf(const value_type* p1Begin, const value_type* p1End, 
                                                           const value_type* p2Begin, const value_type* p2End)
     {
-        for( ; p1Begin != p1End; ++p1Begin)
-        {
-            for(const value_type* pTemp = p2Begin; pTemp != p2End; ++pTemp)
-            {
-                if(*p1Begin == *pTemp)
-                    return p1Begin;
-            }
-        }
-        return p1End;
+        return CharFindFirstOf(p1Begin, p1End, p2Begin, p2End);
     }
 
 
@@ -3132,18 +3213,7 @@ namespace eastl
     basic_string<T, Allocator>::CharTypeStringFindFirstNotOf(const value_type* p1Begin, const value_type* p1End, 
                                                              const value_type* p2Begin, const value_type* p2End)
     {
-        for( ; p1Begin != p1End; ++p1Begin)
-        {
-            const value_type* pTemp;
-            for(pTemp = p2Begin; pTemp != p2End; ++pTemp)
-            {
-                if(*p1Begin == *pTemp)
-                    break;
-            }
-            if(pTemp == p2End)
-                return p1Begin;
-        }
-        return p1End;
+        return CharFindFirstNotOf(p1Begin, p1End, p2Begin, p2End);
     }
 
 
@@ -3260,6 +3330,8 @@ namespace eastl
             return false;
         if(mpCapacity < mpEnd)
             return false;
+        if(IsLocal() && (mpCapacity != (mLocalBuffer + kLocalSize)))
+            return false;
         return true;
     }
 
@@ -3419,6 +3491,49 @@ namespace eastl
     }
 
 
+    // Comparisons with basic_string_view.
+    template <typename T, typename Allocator>
+    inline bool operator==(const basic_string<T, Allocator>& a, const basic_string_view<T>& b)
+    {
+        return basic_string_view<T>(a) == b;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline bool operator==(const basic_string_view<T>& a, const basic_string<T, Allocator>& b)
+    {
+        return a == basic_string_view<T>(b);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline bool operator!=(const basic_string<T, Allocator>& a, const basic_string_view<T>& b)
+    {
+        return !(basic_string_view<T>(a) == b);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline bool operator!=(const basic_string_view<T>& a, const basic_string<T, Allocator>& b)
+    {
+        return !(a == basic_string_view<T>(b));
+    }
+
+
+    template <typename T, typename Allocator>
+    inline bool operator<(const basic_string<T, Allocator>& a, const basic_string_view<T>& b)
+    {
+        return basic_string_view<T>(a).compare(b) < 0;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline bool operator<(const basic_string_view<T>& a, const basic_string<T, Allocator>& b)
+    {
+        return a.compare(basic_string_view<T>(b)) < 0;
+    }
+
+
     template <typename T, typename Allocator>
     inline void swap(basic_string<T, Allocator>& a, basic_string<T, Allocator>& b)
     {
@@ -3437,27 +3552,43 @@ namespace eastl
 
 
 
+    /// to_string
+    ///
+    /// Returns value in decimal, written with eastl::to_chars rather than 
+    /// through sprintf. Unlike std::to_string, which uses "%f", a float or 
+    /// double is written as the shortest decimal which reads back as it,
+    /// so to_string(0.1) is "0.1" and to_string(1e30) is "1e+30".
+    ///
+    inline string to_string(int value)                { return string().append_int(value); }
+    inline string to_string(long value)               { return string().append_int(value); }
+    inline string to_string(long long value)          { return string().append_int(value); }
+    inline string to_string(unsigned value)           { return string().append_uint(value); }
+    inline string to_string(unsigned long value)      { return string().append_uint(value); }
+    inline string to_string(unsigned long long value) { return string().append_uint(value); }
+    inline string to_string(float value)              { char buffer[kMaxFloatChars]; return string(buffer, Internal::WriteFloat(buffer, value)); }
+    inline string to_string(double value)             { return string().append_double(value); }
+
+
+
     /// hash<string>
     ///
     /// We provide EASTL hash function objects for use in hash table containers.
+    /// They hash a basic_string_view, to which strings, char pointers and 
+    /// views all convert, and are transparent: hash_map<string> and 
+    /// hash_set<string> can find a string_view or a char pointer without 
+    /// constructing a string. hash<string_view> gives the same values.
     ///
     /// Example usage:
     ///    #include <EASTL/hash_set.h>
     ///    hash_set<string> stringHashSet;
     ///
-    template <typename T> struct hash;
-
     template <>
     struct hash<string>
     {
-        size_t operator()(const string& x) const
-        {
-            const unsigned char* p = (const unsigned char*)x.c_str(); // To consider: limit p to at most 256 chars.
-            unsigned int c, result = 2166136261U; // We implement an FNV-like string hash. 
-            while((c = *p++) != 0) // Using '!=' disables compiler warnings.
-                result = (result * 16777619) ^ c;
-            return (size_t)result;
-        }
+        typedef int is_transparent;
+
+        size_t operator()(const string_view& x) const
+            { return CharStringHash(x.begin(), x.end()); } // To consider: limit the hash to at most 256 chars.
     };
 
     /// hash<wstring>
@@ -3465,14 +3596,36 @@ namespace eastl
     template <>
     struct hash<wstring>
     {
-        size_t operator()(const wstring& x) const
-        {
-            const wchar_t* p = (const wchar_t*)x.c_str(); // To consider: limit p to at most 256 chars.
-            unsigned int c, result = 2166136261U; // We implement an FNV-like string hash. 
-            while((c = *p++) != 0) // Using '!=' disables compiler warnings.
-                result = (result * 16777619) ^ c;
-            return (size_t)result;
-        }
+        typedef int is_transparent;
+
+        size_t operator()(const wstring_view& x) const
+            { return CharStringHash(x.begin(), x.end()); }
+    };
+
+
+    /// less<basic_string> / equal_to<basic_string>
+    ///
+    /// Transparent versions which compare basic_string_views, so that the tree
+    /// and hash table containers with the default comparisons for string keys 
+    /// accept a string_view or a char pointer in find, count, lower_bound, 
+    /// upper_bound and equal_range without constructing a string.
+    ///
+    template <typename T, typename Allocator>
+    struct less< basic_string<T, Allocator> > : public binary_function<basic_string<T, Allocator>, basic_string<T, Allocator>, bool>
+    {
+        typedef int is_transparent;
+
+        bool operator()(const basic_string_view<T>& a, const basic_string_view<T>& b) const
+            { return a.compare(b) < 0; }
+    };
+
+    template <typename T, typename Allocator>
+    struct equal_to< basic_string<T, Allocator> > : public binary_function<basic_string<T, Allocator>, basic_string<T, Allocator>, bool>
+    {
+        typedef int is_transparent;
+
+        bool operator()(const basic_string_view<T>& a, const basic_string_view<T>& b) const
+            { return a == b; }
     };
 
 
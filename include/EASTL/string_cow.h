@@ -0,0 +1,1049 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/string_cow.h
+//
+// Implements basic_string_cow, a string whose copies share its chars until
+// one of them is modified.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// basic_string doesn't share chars between copies (see the discussion of
+// copy on write at the top of string.h), so copying a large string copies
+// all its chars. basic_string_cow is a separate string for data such as
+// configuration blobs and templates, which is built once and then copied
+// into many containers but rarely modified:
+//    - Copying or assigning one string_cow to another is O(1). It adds a
+//      reference to the same chars, counted with an atomic increment, so
+//      copies can be made and destroyed on different threads.
+//    - The read-only interface (data, c_str, size, operator[], iteration,
+//      find, compare) never copies.
+//    - The modifying functions (append, insert, erase, resize, reserve,
+//      mutable_data...) first copy the chars if any other string shares
+//      them (see unique), and then modify this string's copy in place.
+//      The other strings are never affected.
+//    - There is no non-const operator[] or iterator, as handing out a
+//      reference into shared chars would make copy on write unsafe.
+//      mutable_data returns a pointer to this string's own chars instead.
+//
+// The chars live in a single block with their reference count, size and
+// capacity, so a string_cow is one pointer plus its allocator, and an
+// empty one allocates nothing. The block is freed with the allocator of
+// the string which releases the last reference, so copies share chars
+// only when their allocators compare equal, and otherwise copy them.
+//
+// A string_cow converts to a basic_string_view without copying, and to
+// and from a basic_string by copying. hash<string_cow> gives the same
+// values as hash<string>, and hash, less and equal_to for string_cow are
+// transparent, so containers of string_cow can find a view or a char
+// pointer without constructing a string_cow.
+//
+// Example usage:
+//    eastl::string_cow config(LoadFile("config.json"));   // One copy of the chars...
+//    for(int i = 0; i < nWorkerCount; ++i)
+//        workers[i].mConfig = config;                       // ...shared by every worker.
+//
+//    eastl::string_cow local(config);
+//    local.append(",\"verbose\":true");                     // Copies first; config is unchanged.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_STRING_COW_H
+#define EASTL_STRING_COW_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/internal/atomic.h>
+#include <EASTL/string.h>
+#include <EASTL/string_view.h>
+#include <stddef.h>
+#include <string.h>
+
+
+namespace eastl
+{
+
+    /// EASTL_STRING_COW_DEFAULT_NAME
+    ///
+    /// Defines a default container name in the absence of a user-provided name.
+    ///
+    #ifndef EASTL_STRING_COW_DEFAULT_NAME
+        #define EASTL_STRING_COW_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " string_cow" // Unless the user overrides something, this is "EASTL string_cow".
+    #endif
+
+
+    /// EASTL_STRING_COW_DEFAULT_ALLOCATOR
+    ///
+    #ifndef EASTL_STRING_COW_DEFAULT_ALLOCATOR
+        #define EASTL_STRING_COW_DEFAULT_ALLOCATOR allocator_type(EASTL_STRING_COW_DEFAULT_NAME)
+    #endif
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// basic_string_cow
+    ///
+    /// Implements a reference counted, copy on write string.
+    ///
+    template <typename T, typename Allocator = EASTLAllocatorType>
+    class basic_string_cow
+    {
+    public:
+        typedef basic_string_cow<T, Allocator>                  this_type;
+        typedef basic_string<T, Allocator>                      string_type;
+        typedef basic_string_view<T>                            view_type;
+        typedef T                                               value_type;
+        typedef T*                                              pointer;
+        typedef const T*                                        const_pointer;
+        typedef const T&                                        const_reference;
+        typedef const T*                                        const_iterator;
+        typedef eastl::reverse_iterator<const_iterator>         const_reverse_iterator;
+        typedef eastl_size_t                                    size_type;
+        typedef ptrdiff_t                                       difference_type;
+        typedef Allocator                                       allocator_type;
+
+        static const size_type npos     = (size_type)-1;
+        static const size_type kMaxSize = (size_type)-2;
+
+    protected:
+        // Rep
+        // The header of the block holding the chars, which follow it, 0-terminated.
+        struct Rep
+        {
+            volatile int32_t mnRefCount;  // The number of strings sharing the block.
+            size_type        mnSize;
+            size_type        mnCapacity;  // The number of chars which fit, not counting the terminating 0.
+
+            value_type* chars() { return (value_type*)(this + 1); }
+        };
+
+        Rep*           mpRep;           // NULL if the string is empty and has no capacity.
+        allocator_type mAllocator;
+
+        static const value_type kEmptyString[1];
+
+    public:
+        // Constructor, destructor
+        basic_string_cow();
+        explicit basic_string_cow(const allocator_type& allocator);
+        EASTL_STRING_EXPLICIT basic_string_cow(const value_type* p, const allocator_type& allocator = EASTL_STRING_COW_DEFAULT_ALLOCATOR);
+        basic_string_cow(const value_type* p, size_type n, const allocator_type& allocator = EASTL_STRING_COW_DEFAULT_ALLOCATOR);
+        basic_string_cow(const value_type* pBegin, const value_type* pEnd, const allocator_type& allocator = EASTL_STRING_COW_DEFAULT_ALLOCATOR);
+        explicit basic_string_cow(const view_type& x, const allocator_type& allocator = EASTL_STRING_COW_DEFAULT_ALLOCATOR);
+        explicit basic_string_cow(const string_type& x);
+        basic_string_cow(const this_type& x);
+#ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
+        basic_string_cow(this_type&& x);
+#endif
+       ~basic_string_cow();
+
+        // Allocator
+        const allocator_type& get_allocator() const;
+        allocator_type&       get_allocator();
+        void                  set_allocator(const allocator_type& allocator);
+
+        // Assignment. Assigning a basic_string_cow shares its chars.
+        this_type& operator=(const this_type& x);
+#ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
+        this_type& operator=(this_type&& x);
+#endif
+        this_type& operator=(const value_type* p);
+        this_type& operator=(const view_type& x);
+        this_type& assign(const value_type* p, size_type n);
+
+        void swap(this_type& x);
+
+        // Sharing
+        bool    unique() const;         // Whether no other string shares the chars, so that modifying them won't copy them.
+        int32_t use_count() const;      // The number of strings sharing the chars, or 0 if the string has no chars allocated.
+
+        // Read access. These never copy the chars.
+        const_iterator begin() const;
+        const_iterator end() const;
+        const_reverse_iterator rbegin() const;
+        const_reverse_iterator rend() const;
+
+        bool      empty() const;
+        size_type size() const;
+        size_type length() const;
+        size_type max_size() const;
+        size_type capacity() const;
+
+        const value_type* data() const;
+        const value_type* c_str() const;
+
+        const_reference operator[](size_type n) const;
+        const_reference front() const;
+        const_reference back() const;
+
+        // View of the chars; valid until this string is modified or destroyed.
+        operator view_type() const;
+
+        // A basic_string holding a copy of the chars, using this string's allocator.
+        string_type str() const;
+
+        size_type find(value_type c, size_type position = 0) const;
+        size_type find(const view_type& x, size_type position = 0) const;
+        int       compare(const view_type& x) const;
+
+        // Modification. These first copy the chars if other strings share them.
+        value_type* mutable_data();     // This string's own chars, or NULL if it has none allocated. Valid until this string is modified or destroyed.
+
+        this_type& append(const value_type* p, size_type n);
+        this_type& append(const value_type* p);
+        this_type& append(const view_type& x);
+        this_type& append(size_type n, value_type c);
+
+        this_type& operator+=(const value_type* p);
+        this_type& operator+=(const view_type& x);
+        this_type& operator+=(value_type c);
+
+        void       push_back(value_type c);
+        this_type& insert(size_type position, const view_type& x);
+        this_type& erase(size_type position = 0, size_type n = npos);
+
+        void resize(size_type n, value_type c);
+        void resize(size_type n);
+        void reserve(size_type n);
+        void clear();
+
+    protected:
+        Rep*        DoAllocateRep(size_type nCapacity);
+        void        DoFreeRep(Rep* pRep);
+        void        DoRelease();
+        value_type* DoReplace(size_type position, size_type nErase, const value_type* p, size_type n);
+        void        ThrowLengthException() const;
+        void        ThrowRangeException() const;
+
+    }; // basic_string_cow
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // basic_string_cow
+    ///////////////////////////////////////////////////////////////////////////////
+
+    template <typename T, typename Allocator>
+    const T basic_string_cow<T, Allocator>::kEmptyString[1] = { 0 };
+
+
+    template <typename T, typename Allocator>
+    inline basic_string_cow<T, Allocator>::basic_string_cow()
+        : mpRep(NULL),
+          mAllocator(EASTL_STRING_COW_DEFAULT_NAME)
+    {
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_string_cow<T, Allocator>::basic_string_cow(const allocator_type& allocator)
+        : mpRep(NULL),
+          mAllocator(allocator)
+    {
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_string_cow<T, Allocator>::basic_string_cow(const value_type* p, const allocator_type& allocator)
+        : mpRep(NULL),
+          mAllocator(allocator)
+    {
+        DoReplace(0, 0, p, (size_type)CharStrlen(p));
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_string_cow<T, Allocator>::basic_string_cow(const value_type* p, size_type n, const allocator_type& allocator)
+        : mpRep(NULL),
+          mAllocator(allocator)
+    {
+        DoReplace(0, 0, p, n);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_string_cow<T, Allocator>::basic_string_cow(const value_type* pBegin, const value_type* pEnd, const allocator_type& allocator)
+        : mpRep(NULL),
+          mAllocator(allocator)
+    {
+        DoReplace(0, 0, pBegin, (size_type)(pEnd - pBegin));
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_string_cow<T, Allocator>::basic_string_cow(const view_type& x, const allocator_type& allocator)
+        : mpRep(NULL),
+          mAllocator(allocator)
+    {
+        DoReplace(0, 0, x.data(), x.size());
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_string_cow<T, Allocator>::basic_string_cow(const string_type& x)
+        : mpRep(NULL),
+          mAllocator(x.get_allocator())
+    {
+        DoReplace(0, 0, x.data(), x.size());
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_string_cow<T, Allocator>::basic_string_cow(const this_type& x)
+        : mpRep(x.mpRep),
+          mAllocator(x.mAllocator)
+    {
+        if(mpRep)
+            AtomicIncrement(&mpRep->mnRefCount);
+    }
+
+
+#ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
+    template <typename T, typename Allocator>
+    inline basic_string_cow<T, Allocator>::basic_string_cow(this_type&& x)
+        : mpRep(x.mpRep),
+          mAllocator(x.mAllocator)
+    {
+        x.mpRep = NULL;
+    }
+#endif
+
+
+    template <typename T, typename Allocator>
+    inline basic_string_cow<T, Allocator>::~basic_string_cow()
+    {
+        DoRelease();
+    }
+
+
+    template <typename T, typename Allocator>
+    inline const typename basic_string_cow<T, Allocator>::allocator_type&
+    basic_string_cow<T, Allocator>::get_allocator() const
+    {
+        return mAllocator;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::allocator_type&
+    basic_string_cow<T, Allocator>::get_allocator()
+    {
+        return mAllocator;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline void basic_string_cow<T, Allocator>::set_allocator(const allocator_type& allocator)
+    {
+        mAllocator = allocator;
+    }
+
+
+    template <typename T, typename Allocator>
+    typename basic_string_cow<T, Allocator>::this_type&
+    basic_string_cow<T, Allocator>::operator=(const this_type& x)
+    {
+        if(mpRep != x.mpRep)
+        {
+            if(mAllocator == x.mAllocator) // If we can free x's chars...
+            {
+                if(x.mpRep)
+                    AtomicIncrement(&x.mpRep->mnRefCount);
+                DoRelease();
+                mpRep = x.mpRep;
+            }
+            else
+                DoReplace(0, size(), x.data(), x.size());
+        }
+        return *this;
+    }
+
+
+#ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::this_type&
+    basic_string_cow<T, Allocator>::operator=(this_type&& x)
+    {
+        if(mAllocator == x.mAllocator)
+            eastl::swap(mpRep, x.mpRep);
+        else
+            operator=(static_cast<const this_type&>(x));
+        return *this;
+    }
+#endif
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::this_type&
+    basic_string_cow<T, Allocator>::operator=(const value_type* p)
+    {
+        DoReplace(0, size(), p, (size_type)CharStrlen(p));
+        return *this;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::this_type&
+    basic_string_cow<T, Allocator>::operator=(const view_type& x)
+    {
+        DoReplace(0, size(), x.data(), x.size());
+        return *this;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::this_type&
+    basic_string_cow<T, Allocator>::assign(const value_type* p, size_type n)
+    {
+        DoReplace(0, size(), p, n);
+        return *this;
+    }
+
+
+    template <typename T, typename Allocator>
+    void basic_string_cow<T, Allocator>::swap(this_type& x)
+    {
+        if(mAllocator == x.mAllocator)
+            eastl::swap(mpRep, x.mpRep);
+        else
+        {
+            const this_type temp(*this);
+            *this = x;
+            x = temp;
+        }
+    }
+
+
+    template <typename T, typename Allocator>
+    inline bool basic_string_cow<T, Allocator>::unique() const
+    {
+        return !mpRep || (AtomicLoadAcquire(&mpRep->mnRefCount) == 1);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline int32_t basic_string_cow<T, Allocator>::use_count() const
+    {
+        return mpRep ? AtomicLoadAcquire(&mpRep->mnRefCount) : 0;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::const_iterator
+    basic_string_cow<T, Allocator>::begin() const
+    {
+        return data();
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::const_iterator
+    basic_string_cow<T, Allocator>::end() const
+    {
+        return data() + size();
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::const_reverse_iterator
+    basic_string_cow<T, Allocator>::rbegin() const
+    {
+        return const_reverse_iterator(end());
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::const_reverse_iterator
+    basic_string_cow<T, Allocator>::rend() const
+    {
+        return const_reverse_iterator(begin());
+    }
+
+
+    template <typename T, typename Allocator>
+    inline bool basic_string_cow<T, Allocator>::empty() const
+    {
+        return !mpRep || !mpRep->mnSize;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::size_type
+    basic_string_cow<T, Allocator>::size() const
+    {
+        return mpRep ? mpRep->mnSize : 0;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::size_type
+    basic_string_cow<T, Allocator>::length() const
+    {
+        return size();
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::size_type
+    basic_string_cow<T, Allocator>::max_size() const
+    {
+        return kMaxSize;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::size_type
+    basic_string_cow<T, Allocator>::capacity() const
+    {
+        return mpRep ? mpRep->mnCapacity : 0;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline const typename basic_string_cow<T, Allocator>::value_type*
+    basic_string_cow<T, Allocator>::data() const
+    {
+        return mpRep ? mpRep->chars() : kEmptyString;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline const typename basic_string_cow<T, Allocator>::value_type*
+    basic_string_cow<T, Allocator>::c_str() const
+    {
+        return data();
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::const_reference
+    basic_string_cow<T, Allocator>::operator[](size_type n) const
+    {
+        #if EASTL_ASSERT_ENABLED // We allow the user to reference the trailing 0 char without asserting.
+            if(EASTL_UNLIKELY(n > size()))
+                EASTL_FAIL_MSG("basic_string_cow::operator[] -- out of range");
+        #endif
+
+        return data()[n];
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::const_reference
+    basic_string_cow<T, Allocator>::front() const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(empty()))
+                EASTL_FAIL_MSG("basic_string_cow::front -- empty string");
+        #endif
+
+        return data()[0];
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::const_reference
+    basic_string_cow<T, Allocator>::back() const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(empty()))
+                EASTL_FAIL_MSG("basic_string_cow::back -- empty string");
+        #endif
+
+        return data()[size() - 1];
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_string_cow<T, Allocator>::operator view_type() const
+    {
+        return view_type(data(), size());
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::string_type
+    basic_string_cow<T, Allocator>::str() const
+    {
+        return string_type(data(), data() + size(), mAllocator);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::size_type
+    basic_string_cow<T, Allocator>::find(value_type c, size_type position) const
+    {
+        return view_type(data(), size()).find(c, position);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::size_type
+    basic_string_cow<T, Allocator>::find(const view_type& x, size_type position) const
+    {
+        return view_type(data(), size()).find(x, position);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline int basic_string_cow<T, Allocator>::compare(const view_type& x) const
+    {
+        return view_type(data(), size()).compare(x);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::value_type*
+    basic_string_cow<T, Allocator>::mutable_data()
+    {
+        if(!unique())
+            DoReplace(size(), 0, NULL, 0);
+        return mpRep ? mpRep->chars() : NULL;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::this_type&
+    basic_string_cow<T, Allocator>::append(const value_type* p, size_type n)
+    {
+        DoReplace(size(), 0, p, n);
+        return *this;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::this_type&
+    basic_string_cow<T, Allocator>::append(const value_type* p)
+    {
+        DoReplace(size(), 0, p, (size_type)CharStrlen(p));
+        return *this;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::this_type&
+    basic_string_cow<T, Allocator>::append(const view_type& x)
+    {
+        DoReplace(size(), 0, x.data(), x.size());
+        return *this;
+    }
+
+
+    template <typename T, typename Allocator>
+    typename basic_string_cow<T, Allocator>::this_type&
+    basic_string_cow<T, Allocator>::append(size_type n, value_type c)
+    {
+        value_type* const p = DoReplace(size(), 0, NULL, n);
+
+        for(size_type i = 0; i < n; ++i)
+            p[i] = c;
+        return *this;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::this_type&
+    basic_string_cow<T, Allocator>::operator+=(const value_type* p)
+    {
+        return append(p);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::this_type&
+    basic_string_cow<T, Allocator>::operator+=(const view_type& x)
+    {
+        return append(x);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_cow<T, Allocator>::this_type&
+    basic_string_cow<T, Allocator>::operator+=(value_type c)
+    {
+        push_back(c);
+        return *this;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline void basic_string_cow<T, Allocator>::push_back(value_type c)
+    {
+        *DoReplace(size(), 0, NULL, 1) = c;
+    }
+
+
+    template <typename T, typename Allocator>
+    typename basic_string_cow<T, Allocator>::this_type&
+    basic_string_cow<T, Allocator>::insert(size_type position, const view_type& x)
+    {
+        #if EASTL_STRING_OPT_RANGE_ERRORS
+            if(EASTL_UNLIKELY(position > size()))
+                ThrowRangeException();
+        #endif
+
+        DoReplace(position, 0, x.data(), x.size());
+        return *this;
+    }
+
+
+    template <typename T, typename Allocator>
+    typename basic_string_cow<T, Allocator>::this_type&
+    basic_string_cow<T, Allocator>::erase(size_type position, size_type n)
+    {
+        const size_type nSize = size();
+
+        #if EASTL_STRING_OPT_RANGE_ERRORS
+            if(EASTL_UNLIKELY(position > nSize))
+                ThrowRangeException();
+        #endif
+
+        DoReplace(position, eastl::min_alt(n, nSize - position), NULL, 0);
+        return *this;
+    }
+
+
+    template <typename T, typename Allocator>
+    void basic_string_cow<T, Allocator>::resize(size_type n, value_type c)
+    {
+        const size_type nSize = size();
+
+        if(n > nSize)
+            append(n - nSize, c);
+        else if(n < nSize)
+            DoReplace(n, nSize - n, NULL, 0);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline void basic_string_cow<T, Allocator>::resize(size_type n)
+    {
+        resize(n, value_type());
+    }
+
+
+    template <typename T, typename Allocator>
+    void basic_string_cow<T, Allocator>::reserve(size_type n)
+    {
+        if(n > capacity())
+        {
+            const size_type nSize = size();
+            Rep* const      pRep  = DoAllocateRep(n);
+
+            if(nSize)
+                memcpy(pRep->chars(), mpRep->chars(), (size_t)nSize * sizeof(value_type));
+            pRep->mnSize = nSize;
+            pRep->chars()[nSize] = 0;
+
+            DoRelease();
+            mpRep = pRep;
+        }
+    }
+
+
+    template <typename T, typename Allocator>
+    inline void basic_string_cow<T, Allocator>::clear()
+    {
+        DoReplace(0, size(), NULL, 0);
+    }
+
+
+    template <typename T, typename Allocator>
+    typename basic_string_cow<T, Allocator>::Rep*
+    basic_string_cow<T, Allocator>::DoAllocateRep(size_type nCapacity)
+    {
+        #if EASTL_STRING_OPT_LENGTH_ERRORS
+            if(EASTL_UNLIKELY(nCapacity > kMaxSize))
+                ThrowLengthException();
+        #endif
+
+        Rep* const pRep = (Rep*)EASTLAlloc(mAllocator, sizeof(Rep) + ((size_t)nCapacity + 1) * sizeof(value_type));
+        pRep->mnRefCount = 1;
+        pRep->mnSize     = 0;
+        pRep->mnCapacity = nCapacity;
+        return pRep;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline void basic_string_cow<T, Allocator>::DoFreeRep(Rep* pRep)
+    {
+        EASTLFree(mAllocator, pRep, sizeof(Rep) + ((size_t)pRep->mnCapacity + 1) * sizeof(value_type));
+    }
+
+
+    template <typename T, typename Allocator>
+    inline void basic_string_cow<T, Allocator>::DoRelease()
+    {
+        if(mpRep && (AtomicDecrement(&mpRep->mnRefCount) == 0))
+            DoFreeRep(mpRep);
+    }
+
+
+    // DoReplace
+    // Replaces the nErase chars at position with the n chars at p, or with n
+    // uninitialized chars if p is NULL, and returns a pointer to the first of them.
+    // This is done in place if the chars aren't shared, fit the capacity, and p
+    // doesn't point into them. Otherwise it copies into a new block, whose
+    // capacity grows geometrically unless the whole string is being replaced.
+    template <typename T, typename Allocator>
+    typename basic_string_cow<T, Allocator>::value_type*
+    basic_string_cow<T, Allocator>::DoReplace(size_type position, size_type nErase, const value_type* p, size_type n)
+    {
+        const size_type nSize     = size();
+        const size_type nCapacity = capacity();
+        const size_type nTail     = nSize - position - nErase;
+
+        #if EASTL_STRING_OPT_LENGTH_ERRORS
+            if(EASTL_UNLIKELY(n > (kMaxSize - (nSize - nErase))))
+                ThrowLengthException();
+        #endif
+
+        const size_type nNewSize = (nSize - nErase) + n;
+        value_type*     pChars   = mpRep ? mpRep->chars() : NULL;
+
+        if(mpRep && (nNewSize <= nCapacity) && unique() && !(p && (p >= pChars) && (p <= (pChars + nCapacity))))
+        {
+            if(nTail && (n != nErase))
+                memmove(pChars + position + n, pChars + position + nErase, (size_t)nTail * sizeof(value_type));
+            if(p && n)
+                memcpy(pChars + position, p, (size_t)n * sizeof(value_type));
+        }
+        else if(nNewSize == 0)
+        {
+            DoRelease();
+            mpRep = NULL;
+            return NULL;
+        }
+        else
+        {
+            const size_type nNewCapacity = ((nNewSize > nCapacity) && (nErase != nSize)) ? eastl::max_alt(nNewSize, (size_type)(2 * nCapacity)) : nNewSize;
+            Rep* const      pRep         = DoAllocateRep(nNewCapacity);
+            value_type*     pNewChars    = pRep->chars();
+
+            if(position)
+                memcpy(pNewChars, pChars, (size_t)position * sizeof(value_type));
+            if(p && n)
+                memcpy(pNewChars + position, p, (size_t)n * sizeof(value_type));
+            if(nTail)
+                memcpy(pNewChars + position + n, pChars + position + nErase, (size_t)nTail * sizeof(value_type));
+
+            DoRelease();
+            mpRep  = pRep;
+            pChars = pNewChars;
+        }
+
+        mpRep->mnSize    = nNewSize;
+        pChars[nNewSize] = 0;
+        return pChars + position;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline void basic_string_cow<T, Allocator>::ThrowLengthException() const
+    {
+        #if EASTL_EXCEPTIONS_ENABLED
+            throw std::length_error("basic_string_cow -- length_error");
+        #elif EASTL_ASSERT_ENABLED
+            EASTL_FAIL_MSG("basic_string_cow -- length_error");
+        #endif
+    }
+
+
+    template <typename T, typename Allocator>
+    inline void basic_string_cow<T, Allocator>::ThrowRangeException() const
+    {
+        #if EASTL_EXCEPTIONS_ENABLED
+            throw std::out_of_range("basic_string_cow -- out of range");
+        #elif EASTL_ASSERT_ENABLED
+            EASTL_FAIL_MSG("basic_string_cow -- out of range");
+        #endif
+    }
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // global operators
+    ///////////////////////////////////////////////////////////////////////////////
+
+    // Strings sharing their chars are equal without comparing them.
+    template <typename T, typename Allocator>
+    inline bool operator==(const basic_string_cow<T, Allocator>& a, const basic_string_cow<T, Allocator>& b)
+    {
+        return (a.data() == b.data()) || (basic_string_view<T>(a) == basic_string_view<T>(b));
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator==(const basic_string_cow<T, Allocator>& a, const basic_string_view<T>& b)
+    {
+        return basic_string_view<T>(a) == b;
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator==(const basic_string_view<T>& a, const basic_string_cow<T, Allocator>& b)
+    {
+        return a == basic_string_view<T>(b);
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator==(const basic_string_cow<T, Allocator>& a, const basic_string<T, Allocator>& b)
+    {
+        return basic_string_view<T>(a) == basic_string_view<T>(b);
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator==(const basic_string<T, Allocator>& a, const basic_string_cow<T, Allocator>& b)
+    {
+        return basic_string_view<T>(a) == basic_string_view<T>(b);
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator==(const basic_string_cow<T, Allocator>& a, const T* p)
+    {
+        return basic_string_view<T>(a) == basic_string_view<T>(p);
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator==(const T* p, const basic_string_cow<T, Allocator>& b)
+    {
+        return basic_string_view<T>(p) == basic_string_view<T>(b);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline bool operator!=(const basic_string_cow<T, Allocator>& a, const basic_string_cow<T, Allocator>& b)
+    {
+        return !(a == b);
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator!=(const basic_string_cow<T, Allocator>& a, const basic_string_view<T>& b)
+    {
+        return !(a == b);
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator!=(const basic_string_view<T>& a, const basic_string_cow<T, Allocator>& b)
+    {
+        return !(a == b);
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator!=(const basic_string_cow<T, Allocator>& a, const basic_string<T, Allocator>& b)
+    {
+        return !(a == b);
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator!=(const basic_string<T, Allocator>& a, const basic_string_cow<T, Allocator>& b)
+    {
+        return !(a == b);
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator!=(const basic_string_cow<T, Allocator>& a, const T* p)
+    {
+        return !(a == p);
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator!=(const T* p, const basic_string_cow<T, Allocator>& b)
+    {
+        return !(p == b);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline bool operator<(const basic_string_cow<T, Allocator>& a, const basic_string_cow<T, Allocator>& b)
+    {
+        return a.compare(b) < 0;
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator>(const basic_string_cow<T, Allocator>& a, const basic_string_cow<T, Allocator>& b)
+    {
+        return b < a;
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator<=(const basic_string_cow<T, Allocator>& a, const basic_string_cow<T, Allocator>& b)
+    {
+        return !(b < a);
+    }
+
+    template <typename T, typename Allocator>
+    inline bool operator>=(const basic_string_cow<T, Allocator>& a, const basic_string_cow<T, Allocator>& b)
+    {
+        return !(a < b);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline void swap(basic_string_cow<T, Allocator>& a, basic_string_cow<T, Allocator>& b)
+    {
+        a.swap(b);
+    }
+
+
+    /// string_cow / wstring_cow
+    typedef basic_string_cow<char>    string_cow;
+    typedef basic_string_cow<wchar_t> wstring_cow;
+
+    /// string8_cow / string16_cow / string32_cow
+    typedef basic_string_cow<char8_t>  string8_cow;
+    typedef basic_string_cow<char16_t> string16_cow;
+    typedef basic_string_cow<char32_t> string32_cow;
+
+
+
+    /// hash<string_cow>
+    ///
+    /// Transparent, and gives the same values as hash<string> and hash<string_view>.
+    ///
+    template <>
+    struct hash<string_cow>
+    {
+        typedef int is_transparent;
+
+        size_t operator()(const string_view& x) const
+            { return CharStringHash(x.begin(), x.end()); }
+    };
+
+    /// hash<wstring_cow>
+    ///
+    template <>
+    struct hash<wstring_cow>
+    {
+        typedef int is_transparent;
+
+        size_t operator()(const wstring_view& x) const
+            { return CharStringHash(x.begin(), x.end()); }
+    };
+
+
+    /// less<basic_string_cow> / equal_to<basic_string_cow>
+    ///
+    /// Transparent versions which compare basic_string_views, as for basic_string.
+    ///
+    template <typename T, typename Allocator>
+    struct less< basic_string_cow<T, Allocator> > : public binary_function<basic_string_cow<T, Allocator>, basic_string_cow<T, Allocator>, bool>
+    {
+        typedef int is_transparent;
+
+        bool operator()(const basic_string_view<T>& a, const basic_string_view<T>& b) const
+            { return a.compare(b) < 0; }
+    };
+
+    template <typename T, typename Allocator>
+    struct equal_to< basic_string_cow<T, Allocator> > : public binary_function<basic_string_cow<T, Allocator>, basic_string_cow<T, Allocator>, bool>
+    {
+        typedef int is_transparent;
+
+        bool operator()(const basic_string_view<T>& a, const basic_string_view<T>& b) const
+            { return a == b; }
+    };
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
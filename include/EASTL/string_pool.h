@@ -0,0 +1,597 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/string_pool.h
+//
+// Implements basic_string_pool, which interns strings as 32 bit atoms.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Data such as metric names and tag values repeats the same few thousand
+// strings millions of times. Kept as separate basic_strings, each copy has
+// its own allocation, and comparing or hashing two of them reads all their
+// chars. A string_pool keeps one copy of each distinct string and names it
+// with an atom, a uint32_t counting from 0 in the order strings are first
+// interned:
+//    - Atoms compare equal exactly when their strings do, so comparing and
+//      hashing them (hash<uint32_t>) is O(1), and since they are dense they
+//      can also index a vector.
+//    - str, c_str and length return the string of an atom in O(1). Its
+//      chars stay at the same address until the pool is cleared.
+//    - hash returns the string's hash, computed once when it was interned.
+//      It is the value hash<string> and hash<string_view> give.
+//
+// The chars are copied into blocks of 64 KB (longer strings get a block of
+// their own), each with a terminating 0, so interning doesn't allocate for
+// each string. The entry of each atom, which holds its chars pointer,
+// length and hash, is in an array of segments, the first holding 1024
+// entries and each of the others as many as all before it, so entries
+// never move either. The index from strings to atoms is an open addressing
+// table of (hash, atom) pairs, which compares the chars only on a match of
+// the 32 bit hash.
+//
+// Concurrent mode
+// A pool constructed with bConcurrent true may be used by several threads
+// at once: intern and find from any thread, and str, c_str, length and
+// hash for any atom the calling thread has obtained. The index and blocks
+// are then divided into 16 shards by hash, each with its own spin lock,
+// so threads interning different strings rarely wait for each other.
+// Reading an atom's string takes no lock. The allocator must be usable
+// from several threads, as the default one is. clear, and destroying the
+// pool, must not overlap with any other use. Without bConcurrent, the
+// pool takes no locks and is used like the other containers.
+//
+// Example usage:
+//    eastl::string_pool names;
+//    eastl::string_pool::atom_type cpu = names.intern("cpu.usage");
+//    eastl::hash_map<eastl::string_pool::atom_type, double> values; // Keyed by 4 bytes.
+//    values[cpu] = 0.5;
+//    printf("%s\n", names.c_str(cpu));
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_STRING_POOL_H
+#define EASTL_STRING_POOL_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/internal/atomic.h>
+#include <EASTL/allocator.h>
+#include <EASTL/bitset.h>
+#include <EASTL/functional.h>
+#include <EASTL/string_view.h>
+#include <stddef.h>
+#include <string.h>
+
+
+namespace eastl
+{
+
+    /// EASTL_STRING_POOL_DEFAULT_NAME
+    ///
+    /// Defines a default container name in the absence of a user-provided name.
+    ///
+    #ifndef EASTL_STRING_POOL_DEFAULT_NAME
+        #define EASTL_STRING_POOL_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " string_pool" // Unless the user overrides something, this is "EASTL string_pool".
+    #endif
+
+
+    /// EASTL_STRING_POOL_DEFAULT_ALLOCATOR
+    ///
+    #ifndef EASTL_STRING_POOL_DEFAULT_ALLOCATOR
+        #define EASTL_STRING_POOL_DEFAULT_ALLOCATOR allocator_type(EASTL_STRING_POOL_DEFAULT_NAME)
+    #endif
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// basic_string_pool
+    ///
+    /// Implements a set of strings, each named by a uint32_t atom.
+    ///
+    template <typename T, typename Allocator = EASTLAllocatorType>
+    class basic_string_pool
+    {
+    public:
+        typedef basic_string_pool<T, Allocator>     this_type;
+        typedef basic_string_view<T>                view_type;
+        typedef T                                   value_type;
+        typedef eastl_size_t                        size_type;
+        typedef uint32_t                            atom_type;
+        typedef Allocator                           allocator_type;
+
+        static const atom_type kInvalidAtom = (atom_type)-1; // Returned by find for a string which hasn't been interned.
+
+        enum
+        {
+            kShardCount        = 16,                        // Shards in concurrent mode.
+            kBlockSize         = 65536,                     // Bytes of chars per block, less the block header.
+            kFirstSegmentShift = 10,
+            kFirstSegmentSize  = 1 << kFirstSegmentShift,   // Entries in the first segment.
+            kSegmentCount      = 32 - kFirstSegmentShift
+        };
+
+    protected:
+        struct Entry
+        {
+            const value_type* mpChars;
+            size_type         mnLength;
+            size_t            mnHash;
+        };
+
+        struct Slot
+        {
+            uint32_t  mnHash;           // The low 32 bits of the mixed hash.
+            atom_type mnAtom;           // kInvalidAtom if the slot is empty.
+        };
+
+        struct Block
+        {
+            Block* mpNext;
+            size_t mnSize;              // Including this header. The chars follow it.
+        };
+
+        struct Shard
+        {
+            mutable volatile int32_t mnLock;
+            Slot*                    mpSlots;
+            uint32_t                 mnSlotMask;    // The slot count less one, a power of two less one, or 0 if mpSlots is NULL.
+            uint32_t                 mnCount;
+            char*                    mpFree;        // The unused part of the current block.
+            char*                    mpFreeEnd;
+            Block*                   mpBlocks;
+        };
+
+        Entry* volatile  mpSegments[kSegmentCount]; // Segment k holds the entries of atoms kFirstSegmentSize * (2^k - 1) and on.
+        volatile int32_t mnAtomCount;
+        Shard            mShards[kShardCount];      // Only the first is used if not concurrent.
+        bool             mbConcurrent;
+        allocator_type   mAllocator;
+
+    public:
+        explicit basic_string_pool(const allocator_type& allocator = EASTL_STRING_POOL_DEFAULT_ALLOCATOR);
+        explicit basic_string_pool(bool bConcurrent, const allocator_type& allocator = EASTL_STRING_POOL_DEFAULT_ALLOCATOR);
+       ~basic_string_pool();
+
+        const allocator_type& get_allocator() const;
+        bool                  concurrent() const;
+
+        atom_type intern(const view_type& x);       // Returns the atom of x, adding x if it isn't in the pool.
+        atom_type find(const view_type& x) const;   // Returns the atom of x, or kInvalidAtom if it isn't in the pool.
+
+        view_type         str(atom_type atom) const;
+        view_type         operator[](atom_type atom) const;
+        const value_type* c_str(atom_type atom) const;
+        size_type         length(atom_type atom) const;
+        size_t            hash(atom_type atom) const;
+
+        size_type size() const;                     // The number of atoms. In concurrent mode, it includes any being added.
+        bool      empty() const;
+        void      clear();
+
+    protected:
+        const Entry&      DoGetEntry(atom_type atom) const;
+        Entry&            DoAllocateEntry(atom_type atom);
+        Slot*             DoFindSlot(const Shard& shard, uint32_t nHash, const view_type& x) const;
+        void              DoGrow(Shard& shard);
+        const value_type* DoCopyChars(Shard& shard, const view_type& x);
+        Shard&            DoGetShard(uint32_t nHash) const;
+        void              DoLock(const Shard& shard) const;
+        void              DoUnlock(const Shard& shard) const;
+        void              DoInit();
+
+        static uint32_t   DoMixHash(size_t h);
+
+    private:
+        // Not copyable: atoms are only meaningful to the pool which issued them.
+        basic_string_pool(const this_type&);
+        this_type& operator=(const this_type&);
+
+    }; // basic_string_pool
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // basic_string_pool
+    ///////////////////////////////////////////////////////////////////////////////
+
+    template <typename T, typename Allocator>
+    const typename basic_string_pool<T, Allocator>::atom_type basic_string_pool<T, Allocator>::kInvalidAtom;
+
+
+    template <typename T, typename Allocator>
+    inline basic_string_pool<T, Allocator>::basic_string_pool(const allocator_type& allocator)
+        : mbConcurrent(false),
+          mAllocator(allocator)
+    {
+        DoInit();
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_string_pool<T, Allocator>::basic_string_pool(bool bConcurrent, const allocator_type& allocator)
+        : mbConcurrent(bConcurrent),
+          mAllocator(allocator)
+    {
+        DoInit();
+    }
+
+
+    template <typename T, typename Allocator>
+    inline basic_string_pool<T, Allocator>::~basic_string_pool()
+    {
+        clear();
+    }
+
+
+    template <typename T, typename Allocator>
+    inline const typename basic_string_pool<T, Allocator>::allocator_type&
+    basic_string_pool<T, Allocator>::get_allocator() const
+    {
+        return mAllocator;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline bool basic_string_pool<T, Allocator>::concurrent() const
+    {
+        return mbConcurrent;
+    }
+
+
+    template <typename T, typename Allocator>
+    typename basic_string_pool<T, Allocator>::atom_type
+    basic_string_pool<T, Allocator>::intern(const view_type& x)
+    {
+        const size_t   h     = CharStringHash(x.begin(), x.end());
+        const uint32_t nHash = DoMixHash(h);
+        Shard&         shard = DoGetShard(nHash);
+
+        DoLock(shard);
+
+        if((shard.mnCount + 1) > ((shard.mnSlotMask + 1) / 2)) // Keep the table at most half full.
+            DoGrow(shard);
+
+        Slot* const pSlot = DoFindSlot(shard, nHash, x);
+
+        if(pSlot->mnAtom == kInvalidAtom)
+        {
+            const atom_type atom   = mbConcurrent ? (atom_type)(AtomicIncrement(&mnAtomCount) - 1) : (atom_type)mnAtomCount++;
+            Entry&          entry  = DoAllocateEntry(atom);
+
+            entry.mpChars  = DoCopyChars(shard, x);
+            entry.mnLength = x.size();
+            entry.mnHash   = h;
+
+            pSlot->mnHash = nHash;
+            pSlot->mnAtom = atom;
+            ++shard.mnCount;
+        }
+
+        const atom_type atom = pSlot->mnAtom;
+        DoUnlock(shard);
+        return atom;
+    }
+
+
+    template <typename T, typename Allocator>
+    typename basic_string_pool<T, Allocator>::atom_type
+    basic_string_pool<T, Allocator>::find(const view_type& x) const
+    {
+        const uint32_t nHash = DoMixHash(CharStringHash(x.begin(), x.end()));
+        const Shard&   shard = DoGetShard(nHash);
+        atom_type      atom  = kInvalidAtom;
+
+        DoLock(shard);
+        if(shard.mpSlots)
+            atom = DoFindSlot(shard, nHash, x)->mnAtom;
+        DoUnlock(shard);
+
+        return atom;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_pool<T, Allocator>::view_type
+    basic_string_pool<T, Allocator>::str(atom_type atom) const
+    {
+        const Entry& entry = DoGetEntry(atom);
+        return view_type(entry.mpChars, entry.mnLength);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_pool<T, Allocator>::view_type
+    basic_string_pool<T, Allocator>::operator[](atom_type atom) const
+    {
+        return str(atom);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline const typename basic_string_pool<T, Allocator>::value_type*
+    basic_string_pool<T, Allocator>::c_str(atom_type atom) const
+    {
+        return DoGetEntry(atom).mpChars;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_pool<T, Allocator>::size_type
+    basic_string_pool<T, Allocator>::length(atom_type atom) const
+    {
+        return DoGetEntry(atom).mnLength;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline size_t basic_string_pool<T, Allocator>::hash(atom_type atom) const
+    {
+        return DoGetEntry(atom).mnHash;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_pool<T, Allocator>::size_type
+    basic_string_pool<T, Allocator>::size() const
+    {
+        return (size_type)mnAtomCount;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline bool basic_string_pool<T, Allocator>::empty() const
+    {
+        return mnAtomCount == 0;
+    }
+
+
+    template <typename T, typename Allocator>
+    void basic_string_pool<T, Allocator>::clear()
+    {
+        for(int k = 0; k < kSegmentCount; ++k)
+        {
+            if(mpSegments[k])
+                EASTLFree(mAllocator, mpSegments[k], ((size_t)kFirstSegmentSize << k) * sizeof(Entry));
+        }
+
+        for(int i = 0; i < kShardCount; ++i)
+        {
+            Shard& shard = mShards[i];
+
+            if(shard.mpSlots)
+                EASTLFree(mAllocator, shard.mpSlots, ((size_t)shard.mnSlotMask + 1) * sizeof(Slot));
+
+            for(Block* pBlock = shard.mpBlocks; pBlock; )
+            {
+                Block* const pNext = pBlock->mpNext;
+                EASTLFree(mAllocator, pBlock, pBlock->mnSize);
+                pBlock = pNext;
+            }
+        }
+
+        DoInit();
+    }
+
+
+    template <typename T, typename Allocator>
+    void basic_string_pool<T, Allocator>::DoInit()
+    {
+        for(int k = 0; k < kSegmentCount; ++k)
+            mpSegments[k] = NULL;
+        mnAtomCount = 0;
+
+        for(int i = 0; i < kShardCount; ++i)
+        {
+            Shard& shard = mShards[i];
+
+            shard.mnLock     = 0;
+            shard.mpSlots    = NULL;
+            shard.mnSlotMask = 0;
+            shard.mnCount    = 0;
+            shard.mpFree     = NULL;
+            shard.mpFreeEnd  = NULL;
+            shard.mpBlocks   = NULL;
+        }
+    }
+
+
+    template <typename T, typename Allocator>
+    inline const typename basic_string_pool<T, Allocator>::Entry&
+    basic_string_pool<T, Allocator>::DoGetEntry(atom_type atom) const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(atom >= (atom_type)mnAtomCount))
+                EASTL_FAIL_MSG("basic_string_pool -- invalid atom");
+        #endif
+
+        const uint32_t n = atom + kFirstSegmentSize;
+        const uint32_t k = GetLastBit(n) - kFirstSegmentShift;
+
+        return mpSegments[k][n - ((uint32_t)kFirstSegmentSize << k)];
+    }
+
+
+    // DoAllocateEntry
+    // Returns the entry of a new atom, allocating its segment if it is the first in it.
+    // In concurrent mode the atoms of a segment may be added in any order, so whichever
+    // thread finds the segment missing allocates it, and keeps it if no other thread
+    // has stored one in the meantime.
+    template <typename T, typename Allocator>
+    typename basic_string_pool<T, Allocator>::Entry&
+    basic_string_pool<T, Allocator>::DoAllocateEntry(atom_type atom)
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(atom >= (kInvalidAtom / 2)))
+                EASTL_FAIL_MSG("basic_string_pool -- too many atoms");
+        #endif
+
+        const uint32_t n        = atom + kFirstSegmentSize;
+        const uint32_t k        = GetLastBit(n) - kFirstSegmentShift;
+        Entry*         pSegment = AtomicLoadAcquire(&mpSegments[k]);
+
+        if(!pSegment)
+        {
+            const size_t nSize = ((size_t)kFirstSegmentSize << k) * sizeof(Entry);
+
+            pSegment = (Entry*)EASTLAlloc(mAllocator, nSize);
+            if(!AtomicCompareAndSwap(&mpSegments[k], (Entry*)NULL, pSegment))
+            {
+                EASTLFree(mAllocator, pSegment, nSize);
+                pSegment = AtomicLoadAcquire(&mpSegments[k]);
+            }
+        }
+
+        return pSegment[n - ((uint32_t)kFirstSegmentSize << k)];
+    }
+
+
+    // DoFindSlot
+    // Returns the slot holding x, or the empty slot where x would be added.
+    template <typename T, typename Allocator>
+    typename basic_string_pool<T, Allocator>::Slot*
+    basic_string_pool<T, Allocator>::DoFindSlot(const Shard& shard, uint32_t nHash, const view_type& x) const
+    {
+        for(uint32_t i = nHash; ; ++i)
+        {
+            Slot* const pSlot = shard.mpSlots + (i & shard.mnSlotMask);
+
+            if(pSlot->mnAtom == kInvalidAtom)
+                return pSlot;
+
+            if(pSlot->mnHash == nHash)
+            {
+                const Entry& entry = DoGetEntry(pSlot->mnAtom);
+
+                if((entry.mnLength == x.size()) && (Compare(entry.mpChars, x.data(), (size_t)x.size()) == 0))
+                    return pSlot;
+            }
+        }
+    }
+
+
+    template <typename T, typename Allocator>
+    void basic_string_pool<T, Allocator>::DoGrow(Shard& shard)
+    {
+        const uint32_t nOldSlotCount = shard.mpSlots ? (shard.mnSlotMask + 1) : 0;
+        const uint32_t nSlotCount    = nOldSlotCount ? (nOldSlotCount * 2) : (mbConcurrent ? 64 : 1024);
+        Slot* const    pSlots        = (Slot*)EASTLAlloc(mAllocator, nSlotCount * sizeof(Slot));
+
+        for(uint32_t i = 0; i < nSlotCount; ++i)
+            pSlots[i].mnAtom = kInvalidAtom;
+
+        // Reinsert by the stored hashes; the strings are neither rehashed nor compared.
+        for(uint32_t i = 0; i < nOldSlotCount; ++i)
+        {
+            const Slot& slot = shard.mpSlots[i];
+
+            if(slot.mnAtom != kInvalidAtom)
+            {
+                uint32_t j = slot.mnHash;
+                while(pSlots[j & (nSlotCount - 1)].mnAtom != kInvalidAtom)
+                    ++j;
+                pSlots[j & (nSlotCount - 1)] = slot;
+            }
+        }
+
+        if(shard.mpSlots)
+            EASTLFree(mAllocator, shard.mpSlots, nOldSlotCount * sizeof(Slot));
+        shard.mpSlots    = pSlots;
+        shard.mnSlotMask = nSlotCount - 1;
+    }
+
+
+    // DoCopyChars
+    // Copies x and a terminating 0 into the shard's current block, starting another
+    // block if it doesn't fit. Strings longer than a quarter of a block get a block of
+    // their own, so that at most a quarter of each block is wasted.
+    template <typename T, typename Allocator>
+    const typename basic_string_pool<T, Allocator>::value_type*
+    basic_string_pool<T, Allocator>::DoCopyChars(Shard& shard, const view_type& x)
+    {
+        const size_t nBytes = ((size_t)x.size() + 1) * sizeof(value_type);
+        value_type*  p;
+
+        if(nBytes <= (size_t)(shard.mpFreeEnd - shard.mpFree))
+        {
+            p = (value_type*)shard.mpFree;
+            shard.mpFree += nBytes;
+        }
+        else
+        {
+            const bool   bOwnBlock = (nBytes > (kBlockSize / 4));
+            const size_t nSize     = sizeof(Block) + (bOwnBlock ? nBytes : (size_t)kBlockSize);
+            Block* const pBlock    = (Block*)EASTLAlloc(mAllocator, nSize);
+
+            pBlock->mpNext = shard.mpBlocks;
+            pBlock->mnSize = nSize;
+            shard.mpBlocks = pBlock;
+
+            p = (value_type*)(pBlock + 1);
+            if(!bOwnBlock)
+            {
+                shard.mpFree    = (char*)(pBlock + 1) + nBytes;
+                shard.mpFreeEnd = (char*)pBlock + nSize;
+            }
+        }
+
+        if(x.size())
+            memcpy(p, x.data(), (size_t)x.size() * sizeof(value_type));
+        p[x.size()] = 0;
+        return p;
+    }
+
+
+    template <typename T, typename Allocator>
+    inline typename basic_string_pool<T, Allocator>::Shard&
+    basic_string_pool<T, Allocator>::DoGetShard(uint32_t nHash) const
+    {
+        // The table index comes from the low bits of the hash, so the shard from the high.
+        return const_cast<Shard&>(mShards[mbConcurrent ? (nHash >> 28) : 0]);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline void basic_string_pool<T, Allocator>::DoLock(const Shard& shard) const
+    {
+        if(mbConcurrent)
+        {
+            while(!AtomicCompareAndSwap(&shard.mnLock, 0, 1))
+            {
+                // Wait without writing, so the cache line isn't contended, and give up
+                // the processor if the holder seems to have been preempted.
+                for(int i = 0; AtomicLoadAcquire(&shard.mnLock); ++i)
+                {
+                    if(i >= 64)
+                        ThreadYield();
+                }
+            }
+        }
+    }
+
+
+    template <typename T, typename Allocator>
+    inline void basic_string_pool<T, Allocator>::DoUnlock(const Shard& shard) const
+    {
+        if(mbConcurrent)
+            AtomicStoreRelease(&shard.mnLock, 0);
+    }
+
+
+    template <typename T, typename Allocator>
+    inline uint32_t basic_string_pool<T, Allocator>::DoMixHash(size_t h)
+    {
+        // CharStringHash's low bits depend mostly on the last chars, so mix before masking.
+        return (uint32_t)hash_mix((uint64_t)h);
+    }
+
+
+
+    /// string_pool / wstring_pool
+    typedef basic_string_pool<char>    string_pool;
+    typedef basic_string_pool<wchar_t> wstring_pool;
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
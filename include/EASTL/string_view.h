@@ -0,0 +1,425 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/string_view.h
+//
+// Implements basic_string_view, a non-owning reference to a range of chars.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// A basic_string_view is a pointer and a length referring to chars owned by
+// someone else: a basic_string, a string literal, or a token within a larger
+// buffer such as a parser's input. Making one copies two pointers and never
+// allocates, so functions which only read a string can take a view and be
+// called with any of these without a basic_string being constructed first.
+//
+// The view doesn't keep the chars alive, so it must not outlive them, and
+// the chars need not be 0-terminated; use data() and size() together.
+//
+// hash<basic_string_view<T> > gives the same value as hash<basic_string<T> >
+// for the same chars, and less<basic_string<T> >, equal_to<basic_string<T> >
+// and hash<basic_string<T> > are transparent (see is_transparent_comparison).
+// So map, set, hash_map, hash_set and vector_map with string keys can look
+// up a view directly:
+//
+// Example usage:
+//    eastl::hash_map<eastl::string, int> keywords;
+//    eastl::string_view token(pInput + nTokenBegin, nTokenLength);
+//
+//    eastl::hash_map<eastl::string, int>::iterator it = keywords.find(token); // No string is constructed.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_STRING_VIEW_H
+#define EASTL_STRING_VIEW_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/internal/char_search.h>
+#include <EASTL/functional.h>
+#include <EASTL/iterator.h>
+#include <stddef.h>
+#include <string.h>
+
+
+namespace eastl
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Char helpers shared by basic_string_view and basic_string.
+    ///////////////////////////////////////////////////////////////////////////////
+
+    template <typename T>
+    int Compare(const T* p1, const T* p2, size_t n)
+    {
+        for(; n > 0; ++p1, ++p2, --n)
+        {
+            if(*p1 != *p2)
+                return (*p1 < *p2) ? -1 : 1;
+        }
+        return 0;
+    }
+
+    inline int Compare(const char8_t* p1, const char8_t* p2, size_t n)
+    {
+        return n ? memcmp(p1, p2, n) : 0; // An empty view's data() may be NULL, which memcmp doesn't allow even with n == 0.
+    }
+
+
+    inline size_t CharStrlen(const char8_t* p)
+    {
+        #ifdef _MSC_VER // VC++ can implement an instrinsic here.
+            return strlen(p);
+        #else
+            const char8_t* pCurrent = p;
+            while(*pCurrent)
+                ++pCurrent;
+            return (size_t)(pCurrent - p);
+        #endif
+    }
+
+    inline size_t CharStrlen(const char16_t* p)
+    {
+        const char16_t* pCurrent = p;
+        while(*pCurrent)
+            ++pCurrent;
+        return (size_t)(pCurrent - p);
+    }
+
+    inline size_t CharStrlen(const char32_t* p)
+    {
+        const char32_t* pCurrent = p;
+        while(*pCurrent)
+            ++pCurrent;
+        return (size_t)(pCurrent - p);
+    }
+
+
+    /// CharStringHash
+    ///
+    /// The FNV-like hash of the chars in [pBegin, pEnd), used by the hash
+    /// specializations of both basic_string and basic_string_view so that the
+    /// two agree. chars are hashed as unsigned chars and wider chars as their
+    /// unsigned values.
+    ///
+    inline size_t CharStringHash(const char8_t* pBegin, const char8_t* pEnd)
+    {
+        unsigned int result = 2166136261U;
+        while(pBegin != pEnd)
+            result = (result * 16777619) ^ (uint8_t)*pBegin++;
+        return (size_t)result;
+    }
+
+    template <typename T>
+    inline size_t CharStringHash(const T* pBegin, const T* pEnd)
+    {
+        unsigned int result = 2166136261U;
+        while(pBegin != pEnd)
+            result = (result * 16777619) ^ (unsigned int)*pBegin++;
+        return (size_t)result;
+    }
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// basic_string_view
+    ///
+    /// Refers to the chars [data(), data() + size()) without owning them.
+    /// The read-only subset of the basic_string interface is provided, with
+    /// remove_prefix and remove_suffix to narrow the view in place.
+    ///
+    template <typename T>
+    class basic_string_view
+    {
+    public:
+        typedef basic_string_view<T>                            this_type;
+        typedef T                                               value_type;
+        typedef const T*                                        pointer;
+        typedef const T*                                        const_pointer;
+        typedef const T&                                        reference;
+        typedef const T&                                        const_reference;
+        typedef const T*                                        iterator;
+        typedef const T*                                        const_iterator;
+        typedef eastl::reverse_iterator<const_iterator>         reverse_iterator;
+        typedef eastl::reverse_iterator<const_iterator>         const_reverse_iterator;
+        typedef eastl_size_t                                    size_type;
+        typedef ptrdiff_t                                       difference_type;
+
+        static const size_type npos = (size_type)-1;            /// 'npos' means non-valid position or simply non-position.
+
+    protected:
+        const value_type* mpBegin;
+        const value_type* mpEnd;
+
+    public:
+        basic_string_view()
+            : mpBegin(NULL), mpEnd(NULL) { }
+
+        basic_string_view(const value_type* p, size_type n)
+            : mpBegin(p), mpEnd(p + n) { }
+
+        basic_string_view(const value_type* pBegin, const value_type* pEnd)
+            : mpBegin(pBegin), mpEnd(pEnd) { }
+
+        basic_string_view(const value_type* p)  // p must be 0-terminated.
+            : mpBegin(p), mpEnd(p + CharStrlen(p)) { }
+
+        const_iterator begin() const { return mpBegin; }
+        const_iterator end() const   { return mpEnd; }
+
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(mpEnd); }
+        const_reverse_iterator rend() const   { return const_reverse_iterator(mpBegin); }
+
+        const value_type* data() const { return mpBegin; }
+        bool      empty() const  { return mpBegin == mpEnd; }
+        size_type size() const   { return (size_type)(mpEnd - mpBegin); }
+        size_type length() const { return (size_type)(mpEnd - mpBegin); }
+
+        const_reference operator[](size_type n) const;
+        const_reference front() const;
+        const_reference back() const;
+
+        void remove_prefix(size_type n);
+        void remove_suffix(size_type n);
+
+        this_type substr(size_type position, size_type n = npos) const;
+
+        int compare(const this_type& x) const;
+
+        size_type find(value_type c, size_type position = 0) const;
+        size_type find(const this_type& x, size_type position = 0) const;
+
+        bool starts_with(const this_type& x) const;
+        bool ends_with(const this_type& x) const;
+
+    }; // basic_string_view
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // basic_string_view
+    ///////////////////////////////////////////////////////////////////////////////
+
+    template <typename T>
+    inline typename basic_string_view<T>::const_reference
+    basic_string_view<T>::operator[](size_type n) const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(n >= (size_type)(mpEnd - mpBegin)))
+                EASTL_FAIL_MSG("basic_string_view::operator[] -- out of range");
+        #endif
+
+        return mpBegin[n];
+    }
+
+
+    template <typename T>
+    inline typename basic_string_view<T>::const_reference
+    basic_string_view<T>::front() const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mpEnd <= mpBegin)) // We assert if the user references the front of an empty view.
+                EASTL_FAIL_MSG("basic_string_view::front -- empty view");
+        #endif
+
+        return *mpBegin;
+    }
+
+
+    template <typename T>
+    inline typename basic_string_view<T>::const_reference
+    basic_string_view<T>::back() const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mpEnd <= mpBegin)) // We assert if the user references the back of an empty view.
+                EASTL_FAIL_MSG("basic_string_view::back -- empty view");
+        #endif
+
+        return *(mpEnd - 1);
+    }
+
+
+    template <typename T>
+    inline void basic_string_view<T>::remove_prefix(size_type n)
+    {
+        EASTL_ASSERT(n <= (size_type)(mpEnd - mpBegin));
+        mpBegin += n;
+    }
+
+
+    template <typename T>
+    inline void basic_string_view<T>::remove_suffix(size_type n)
+    {
+        EASTL_ASSERT(n <= (size_type)(mpEnd - mpBegin));
+        mpEnd -= n;
+    }
+
+
+    template <typename T>
+    inline basic_string_view<T> basic_string_view<T>::substr(size_type position, size_type n) const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(position > (size_type)(mpEnd - mpBegin)))
+                EASTL_FAIL_MSG("basic_string_view::substr -- out of range");
+        #endif
+
+        return this_type(mpBegin + position, mpBegin + position + eastl::min_alt(n, (size_type)(mpEnd - mpBegin) - position));
+    }
+
+
+    template <typename T>
+    inline int basic_string_view<T>::compare(const this_type& x) const
+    {
+        const size_type n1 = (size_type)(mpEnd - mpBegin);
+        const size_type n2 = (size_type)(x.mpEnd - x.mpBegin);
+        const int       result = Compare(mpBegin, x.mpBegin, (size_t)eastl::min_alt(n1, n2));
+
+        if(result != 0)
+            return result;
+        return (n1 < n2) ? -1 : ((n1 > n2) ? 1 : 0);
+    }
+
+
+    template <typename T>
+    typename basic_string_view<T>::size_type
+    basic_string_view<T>::find(value_type c, size_type position) const
+    {
+        if(EASTL_LIKELY(position < (size_type)(mpEnd - mpBegin)))
+        {
+            const value_type* const pResult = CharFind(mpBegin + position, mpEnd, c);
+
+            if(pResult != mpEnd)
+                return (size_type)(pResult - mpBegin);
+        }
+        return npos;
+    }
+
+
+    template <typename T>
+    typename basic_string_view<T>::size_type
+    basic_string_view<T>::find(const this_type& x, size_type position) const
+    {
+        const size_type nSize = (size_type)(mpEnd - mpBegin);
+        const size_type n     = x.size();
+
+        if(EASTL_LIKELY((position <= nSize) && (n <= (nSize - position))))
+        {
+            const value_type* const pResult = CharSearch(mpBegin + position, mpEnd, x.mpBegin, x.mpEnd);
+
+            if((pResult != mpEnd) || (n == 0))
+                return (size_type)(pResult - mpBegin);
+        }
+        return npos;
+    }
+
+
+    template <typename T>
+    inline bool basic_string_view<T>::starts_with(const this_type& x) const
+    {
+        const size_type n = x.size();
+        return (n <= size()) && (Compare(mpBegin, x.mpBegin, (size_t)n) == 0);
+    }
+
+
+    template <typename T>
+    inline bool basic_string_view<T>::ends_with(const this_type& x) const
+    {
+        const size_type n = x.size();
+        return (n <= size()) && (Compare(mpEnd - n, x.mpBegin, (size_t)n) == 0);
+    }
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // global operators
+    ///////////////////////////////////////////////////////////////////////////////
+
+    template <typename T>
+    inline bool operator==(const basic_string_view<T>& a, const basic_string_view<T>& b)
+    {
+        return (a.size() == b.size()) && (Compare(a.data(), b.data(), (size_t)a.size()) == 0);
+    }
+
+    template <typename T>
+    inline bool operator==(const basic_string_view<T>& a, const T* p)
+    {
+        return a == basic_string_view<T>(p);
+    }
+
+    template <typename T>
+    inline bool operator==(const T* p, const basic_string_view<T>& b)
+    {
+        return basic_string_view<T>(p) == b;
+    }
+
+    template <typename T>
+    inline bool operator!=(const basic_string_view<T>& a, const basic_string_view<T>& b)
+    {
+        return !(a == b);
+    }
+
+    template <typename T>
+    inline bool operator!=(const basic_string_view<T>& a, const T* p)
+    {
+        return !(a == basic_string_view<T>(p));
+    }
+
+    template <typename T>
+    inline bool operator!=(const T* p, const basic_string_view<T>& b)
+    {
+        return !(basic_string_view<T>(p) == b);
+    }
+
+    template <typename T>
+    inline bool operator<(const basic_string_view<T>& a, const basic_string_view<T>& b)
+    {
+        return a.compare(b) < 0;
+    }
+
+    template <typename T>
+    inline bool operator>(const basic_string_view<T>& a, const basic_string_view<T>& b)
+    {
+        return b < a;
+    }
+
+    template <typename T>
+    inline bool operator<=(const basic_string_view<T>& a, const basic_string_view<T>& b)
+    {
+        return !(b < a);
+    }
+
+    template <typename T>
+    inline bool operator>=(const basic_string_view<T>& a, const basic_string_view<T>& b)
+    {
+        return !(a < b);
+    }
+
+
+    /// string_view / wstring_view
+    typedef basic_string_view<char>    string_view;
+    typedef basic_string_view<wchar_t> wstring_view;
+
+    /// string8_view / string16_view / string32_view
+    typedef basic_string_view<char8_t>  string8_view;
+    typedef basic_string_view<char16_t> string16_view;
+    typedef basic_string_view<char32_t> string32_view;
+
+
+
+    /// hash<basic_string_view>
+    ///
+    /// Agrees with hash<basic_string> for the same chars.
+    ///
+    template <typename T>
+    struct hash< basic_string_view<T> >
+    {
+        size_t operator()(const basic_string_view<T>& x) const
+            { return CharStringHash(x.begin(), x.end()); }
+    };
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -0,0 +1,1146 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/tuple_vector.h
+//
+// Implements a vector of tuples which stores each tuple field in its own
+// contiguous array (a "structure of arrays").
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// tuple_vector<Ts...> is useful when a container of structs is usually
+// processed one or two fields at a time. With vector<Struct>, such a pass
+// loads every field of every element into cache; with tuple_vector it only
+// touches the arrays it reads, and those arrays are plain contiguous arrays
+// of a single type, which compilers can vectorize.
+//
+// All field arrays live in a single allocation, one after the other, so a
+// tuple_vector costs one allocation per growth just like vector.
+//
+// Rows are accessed through tuples of references:
+//    eastl::tuple_vector<Vec3, Vec3, float> particles; // position, velocity, life
+//    particles.push_back(position, velocity, 10.f);
+//
+//    Vec3*        pPosition = particles.get<0>();
+//    const Vec3*  pVelocity = particles.get<1>();
+//    for(eastl_size_t i = 0, iEnd = particles.size(); i != iEnd; ++i)
+//        pPosition[i] += pVelocity[i] * dt;
+//
+//    for(auto it = particles.begin(); it != particles.end(); ++it)
+//        std::get<2>(*it) -= dt;
+//
+// tuple_vector requires compiler support for variadic templates and
+// assumes that field constructors, assignments and destructors don't throw.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_TUPLE_VECTOR_H
+#define EASTL_TUPLE_VECTOR_H
+
+
+#include <EASTL/internal/config.h>
+
+#ifdef EA_COMPILER_HAS_VARIADIC_TEMPLATES
+
+#include <EASTL/allocator.h>
+#include <EASTL/type_traits.h>
+#include <EASTL/iterator.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/memory.h>
+
+#ifdef _MSC_VER
+    #pragma warning(push, 0)
+#endif
+#include <new>
+#include <stddef.h>
+#include <string.h>
+#include <tuple>
+#include <utility>
+#if EASTL_EXCEPTIONS_ENABLED
+    #include <stdexcept> // std::out_of_range
+#endif
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+
+namespace eastl
+{
+
+    /// EASTL_TUPLE_VECTOR_DEFAULT_NAME
+    ///
+    /// Defines a default container name in the absence of a user-provided name.
+    ///
+    #ifndef EASTL_TUPLE_VECTOR_DEFAULT_NAME
+        #define EASTL_TUPLE_VECTOR_DEFAULT_NAME EASTL_DEFAULT_NAME_PREFIX " tuple_vector" // Unless the user overrides something, this is "EASTL tuple_vector".
+    #endif
+
+
+    /// EASTL_TUPLE_VECTOR_DEFAULT_ALLOCATOR
+    ///
+    #ifndef EASTL_TUPLE_VECTOR_DEFAULT_ALLOCATOR
+        #define EASTL_TUPLE_VECTOR_DEFAULT_ALLOCATOR allocator_type(EASTL_TUPLE_VECTOR_DEFAULT_NAME)
+    #endif
+
+
+
+    namespace Internal
+    {
+        // A compile time list of indices, used to expand a field index alongside the field types.
+        template <size_t... Is>
+        struct TupleVecIndexSequence {};
+
+        template <size_t N, size_t... Is>
+        struct TupleVecMakeIndexSequence : public TupleVecMakeIndexSequence<N - 1, N - 1, Is...> {};
+
+        template <size_t... Is>
+        struct TupleVecMakeIndexSequence<0, Is...> { typedef TupleVecIndexSequence<Is...> type; };
+
+
+        // The combined size of one element of each field.
+        template <typename... Ts>
+        struct TupleVecRowSize { static const size_t value = 0; };
+
+        template <typename T, typename... Ts>
+        struct TupleVecRowSize<T, Ts...> { static const size_t value = sizeof(T) + TupleVecRowSize<Ts...>::value; };
+
+
+        // Operations on a single field array.
+        template <typename T>
+        struct TupleVecField
+        {
+            static void DefaultConstruct(T* p, size_t n)
+            {
+                for(T* const pEnd = p + n; p != pEnd; ++p)
+                    ::new((void*)p) T();
+            }
+
+            static void Relocate(T* pDest, T* pSource, size_t n)
+            {
+                DoRelocate(pDest, pSource, n, has_trivial_relocate<T>());
+            }
+
+            static void DoRelocate(T* pDest, T* pSource, size_t n, true_type)
+            {
+                if(n)
+                    memcpy(pDest, pSource, n * sizeof(T));
+            }
+
+            static void DoRelocate(T* pDest, T* pSource, size_t n, false_type)
+            {
+                for(size_t i = 0; i < n; ++i)
+                {
+                    ::new((void*)(pDest + i)) T(std::move(pSource[i]));
+                    pSource[i].~T();
+                }
+            }
+
+            static void MoveDown(T* pDest, T* pSource, T* pSourceEnd)
+            {
+                while(pSource != pSourceEnd)
+                    *pDest++ = std::move(*pSource++);
+            }
+        };
+    }
+
+
+
+    /// TupleVecIterator
+    ///
+    /// A random access iterator over the rows of a tuple_vector. Dereferencing
+    /// it yields a tuple of references to the fields of the row, so it is a
+    /// proxy iterator: operator* returns by value and there is no operator->.
+    ///
+    template <bool bConst, typename... Ts>
+    struct TupleVecIterator
+    {
+        typedef TupleVecIterator<bConst, Ts...>                                this_type;
+        typedef TupleVecIterator<false, Ts...>                                 iterator;
+        typedef eastl_size_t                                                   size_type;
+        typedef ptrdiff_t                                                      difference_type;
+        typedef std::tuple<Ts...>                                              value_type;
+        typedef typename type_select<bConst, std::tuple<const Ts&...>, std::tuple<Ts&...> >::type reference;
+        typedef void                                                           pointer;
+        typedef EASTL_ITC_NS::random_access_iterator_tag                       iterator_category;
+
+    public:
+        std::tuple<Ts*...> mpFields;
+        size_type          mnIndex;
+
+    public:
+        TupleVecIterator()
+            : mpFields(), mnIndex(0) { }
+
+        TupleVecIterator(const std::tuple<Ts*...>& pFields, size_type nIndex)
+            : mpFields(pFields), mnIndex(nIndex) { }
+
+        TupleVecIterator(const iterator& x)
+            : mpFields(x.mpFields), mnIndex(x.mnIndex) { }
+
+        reference operator*() const
+            { return DoGetReference(typename Internal::TupleVecMakeIndexSequence<sizeof...(Ts)>::type()); }
+
+        reference operator[](difference_type n) const
+            { return *(*this + n); }
+
+        this_type& operator++()                   { ++mnIndex; return *this; }
+        this_type  operator++(int)                { this_type temp(*this); ++mnIndex; return temp; }
+        this_type& operator--()                   { --mnIndex; return *this; }
+        this_type  operator--(int)                { this_type temp(*this); --mnIndex; return temp; }
+        this_type& operator+=(difference_type n)  { mnIndex = (size_type)(mnIndex + n); return *this; }
+        this_type& operator-=(difference_type n)  { mnIndex = (size_type)(mnIndex - n); return *this; }
+
+        this_type operator+(difference_type n) const { return this_type(mpFields, (size_type)(mnIndex + n)); }
+        this_type operator-(difference_type n) const { return this_type(mpFields, (size_type)(mnIndex - n)); }
+
+    protected:
+        template <size_t... Is>
+        reference DoGetReference(Internal::TupleVecIndexSequence<Is...>) const
+            { return reference(std::get<Is>(mpFields)[mnIndex]...); }
+
+    }; // TupleVecIterator
+
+
+    // The C++ defect report #179 requires that we support comparisons between const and non-const iterators.
+    template <bool bConstA, bool bConstB, typename... Ts>
+    inline bool operator==(const TupleVecIterator<bConstA, Ts...>& a, const TupleVecIterator<bConstB, Ts...>& b)
+        { return a.mnIndex == b.mnIndex; }
+
+    template <bool bConstA, bool bConstB, typename... Ts>
+    inline bool operator!=(const TupleVecIterator<bConstA, Ts...>& a, const TupleVecIterator<bConstB, Ts...>& b)
+        { return a.mnIndex != b.mnIndex; }
+
+    template <bool bConstA, bool bConstB, typename... Ts>
+    inline bool operator<(const TupleVecIterator<bConstA, Ts...>& a, const TupleVecIterator<bConstB, Ts...>& b)
+        { return a.mnIndex < b.mnIndex; }
+
+    template <bool bConstA, bool bConstB, typename... Ts>
+    inline bool operator>(const TupleVecIterator<bConstA, Ts...>& a, const TupleVecIterator<bConstB, Ts...>& b)
+        { return a.mnIndex > b.mnIndex; }
+
+    template <bool bConstA, bool bConstB, typename... Ts>
+    inline bool operator<=(const TupleVecIterator<bConstA, Ts...>& a, const TupleVecIterator<bConstB, Ts...>& b)
+        { return a.mnIndex <= b.mnIndex; }
+
+    template <bool bConstA, bool bConstB, typename... Ts>
+    inline bool operator>=(const TupleVecIterator<bConstA, Ts...>& a, const TupleVecIterator<bConstB, Ts...>& b)
+        { return a.mnIndex >= b.mnIndex; }
+
+    template <bool bConstA, bool bConstB, typename... Ts>
+    inline ptrdiff_t operator-(const TupleVecIterator<bConstA, Ts...>& a, const TupleVecIterator<bConstB, Ts...>& b)
+        { return (ptrdiff_t)a.mnIndex - (ptrdiff_t)b.mnIndex; }
+
+    template <bool bConst, typename... Ts>
+    inline TupleVecIterator<bConst, Ts...> operator+(ptrdiff_t n, const TupleVecIterator<bConst, Ts...>& x)
+        { return x + n; }
+
+
+
+
+    /// tuple_vector_alloc
+    ///
+    /// Implements a structure-of-arrays vector with a user-specified allocator.
+    /// tuple_vector<Ts...> (below) is this with the default allocator. The
+    /// allocator comes first because Ts is a parameter pack.
+    ///
+    template <typename Allocator, typename... Ts>
+    class tuple_vector_alloc
+    {
+        typedef tuple_vector_alloc<Allocator, Ts...>                                  this_type;
+        typedef typename Internal::TupleVecMakeIndexSequence<sizeof...(Ts)>::type     index_sequence_type;
+
+    public:
+        typedef Allocator                                       allocator_type;
+        typedef eastl_size_t                                    size_type;     // See config.h for the definition of eastl_size_t, which defaults to uint32_t.
+        typedef ptrdiff_t                                       difference_type;
+        typedef std::tuple<Ts...>                               value_type;
+        typedef std::tuple<Ts&...>                              reference;
+        typedef std::tuple<const Ts&...>                        const_reference;
+        typedef TupleVecIterator<false, Ts...>                  iterator;
+        typedef TupleVecIterator<true, Ts...>                   const_iterator;
+        typedef eastl::reverse_iterator<iterator>               reverse_iterator;
+        typedef eastl::reverse_iterator<const_iterator>         const_reverse_iterator;
+
+        /// element<I>::type is the type of field I.
+        template <size_t I>
+        struct element { typedef typename std::tuple_element<I, value_type>::type type; };
+
+        static const size_type npos     = (size_type)-1;      /// 'npos' means non-valid position or simply non-position.
+        static const size_type kMaxSize = (size_type)-2;      /// -1 is reserved for 'npos'. It also happens to be slightly beneficial that kMaxSize is a value less than -1, as it helps us deal with potential integer wraparound issues.
+
+        enum { kFieldCount = sizeof...(Ts) };
+
+    protected:
+        void*              mpData;      // The single block holding all field arrays.
+        std::tuple<Ts*...> mpFields;    // The start of each field array within mpData.
+        size_type          mnSize;
+        size_type          mnCapacity;
+        allocator_type     mAllocator;  // To do: Use base class optimization to make this go away.
+
+    public:
+        tuple_vector_alloc();
+        explicit tuple_vector_alloc(const allocator_type& allocator);
+        explicit tuple_vector_alloc(size_type n, const allocator_type& allocator = EASTL_TUPLE_VECTOR_DEFAULT_ALLOCATOR);
+        tuple_vector_alloc(const this_type& x);
+        tuple_vector_alloc(this_type&& x);
+       ~tuple_vector_alloc();
+
+        this_type& operator=(const this_type& x);
+        this_type& operator=(this_type&& x);
+        void swap(this_type& x);
+
+        allocator_type& get_allocator();
+        void            set_allocator(const allocator_type& allocator);
+
+        iterator       begin();
+        const_iterator begin() const;
+        iterator       end();
+        const_iterator end() const;
+
+        reverse_iterator       rbegin();
+        const_reverse_iterator rbegin() const;
+        reverse_iterator       rend();
+        const_reverse_iterator rend() const;
+
+        bool      empty() const;
+        size_type size() const;
+        size_type capacity() const;
+
+        void resize(size_type n);
+        void resize(size_type n, const Ts&... values);
+        void reserve(size_type n);
+        void set_capacity(size_type n = npos);   // Revises the capacity to n. If n < size() the container is resized to n. If n == npos then the capacity is reduced to size().
+
+        /// Returns the array of field I, which holds size() elements.
+        template <size_t I>
+        typename element<I>::type* get();
+
+        template <size_t I>
+        const typename element<I>::type* get() const;
+
+        reference       operator[](size_type n);
+        const_reference operator[](size_type n) const;
+
+        reference       at(size_type n);
+        const_reference at(size_type n) const;
+
+        reference       front();
+        const_reference front() const;
+
+        reference       back();
+        const_reference back() const;
+
+        void push_back(const Ts&... values);
+        void push_back(Ts&&... values);
+        void push_back();
+
+        void pop_back();
+
+        iterator erase(const_iterator position);
+        iterator erase(const_iterator first, const_iterator last);
+        iterator erase_unsorted(const_iterator position); // Moves the last row into position instead of shifting all rows after it. O(1) but changes the row order.
+
+        void clear();
+
+        bool validate() const;
+        int  validate_iterator(const_iterator i) const;
+
+    protected:
+        static size_t DoGetLayout(size_type nCapacity, size_t* pOffsets, size_t& nAlignment);
+
+        size_type DoGetNewCapacity(size_type nCurrentCapacity) const;
+        void      DoReallocate(size_type nNewCapacity);
+        void      DoFree();
+
+        template <size_t... Is>
+        void DoSetFields(void* pData, size_type nCapacity, std::tuple<Ts*...>& pFields, Internal::TupleVecIndexSequence<Is...>);
+
+        template <size_t... Is>
+        void DoRelocate(std::tuple<Ts*...>& pDestFields, Internal::TupleVecIndexSequence<Is...>);
+
+        template <size_t... Is>
+        void DoCopyConstruct(const this_type& x, Internal::TupleVecIndexSequence<Is...>);
+
+        template <size_t... Is, typename... Args>
+        void DoConstructAt(size_type n, Internal::TupleVecIndexSequence<Is...>, Args&&... args);
+
+        template <size_t... Is>
+        void DoConstructAtFromTuple(size_type n, value_type&& values, Internal::TupleVecIndexSequence<Is...>);
+
+        template <size_t... Is>
+        void DoFillConstruct(size_type nFirst, size_type nLast, const value_type& values, Internal::TupleVecIndexSequence<Is...>);
+
+        template <size_t... Is>
+        void DoDefaultConstruct(size_type nFirst, size_type nLast, Internal::TupleVecIndexSequence<Is...>);
+
+        template <size_t... Is>
+        void DoDestroy(size_type nFirst, size_type nLast, Internal::TupleVecIndexSequence<Is...>);
+
+        template <size_t... Is>
+        void DoMoveDown(size_type nDest, size_type nFirst, size_type nLast, Internal::TupleVecIndexSequence<Is...>);
+
+        template <size_t... Is>
+        reference DoGetReference(size_type n, Internal::TupleVecIndexSequence<Is...>) const;
+
+        template <size_t... Is>
+        bool DoEqual(const this_type& x, Internal::TupleVecIndexSequence<Is...>) const;
+
+        template <typename Allocator2, typename... Ts2>
+        friend bool operator==(const tuple_vector_alloc<Allocator2, Ts2...>& a, const tuple_vector_alloc<Allocator2, Ts2...>& b);
+
+    }; // class tuple_vector_alloc
+
+
+
+
+    /// tuple_vector
+    ///
+    /// A tuple_vector_alloc which uses the default EASTL allocator.
+    ///
+    template <typename... Ts>
+    class tuple_vector : public tuple_vector_alloc<EASTLAllocatorType, Ts...>
+    {
+        typedef tuple_vector_alloc<EASTLAllocatorType, Ts...> base_type;
+
+    public:
+        typedef typename base_type::allocator_type allocator_type;
+        typedef typename base_type::size_type      size_type;
+
+        tuple_vector()
+            : base_type() { }
+
+        explicit tuple_vector(const allocator_type& allocator)
+            : base_type(allocator) { }
+
+        explicit tuple_vector(size_type n, const allocator_type& allocator = EASTL_TUPLE_VECTOR_DEFAULT_ALLOCATOR)
+            : base_type(n, allocator) { }
+
+    }; // class tuple_vector
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // tuple_vector_alloc
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename Allocator, typename... Ts>
+    inline tuple_vector_alloc<Allocator, Ts...>::tuple_vector_alloc()
+        : mpData(NULL), mpFields(), mnSize(0), mnCapacity(0), mAllocator(EASTL_TUPLE_VECTOR_DEFAULT_NAME)
+    {
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline tuple_vector_alloc<Allocator, Ts...>::tuple_vector_alloc(const allocator_type& allocator)
+        : mpData(NULL), mpFields(), mnSize(0), mnCapacity(0), mAllocator(allocator)
+    {
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline tuple_vector_alloc<Allocator, Ts...>::tuple_vector_alloc(size_type n, const allocator_type& allocator)
+        : mpData(NULL), mpFields(), mnSize(0), mnCapacity(0), mAllocator(allocator)
+    {
+        resize(n);
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline tuple_vector_alloc<Allocator, Ts...>::tuple_vector_alloc(const this_type& x)
+        : mpData(NULL), mpFields(), mnSize(0), mnCapacity(0), mAllocator(x.mAllocator)
+    {
+        reserve(x.mnSize);
+        DoCopyConstruct(x, index_sequence_type());
+        mnSize = x.mnSize;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline tuple_vector_alloc<Allocator, Ts...>::tuple_vector_alloc(this_type&& x)
+        : mpData(NULL), mpFields(), mnSize(0), mnCapacity(0), mAllocator(x.mAllocator)
+    {
+        swap(x);
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline tuple_vector_alloc<Allocator, Ts...>::~tuple_vector_alloc()
+    {
+        DoDestroy(0, mnSize, index_sequence_type());
+        DoFree();
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::this_type&
+    tuple_vector_alloc<Allocator, Ts...>::operator=(const this_type& x)
+    {
+        if(&x != this)
+            this_type(x).swap(*this);
+        return *this;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::this_type&
+    tuple_vector_alloc<Allocator, Ts...>::operator=(this_type&& x)
+    {
+        if(&x != this)
+        {
+            clear();
+            set_capacity(0);
+            swap(x);
+        }
+        return *this;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline void tuple_vector_alloc<Allocator, Ts...>::swap(this_type& x)
+    {
+        // Like vector, we swap the allocators along with the contents, which
+        // makes this an O(1) operation.
+        eastl::swap(mpData,     x.mpData);
+        eastl::swap(mpFields,   x.mpFields);
+        eastl::swap(mnSize,     x.mnSize);
+        eastl::swap(mnCapacity, x.mnCapacity);
+        eastl::swap(mAllocator, x.mAllocator);
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::allocator_type&
+    tuple_vector_alloc<Allocator, Ts...>::get_allocator()
+    {
+        return mAllocator;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline void tuple_vector_alloc<Allocator, Ts...>::set_allocator(const allocator_type& allocator)
+    {
+        mAllocator = allocator;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::iterator
+    tuple_vector_alloc<Allocator, Ts...>::begin()
+    {
+        return iterator(mpFields, 0);
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::const_iterator
+    tuple_vector_alloc<Allocator, Ts...>::begin() const
+    {
+        return const_iterator(iterator(mpFields, 0));
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::iterator
+    tuple_vector_alloc<Allocator, Ts...>::end()
+    {
+        return iterator(mpFields, mnSize);
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::const_iterator
+    tuple_vector_alloc<Allocator, Ts...>::end() const
+    {
+        return const_iterator(iterator(mpFields, mnSize));
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::reverse_iterator
+    tuple_vector_alloc<Allocator, Ts...>::rbegin()
+    {
+        return reverse_iterator(end());
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::const_reverse_iterator
+    tuple_vector_alloc<Allocator, Ts...>::rbegin() const
+    {
+        return const_reverse_iterator(end());
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::reverse_iterator
+    tuple_vector_alloc<Allocator, Ts...>::rend()
+    {
+        return reverse_iterator(begin());
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::const_reverse_iterator
+    tuple_vector_alloc<Allocator, Ts...>::rend() const
+    {
+        return const_reverse_iterator(begin());
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline bool tuple_vector_alloc<Allocator, Ts...>::empty() const
+    {
+        return (mnSize == 0);
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::size_type
+    tuple_vector_alloc<Allocator, Ts...>::size() const
+    {
+        return mnSize;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::size_type
+    tuple_vector_alloc<Allocator, Ts...>::capacity() const
+    {
+        return mnCapacity;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    void tuple_vector_alloc<Allocator, Ts...>::resize(size_type n)
+    {
+        if(n > mnSize)
+        {
+            if(n > mnCapacity)
+                DoReallocate(eastl::max_alt(n, DoGetNewCapacity(mnCapacity)));
+            DoDefaultConstruct(mnSize, n, index_sequence_type());
+        }
+        else
+            DoDestroy(n, mnSize, index_sequence_type());
+
+        mnSize = n;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    void tuple_vector_alloc<Allocator, Ts...>::resize(size_type n, const Ts&... values)
+    {
+        if(n > mnSize)
+        {
+            const value_type temp(values...); // values may refer to elements of this container, which reallocation invalidates.
+
+            if(n > mnCapacity)
+                DoReallocate(eastl::max_alt(n, DoGetNewCapacity(mnCapacity)));
+            DoFillConstruct(mnSize, n, temp, index_sequence_type());
+        }
+        else
+            DoDestroy(n, mnSize, index_sequence_type());
+
+        mnSize = n;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline void tuple_vector_alloc<Allocator, Ts...>::reserve(size_type n)
+    {
+        if(n > mnCapacity)
+            DoReallocate(n);
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    void tuple_vector_alloc<Allocator, Ts...>::set_capacity(size_type n)
+    {
+        if(n == npos)
+            n = mnSize;
+        else if(n < mnSize)
+        {
+            DoDestroy(n, mnSize, index_sequence_type());
+            mnSize = n;
+        }
+
+        if(n != mnCapacity)
+            DoReallocate(n);
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    template <size_t I>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::template element<I>::type*
+    tuple_vector_alloc<Allocator, Ts...>::get()
+    {
+        return std::get<I>(mpFields);
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    template <size_t I>
+    inline const typename tuple_vector_alloc<Allocator, Ts...>::template element<I>::type*
+    tuple_vector_alloc<Allocator, Ts...>::get() const
+    {
+        return std::get<I>(mpFields);
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::reference
+    tuple_vector_alloc<Allocator, Ts...>::operator[](size_type n)
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(n >= mnSize))
+                EASTL_FAIL_MSG("tuple_vector::operator[] -- out of range");
+        #endif
+
+        return DoGetReference(n, index_sequence_type());
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::const_reference
+    tuple_vector_alloc<Allocator, Ts...>::operator[](size_type n) const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(n >= mnSize))
+                EASTL_FAIL_MSG("tuple_vector::operator[] -- out of range");
+        #endif
+
+        return DoGetReference(n, index_sequence_type());
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::reference
+    tuple_vector_alloc<Allocator, Ts...>::at(size_type n)
+    {
+        #if EASTL_EXCEPTIONS_ENABLED
+            if(EASTL_UNLIKELY(n >= mnSize))
+                throw std::out_of_range("tuple_vector::at -- out of range");
+        #elif EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(n >= mnSize))
+                EASTL_FAIL_MSG("tuple_vector::at -- out of range");
+        #endif
+
+        return DoGetReference(n, index_sequence_type());
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::const_reference
+    tuple_vector_alloc<Allocator, Ts...>::at(size_type n) const
+    {
+        #if EASTL_EXCEPTIONS_ENABLED
+            if(EASTL_UNLIKELY(n >= mnSize))
+                throw std::out_of_range("tuple_vector::at -- out of range");
+        #elif EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(n >= mnSize))
+                EASTL_FAIL_MSG("tuple_vector::at -- out of range");
+        #endif
+
+        return DoGetReference(n, index_sequence_type());
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::reference
+    tuple_vector_alloc<Allocator, Ts...>::front()
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mnSize == 0)) // We don't allow the user to reference an empty container.
+                EASTL_FAIL_MSG("tuple_vector::front -- empty container");
+        #endif
+
+        return DoGetReference(0, index_sequence_type());
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::const_reference
+    tuple_vector_alloc<Allocator, Ts...>::front() const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mnSize == 0)) // We don't allow the user to reference an empty container.
+                EASTL_FAIL_MSG("tuple_vector::front -- empty container");
+        #endif
+
+        return DoGetReference(0, index_sequence_type());
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::reference
+    tuple_vector_alloc<Allocator, Ts...>::back()
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mnSize == 0)) // We don't allow the user to reference an empty container.
+                EASTL_FAIL_MSG("tuple_vector::back -- empty container");
+        #endif
+
+        return DoGetReference(mnSize - 1, index_sequence_type());
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::const_reference
+    tuple_vector_alloc<Allocator, Ts...>::back() const
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mnSize == 0)) // We don't allow the user to reference an empty container.
+                EASTL_FAIL_MSG("tuple_vector::back -- empty container");
+        #endif
+
+        return DoGetReference(mnSize - 1, index_sequence_type());
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline void tuple_vector_alloc<Allocator, Ts...>::push_back(const Ts&... values)
+    {
+        if(mnSize == mnCapacity)
+        {
+            value_type temp(values...); // values may refer to elements of this container, which reallocation invalidates.
+            DoReallocate(DoGetNewCapacity(mnCapacity));
+            DoConstructAtFromTuple(mnSize, std::move(temp), index_sequence_type());
+        }
+        else
+            DoConstructAt(mnSize, index_sequence_type(), values...);
+        ++mnSize;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline void tuple_vector_alloc<Allocator, Ts...>::push_back(Ts&&... values)
+    {
+        if(mnSize == mnCapacity)
+        {
+            value_type temp(std::move(values)...); // values may refer to elements of this container, which reallocation invalidates.
+            DoReallocate(DoGetNewCapacity(mnCapacity));
+            DoConstructAtFromTuple(mnSize, std::move(temp), index_sequence_type());
+        }
+        else
+            DoConstructAt(mnSize, index_sequence_type(), std::move(values)...);
+        ++mnSize;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline void tuple_vector_alloc<Allocator, Ts...>::push_back()
+    {
+        if(mnSize == mnCapacity)
+            DoReallocate(DoGetNewCapacity(mnCapacity));
+        DoDefaultConstruct(mnSize, mnSize + 1, index_sequence_type());
+        ++mnSize;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline void tuple_vector_alloc<Allocator, Ts...>::pop_back()
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(mnSize == 0))
+                EASTL_FAIL_MSG("tuple_vector::pop_back -- empty container");
+        #endif
+
+        DoDestroy(mnSize - 1, mnSize, index_sequence_type());
+        --mnSize;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::iterator
+    tuple_vector_alloc<Allocator, Ts...>::erase(const_iterator position)
+    {
+        return erase(position, position + 1);
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    typename tuple_vector_alloc<Allocator, Ts...>::iterator
+    tuple_vector_alloc<Allocator, Ts...>::erase(const_iterator first, const_iterator last)
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY((first.mnIndex > last.mnIndex) || (last.mnIndex > mnSize)))
+                EASTL_FAIL_MSG("tuple_vector::erase -- invalid position");
+        #endif
+
+        if(first != last)
+        {
+            const size_type nNewSize = mnSize - (last.mnIndex - first.mnIndex);
+
+            DoMoveDown(first.mnIndex, last.mnIndex, mnSize, index_sequence_type());
+            DoDestroy(nNewSize, mnSize, index_sequence_type());
+            mnSize = nNewSize;
+        }
+
+        return iterator(mpFields, first.mnIndex);
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    typename tuple_vector_alloc<Allocator, Ts...>::iterator
+    tuple_vector_alloc<Allocator, Ts...>::erase_unsorted(const_iterator position)
+    {
+        #if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(position.mnIndex >= mnSize))
+                EASTL_FAIL_MSG("tuple_vector::erase_unsorted -- invalid position");
+        #endif
+
+        if(position.mnIndex != (mnSize - 1))
+            DoMoveDown(position.mnIndex, mnSize - 1, mnSize, index_sequence_type());
+        pop_back();
+
+        return iterator(mpFields, position.mnIndex);
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline void tuple_vector_alloc<Allocator, Ts...>::clear()
+    {
+        DoDestroy(0, mnSize, index_sequence_type());
+        mnSize = 0;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline bool tuple_vector_alloc<Allocator, Ts...>::validate() const
+    {
+        if(mnSize > mnCapacity)
+            return false;
+        if((mpData == NULL) != (mnCapacity == 0))
+            return false;
+        return true;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline int tuple_vector_alloc<Allocator, Ts...>::validate_iterator(const_iterator i) const
+    {
+        if(i.mpFields == mpFields)
+        {
+            if(i.mnIndex < mnSize)
+                return (isf_valid | isf_current | isf_can_dereference);
+
+            if(i.mnIndex == mnSize)
+                return (isf_valid | isf_current);
+        }
+
+        return isf_none;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    size_t tuple_vector_alloc<Allocator, Ts...>::DoGetLayout(size_type nCapacity, size_t* pOffsets, size_t& nAlignment)
+    {
+        // The field arrays are laid out one after another, in field order,
+        // each aligned for its type. Returns the total size of the block.
+        static const size_t kSizes[]      = { sizeof(Ts)... };
+        static const size_t kAlignments[] = { EASTL_ALIGN_OF(Ts)... };
+
+        size_t nOffset = 0;
+        nAlignment = 1;
+
+        for(size_t i = 0; i < sizeof...(Ts); ++i)
+        {
+            nOffset     = (nOffset + (kAlignments[i] - 1)) & ~(kAlignments[i] - 1);
+            pOffsets[i] = nOffset;
+            nOffset    += kSizes[i] * nCapacity;
+            if(kAlignments[i] > nAlignment)
+                nAlignment = kAlignments[i];
+        }
+
+        return nOffset;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::size_type
+    tuple_vector_alloc<Allocator, Ts...>::DoGetNewCapacity(size_type nCurrentCapacity) const
+    {
+        // This needs to return a value of at least currentCapacity and at least 1.
+        typedef typename allocator_growth_policy<Allocator>::type growth_policy_type;
+        return (size_type)growth_policy_type()(mAllocator, (size_t)nCurrentCapacity, 1, Internal::TupleVecRowSize<Ts...>::value);
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    void tuple_vector_alloc<Allocator, Ts...>::DoReallocate(size_type nNewCapacity)
+    {
+        EASTL_ASSERT(nNewCapacity >= mnSize);
+
+        void*              pNewData = NULL;
+        std::tuple<Ts*...> pNewFields;
+
+        if(nNewCapacity)
+        {
+            size_t       offsets[sizeof...(Ts)];
+            size_t       nAlignment;
+            const size_t nBlockSize = DoGetLayout(nNewCapacity, offsets, nAlignment);
+
+            pNewData = allocate_memory(mAllocator, nBlockSize, nAlignment, 0);
+            DoSetFields(pNewData, nNewCapacity, pNewFields, index_sequence_type());
+            DoRelocate(pNewFields, index_sequence_type());
+        }
+
+        DoFree();
+
+        mpData     = pNewData;
+        mpFields   = pNewFields;
+        mnCapacity = nNewCapacity;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline void tuple_vector_alloc<Allocator, Ts...>::DoFree()
+    {
+        if(mpData)
+        {
+            size_t offsets[sizeof...(Ts)];
+            size_t nAlignment;
+            EASTLFree(mAllocator, mpData, DoGetLayout(mnCapacity, offsets, nAlignment));
+        }
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    template <size_t... Is>
+    inline void tuple_vector_alloc<Allocator, Ts...>::DoSetFields(void* pData, size_type nCapacity, std::tuple<Ts*...>& pFields, Internal::TupleVecIndexSequence<Is...>)
+    {
+        size_t offsets[sizeof...(Ts)];
+        size_t nAlignment;
+        DoGetLayout(nCapacity, offsets, nAlignment);
+
+        pFields = std::tuple<Ts*...>((Ts*)((char*)pData + offsets[Is])...);
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    template <size_t... Is>
+    inline void tuple_vector_alloc<Allocator, Ts...>::DoRelocate(std::tuple<Ts*...>& pDestFields, Internal::TupleVecIndexSequence<Is...>)
+    {
+        const int unused[] = { 0, (Internal::TupleVecField<Ts>::Relocate(std::get<Is>(pDestFields), std::get<Is>(mpFields), mnSize), 0)... };
+        (void)unused;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    template <size_t... Is>
+    inline void tuple_vector_alloc<Allocator, Ts...>::DoCopyConstruct(const this_type& x, Internal::TupleVecIndexSequence<Is...>)
+    {
+        const int unused[] = { 0, ((void)eastl::uninitialized_copy_ptr(std::get<Is>(x.mpFields), std::get<Is>(x.mpFields) + x.mnSize, std::get<Is>(mpFields)), 0)... };
+        (void)unused;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    template <size_t... Is, typename... Args>
+    inline void tuple_vector_alloc<Allocator, Ts...>::DoConstructAt(size_type n, Internal::TupleVecIndexSequence<Is...>, Args&&... args)
+    {
+        const int unused[] = { 0, ((void)::new((void*)(std::get<Is>(mpFields) + n)) Ts(std::forward<Args>(args)), 0)... };
+        (void)unused;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    template <size_t... Is>
+    inline void tuple_vector_alloc<Allocator, Ts...>::DoConstructAtFromTuple(size_type n, value_type&& values, Internal::TupleVecIndexSequence<Is...>)
+    {
+        const int unused[] = { 0, ((void)::new((void*)(std::get<Is>(mpFields) + n)) Ts(std::move(std::get<Is>(values))), 0)... };
+        (void)unused;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    template <size_t... Is>
+    inline void tuple_vector_alloc<Allocator, Ts...>::DoFillConstruct(size_type nFirst, size_type nLast, const value_type& values, Internal::TupleVecIndexSequence<Is...>)
+    {
+        const int unused[] = { 0, ((void)eastl::uninitialized_fill_n(std::get<Is>(mpFields) + nFirst, nLast - nFirst, std::get<Is>(values)), 0)... };
+        (void)unused;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    template <size_t... Is>
+    inline void tuple_vector_alloc<Allocator, Ts...>::DoDefaultConstruct(size_type nFirst, size_type nLast, Internal::TupleVecIndexSequence<Is...>)
+    {
+        const int unused[] = { 0, (Internal::TupleVecField<Ts>::DefaultConstruct(std::get<Is>(mpFields) + nFirst, nLast - nFirst), 0)... };
+        (void)unused;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    template <size_t... Is>
+    inline void tuple_vector_alloc<Allocator, Ts...>::DoDestroy(size_type nFirst, size_type nLast, Internal::TupleVecIndexSequence<Is...>)
+    {
+        const int unused[] = { 0, (eastl::destruct(std::get<Is>(mpFields) + nFirst, std::get<Is>(mpFields) + nLast), 0)... };
+        (void)unused;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    template <size_t... Is>
+    inline void tuple_vector_alloc<Allocator, Ts...>::DoMoveDown(size_type nDest, size_type nFirst, size_type nLast, Internal::TupleVecIndexSequence<Is...>)
+    {
+        const int unused[] = { 0, (Internal::TupleVecField<Ts>::MoveDown(std::get<Is>(mpFields) + nDest, std::get<Is>(mpFields) + nFirst, std::get<Is>(mpFields) + nLast), 0)... };
+        (void)unused;
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    template <size_t... Is>
+    inline typename tuple_vector_alloc<Allocator, Ts...>::reference
+    tuple_vector_alloc<Allocator, Ts...>::DoGetReference(size_type n, Internal::TupleVecIndexSequence<Is...>) const
+    {
+        return reference(std::get<Is>(mpFields)[n]...);
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    template <size_t... Is>
+    inline bool tuple_vector_alloc<Allocator, Ts...>::DoEqual(const this_type& x, Internal::TupleVecIndexSequence<Is...>) const
+    {
+        const bool results[] = { true, eastl::equal(std::get<Is>(mpFields), std::get<Is>(mpFields) + mnSize, std::get<Is>(x.mpFields))... };
+
+        for(size_t i = 0; i < sizeof...(Ts); ++i)
+        {
+            if(!results[i + 1])
+                return false;
+        }
+        return true;
+    }
+
+
+
+
+    ///////////////////////////////////////////////////////////////////////
+    // global operators
+    ///////////////////////////////////////////////////////////////////////
+
+    template <typename Allocator, typename... Ts>
+    inline bool operator==(const tuple_vector_alloc<Allocator, Ts...>& a, const tuple_vector_alloc<Allocator, Ts...>& b)
+    {
+        return (a.size() == b.size()) && a.DoEqual(b, typename Internal::TupleVecMakeIndexSequence<sizeof...(Ts)>::type());
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline bool operator!=(const tuple_vector_alloc<Allocator, Ts...>& a, const tuple_vector_alloc<Allocator, Ts...>& b)
+    {
+        return !(a == b);
+    }
+
+
+    template <typename Allocator, typename... Ts>
+    inline void swap(tuple_vector_alloc<Allocator, Ts...>& a, tuple_vector_alloc<Allocator, Ts...>& b)
+    {
+        a.swap(b);
+    }
+
+
+} // namespace eastl
+
+
+#endif // EA_COMPILER_HAS_VARIADIC_TEMPLATES
+
+#endif // Header include guard
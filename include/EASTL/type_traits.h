@@ -244,6 +244,25 @@ namespace eastl
 
 
 
+    ///////////////////////////////////////////////////////////////////////
+    // enable_if
+    //
+    // Defines 'type' only when the condition is true. Used in a return type
+    // or default template argument to remove a function template from
+    // overload resolution when the condition does not hold.
+    //
+    // Example usage:
+    //    template <typename U>
+    //    typename enable_if<is_integral<U>::value, U>::type Twice(U u) { return u * 2; }
+    //
+    template <bool bCondition, typename T = void>
+    struct enable_if { };
+
+    template <typename T>
+    struct enable_if<true, T> { typedef T type; };
+
+
+
     ///////////////////////////////////////////////////////////////////////
     // type_or
     //
@@ -0,0 +1,569 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/utf.h
+//
+// Implements validation of UTF-8, UTF-16 and UTF-32 text and conversion
+// between them, for pointer ranges and basic_strings.
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// Text is held as char8_t (UTF-8), char16_t (UTF-16) or char32_t (UTF-32),
+// as in string8, string16 and string32:
+//    - Validation is strict. UTF-8 must be the shortest encoding of each
+//      code point, and no text may encode a surrogate (U+D800 to U+DFFF)
+//      other than as a UTF-16 pair, or a value above U+10FFFF. Text which
+//      ends partway through a sequence is invalid.
+//    - utf_length counts the units text converts to, which is how the
+//      string conversions allocate once, at the final size.
+//    - Runs of ASCII are examined and converted a SIMD register at a time
+//      where EASTL_SSE2 is enabled; the UTF-8 scans use the AVX2 registers
+//      of char_search.h under EASTL_AVX2. Other characters are decoded one
+//      at a time.
+//
+// The pointer conversion, utf_convert(p, pEnd, pDest), requires valid
+// text; use it after utf_validate or utf_length, with a destination of
+// utf_length units. The string conversions validate as they measure, and
+// return false, leaving the destination unchanged, for invalid text.
+//
+// Example usage:
+//    eastl::string16 name16;
+//    if(!eastl::utf_convert(name8, name16)) // name8 is an eastl::string8 from the network.
+//        return kErrorInvalidName;
+//
+//    const char8_t* pInvalid = eastl::utf_find_invalid(pBuffer, pBufferEnd);
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef EASTL_UTF_H
+#define EASTL_UTF_H
+
+
+#include <EASTL/internal/config.h>
+#include <EASTL/internal/char_search.h>
+#include <EASTL/string.h>
+#include <stddef.h>
+
+
+
+namespace eastl
+{
+
+    namespace Internal
+    {
+        // The length of text's valid prefix in each of the encodings.
+        struct UtfCounts
+        {
+            size_t n8;
+            size_t n16;
+            size_t n32;
+        };
+
+        inline size_t UtfCount(const UtfCounts& counts, const char8_t*)  { return counts.n8; }
+        inline size_t UtfCount(const UtfCounts& counts, const char16_t*) { return counts.n16; }
+        inline size_t UtfCount(const UtfCounts& counts, const char32_t*) { return counts.n32; }
+
+
+        // Utf8AsciiEnd / Utf16AsciiEnd / Utf32AsciiEnd
+        // Return the first unit in [p, pEnd) which isn't ASCII, or pEnd.
+        inline const char8_t* Utf8AsciiEnd(const char8_t* p, const char8_t* pEnd)
+        {
+            #if EASTL_SSE2
+                for(; (pEnd - p) >= kCharBlockSize; p += kCharBlockSize)
+                {
+                    const uint32_t mask = CharBlockMask(CharBlockLoad(p));
+
+                    if(mask)
+                        return p + CharBlockFirst(mask);
+                }
+            #endif
+
+            while((p != pEnd) && ((uint8_t)*p < 0x80))
+                ++p;
+            return p;
+        }
+
+
+        inline const char16_t* Utf16AsciiEnd(const char16_t* p, const char16_t* pEnd)
+        {
+            #if EASTL_SSE2
+                const __m128i vNonAscii = _mm_set1_epi16((short)0xff80);
+                const __m128i vZero     = _mm_setzero_si128();
+
+                for(; (pEnd - p) >= 8; p += 8)
+                {
+                    const __m128i  v    = _mm_loadu_si128((const __m128i*)p);
+                    const uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, vNonAscii), vZero)) ^ 0xffff;
+
+                    if(mask)
+                        return p + (CharBlockFirst(mask) / 2);
+                }
+            #endif
+
+            while((p != pEnd) && ((uint32_t)*p < 0x80))
+                ++p;
+            return p;
+        }
+
+
+        inline const char32_t* Utf32AsciiEnd(const char32_t* p, const char32_t* pEnd)
+        {
+            #if EASTL_SSE2
+                const __m128i vNonAscii = _mm_set1_epi32((int)0xffffff80);
+                const __m128i vZero     = _mm_setzero_si128();
+
+                for(; (pEnd - p) >= 4; p += 4)
+                {
+                    const __m128i  v    = _mm_loadu_si128((const __m128i*)p);
+                    const uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(v, vNonAscii), vZero)) ^ 0xffff;
+
+                    if(mask)
+                        return p + (CharBlockFirst(mask) / 4);
+                }
+            #endif
+
+            while((p != pEnd) && ((uint32_t)*p < 0x80))
+                ++p;
+            return p;
+        }
+
+        inline const char8_t*  UtfAsciiEnd(const char8_t* p,  const char8_t* pEnd)  { return Utf8AsciiEnd(p, pEnd); }
+        inline const char16_t* UtfAsciiEnd(const char16_t* p, const char16_t* pEnd) { return Utf16AsciiEnd(p, pEnd); }
+        inline const char32_t* UtfAsciiEnd(const char32_t* p, const char32_t* pEnd) { return Utf32AsciiEnd(p, pEnd); }
+
+
+        // UtfCopyAscii
+        // Copies the ASCII [p, pEnd) to pDest, changing the width of each unit,
+        // and returns the end of what it wrote.
+        template <typename DestT, typename SrcT>
+        inline DestT* UtfCopyAscii(const SrcT* p, const SrcT* pEnd, DestT* pDest)
+        {
+            for(; p != pEnd; ++p)
+                *pDest++ = (DestT)*p;
+            return pDest;
+        }
+
+        #if EASTL_SSE2
+            template <>
+            inline char16_t* UtfCopyAscii<char16_t, char8_t>(const char8_t* p, const char8_t* pEnd, char16_t* pDest)
+            {
+                const __m128i vZero = _mm_setzero_si128();
+
+                for(; (pEnd - p) >= 16; p += 16, pDest += 16)
+                {
+                    const __m128i v = _mm_loadu_si128((const __m128i*)p);
+                    _mm_storeu_si128((__m128i*)pDest,       _mm_unpacklo_epi8(v, vZero));
+                    _mm_storeu_si128((__m128i*)(pDest + 8), _mm_unpackhi_epi8(v, vZero));
+                }
+
+                for(; p != pEnd; ++p)
+                    *pDest++ = (char16_t)*p;
+                return pDest;
+            }
+
+            template <>
+            inline char32_t* UtfCopyAscii<char32_t, char8_t>(const char8_t* p, const char8_t* pEnd, char32_t* pDest)
+            {
+                const __m128i vZero = _mm_setzero_si128();
+
+                for(; (pEnd - p) >= 16; p += 16, pDest += 16)
+                {
+                    const __m128i v  = _mm_loadu_si128((const __m128i*)p);
+                    const __m128i lo = _mm_unpacklo_epi8(v, vZero);
+                    const __m128i hi = _mm_unpackhi_epi8(v, vZero);
+                    _mm_storeu_si128((__m128i*)pDest,        _mm_unpacklo_epi16(lo, vZero));
+                    _mm_storeu_si128((__m128i*)(pDest + 4),  _mm_unpackhi_epi16(lo, vZero));
+                    _mm_storeu_si128((__m128i*)(pDest + 8),  _mm_unpacklo_epi16(hi, vZero));
+                    _mm_storeu_si128((__m128i*)(pDest + 12), _mm_unpackhi_epi16(hi, vZero));
+                }
+
+                for(; p != pEnd; ++p)
+                    *pDest++ = (char32_t)*p;
+                return pDest;
+            }
+
+            template <>
+            inline char8_t* UtfCopyAscii<char8_t, char16_t>(const char16_t* p, const char16_t* pEnd, char8_t* pDest)
+            {
+                for(; (pEnd - p) >= 16; p += 16, pDest += 16)
+                {
+                    const __m128i a = _mm_loadu_si128((const __m128i*)p);
+                    const __m128i b = _mm_loadu_si128((const __m128i*)(p + 8));
+                    _mm_storeu_si128((__m128i*)pDest, _mm_packus_epi16(a, b));
+                }
+
+                for(; p != pEnd; ++p)
+                    *pDest++ = (char8_t)*p;
+                return pDest;
+            }
+
+            template <>
+            inline char8_t* UtfCopyAscii<char8_t, char32_t>(const char32_t* p, const char32_t* pEnd, char8_t* pDest)
+            {
+                for(; (pEnd - p) >= 16; p += 16, pDest += 16)
+                {
+                    const __m128i ab = _mm_packs_epi32(_mm_loadu_si128((const __m128i*)p),       _mm_loadu_si128((const __m128i*)(p + 4)));
+                    const __m128i cd = _mm_packs_epi32(_mm_loadu_si128((const __m128i*)(p + 8)), _mm_loadu_si128((const __m128i*)(p + 12)));
+                    _mm_storeu_si128((__m128i*)pDest, _mm_packus_epi16(ab, cd));
+                }
+
+                for(; p != pEnd; ++p)
+                    *pDest++ = (char8_t)*p;
+                return pDest;
+            }
+        #endif
+
+
+        // UtfPut
+        // Writes the code point c to pDest and returns the end of what it wrote.
+        inline char8_t* UtfPut(char8_t* pDest, uint32_t c)
+        {
+            if(c < 0x80)
+                *pDest++ = (char8_t)c;
+            else if(c < 0x800)
+            {
+                *pDest++ = (char8_t)(0xc0 | (c >> 6));
+                *pDest++ = (char8_t)(0x80 | (c & 0x3f));
+            }
+            else if(c < 0x10000)
+            {
+                *pDest++ = (char8_t)(0xe0 | (c >> 12));
+                *pDest++ = (char8_t)(0x80 | ((c >> 6) & 0x3f));
+                *pDest++ = (char8_t)(0x80 | (c & 0x3f));
+            }
+            else
+            {
+                *pDest++ = (char8_t)(0xf0 | (c >> 18));
+                *pDest++ = (char8_t)(0x80 | ((c >> 12) & 0x3f));
+                *pDest++ = (char8_t)(0x80 | ((c >> 6) & 0x3f));
+                *pDest++ = (char8_t)(0x80 | (c & 0x3f));
+            }
+            return pDest;
+        }
+
+        inline char16_t* UtfPut(char16_t* pDest, uint32_t c)
+        {
+            if(c < 0x10000)
+                *pDest++ = (char16_t)c;
+            else
+            {
+                *pDest++ = (char16_t)(0xd7c0 + (c >> 10));      // 0xd800 + ((c - 0x10000) >> 10)
+                *pDest++ = (char16_t)(0xdc00 | (c & 0x3ff));
+            }
+            return pDest;
+        }
+
+        inline char32_t* UtfPut(char32_t* pDest, uint32_t c)
+        {
+            *pDest++ = (char32_t)c;
+            return pDest;
+        }
+
+
+        // UtfScan
+        // Returns the start of the first invalid sequence in [p, pEnd), or
+        // pEnd, and sets counts to the length of the text before it.
+        inline const char8_t* UtfScan(const char8_t* p, const char8_t* pEnd, UtfCounts& counts)
+        {
+            const char8_t* const pBegin = p;
+            size_t nCodePoints    = 0;
+            size_t nSupplementary = 0;  // Code points above U+FFFF, which take two UTF-16 units.
+
+            while(p != pEnd)
+            {
+                const char8_t* const pAsciiEnd = Utf8AsciiEnd(p, pEnd);
+                nCodePoints += (size_t)(pAsciiEnd - p);
+
+                for(p = pAsciiEnd; (p != pEnd) && ((uint8_t)*p >= 0x80); ++nCodePoints)
+                {
+                    // Each sequence is checked by decoding enough of it to see that it is
+                    // the shortest encoding of a code point up to U+10FFFF and not a surrogate.
+                    const uint8_t* const pu = (const uint8_t*)p;
+                    const ptrdiff_t      n  = pEnd - p;
+                    const uint32_t       c0 = pu[0];
+
+                    if(c0 < 0xe0)
+                    {
+                        if((c0 < 0xc2) || (n < 2) || ((pu[1] & 0xc0) != 0x80))
+                            break;
+                        p += 2;
+                    }
+                    else if(c0 < 0xf0)
+                    {
+                        if((n < 3) || ((pu[1] & 0xc0) != 0x80) || ((pu[2] & 0xc0) != 0x80))
+                            break;
+
+                        const uint32_t c = ((c0 & 0x0f) << 12) | ((uint32_t)(pu[1] & 0x3f) << 6);
+                        if((c < 0x800) || ((c & 0xf800) == 0xd800))
+                            break;
+                        p += 3;
+                    }
+                    else
+                    {
+                        if((n < 4) || ((pu[1] & 0xc0) != 0x80) || ((pu[2] & 0xc0) != 0x80) || ((pu[3] & 0xc0) != 0x80))
+                            break;
+
+                        const uint32_t c = ((c0 & 0x0f) << 18) | ((uint32_t)(pu[1] & 0x3f) << 12); // 0x0f rather than 0x07 so that leads above 0xf7 exceed U+10FFFF.
+                        if((c < 0x10000) || (c > 0x10ffff))
+                            break;
+                        p += 4;
+                        ++nSupplementary;
+                    }
+                }
+
+                if((p != pEnd) && ((uint8_t)*p >= 0x80)) // If the loop above stopped at an invalid sequence...
+                    break;
+            }
+
+            counts.n8  = (size_t)(p - pBegin);
+            counts.n16 = nCodePoints + nSupplementary;
+            counts.n32 = nCodePoints;
+            return p;
+        }
+
+
+        inline const char16_t* UtfScan(const char16_t* p, const char16_t* pEnd, UtfCounts& counts)
+        {
+            const char16_t* const pBegin = p;
+            size_t n8          = 0;
+            size_t nCodePoints = 0;
+
+            while(p != pEnd)
+            {
+                const char16_t* const pAsciiEnd = Utf16AsciiEnd(p, pEnd);
+                n8          += (size_t)(pAsciiEnd - p);
+                nCodePoints += (size_t)(pAsciiEnd - p);
+
+                for(p = pAsciiEnd; (p != pEnd) && ((uint32_t)*p >= 0x80); ++nCodePoints)
+                {
+                    const uint32_t c = (uint32_t)*p;
+
+                    if((c & 0xf800) != 0xd800)
+                    {
+                        n8 += (c < 0x800) ? 2 : 3;
+                        ++p;
+                    }
+                    else if((c < 0xdc00) && ((pEnd - p) >= 2) && (((uint32_t)p[1] & 0xfc00) == 0xdc00))
+                    {
+                        n8 += 4;
+                        p  += 2;
+                    }
+                    else
+                        break;
+                }
+
+                if((p != pEnd) && ((uint32_t)*p >= 0x80))
+                    break;
+            }
+
+            counts.n8  = n8;
+            counts.n16 = (size_t)(p - pBegin);
+            counts.n32 = nCodePoints;
+            return p;
+        }
+
+
+        inline const char32_t* UtfScan(const char32_t* p, const char32_t* pEnd, UtfCounts& counts)
+        {
+            const char32_t* const pBegin = p;
+            size_t n8  = 0;
+            size_t n16 = 0;
+
+            while(p != pEnd)
+            {
+                const char32_t* const pAsciiEnd = Utf32AsciiEnd(p, pEnd);
+                n8  += (size_t)(pAsciiEnd - p);
+                n16 += (size_t)(pAsciiEnd - p);
+
+                for(p = pAsciiEnd; (p != pEnd) && ((uint32_t)*p >= 0x80); ++p)
+                {
+                    const uint32_t c = (uint32_t)*p;
+
+                    if((c > 0x10ffff) || ((c & 0xfffff800) == 0xd800))
+                        break;
+
+                    n8  += (c < 0x800) ? 2 : ((c < 0x10000) ? 3 : 4);
+                    n16 += (c < 0x10000) ? 1 : 2;
+                }
+
+                if((p != pEnd) && ((uint32_t)*p >= 0x80))
+                    break;
+            }
+
+            counts.n8  = n8;
+            counts.n16 = n16;
+            counts.n32 = (size_t)(p - pBegin);
+            return p;
+        }
+
+
+        // UtfDecode
+        // Returns the code point which starts at the valid text p, which isn't
+        // ASCII, and moves p past it.
+        inline uint32_t UtfDecode(const char8_t*& p)
+        {
+            const uint32_t c = (uint8_t)p[0];
+
+            if(c < 0xe0)
+            {
+                p += 2;
+                return ((c & 0x1f) << 6) | ((uint8_t)p[-1] & 0x3f);
+            }
+            if(c < 0xf0)
+            {
+                p += 3;
+                return ((c & 0x0f) << 12) | (((uint8_t)p[-2] & 0x3f) << 6) | ((uint8_t)p[-1] & 0x3f);
+            }
+            p += 4;
+            return ((c & 0x07) << 18) | (((uint8_t)p[-3] & 0x3f) << 12) | (((uint8_t)p[-2] & 0x3f) << 6) | ((uint8_t)p[-1] & 0x3f);
+        }
+
+        inline uint32_t UtfDecode(const char16_t*& p)
+        {
+            const uint32_t c = (uint32_t)*p++;
+
+            if((c & 0xf800) != 0xd800)
+                return c;
+            return (c << 10) + (uint32_t)*p++ - ((0xd800u << 10) + 0xdc00 - 0x10000);
+        }
+
+        inline uint32_t UtfDecode(const char32_t*& p)
+        {
+            return (uint32_t)*p++;
+        }
+
+
+        // UtfConvert
+        // Converts the valid text [p, pEnd) to pDest and returns the end of what it wrote.
+        template <typename DestT, typename SrcT>
+        DestT* UtfConvert(const SrcT* p, const SrcT* pEnd, DestT* pDest)
+        {
+            while(p != pEnd)
+            {
+                const SrcT* const pAsciiEnd = UtfAsciiEnd(p, pEnd);
+                pDest = UtfCopyAscii(p, pAsciiEnd, pDest);
+
+                for(p = pAsciiEnd; (p != pEnd) && ((uint32_t)*p >= 0x80); )
+                    pDest = UtfPut(pDest, UtfDecode(p));
+            }
+            return pDest;
+        }
+
+    } // namespace Internal
+
+
+
+    /// utf_find_invalid
+    ///
+    /// Returns the start of the first invalid sequence in the UTF-8, UTF-16
+    /// or UTF-32 text [p, pEnd), or pEnd if the text is valid.
+    ///
+    template <typename T>
+    inline const T* utf_find_invalid(const T* p, const T* pEnd)
+    {
+        Internal::UtfCounts counts;
+        return Internal::UtfScan(p, pEnd, counts);
+    }
+
+
+    /// utf_validate
+    ///
+    /// Returns whether [p, pEnd) is valid UTF-8, UTF-16 or UTF-32.
+    ///
+    template <typename T>
+    inline bool utf_validate(const T* p, const T* pEnd)
+    {
+        return utf_find_invalid(p, pEnd) == pEnd;
+    }
+
+    template <typename T, typename Allocator>
+    inline bool utf_validate(const basic_string<T, Allocator>& s)
+    {
+        return utf_validate(s.data(), s.data() + s.size());
+    }
+
+
+    /// utf_length
+    ///
+    /// Returns the number of DestT units that [p, pEnd) converts to, as in
+    /// utf_length<char16_t>(p8, p8End). If the text is invalid, returns the
+    /// number that the text before the first invalid sequence converts to.
+    ///
+    template <typename DestT, typename SrcT>
+    inline size_t utf_length(const SrcT* p, const SrcT* pEnd)
+    {
+        Internal::UtfCounts counts;
+        Internal::UtfScan(p, pEnd, counts);
+        return Internal::UtfCount(counts, (const DestT*)NULL);
+    }
+
+
+    /// utf_convert
+    ///
+    /// Converts the valid text [p, pEnd) to pDest, which must have room for
+    /// utf_length<DestT>(p, pEnd) units, and returns the end of what it wrote.
+    /// The result isn't 0-terminated.
+    ///
+    template <typename DestT, typename SrcT>
+    inline DestT* utf_convert(const SrcT* p, const SrcT* pEnd, DestT* pDest)
+    {
+        EASTL_ASSERT(utf_validate(p, pEnd));
+        return Internal::UtfConvert(p, pEnd, pDest);
+    }
+
+
+    /// utf_convert
+    ///
+    /// Replaces dest's contents with [p, pEnd) converted to dest's encoding.
+    /// The text is validated and measured in one pass, so dest is allocated
+    /// at most once, and then converted in a second. Returns false, leaving
+    /// dest unchanged, if the text is invalid.
+    ///
+    /// [p, pEnd) may be within dest itself. If it is all of dest in the same
+    /// encoding there is nothing to convert; otherwise the text is converted
+    /// to a new string which is then swapped into dest.
+    ///
+    template <typename DestT, typename Allocator, typename SrcT>
+    bool utf_convert(const SrcT* p, const SrcT* pEnd, basic_string<DestT, Allocator>& dest)
+    {
+        typedef typename basic_string<DestT, Allocator>::size_type size_type;
+
+        Internal::UtfCounts counts;
+        if(Internal::UtfScan(p, pEnd, counts) != pEnd)
+            return false;
+
+        const size_type n = (size_type)Internal::UtfCount(counts, (const DestT*)NULL);
+
+        const uintptr_t nDestBegin = (uintptr_t)dest.data();
+        const uintptr_t nDestEnd   = (uintptr_t)(dest.data() + dest.capacity() + 1);
+
+        if(((uintptr_t)p < nDestEnd) && ((uintptr_t)pEnd > nDestBegin)) // If [p, pEnd) overlaps dest's block...
+        {
+            if((sizeof(SrcT) == sizeof(DestT)) && ((uintptr_t)p == nDestBegin) && (n == dest.size()))
+                return true;
+
+            basic_string<DestT, Allocator> temp(dest.get_allocator());
+            utf_convert(p, pEnd, temp);
+            dest.swap(temp);
+            return true;
+        }
+
+        dest.clear();
+        dest.reserve(n);
+
+        DestT* const pDest = dest.begin();
+        Internal::UtfConvert(p, pEnd, pDest)[0] = 0;
+        dest.force_size(n);
+
+        return true;
+    }
+
+    template <typename DestT, typename DestAllocator, typename SrcT, typename SrcAllocator>
+    inline bool utf_convert(const basic_string<SrcT, SrcAllocator>& src, basic_string<DestT, DestAllocator>& dest)
+    {
+        return utf_convert(src.data(), src.data() + src.size(), dest);
+    }
+
+
+} // namespace eastl
+
+
+#endif // Header include guard
@@ -191,6 +191,7 @@ namespace eastl
 
     protected:
         T*        DoAllocate(size_type n);
+        T*        DoAllocateAtLeast(size_type n, size_type& nCapacity);
         void      DoFree(T* p, size_type n);
         size_type GetNewCapacity(size_type currentCapacity);
 
@@ -230,8 +231,15 @@ namespace eastl
         using base_type::npos;
         using base_type::GetNewCapacity;
         using base_type::DoAllocate;
+        using base_type::DoAllocateAtLeast;
         using base_type::DoFree;
 
+    protected:
+        // true_type if our storage can be resized in place by the allocator instead 
+        // of by allocating a new block and copying. See allocator_can_reallocate.
+        typedef integral_constant<bool, has_trivial_relocate<T>::value && 
+                                        allocator_can_reallocate<Allocator>::value> can_reallocate_type;
+
     public:
         vector();
         explicit vector(const allocator_type& allocator);
@@ -337,6 +345,9 @@ namespace eastl
         template <typename ForwardIterator>
         pointer DoRealloc(size_type n, ForwardIterator first, ForwardIterator last);
 
+        void DoSetCapacity(size_type n, true_type);
+        void DoSetCapacity(size_type n, false_type);
+
         template <typename Integer>
         void DoInit(Integer n, Integer value, true_type);
 
@@ -461,6 +472,29 @@ namespace eastl
     }
 
 
+    template <typename T, typename Allocator>
+    inline T* VectorBase<T, Allocator>::DoAllocateAtLeast(size_type n, size_type& nCapacity)
+    {
+#if EASTL_ASSERT_ENABLED
+            if(EASTL_UNLIKELY(n >= 0x80000000))
+                EASTL_FAIL_MSG("vector::DoAllocateAtLeast -- improbably large request.");
+#endif
+
+        // Like DoAllocate, but we learn from the allocator how many elements actually 
+        // fit in the block it returns (see allocate_memory_at_least), which may be more 
+        // than n. Our callers use that as the new capacity so as to not waste it.
+        if(n)
+        {
+            const allocation_result result = allocate_memory_at_least(mAllocator, n * sizeof(T), kAlignment, kAlignmentOffset);
+            nCapacity = result.ptr ? (size_type)(result.count / sizeof(T)) : 0;
+            return (T*)result.ptr;
+        }
+
+        nCapacity = 0;
+        return NULL;
+    }
+
+
     template <typename T, typename Allocator>
     inline void VectorBase<T, Allocator>::DoFree(T* p, size_type n)
     {
@@ -474,7 +508,8 @@ namespace eastl
     VectorBase<T, Allocator>::GetNewCapacity(size_type currentCapacity)
     {
         // This needs to return a value of at least currentCapacity and at least 1.
-        return (currentCapacity > 0) ? (2 * currentCapacity) : 1;
+        typedef typename allocator_growth_policy<Allocator>::type growth_policy_type;
+        return (size_type)growth_policy_type()(mAllocator, (size_t)currentCapacity, 1, sizeof(T));
     }
 
 
@@ -779,20 +814,7 @@ namespace eastl
     {
         // If the user wants to reduce the reserved memory, there is the set_capacity function.
         if(n > size_type(mpCapacity - mpBegin)) // If n > capacity ...
-        {
-            // To consider: fold this reserve implementation with the set_capacity 
-            // implementation below. But we need to be careful to not call resize
-            // in the implementation, as that would require the user to have a 
-            // default constructor, which we are trying to avoid.
-            pointer const pNewData = DoRealloc(n, mpBegin, mpEnd);
-            DoDestroyValues(mpBegin, mpEnd);
-            DoFree(mpBegin, (size_type)(mpCapacity - mpBegin));
-
-            const ptrdiff_t nPrevSize = mpEnd - mpBegin;
-            mpBegin    = pNewData;
-            mpEnd      = pNewData + nPrevSize;
-            mpCapacity = mpBegin + n;
-        }
+            DoSetCapacity(n, can_reallocate_type());
     }
 
 
@@ -804,20 +826,16 @@ namespace eastl
             if(n < (size_type)(mpEnd - mpBegin))
                 resize(n);
 
-            this_type temp(*this);  // This is the simplest way to accomplish this, 
-            swap(temp);             // and it is as efficient as any other.
+            if(can_reallocate_type::value) // If the allocator can shrink the block in place...
+                DoSetCapacity((size_type)(mpEnd - mpBegin), can_reallocate_type());
+            else
+            {
+                this_type temp(*this);  // This is the simplest way to accomplish this, 
+                swap(temp);             // and it is as efficient as any other.
+            }
         }
         else // Else new capacity > size.
-        {
-            pointer const pNewData = DoRealloc(n, mpBegin, mpEnd);
-            DoDestroyValues(mpBegin, mpEnd);
-            DoFree(mpBegin, (size_type)(mpCapacity - mpBegin));
-
-            const ptrdiff_t nPrevSize = mpEnd - mpBegin;
-            mpBegin    = pNewData;
-            mpEnd      = pNewData + nPrevSize;
-            mpCapacity = mpBegin + n;
-        }
+            DoSetCapacity(n, can_reallocate_type());
     }
 
 
@@ -1170,6 +1188,62 @@ namespace eastl
     }
 
 
+    template <typename T, typename Allocator>
+    void vector<T, Allocator>::DoSetCapacity(size_type n, true_type)
+    {
+        // The allocator resizes the block (possibly moving it) for us. This avoids 
+        // having both the old and new blocks in memory at once, and for allocators 
+        // such as mmap_allocator the move is done by remapping pages instead of copying.
+        // We can do this only because T is trivially relocatable. n must be >= size().
+        // If the allocator fails it returns NULL and leaves our block as it was; with 
+        // exceptions disabled we then return with the capacity unchanged, so callers 
+        // which go on to write past mpEnd must check that the room was made.
+        const ptrdiff_t nPrevSize = mpEnd - mpBegin;
+
+        if(n)
+        {
+            pointer const pNewData = (pointer)mAllocator.reallocate(mpBegin, (size_t)(mpCapacity - mpBegin) * sizeof(T), (size_t)n * sizeof(T));
+
+            if(EASTL_UNLIKELY(!pNewData))
+            {
+#if EASTL_EXCEPTIONS_ENABLED
+                    throw std::bad_alloc();
+#else
+                    EASTL_FAIL_MSG("vector::DoSetCapacity -- reallocation failed.");
+                    return;
+#endif
+            }
+
+            mpBegin    = pNewData;
+            mpEnd      = pNewData + nPrevSize;
+            mpCapacity = pNewData + n;
+        }
+        else
+        {
+            DoFree(mpBegin, (size_type)(mpCapacity - mpBegin));
+            mpBegin = mpEnd = mpCapacity = NULL;
+        }
+    }
+
+
+    template <typename T, typename Allocator>
+    void vector<T, Allocator>::DoSetCapacity(size_type n, false_type)
+    {
+        // We need to be careful to not call resize in the implementation, as that 
+        // would require the user to have a default constructor, which we are trying to avoid.
+        size_type     nNewCapacity;
+        pointer const pNewData = DoAllocateAtLeast(n, nNewCapacity);
+        eastl::uninitialized_copy_ptr(mpBegin, mpEnd, pNewData);
+        DoDestroyValues(mpBegin, mpEnd);
+        DoFree(mpBegin, (size_type)(mpCapacity - mpBegin));
+
+        const ptrdiff_t nPrevSize = mpEnd - mpBegin;
+        mpBegin    = pNewData;
+        mpEnd      = pNewData + nPrevSize;
+        mpCapacity = mpBegin + nNewCapacity;
+    }
+
+
     template <typename T, typename Allocator>
     template <typename Integer>
     inline void vector<T, Allocator>::DoInit(Integer n, Integer value, true_type)
@@ -1375,7 +1449,8 @@ namespace eastl
                 const size_type nPrevSize = size_type(mpEnd - mpBegin);
                 const size_type nGrowSize = GetNewCapacity(nPrevSize);
                 const size_type nNewSize  = nGrowSize > (nPrevSize + n) ? nGrowSize : (nPrevSize + n);
-                pointer const   pNewData  = DoAllocate(nNewSize);
+                size_type       nNewCapacity;
+                pointer const   pNewData  = DoAllocateAtLeast(nNewSize, nNewCapacity);
 
 #if EASTL_EXCEPTIONS_ENABLED
                     pointer pNewEnd = pNewData;
@@ -1388,7 +1463,7 @@ namespace eastl
                     catch(...)
                     {
                         DoDestroyValues(pNewData, pNewEnd);
-                        DoFree(pNewData, nNewSize);
+                        DoFree(pNewData, nNewCapacity);
                         throw;
                     }
 #else
@@ -1402,7 +1477,7 @@ namespace eastl
 
                 mpBegin    = pNewData;
                 mpEnd      = pNewEnd;
-                mpCapacity = pNewData + nNewSize;
+                mpCapacity = pNewData + nNewCapacity;
             }
         }
     }
@@ -1442,12 +1517,25 @@ namespace eastl
                 }
             }
         }
+        else if(can_reallocate_type::value && (position == mpEnd)) // else if appending and the allocator can grow our block in place...
+        {
+            const value_type temp      = value; // value may refer to an element of this vector, which reallocation invalidates.
+            const size_type  nPrevSize = size_type(mpEnd - mpBegin);
+            const size_type  nGrowSize = GetNewCapacity(nPrevSize);
+
+            DoSetCapacity(nGrowSize > (nPrevSize + n) ? nGrowSize : (nPrevSize + n), can_reallocate_type());
+            if(EASTL_UNLIKELY(n > size_type(mpCapacity - mpEnd))) // If the reallocation failed...
+                return;
+            eastl::uninitialized_fill_n_ptr(mpEnd, n, temp);
+            mpEnd += n;
+        }
         else // else n > capacity
         {
             const size_type nPrevSize = size_type(mpEnd - mpBegin);
             const size_type nGrowSize = GetNewCapacity(nPrevSize);
             const size_type nNewSize  = nGrowSize > (nPrevSize + n) ? nGrowSize : (nPrevSize + n);
-            pointer const pNewData    = DoAllocate(nNewSize);
+            size_type       nNewCapacity;
+            pointer const pNewData    = DoAllocateAtLeast(nNewSize, nNewCapacity);
 
 #if EASTL_EXCEPTIONS_ENABLED
                 pointer pNewEnd = pNewData;
@@ -1460,7 +1548,7 @@ namespace eastl
                 catch(...)
                 {
                     DoDestroyValues(pNewData, pNewEnd);
-                    DoFree(pNewData, nNewSize);
+                    DoFree(pNewData, nNewCapacity);
                     throw;
                 }
 #else
@@ -1474,7 +1562,7 @@ namespace eastl
 
             mpBegin    = pNewData;
             mpEnd      = pNewEnd;
-            mpCapacity = pNewData + nNewSize;
+            mpCapacity = pNewData + nNewCapacity;
         }
     }
 
@@ -1499,11 +1587,20 @@ namespace eastl
             *position = *pValue;
             ++mpEnd;
         }
+        else if(can_reallocate_type::value && (position == mpEnd)) // else if appending and the allocator can grow our block in place...
+        {
+            const value_type temp(value); // value may refer to an element of this vector, which reallocation invalidates.
+            DoSetCapacity(GetNewCapacity(size_type(mpEnd - mpBegin)), can_reallocate_type());
+            if(EASTL_UNLIKELY(mpEnd == mpCapacity)) // If the reallocation failed...
+                return;
+            ::new(mpEnd++) value_type(temp);
+        }
         else // else (size == capacity)
         {
             const size_type nPrevSize = size_type(mpEnd - mpBegin);
             const size_type nNewSize  = GetNewCapacity(nPrevSize);
-            pointer const   pNewData  = DoAllocate(nNewSize);
+            size_type       nNewCapacity;
+            pointer const   pNewData  = DoAllocateAtLeast(nNewSize, nNewCapacity);
 
 #if EASTL_EXCEPTIONS_ENABLED
                 pointer pNewEnd = pNewData;
@@ -1516,7 +1613,7 @@ namespace eastl
                 catch(...)
                 {
                     DoDestroyValues(pNewData, pNewEnd);
-                    DoFree(pNewData, nNewSize);
+                    DoFree(pNewData, nNewCapacity);
                     throw;
                 }
 #else
@@ -1530,7 +1627,7 @@ namespace eastl
 
             mpBegin    = pNewData;
             mpEnd      = pNewEnd;
-            mpCapacity = pNewData + nNewSize;
+            mpCapacity = pNewData + nNewCapacity;
         }
     }
 
@@ -1555,11 +1652,20 @@ namespace eastl
             *position = *pValue;
             ++mpEnd;
         }
+        else if(can_reallocate_type::value && (position == mpEnd)) // else if appending and the allocator can grow our block in place...
+        {
+            value_type temp(std::forward<T>(value)); // value may refer to an element of this vector, which reallocation invalidates.
+            DoSetCapacity(GetNewCapacity(size_type(mpEnd - mpBegin)), can_reallocate_type());
+            if(EASTL_UNLIKELY(mpEnd == mpCapacity)) // If the reallocation failed...
+                return;
+            ::new(mpEnd++) value_type(std::move(temp));
+        }
         else // else (size == capacity)
         {
             const size_type nPrevSize = size_type(mpEnd - mpBegin);
             const size_type nNewSize  = GetNewCapacity(nPrevSize);
-            pointer const   pNewData  = DoAllocate(nNewSize);
+            size_type       nNewCapacity;
+            pointer const   pNewData  = DoAllocateAtLeast(nNewSize, nNewCapacity);
 
 #if EASTL_EXCEPTIONS_ENABLED
                 pointer pNewEnd = pNewData;
@@ -1572,7 +1678,7 @@ namespace eastl
                 catch(...)
                 {
                     DoDestroyValues(pNewData, pNewEnd);
-                    DoFree(pNewData, nNewSize);
+                    DoFree(pNewData, nNewCapacity);
                     throw;
                 }
 #else
@@ -1586,7 +1692,7 @@ namespace eastl
 
             mpBegin    = pNewData;
             mpEnd      = pNewEnd;
-            mpCapacity = pNewData + nNewSize;
+            mpCapacity = pNewData + nNewCapacity;
         }
     }
 #endif
@@ -43,8 +43,90 @@ struct compare_impl {
   Compare m_cmp;
 }; // struct compare_impl
 
+// True for adjacent elements a, b of a sorted range when they are equivalent.
+template<class Compare>
+struct adjacent_equivalent {
+  adjacent_equivalent(Compare const& cmp) : m_cmp(cmp) {}
+
+  template<class T>
+  bool operator()(T const& lhs, T const& rhs) const { return !m_cmp(lhs, rhs); }
+ private:
+  Compare m_cmp;
+}; // struct adjacent_equivalent
+
+// Makes a sorted vector out of the sorted elements [0, n_sorted) of v and the
+// elements appended after them: sorts the appended elements unless
+// tail_sorted is set, merges them with the others and, if unique is set,
+// drops every element equivalent to an earlier one. This is O(n log n),
+// where inserting the elements one by one would be O(n^2).
+template<class Vector, class Compare>
+void merge_sorted_tail(Vector& v, typename Vector::size_type const n_sorted,
+                       Compare const& cmp, bool const tail_sorted, bool const unique)
+{
+  typename Vector::iterator const mid(v.begin() + n_sorted);
+
+  if(!tail_sorted)
+    ::eastl::stable_sort(mid, v.end(), v.get_allocator(), cmp);
+  EASTL_ASSERT(::eastl::is_sorted(mid, v.end(), cmp));
+
+  ::eastl::inplace_merge(v.begin(), mid, v.end(), v.get_allocator(), cmp);
+
+  if(unique) {
+    // Stability puts existing elements before new equivalent ones, so the
+    // existing ones are kept, as with single element insert.
+    v.erase(::eastl::unique(v.begin(), v.end(), adjacent_equivalent<Compare>(cmp)), v.end());
+  }
+}
+
+// Binary search for find_as: cmp compares extract_key(element) with u and
+// u with extract_key(element), as the rbtree find_as requires.
+template<class Iterator, class U, class Compare2, class ExtractKey>
+Iterator sorted_find_as(Iterator first, Iterator const last, U const& u,
+                        Compare2 cmp, ExtractKey const extract_key)
+{
+  Iterator const end(last);
+  for(typename ::eastl::iterator_traits<Iterator>::difference_type n = last - first; n > 0;) {
+    typename ::eastl::iterator_traits<Iterator>::difference_type const half = n >> 1;
+    Iterator const mid(first + half);
+    if(cmp(extract_key(*mid), u)) {
+      first = mid + 1;
+      n -= half + 1;
+    }
+    else
+      n = half;
+  }
+  return (first != end && !cmp(u, extract_key(*first)))? first : end;
+}
+
+// Compares the keys of the pairs of a sorted range with a U, in either
+// order, for the transparent lookups; Compare must accept both.
+template<class Pair, class U, class Compare>
+struct transparent_key_compare {
+  explicit transparent_key_compare(Compare const& cmp) : m_cmp(cmp) {}
+
+  bool operator()(Pair const& lhs, U const& rhs) const { return m_cmp(lhs.first, rhs); }
+  bool operator()(U const& lhs, Pair const& rhs) const { return m_cmp(lhs, rhs.first); }
+ private:
+  Compare m_cmp;
+}; // struct transparent_key_compare
+
 } // namespace detail
 
+/// sorted_unique_t
+///
+/// Tag for the constructors and insert overloads of sorted vector containers
+/// which take a range that is already sorted and free of equivalent elements.
+/// Such a range is appended without sorting it first.
+struct sorted_unique_t {};
+const sorted_unique_t sorted_unique = sorted_unique_t();
+
+/// sorted_equivalent_t
+///
+/// The counterpart of sorted_unique_t for the multi containers: the range
+/// is sorted but may hold equivalent elements.
+struct sorted_equivalent_t {};
+const sorted_equivalent_t sorted_equivalent = sorted_equivalent_t();
+
 template<class K, class V, class C = ::eastl::less<K>, class A = EASTLAllocatorType>
 class vector_map {
  public:
@@ -93,11 +175,13 @@ class vector_map {
              key_compare const& cmp = key_compare(),
              allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
       : m_base(alloc), m_cmp(cmp)
-  {
-    ::eastl::map<key_type, mapped_type, key_compare, allocator_type> const tmp(first, last);
-    m_base.reserve(tmp.size());
-    ::eastl::copy(tmp.begin(), tmp.end(), ::eastl::back_inserter(m_base));
-  }
+  { insert(first, last); }
+  template<class InputIterator>
+  vector_map(sorted_unique_t, InputIterator first, InputIterator last,
+             key_compare const& cmp = key_compare(),
+             allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
+      : m_base(alloc), m_cmp(cmp)
+  { insert(sorted_unique, first, last); }
 
   vector_map& operator =(vector_map const& rhs) {
     vector_map(rhs).swap(*this);
@@ -115,6 +199,7 @@ class vector_map {
   const_reverse_iterator rend() const { return m_base.rend(); }
 
   void clear() { m_base.clear(); }
+  void reserve(size_type const n) { m_base.reserve(n); }
 
   bool empty() const { return m_base.empty(); }
   size_type size() const { return m_base.size(); }
@@ -141,8 +226,17 @@ class vector_map {
         ;
   }
   template<class InputIterator>
-  void insert(InputIterator first, InputIterator const last)
-  { for(; first != last; ++first) insert(*first); }
+  void insert(InputIterator first, InputIterator const last) {
+    size_type const n = size();
+    m_base.insert(m_base.end(), first, last);
+    detail::merge_sorted_tail(m_base, n, m_cmp, false, true);
+  }
+  template<class InputIterator>
+  void insert(sorted_unique_t, InputIterator first, InputIterator const last) {
+    size_type const n = size();
+    m_base.insert(m_base.end(), first, last);
+    detail::merge_sorted_tail(m_base, n, m_cmp, true, true);
+  }
 
   void erase(iterator const pos) { m_base.erase(pos); }
   void erase(iterator const first, iterator const last)
@@ -172,6 +266,15 @@ class vector_map {
     const_iterator const i(lower_bound(k));
     return (i != end() && m_cmp(k, i->first))? end() : i;
   }
+  /// Finds with a key of another type, see rbtree::find_as.
+  template<class U, class Compare2>
+  iterator find_as(U const& u, Compare2 cmp) {
+    return detail::sorted_find_as(begin(), end(), u, cmp, ::eastl::use_first<value_type>());
+  }
+  template<class U, class Compare2>
+  const_iterator find_as(U const& u, Compare2 cmp) const {
+    return detail::sorted_find_as(begin(), end(), u, cmp, ::eastl::use_first<value_type>());
+  }
   size_type count(key_type const& k) const { return find(k) != end()? 1 : 0; }
   iterator lower_bound(key_type const& k) {
     return ::eastl::lower_bound(begin(), end(), k, m_cmp);
@@ -193,6 +296,48 @@ class vector_map {
     return ::eastl::equal_range(begin(), end(), k, m_cmp);
   }
 
+  /// Transparent lookup: if key_compare declares is_transparent (as
+  /// less<string> does), these take any type it compares with key_type,
+  /// such as a string_view for string keys, without making a key_type.
+  template<class U>
+  typename enable_if_transparent<key_compare, U, iterator>::type find(U const& u) {
+    iterator const i(lower_bound(u));
+    return (i != end() && key_comp()(u, i->first))? end() : i;
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type find(U const& u) const {
+    const_iterator const i(lower_bound(u));
+    return (i != end() && key_comp()(u, i->first))? end() : i;
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, size_type>::type count(U const& u) const {
+    return find(u) != end()? 1 : 0;
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, iterator>::type lower_bound(U const& u) {
+    return ::eastl::lower_bound(begin(), end(), u, detail::transparent_key_compare<value_type, U, key_compare>(key_comp()));
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type lower_bound(U const& u) const {
+    return ::eastl::lower_bound(begin(), end(), u, detail::transparent_key_compare<value_type, U, key_compare>(key_comp()));
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, iterator>::type upper_bound(U const& u) {
+    return ::eastl::upper_bound(begin(), end(), u, detail::transparent_key_compare<value_type, U, key_compare>(key_comp()));
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type upper_bound(U const& u) const {
+    return ::eastl::upper_bound(begin(), end(), u, detail::transparent_key_compare<value_type, U, key_compare>(key_comp()));
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, ::eastl::pair<iterator, iterator> >::type equal_range(U const& u) {
+    return ::eastl::equal_range(begin(), end(), u, detail::transparent_key_compare<value_type, U, key_compare>(key_comp()));
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, ::eastl::pair<const_iterator, const_iterator> >::type equal_range(U const& u) const {
+    return ::eastl::equal_range(begin(), end(), u, detail::transparent_key_compare<value_type, U, key_compare>(key_comp()));
+  }
+
   template<class Key, class T, class Compare, class Allocator>
   friend bool operator==(vector_map<Key, T, Compare, Allocator> const& lhs,
                          vector_map<Key, T, Compare, Allocator> const& rhs);
@@ -243,6 +388,243 @@ void swap(vector_map<Key, T, Compare, Allocator> const& lhs,
           vector_map<Key, T, Compare, Allocator> const& rhs)
 { return lhs.swap(rhs); }
 
+/// vector_multimap
+///
+/// The vector_map counterpart of multimap: a sorted vector of pairs which
+/// may hold equivalent keys. Elements with equivalent keys keep the order
+/// in which they were inserted, as with multimap.
+template<class K, class V, class C = ::eastl::less<K>, class A = EASTLAllocatorType>
+class vector_multimap {
+ public:
+  typedef K key_type;
+  typedef V mapped_type;
+  typedef ::eastl::pair<key_type, mapped_type> value_type;
+  typedef C key_compare;
+  typedef A allocator_type;
+
+  typedef ::eastl::vector<value_type, allocator_type> base_type;
+ private:
+  base_type m_base;
+  detail::compare_impl<value_type, key_compare> m_cmp;
+ public:
+  typedef typename base_type::iterator iterator;
+  typedef typename base_type::const_iterator const_iterator;
+  typedef typename base_type::reverse_iterator reverse_iterator;
+  typedef typename base_type::const_reverse_iterator const_reverse_iterator;
+
+  typedef typename base_type::size_type size_type;
+  typedef typename base_type::difference_type difference_type;
+
+  typedef typename base_type::reference reference;
+  typedef typename base_type::const_reference const_reference;
+  typedef typename base_type::pointer pointer;
+  typedef typename base_type::const_pointer const_pointer;
+
+  static const size_type kMaxSize = base_type::kMaxSize;
+
+  class value_compare {
+    friend class vector_multimap;
+    key_compare const m_cmp;
+   protected:
+    value_compare(key_compare pred) : m_cmp(pred) {}
+   public:
+    bool operator()(value_type const& lhs, value_type const& rhs) const
+    { return m_cmp(lhs.first, rhs.first); }
+  }; // struct value_compare
+
+  explicit vector_multimap(key_compare const& cmp = key_compare(), allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
+      : m_base(alloc), m_cmp(cmp) {}
+  template<class InputIterator>
+  vector_multimap(InputIterator first, InputIterator last,
+                  key_compare const& cmp = key_compare(),
+                  allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
+      : m_base(alloc), m_cmp(cmp)
+  { insert(first, last); }
+  template<class InputIterator>
+  vector_multimap(sorted_equivalent_t, InputIterator first, InputIterator last,
+                  key_compare const& cmp = key_compare(),
+                  allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
+      : m_base(alloc), m_cmp(cmp)
+  { insert(sorted_equivalent, first, last); }
+
+  vector_multimap& operator =(vector_multimap const& rhs) {
+    vector_multimap(rhs).swap(*this);
+    return *this;
+  }
+
+  iterator begin() { return m_base.begin(); }
+  iterator end() { return m_base.end(); }
+  reverse_iterator rbegin() { return m_base.rbegin(); }
+  reverse_iterator rend() { return m_base.rend(); }
+
+  const_iterator begin() const { return m_base.begin(); }
+  const_iterator end() const { return m_base.end(); }
+  const_reverse_iterator rbegin() const { return m_base.rbegin(); }
+  const_reverse_iterator rend() const { return m_base.rend(); }
+
+  void clear() { m_base.clear(); }
+  void reserve(size_type const n) { m_base.reserve(n); }
+
+  bool empty() const { return m_base.empty(); }
+  size_type size() const { return m_base.size(); }
+  size_type max_size() { return base_type::kMaxSize; }
+
+  iterator insert(value_type const& val) { return m_base.insert(upper_bound(val.first), val); }
+  iterator insert(iterator const pos, value_type const& val) {
+    return
+        ((pos == begin() || !m_cmp(val, *(pos-1))) &&
+         (pos ==   end() || !m_cmp(*pos, val)))
+        ? m_base.insert(pos, val)
+        : insert(val)
+        ;
+  }
+  template<class InputIterator>
+  void insert(InputIterator first, InputIterator const last) {
+    size_type const n = size();
+    m_base.insert(m_base.end(), first, last);
+    detail::merge_sorted_tail(m_base, n, m_cmp, false, false);
+  }
+  template<class InputIterator>
+  void insert(sorted_equivalent_t, InputIterator first, InputIterator const last) {
+    size_type const n = size();
+    m_base.insert(m_base.end(), first, last);
+    detail::merge_sorted_tail(m_base, n, m_cmp, true, false);
+  }
+
+  void erase(iterator const pos) { m_base.erase(pos); }
+  void erase(iterator const first, iterator const last)
+  { m_base.erase(first, last); }
+  size_type erase(key_type const& k) {
+    ::eastl::pair<iterator, iterator> const range(equal_range(k));
+    size_type const n = size_type(range.second - range.first);
+    erase(range.first, range.second);
+    return n;
+  }
+
+  void swap(vector_multimap& other) {
+    m_base.swap(other.m_base);
+    m_cmp.swap(other.m_cmp);
+  }
+
+  allocator_type& get_allocator() { return m_base.get_allocator(); }
+  void set_allocator(allocator_type const& alloc) { m_base.set_allocator(alloc); }
+
+  key_compare key_comp() const { return static_cast<key_compare>(m_cmp); }
+  value_compare value_comp() const { return value_compare(m_cmp); }
+
+  /// Finds the first element with the key k.
+  iterator find(key_type const& k) {
+    iterator const i(lower_bound(k));
+    return (i != end() && m_cmp(k, i->first))? end() : i;
+  }
+  const_iterator find(key_type const& k) const {
+    const_iterator const i(lower_bound(k));
+    return (i != end() && m_cmp(k, i->first))? end() : i;
+  }
+  template<class U, class Compare2>
+  iterator find_as(U const& u, Compare2 cmp) {
+    return detail::sorted_find_as(begin(), end(), u, cmp, ::eastl::use_first<value_type>());
+  }
+  template<class U, class Compare2>
+  const_iterator find_as(U const& u, Compare2 cmp) const {
+    return detail::sorted_find_as(begin(), end(), u, cmp, ::eastl::use_first<value_type>());
+  }
+  size_type count(key_type const& k) const {
+    ::eastl::pair<const_iterator, const_iterator> const range(equal_range(k));
+    return size_type(range.second - range.first);
+  }
+  iterator lower_bound(key_type const& k) {
+    return ::eastl::lower_bound(begin(), end(), k, m_cmp);
+  }
+  const_iterator lower_bound(key_type const& k) const {
+    return ::eastl::lower_bound(begin(), end(), k, m_cmp);
+  }
+  iterator upper_bound(key_type const& k) {
+    return ::eastl::upper_bound(begin(), end(), k, m_cmp);
+  }
+  const_iterator upper_bound(key_type const& k) const {
+    return ::eastl::upper_bound(begin(), end(), k, m_cmp);
+  }
+
+  ::eastl::pair<iterator, iterator> equal_range(key_type const& k) {
+    return ::eastl::equal_range(begin(), end(), k, m_cmp);
+  }
+  ::eastl::pair<const_iterator, const_iterator> equal_range(key_type const& k) const {
+    return ::eastl::equal_range(begin(), end(), k, m_cmp);
+  }
+
+  /// Transparent lookup, as with vector_map.
+  template<class U>
+  typename enable_if_transparent<key_compare, U, iterator>::type find(U const& u) {
+    iterator const i(lower_bound(u));
+    return (i != end() && key_comp()(u, i->first))? end() : i;
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type find(U const& u) const {
+    const_iterator const i(lower_bound(u));
+    return (i != end() && key_comp()(u, i->first))? end() : i;
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, size_type>::type count(U const& u) const {
+    ::eastl::pair<const_iterator, const_iterator> const range(equal_range(u));
+    return size_type(range.second - range.first);
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, iterator>::type lower_bound(U const& u) {
+    return ::eastl::lower_bound(begin(), end(), u, detail::transparent_key_compare<value_type, U, key_compare>(key_comp()));
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type lower_bound(U const& u) const {
+    return ::eastl::lower_bound(begin(), end(), u, detail::transparent_key_compare<value_type, U, key_compare>(key_comp()));
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, iterator>::type upper_bound(U const& u) {
+    return ::eastl::upper_bound(begin(), end(), u, detail::transparent_key_compare<value_type, U, key_compare>(key_comp()));
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type upper_bound(U const& u) const {
+    return ::eastl::upper_bound(begin(), end(), u, detail::transparent_key_compare<value_type, U, key_compare>(key_comp()));
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, ::eastl::pair<iterator, iterator> >::type equal_range(U const& u) {
+    return ::eastl::equal_range(begin(), end(), u, detail::transparent_key_compare<value_type, U, key_compare>(key_comp()));
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, ::eastl::pair<const_iterator, const_iterator> >::type equal_range(U const& u) const {
+    return ::eastl::equal_range(begin(), end(), u, detail::transparent_key_compare<value_type, U, key_compare>(key_comp()));
+  }
+}; // class vector_multimap
+
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator==(vector_multimap<Key, T, Compare, Allocator> const& lhs,
+                       vector_multimap<Key, T, Compare, Allocator> const& rhs)
+{ return (lhs.size() == rhs.size()) && ::eastl::equal(lhs.begin(), lhs.end(), rhs.begin()); }
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator!=(vector_multimap<Key, T, Compare, Allocator> const& lhs,
+                       vector_multimap<Key, T, Compare, Allocator> const& rhs)
+{ return !(lhs == rhs); }
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator<(vector_multimap<Key, T, Compare, Allocator> const& lhs,
+                      vector_multimap<Key, T, Compare, Allocator> const& rhs)
+{ return ::eastl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); }
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator>(vector_multimap<Key, T, Compare, Allocator> const& lhs,
+                      vector_multimap<Key, T, Compare, Allocator> const& rhs)
+{ return rhs < lhs; }
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator>=(vector_multimap<Key, T, Compare, Allocator> const& lhs,
+                       vector_multimap<Key, T, Compare, Allocator> const& rhs)
+{ return !(lhs < rhs); }
+template<class Key, class T, class Compare, class Allocator>
+inline bool operator<=(vector_multimap<Key, T, Compare, Allocator> const& lhs,
+                       vector_multimap<Key, T, Compare, Allocator> const& rhs)
+{ return !(rhs < lhs); }
+
+template<class Key, class T, class Compare, class Allocator>
+void swap(vector_multimap<Key, T, Compare, Allocator>& lhs,
+          vector_multimap<Key, T, Compare, Allocator>& rhs)
+{ lhs.swap(rhs); }
+
 } // namespace eastl
 
 #endif // EASTL_VECTOR_MAP_H
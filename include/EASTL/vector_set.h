@@ -0,0 +1,405 @@
+#ifndef EASTL_VECTOR_SET_H
+#define EASTL_VECTOR_SET_H
+
+#include <EASTL/internal/config.h>
+
+#include <EASTL/algorithm.h>
+#include <EASTL/allocator.h>
+#include <EASTL/functional.h>
+#include <EASTL/iterator.h>
+#include <EASTL/utility.h>
+#include <EASTL/vector.h>
+#include <EASTL/vector_map.h>
+
+
+namespace eastl {
+
+/// vector_set
+///
+/// The vector_map counterpart of set: a sorted vector of unique keys.
+/// As with set, iterators are constant, since changing an element could
+/// break the order.
+template<class K, class C = ::eastl::less<K>, class A = EASTLAllocatorType>
+class vector_set {
+ public:
+  typedef K key_type;
+  typedef K value_type;
+  typedef C key_compare;
+  typedef C value_compare;
+  typedef A allocator_type;
+
+  typedef ::eastl::vector<value_type, allocator_type> base_type;
+ private:
+  base_type m_base;
+  key_compare m_cmp;
+ public:
+  typedef typename base_type::const_iterator iterator;
+  typedef typename base_type::const_iterator const_iterator;
+  typedef typename base_type::const_reverse_iterator reverse_iterator;
+  typedef typename base_type::const_reverse_iterator const_reverse_iterator;
+
+  typedef typename base_type::size_type size_type;
+  typedef typename base_type::difference_type difference_type;
+
+  typedef typename base_type::const_reference reference;
+  typedef typename base_type::const_reference const_reference;
+  typedef typename base_type::const_pointer pointer;
+  typedef typename base_type::const_pointer const_pointer;
+
+  static const size_type kMaxSize = base_type::kMaxSize;
+
+  explicit vector_set(key_compare const& cmp = key_compare(), allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
+      : m_base(alloc), m_cmp(cmp) {}
+  template<class InputIterator>
+  vector_set(InputIterator first, InputIterator last,
+             key_compare const& cmp = key_compare(),
+             allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
+      : m_base(alloc), m_cmp(cmp)
+  { insert(first, last); }
+  template<class InputIterator>
+  vector_set(sorted_unique_t, InputIterator first, InputIterator last,
+             key_compare const& cmp = key_compare(),
+             allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
+      : m_base(alloc), m_cmp(cmp)
+  { insert(sorted_unique, first, last); }
+
+  vector_set& operator =(vector_set const& rhs) {
+    vector_set(rhs).swap(*this);
+    return *this;
+  }
+
+  const_iterator begin() const { return m_base.begin(); }
+  const_iterator end() const { return m_base.end(); }
+  const_reverse_iterator rbegin() const { return m_base.rbegin(); }
+  const_reverse_iterator rend() const { return m_base.rend(); }
+
+  void clear() { m_base.clear(); }
+  void reserve(size_type const n) { m_base.reserve(n); }
+
+  bool empty() const { return m_base.empty(); }
+  size_type size() const { return m_base.size(); }
+  size_type max_size() { return base_type::kMaxSize; }
+
+  ::eastl::pair<iterator, bool> insert(value_type const& val) {
+    iterator const i(lower_bound(val));
+
+    return (i == end() || m_cmp(val, *i))
+        ? ::eastl::make_pair(iterator(m_base.insert(mutable_iterator(i), val)), true)
+        : ::eastl::make_pair(i, false)
+        ;
+  }
+  iterator insert(iterator const pos, value_type const& val) {
+    return
+        ((pos == begin() || m_cmp(*(pos-1), val)) &&
+         (pos ==   end() || m_cmp(val, *pos)))
+        ? m_base.insert(mutable_iterator(pos), val)
+        : insert(val).first
+        ;
+  }
+  template<class InputIterator>
+  void insert(InputIterator first, InputIterator const last) {
+    size_type const n = size();
+    m_base.insert(m_base.end(), first, last);
+    detail::merge_sorted_tail(m_base, n, m_cmp, false, true);
+  }
+  template<class InputIterator>
+  void insert(sorted_unique_t, InputIterator first, InputIterator const last) {
+    size_type const n = size();
+    m_base.insert(m_base.end(), first, last);
+    detail::merge_sorted_tail(m_base, n, m_cmp, true, true);
+  }
+
+  void erase(iterator const pos) { m_base.erase(mutable_iterator(pos)); }
+  void erase(iterator const first, iterator const last)
+  { m_base.erase(mutable_iterator(first), mutable_iterator(last)); }
+  size_type erase(key_type const& k) {
+    iterator const i(find(k));
+    if(i == end()) return 0;
+    else { erase(i); return 1; }
+  }
+
+  void swap(vector_set& other) {
+    m_base.swap(other.m_base);
+    ::eastl::swap(m_cmp, other.m_cmp);
+  }
+
+  allocator_type& get_allocator() { return m_base.get_allocator(); }
+  void set_allocator(allocator_type const& alloc) { m_base.set_allocator(alloc); }
+
+  key_compare key_comp() const { return m_cmp; }
+  value_compare value_comp() const { return m_cmp; }
+
+  const_iterator find(key_type const& k) const {
+    const_iterator const i(lower_bound(k));
+    return (i != end() && m_cmp(k, *i))? end() : i;
+  }
+  /// Finds with a key of another type, see rbtree::find_as.
+  template<class U, class Compare2>
+  const_iterator find_as(U const& u, Compare2 cmp) const {
+    return detail::sorted_find_as(begin(), end(), u, cmp, ::eastl::use_self<value_type>());
+  }
+  size_type count(key_type const& k) const { return find(k) != end()? 1 : 0; }
+  const_iterator lower_bound(key_type const& k) const {
+    return ::eastl::lower_bound(begin(), end(), k, m_cmp);
+  }
+  const_iterator upper_bound(key_type const& k) const {
+    return ::eastl::upper_bound(begin(), end(), k, m_cmp);
+  }
+  ::eastl::pair<const_iterator, const_iterator> equal_range(key_type const& k) const {
+    return ::eastl::equal_range(begin(), end(), k, m_cmp);
+  }
+
+  /// Transparent lookup, as with vector_map. The elements are the keys,
+  /// so key_compare compares them with a U directly.
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type find(U const& u) const {
+    const_iterator const i(lower_bound(u));
+    return (i != end() && m_cmp(u, *i))? end() : i;
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, size_type>::type count(U const& u) const {
+    return find(u) != end()? 1 : 0;
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type lower_bound(U const& u) const {
+    return ::eastl::lower_bound(begin(), end(), u, m_cmp);
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type upper_bound(U const& u) const {
+    return ::eastl::upper_bound(begin(), end(), u, m_cmp);
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, ::eastl::pair<const_iterator, const_iterator> >::type equal_range(U const& u) const {
+    return ::eastl::equal_range(begin(), end(), u, m_cmp);
+  }
+ private:
+  typename base_type::iterator mutable_iterator(const_iterator const i)
+  { return m_base.begin() + (i - m_base.begin()); }
+}; // class vector_set
+
+
+/// vector_multiset
+///
+/// The vector_map counterpart of multiset: a sorted vector of keys which
+/// may hold equivalent ones, kept in the order in which they were inserted.
+template<class K, class C = ::eastl::less<K>, class A = EASTLAllocatorType>
+class vector_multiset {
+ public:
+  typedef K key_type;
+  typedef K value_type;
+  typedef C key_compare;
+  typedef C value_compare;
+  typedef A allocator_type;
+
+  typedef ::eastl::vector<value_type, allocator_type> base_type;
+ private:
+  base_type m_base;
+  key_compare m_cmp;
+ public:
+  typedef typename base_type::const_iterator iterator;
+  typedef typename base_type::const_iterator const_iterator;
+  typedef typename base_type::const_reverse_iterator reverse_iterator;
+  typedef typename base_type::const_reverse_iterator const_reverse_iterator;
+
+  typedef typename base_type::size_type size_type;
+  typedef typename base_type::difference_type difference_type;
+
+  typedef typename base_type::const_reference reference;
+  typedef typename base_type::const_reference const_reference;
+  typedef typename base_type::const_pointer pointer;
+  typedef typename base_type::const_pointer const_pointer;
+
+  static const size_type kMaxSize = base_type::kMaxSize;
+
+  explicit vector_multiset(key_compare const& cmp = key_compare(), allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
+      : m_base(alloc), m_cmp(cmp) {}
+  template<class InputIterator>
+  vector_multiset(InputIterator first, InputIterator last,
+                  key_compare const& cmp = key_compare(),
+                  allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
+      : m_base(alloc), m_cmp(cmp)
+  { insert(first, last); }
+  template<class InputIterator>
+  vector_multiset(sorted_equivalent_t, InputIterator first, InputIterator last,
+                  key_compare const& cmp = key_compare(),
+                  allocator_type const& alloc = EASTL_VECTOR_DEFAULT_ALLOCATOR)
+      : m_base(alloc), m_cmp(cmp)
+  { insert(sorted_equivalent, first, last); }
+
+  vector_multiset& operator =(vector_multiset const& rhs) {
+    vector_multiset(rhs).swap(*this);
+    return *this;
+  }
+
+  const_iterator begin() const { return m_base.begin(); }
+  const_iterator end() const { return m_base.end(); }
+  const_reverse_iterator rbegin() const { return m_base.rbegin(); }
+  const_reverse_iterator rend() const { return m_base.rend(); }
+
+  void clear() { m_base.clear(); }
+  void reserve(size_type const n) { m_base.reserve(n); }
+
+  bool empty() const { return m_base.empty(); }
+  size_type size() const { return m_base.size(); }
+  size_type max_size() { return base_type::kMaxSize; }
+
+  iterator insert(value_type const& val)
+  { return m_base.insert(mutable_iterator(upper_bound(val)), val); }
+  iterator insert(iterator const pos, value_type const& val) {
+    return
+        ((pos == begin() || !m_cmp(val, *(pos-1))) &&
+         (pos ==   end() || !m_cmp(*pos, val)))
+        ? m_base.insert(mutable_iterator(pos), val)
+        : insert(val)
+        ;
+  }
+  template<class InputIterator>
+  void insert(InputIterator first, InputIterator const last) {
+    size_type const n = size();
+    m_base.insert(m_base.end(), first, last);
+    detail::merge_sorted_tail(m_base, n, m_cmp, false, false);
+  }
+  template<class InputIterator>
+  void insert(sorted_equivalent_t, InputIterator first, InputIterator const last) {
+    size_type const n = size();
+    m_base.insert(m_base.end(), first, last);
+    detail::merge_sorted_tail(m_base, n, m_cmp, true, false);
+  }
+
+  void erase(iterator const pos) { m_base.erase(mutable_iterator(pos)); }
+  void erase(iterator const first, iterator const last)
+  { m_base.erase(mutable_iterator(first), mutable_iterator(last)); }
+  size_type erase(key_type const& k) {
+    ::eastl::pair<iterator, iterator> const range(equal_range(k));
+    size_type const n = size_type(range.second - range.first);
+    erase(range.first, range.second);
+    return n;
+  }
+
+  void swap(vector_multiset& other) {
+    m_base.swap(other.m_base);
+    ::eastl::swap(m_cmp, other.m_cmp);
+  }
+
+  allocator_type& get_allocator() { return m_base.get_allocator(); }
+  void set_allocator(allocator_type const& alloc) { m_base.set_allocator(alloc); }
+
+  key_compare key_comp() const { return m_cmp; }
+  value_compare value_comp() const { return m_cmp; }
+
+  /// Finds the first element equivalent to k.
+  const_iterator find(key_type const& k) const {
+    const_iterator const i(lower_bound(k));
+    return (i != end() && m_cmp(k, *i))? end() : i;
+  }
+  template<class U, class Compare2>
+  const_iterator find_as(U const& u, Compare2 cmp) const {
+    return detail::sorted_find_as(begin(), end(), u, cmp, ::eastl::use_self<value_type>());
+  }
+  size_type count(key_type const& k) const {
+    ::eastl::pair<const_iterator, const_iterator> const range(equal_range(k));
+    return size_type(range.second - range.first);
+  }
+  const_iterator lower_bound(key_type const& k) const {
+    return ::eastl::lower_bound(begin(), end(), k, m_cmp);
+  }
+  const_iterator upper_bound(key_type const& k) const {
+    return ::eastl::upper_bound(begin(), end(), k, m_cmp);
+  }
+  ::eastl::pair<const_iterator, const_iterator> equal_range(key_type const& k) const {
+    return ::eastl::equal_range(begin(), end(), k, m_cmp);
+  }
+
+  /// Transparent lookup, as with vector_set.
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type find(U const& u) const {
+    const_iterator const i(lower_bound(u));
+    return (i != end() && m_cmp(u, *i))? end() : i;
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, size_type>::type count(U const& u) const {
+    ::eastl::pair<const_iterator, const_iterator> const range(equal_range(u));
+    return size_type(range.second - range.first);
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type lower_bound(U const& u) const {
+    return ::eastl::lower_bound(begin(), end(), u, m_cmp);
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, const_iterator>::type upper_bound(U const& u) const {
+    return ::eastl::upper_bound(begin(), end(), u, m_cmp);
+  }
+  template<class U>
+  typename enable_if_transparent<key_compare, U, ::eastl::pair<const_iterator, const_iterator> >::type equal_range(U const& u) const {
+    return ::eastl::equal_range(begin(), end(), u, m_cmp);
+  }
+ private:
+  typename base_type::iterator mutable_iterator(const_iterator const i)
+  { return m_base.begin() + (i - m_base.begin()); }
+}; // class vector_multiset
+
+
+template<class Key, class Compare, class Allocator>
+inline bool operator==(vector_set<Key, Compare, Allocator> const& lhs,
+                       vector_set<Key, Compare, Allocator> const& rhs)
+{ return (lhs.size() == rhs.size()) && ::eastl::equal(lhs.begin(), lhs.end(), rhs.begin()); }
+template<class Key, class Compare, class Allocator>
+inline bool operator!=(vector_set<Key, Compare, Allocator> const& lhs,
+                       vector_set<Key, Compare, Allocator> const& rhs)
+{ return !(lhs == rhs); }
+template<class Key, class Compare, class Allocator>
+inline bool operator<(vector_set<Key, Compare, Allocator> const& lhs,
+                      vector_set<Key, Compare, Allocator> const& rhs)
+{ return ::eastl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); }
+template<class Key, class Compare, class Allocator>
+inline bool operator>(vector_set<Key, Compare, Allocator> const& lhs,
+                      vector_set<Key, Compare, Allocator> const& rhs)
+{ return rhs < lhs; }
+template<class Key, class Compare, class Allocator>
+inline bool operator>=(vector_set<Key, Compare, Allocator> const& lhs,
+                       vector_set<Key, Compare, Allocator> const& rhs)
+{ return !(lhs < rhs); }
+template<class Key, class Compare, class Allocator>
+inline bool operator<=(vector_set<Key, Compare, Allocator> const& lhs,
+                       vector_set<Key, Compare, Allocator> const& rhs)
+{ return !(rhs < lhs); }
+
+template<class Key, class Compare, class Allocator>
+void swap(vector_set<Key, Compare, Allocator>& lhs,
+          vector_set<Key, Compare, Allocator>& rhs)
+{ lhs.swap(rhs); }
+
+
+template<class Key, class Compare, class Allocator>
+inline bool operator==(vector_multiset<Key, Compare, Allocator> const& lhs,
+                       vector_multiset<Key, Compare, Allocator> const& rhs)
+{ return (lhs.size() == rhs.size()) && ::eastl::equal(lhs.begin(), lhs.end(), rhs.begin()); }
+template<class Key, class Compare, class Allocator>
+inline bool operator!=(vector_multiset<Key, Compare, Allocator> const& lhs,
+                       vector_multiset<Key, Compare, Allocator> const& rhs)
+{ return !(lhs == rhs); }
+template<class Key, class Compare, class Allocator>
+inline bool operator<(vector_multiset<Key, Compare, Allocator> const& lhs,
+                      vector_multiset<Key, Compare, Allocator> const& rhs)
+{ return ::eastl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); }
+template<class Key, class Compare, class Allocator>
+inline bool operator>(vector_multiset<Key, Compare, Allocator> const& lhs,
+                      vector_multiset<Key, Compare, Allocator> const& rhs)
+{ return rhs < lhs; }
+template<class Key, class Compare, class Allocator>
+inline bool operator>=(vector_multiset<Key, Compare, Allocator> const& lhs,
+                       vector_multiset<Key, Compare, Allocator> const& rhs)
+{ return !(lhs < rhs); }
+template<class Key, class Compare, class Allocator>
+inline bool operator<=(vector_multiset<Key, Compare, Allocator> const& lhs,
+                       vector_multiset<Key, Compare, Allocator> const& rhs)
+{ return !(rhs < lhs); }
+
+template<class Key, class Compare, class Allocator>
+void swap(vector_multiset<Key, Compare, Allocator>& lhs,
+          vector_multiset<Key, Compare, Allocator>& rhs)
+{ lhs.swap(rhs); }
+
+} // namespace eastl
+
+#endif // EASTL_VECTOR_SET_H
@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////
+// EASTL/mmap_allocator.cpp
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE // For mremap. This must precede any system header.
+#endif
+
+#include <EASTL/internal/config.h>
+#include <EASTL/mmap_allocator.h>
+#include <string.h>
+
+#if defined(EA_PLATFORM_UNIX) || defined(EA_PLATFORM_OSX)
+    #include <sys/mman.h>
+    #include <unistd.h>
+    #define EASTL_MMAP_ALLOCATOR_USE_MMAP 1
+    #if defined(EA_PLATFORM_LINUX) && defined(MREMAP_MAYMOVE)
+        #define EASTL_MMAP_ALLOCATOR_USE_MREMAP 1
+    #else
+        #define EASTL_MMAP_ALLOCATOR_USE_MREMAP 0
+    #endif
+#else
+    #include <stdlib.h>
+    #define EASTL_MMAP_ALLOCATOR_USE_MMAP   0
+    #define EASTL_MMAP_ALLOCATOR_USE_MREMAP 0
+#endif
+
+
+namespace eastl
+{
+
+    #if EASTL_MMAP_ALLOCATOR_USE_MMAP
+        static inline size_t RoundToPageSize(size_t n)
+        {
+            const size_t nPageSize = mmap_allocator::get_page_size();
+            return (n + (nPageSize - 1)) & ~(nPageSize - 1);
+        }
+    #endif
+
+
+    size_t mmap_allocator::get_page_size()
+    {
+        #if EASTL_MMAP_ALLOCATOR_USE_MMAP
+            static size_t nPageSize = 0;
+
+            if(nPageSize == 0) // Benign race; every thread computes the same value.
+            {
+                const long result = sysconf(_SC_PAGESIZE);
+                nPageSize = (result > 0) ? (size_t)result : 4096;
+            }
+            return nPageSize;
+        #else
+            return 4096;
+        #endif
+    }
+
+
+    void* mmap_allocator::allocate(size_t n, int /*flags*/)
+    {
+        #if EASTL_MMAP_ALLOCATOR_USE_MMAP
+            void* const p = mmap(NULL, RoundToPageSize(n), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+            return (p == MAP_FAILED) ? NULL : p;
+        #else
+            return malloc(n);
+        #endif
+    }
+
+
+    void* mmap_allocator::allocate(size_t n, size_t alignment, size_t offset, int flags)
+    {
+        // Blocks are page-aligned, which satisfies any alignment up to the page size.
+        EASTL_ASSERT((alignment <= get_page_size()) && (offset == 0));
+        (void)alignment; (void)offset;
+
+        #if !EASTL_MMAP_ALLOCATOR_USE_MMAP
+            EASTL_ASSERT(alignment <= 8); // 8 (sizeof(double)) is the alignment we can count on from malloc.
+        #endif
+
+        return allocate(n, flags);
+    }
+
+
+    void* mmap_allocator::reallocate(void* p, size_t prevSize, size_t n, int flags)
+    {
+        if(!p)
+            return allocate(n, flags);
+
+        #if EASTL_MMAP_ALLOCATOR_USE_MMAP
+            const size_t nPrevSizeRounded = RoundToPageSize(prevSize);
+            const size_t nSizeRounded     = RoundToPageSize(n);
+
+            if(nSizeRounded == nPrevSizeRounded)
+                return p;
+
+            if(nSizeRounded < nPrevSizeRounded) // Shrinking is always done in place.
+            {
+                if(nSizeRounded)
+                    munmap((char*)p + nSizeRounded, nPrevSizeRounded - nSizeRounded);
+                else
+                    munmap(p, nPrevSizeRounded);
+                return nSizeRounded ? p : NULL;
+            }
+
+            #if EASTL_MMAP_ALLOCATOR_USE_MREMAP
+                void* const pNew = mremap(p, nPrevSizeRounded, nSizeRounded, MREMAP_MAYMOVE);
+                return (pNew == MAP_FAILED) ? NULL : pNew;
+            #else
+                void* const pNew = allocate(n, flags);
+                if(pNew)
+                {
+                    memcpy(pNew, p, prevSize);
+                    munmap(p, nPrevSizeRounded);
+                }
+                return pNew;
+            #endif
+        #else
+            (void)prevSize;
+            return realloc(p, n);
+        #endif
+    }
+
+
+    void mmap_allocator::deallocate(void* p, size_t n)
+    {
+        #if EASTL_MMAP_ALLOCATOR_USE_MMAP
+            if(p)
+                munmap(p, RoundToPageSize(n));
+        #else
+            (void)n;
+            free(p);
+        #endif
+    }
+
+
+} // namespace eastl
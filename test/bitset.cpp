@@ -0,0 +1,66 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <iostream>
+
+#include <EASTL/bitset.h>
+
+
+static void bit_functions() {
+  std::cout << "bit_functions:" << std::endl;
+
+  assert(eastl::BitsetCountBits(eastl::BitsetWordType(0)) == 0);
+  assert(eastl::BitsetCountBits(~eastl::BitsetWordType(0)) == eastl::kBitsPerWord);
+  assert(eastl::GetFirstBit(eastl::BitsetWordType(0)) == eastl::kBitsPerWord);
+  assert(eastl::GetLastBit(eastl::BitsetWordType(0)) == eastl::kBitsPerWord);
+
+  for (unsigned i = 0; i < eastl::kBitsPerWord; ++i) {
+    eastl::BitsetWordType const bit = eastl::BitsetWordType(1) << i;
+    assert(eastl::GetFirstBit(bit) == i && eastl::GetLastBit(bit) == i);
+    assert(eastl::GetFirstBit(~eastl::BitsetWordType(0) << i) == i);
+    assert(eastl::GetLastBit(bit | 1) == i && eastl::BitsetCountBits(bit | 1) == (i ? 2u : 1u));
+  }
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+template<class Bits>
+static void check_finds(size_t const* set, int n) {
+  Bits b;
+  for (int i = 0; i < n; ++i) { b.set(set[i]); }
+  assert(b.count() == size_t(n));
+
+  size_t pos = b.find_first();
+  for (int i = 0; i < n; ++i, pos = b.find_next(pos)) { assert(pos == set[i]); }
+  assert(pos == b.size());
+
+  pos = b.find_last();
+  for (int i = n - 1; i >= 0; --i, pos = b.find_prev(pos)) { assert(pos == set[i]); }
+  assert(pos == b.size());
+}
+
+static void large() {
+  std::cout << "large:" << std::endl;
+
+  size_t const small[] = { 0, 5, 31, 32, 63, 64, 99 };
+  check_finds<eastl::bitset<100> >(small, 7);
+  check_finds<eastl::bitset<64> >(small, 5);
+  check_finds<eastl::bitset<32> >(small, 3);
+
+  size_t const big[] = { 1, 64, 1000, 4095, 4096, 30000, 65535 };
+  check_finds<eastl::bitset<65536> >(big, 7);
+
+  eastl::bitset<65536> a, b;
+  for (size_t i = 0; i < a.size(); i += 3) { a.set(i); }
+  for (size_t i = 0; i < b.size(); i += 5) { b.set(i); }
+  assert((a & b).count() == 4370 && (a | b).count() == 21846 + 13108 - 4370);
+  a ^= b;
+  assert(a.count() == 21846 + 13108 - 2 * 4370);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  bit_functions();
+  large();
+}
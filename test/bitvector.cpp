@@ -0,0 +1,83 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <iostream>
+
+#include <EASTL/bitvector.h>
+
+
+typedef eastl::bitvector<> bits;
+
+
+static void basics() {
+  std::cout << "basics:" << std::endl;
+
+  bits b(70, true);
+  assert(b.size() == 70 && b.count() == 70 && b.all() && b.validate());
+  b.resize(130, false);
+  b.resize(200, true);
+  assert(b.count() == 140 && !b.test(70) && b.test(130) && b.validate());
+  b.resize(65);
+  assert(b.count() == 65 && b.word_count() == 2 && b.validate());
+
+  b.reset().set(3).set(64).flip(100 % 65);
+  assert(b.count() == 3 && b[3] && b[35] && b[64] && !b[4]);
+  b.push_back(true);
+  b.push_back(false);
+  assert(b.size() == 67 && b.test(65) && !b.test(66));
+  b.pop_back();
+  b.pop_back();
+  b.pop_back();
+  assert(b.size() == 64 && b.word_count() == 1 && b.count() == 2 && b.validate());
+
+  b.flip();
+  assert(b.count() == 62 && b.validate());
+  bits const copy(b);
+  assert(copy == b);
+  b.flip(0);
+  assert(copy != b);
+  b.clear();
+  assert(b.empty() && b.none());
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void words() {
+  std::cout << "words:" << std::endl;
+
+  // Long enough for the SIMD loops and a scalar tail.
+  bits a(1000), b(1000);
+  for (bits::size_type i = 0; i < 1000; i += 3) { a.set(i); }
+  for (bits::size_type i = 0; i < 1000; i += 5) { b.set(i); }
+
+  assert((a & b).count() == 67);
+  assert((a | b).count() == 334 + 200 - 67);
+  assert((a ^ b).count() == 334 + 200 - 2 * 67);
+  bits c(a);
+  c.and_not(b);
+  assert(c.count() == 334 - 67 && !c.test(15) && c.test(3) && c.validate());
+
+  assert(a.find_first() == 0 && a.find_next(0) == 3 && a.find_next(998) == 999 && a.find_next(999) == 1000);
+  assert(a.find_last() == 999 && a.find_prev(999) == 996 && a.find_prev(0) == 1000);
+
+  bits sparse(500);
+  sparse.set(0).set(63).set(64).set(300).set(499);
+  bits::size_type const expected[] = { 0, 63, 64, 300, 499 };
+  int n = 0;
+  for (bits::set_bit_iterator i = sparse.set_bits_begin(); i != sparse.set_bits_end(); ++i) {
+    assert(*i == expected[n]);
+    ++n;
+  }
+  assert(n == 5);
+  assert(sparse.find_next(64) == 300 && sparse.find_prev(300) == 64);
+
+  bits const empty(300);
+  assert(empty.set_bits_begin() == empty.set_bits_end() && empty.find_first() == 300);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  basics();
+  words();
+}
@@ -0,0 +1,139 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <iostream>
+
+#include <EASTL/bloom_filter.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+
+static unsigned next(unsigned& seed) {
+  seed = seed * 1103515245u + 12345u;
+  return seed;
+}
+
+static void basic() {
+  std::cout << "basic:" << std::endl;
+
+  // No false negatives, and a measured rate close to the requested one.
+  double const rates[] = { 0.1, 0.01, 0.001 };
+  for (int r = 0; r < 3; ++r) {
+    eastl::bloom_filter<unsigned> filter(20000, rates[r]);
+    assert(filter.validate() && filter.hash_count() >= 1);
+    for (unsigned i = 0; i < 20000; ++i) { filter.insert(i * 2); }
+    assert(filter.size() == 20000);
+    unsigned missing = 0, positives = 0;
+    for (unsigned i = 0; i < 20000; ++i) {
+      missing += filter.contains(i * 2) ? 0 : 1;
+      positives += filter.contains(i * 2 + 1) ? 1 : 0;
+    }
+    double const measured = positives / 20000.0;
+    assert(missing == 0);
+    assert(measured < rates[r] * 1.5 + 0.0005);
+    assert(filter.false_positive_rate() <= rates[r]);
+  }
+
+  // Strings go through eastl::hash<string>.
+  eastl::bloom_filter<eastl::string> strings(100, 0.01);
+  strings.insert(eastl::string("alpha"));
+  strings.insert(eastl::string("beta"));
+  assert(strings.contains(eastl::string("alpha")) && strings.contains(eastl::string("beta")));
+
+  eastl::bloom_filter<eastl::string> other;
+  assert(!other.contains(eastl::string("alpha")) && other.validate());
+  other.swap(strings);
+  assert(other.contains(eastl::string("alpha")) && strings.size() == 0);
+  other.clear();
+  assert(!other.contains(eastl::string("alpha")) && other.size() == 0);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+// Returns blocks at a different offset from a 64-byte boundary each time, so
+// that a copied filter's blocks are never at the same index as the original's.
+class shifting_allocator : public eastl::allocator {
+public:
+  shifting_allocator(const char* name = NULL) : eastl::allocator(name) {}
+
+  void* allocate(size_t n, int flags = 0) {
+    static size_t shift = 0;
+    shift = (shift + 1) % 8;
+    char* const p = static_cast<char*>(eastl::allocator::allocate(n + 64, flags)) + 8 + (shift * 8);
+    reinterpret_cast<size_t*>(p)[-1] = shift;
+    return p;
+  }
+  void* allocate(size_t n, size_t, size_t, int flags = 0) { return allocate(n, flags); }
+  void deallocate(void* p, size_t n) {
+    size_t const shift = static_cast<size_t*>(p)[-1];
+    eastl::allocator::deallocate(static_cast<char*>(p) - 8 - (shift * 8), n + 64);
+  }
+};
+
+inline bool operator==(shifting_allocator const&, shifting_allocator const&) { return true; }
+inline bool operator!=(shifting_allocator const&, shifting_allocator const&) { return false; }
+
+static void copy() {
+  std::cout << "copy:" << std::endl;
+
+  typedef eastl::bloom_filter<unsigned, eastl::hash<unsigned>, shifting_allocator> filter_type;
+
+  filter_type original(3000, 0.01);
+  for (unsigned i = 0; i < 3000; ++i) { original.insert(i * 7); }
+
+  filter_type copied(original);
+  filter_type assigned;
+  assigned = original;
+  filter_type reassigned(10, 0.5);
+  reassigned.insert(1u);
+  reassigned = copied;
+  assert(copied.validate() && assigned.validate() && reassigned.validate());
+  assert(copied.size() == 3000 && assigned.size() == 3000 && reassigned.size() == 3000);
+
+  unsigned missing = 0;
+  for (unsigned i = 0; i < 3000; ++i) {
+    missing += copied.contains(i * 7) ? 0 : 1;
+    missing += assigned.contains(i * 7) ? 0 : 1;
+    missing += reassigned.contains(i * 7) ? 0 : 1;
+  }
+  assert(missing == 0);
+
+  // The copies hold the same bits, so they answer every query alike.
+  for (unsigned i = 0; i < 3000; ++i) {
+    bool const expected = original.contains(i * 7 + 1);
+    assert(copied.contains(i * 7 + 1) == expected && reassigned.contains(i * 7 + 1) == expected);
+  }
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void batch() {
+  std::cout << "batch:" << std::endl;
+
+  eastl::vector<unsigned> values;
+  unsigned seed = 1;
+  for (int i = 0; i < 5000; ++i) { values.push_back(next(seed)); }
+
+  eastl::bloom_filter<unsigned> a(5000, 0.05), b(5000, 0.05);
+  a.insert(values.begin(), values.begin() + 2500);
+  b.insert(values.begin() + 2500, values.end());
+  a |= b;
+  assert(a.size() == 5000);
+
+  for (int i = 0; i < 5000; ++i) { values.push_back(next(seed)); }
+  eastl::vector<bool> results(values.size());
+  eastl::vector<bool>::iterator const end = a.contains(values.begin(), values.end(), results.begin());
+  assert(end == results.end());
+  for (eastl_size_t i = 0; i < values.size(); ++i) {
+    assert(results[i] == a.contains(values[i]));
+    assert(i >= 5000 || results[i]);
+  }
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  basic();
+  copy();
+  batch();
+}
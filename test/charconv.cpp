@@ -0,0 +1,111 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include <EASTL/charconv.h>
+#include <EASTL/string.h>
+
+
+template <typename T>
+static bool parses_as(char const* p, T expected) {
+  T value = 0;
+  eastl::from_chars_result const r = eastl::from_chars(p, p + std::strlen(p), value);
+  return r.ec == eastl::kCharsOK && r.ptr == p + std::strlen(p) && value == expected;
+}
+
+template <typename T>
+static eastl::chars_error parse_error(char const* p) {
+  T value = 7;
+  eastl::from_chars_result const r = eastl::from_chars(p, p + std::strlen(p), value);
+  return value == 7 ? r.ec : eastl::kCharsOK;
+}
+
+static void integers() {
+  std::cout << "integers:" << std::endl;
+
+  eastl::string s;
+  s.append_int(0).append_int(-42).append_uint(18446744073709551615ull).append_int(-9223372036854775807ll - 1);
+  assert(s == "0-4218446744073709551615-9223372036854775808");
+  assert(eastl::to_string(-2147483647 - 1) == "-2147483648" && eastl::to_string(100u) == "100");
+
+  char buffer[4];
+  eastl::to_chars_result const r = eastl::to_chars(buffer, buffer + 4, 1234);
+  assert(r.ec == eastl::kCharsOK && r.ptr == buffer + 4 && std::memcmp(buffer, "1234", 4) == 0);
+  assert(eastl::to_chars(buffer, buffer + 4, 12345).ec == eastl::kCharsValueTooLarge);
+
+  assert(parses_as<int>("-2147483648", -2147483647 - 1) && parses_as<unsigned char>("255", 255));
+  assert(parses_as<long long>("-9223372036854775808", -9223372036854775807ll - 1));
+  assert(parses_as<unsigned long long>("000018446744073709551615", 18446744073709551615ull));
+  assert(parse_error<signed char>("128") == eastl::kCharsResultOutOfRange);
+  assert(parse_error<unsigned long long>("18446744073709551616") == eastl::kCharsResultOutOfRange);
+  assert(parse_error<unsigned>("-1") == eastl::kCharsInvalidArgument && parse_error<int>("-") == eastl::kCharsInvalidArgument);
+  assert(parse_error<int>(" 1") == eastl::kCharsInvalidArgument && parse_error<int>("+1") == eastl::kCharsInvalidArgument);
+
+  // Parsing stops at the first char which isn't part of the number.
+  int value = 0;
+  char const text[] = "12,34";
+  eastl::from_chars_result const r2 = eastl::from_chars(text, text + 5, value);
+  assert(r2.ec == eastl::kCharsOK && r2.ptr == text + 2 && value == 12);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void floats() {
+  std::cout << "floats:" << std::endl;
+
+  eastl::string s;
+  s.append_double(0.1).append(" ").append_double(-0.0).append(" ").append_double(1e21).append(" ").append_double(1.5e-7);
+  assert(s == "0.1 -0 1e+21 1.5e-07");
+  assert(eastl::to_string(123456.0) == "123456" && eastl::to_string(5e-324) == "5e-324" && eastl::to_string(0.3f) == "0.3");
+  assert(eastl::to_string(1.7976931348623157e308) == "1.7976931348623157e+308" && eastl::to_string(0.001) == "0.001");
+
+  double const inf = HUGE_VAL;
+  assert(eastl::to_string(-inf) == "-inf" && eastl::to_string(inf - inf).find("nan") != eastl::string::npos);
+
+  // Every value reads back exactly, whether the fast path or strtod parses it.
+  srand(1);
+  for (int i = 0; i < 100000; ++i) {
+    uint64_t bits = 0;
+    for (int j = 0; j < 4; ++j) { bits = (bits << 16) ^ (uint64_t)(rand() & 0xFFFF); }
+    double d;
+    std::memcpy(&d, &bits, sizeof(d));
+    if (i % 2) { d = (double)(rand() % 1000000) / 1000.0; }
+    if (d != d || d - d != 0) { continue; }
+
+    char buffer[eastl::kMaxDoubleChars];
+    eastl::to_chars_result const r = eastl::to_chars(buffer, buffer + sizeof(buffer), d);
+    double value = 0;
+    eastl::from_chars_result const r2 = eastl::from_chars(buffer, r.ptr, value);
+    assert(r.ec == eastl::kCharsOK && r2.ec == eastl::kCharsOK && r2.ptr == r.ptr && value == d);
+
+    float const f = (float)d;
+    char fbuffer[eastl::kMaxFloatChars];
+    float fvalue = 0;
+    eastl::to_chars_result const r3 = eastl::to_chars(fbuffer, fbuffer + sizeof(fbuffer), f);
+    eastl::from_chars_result const r4 = eastl::from_chars(fbuffer, r3.ptr, fvalue);
+    assert(r3.ec == eastl::kCharsOK && r4.ec == eastl::kCharsOK && (fvalue == f || f - f != 0));
+  }
+
+  assert(parses_as("9007199254740993", 9007199254740992.0) && parses_as("1e23", 1e23) && parses_as("-.5E3", -500.0));
+  assert(parses_as("0.0000000000000000000000000000000000000000000000000000000000001", 1e-61));
+  assert(parses_as("123456789012345678901234567890e-10", 12345678901234567890.123456789));
+  assert(parses_as("INF", inf) && parses_as("-Infinity", -inf) && parses_as("4.9406564584124654e-324", 5e-324));
+  assert(parse_error<double>("1e400") == eastl::kCharsResultOutOfRange && parse_error<double>("1e-400") == eastl::kCharsResultOutOfRange);
+  assert(parse_error<float>("3.5e38") == eastl::kCharsResultOutOfRange && parse_error<double>("e5") == eastl::kCharsInvalidArgument);
+
+  // An exponent without digits isn't part of the number.
+  double value = 0;
+  char const text[] = "2e+x";
+  eastl::from_chars_result const r = eastl::from_chars(text, text + 4, value);
+  assert(r.ec == eastl::kCharsOK && r.ptr == text + 1 && value == 2);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  integers();
+  floats();
+}
@@ -0,0 +1,93 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <iostream>
+
+#include <EASTL/cuckoo_filter.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+
+typedef eastl::cuckoo_filter<unsigned> filter_type;
+
+static void basic() {
+  std::cout << "basic:" << std::endl;
+
+  // Fingerprint sizes from the smallest to the largest.
+  double const rates[] = { 0.5, 0.01, 0.0005 };
+  for (int r = 0; r < 3; ++r) {
+    filter_type filter(20000, rates[r]);
+    assert(filter.validate() && filter.capacity() >= 20000);
+    for (unsigned i = 0; i < 20000; ++i) {
+      bool const inserted = filter.insert(i * 2);
+      assert(inserted);
+    }
+    assert(filter.size() == 20000 && filter.validate());
+    unsigned missing = 0, positives = 0;
+    for (unsigned i = 0; i < 20000; ++i) {
+      missing += filter.contains(i * 2) ? 0 : 1;
+      positives += filter.contains(i * 2 + 1) ? 1 : 0;
+    }
+    assert(missing == 0);
+    assert(positives / 20000.0 < filter.false_positive_rate() * 1.5 + 0.0005);
+    assert(filter.false_positive_rate() <= rates[r] || filter.fingerprint_bit_count() == 4);
+
+    // Removing half leaves the other half, and the removed half mostly absent.
+    for (unsigned i = 0; i < 20000; i += 2) {
+      bool const removed = filter.remove(i * 2);
+      assert(removed);
+    }
+    assert(filter.size() == 10000 && filter.validate());
+    missing = 0;
+    for (unsigned i = 1; i < 20000; i += 2) { missing += filter.contains(i * 2) ? 0 : 1; }
+    assert(missing == 0);
+  }
+
+  eastl::cuckoo_filter<eastl::string> strings(100, 0.01);
+  strings.insert(eastl::string("alpha"));
+  assert(strings.contains(eastl::string("alpha")));
+  bool const removed = strings.remove(eastl::string("alpha"));
+  assert(removed && strings.size() == 0);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void full() {
+  std::cout << "full:" << std::endl;
+
+  // Fill past capacity: inserts fail once the stash is taken, nothing
+  // inserted is lost, and a remove makes room again.
+  filter_type filter(1000, 0.001);
+  unsigned n = 0;
+  while (filter.insert(n)) { ++n; }
+  assert(n > filter.capacity() * 9 / 10 && n <= filter.capacity());
+  assert(filter.size() == n && filter.validate());
+  unsigned missing = 0;
+  for (unsigned i = 0; i < n; ++i) { missing += filter.contains(i) ? 0 : 1; }
+  assert(missing == 0);
+
+  bool const removed = filter.remove(0);
+  assert(removed && filter.validate());
+  bool const inserted = filter.insert(0);
+  assert(inserted && filter.contains(0));
+
+  // Batch insert stops at the first failure and reports how many went in.
+  eastl::vector<unsigned> values;
+  for (unsigned i = 0; i < 3000; ++i) { values.push_back(i * 7919u); }
+  filter_type batch(1000, 0.001);
+  filter_type::size_type const count = batch.insert(values.begin(), values.end());
+  assert(count == batch.size() && count < 3000 && count > 900);
+  eastl::vector<bool> results(count);
+  batch.contains(values.begin(), values.begin() + count, results.begin());
+  for (filter_type::size_type i = 0; i < count; ++i) { assert(results[i]); }
+
+  batch.clear();
+  assert(batch.size() == 0 && batch.validate() && !batch.contains(values[0]));
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  basic();
+  full();
+}
@@ -0,0 +1,178 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+
+#include <EASTL/deque.h>
+#include <EASTL/list.h>
+#include <EASTL/queue.h>
+#include <EASTL/stack.h>
+#include <EASTL/string.h>
+
+
+// A small subarray size so that the tests cross subarray boundaries often.
+typedef eastl::deque<int, EASTLAllocatorType, 4> int_deque;
+
+
+static bool matches(int_deque const& d, int first) {
+  for (int_deque::size_type i = 0; i < d.size(); ++i) {
+    if (d[i] != first + int(i)) { return false; }
+  }
+  return d.validate();
+}
+
+static void push_pop() {
+  std::cout << "push_pop:" << std::endl;
+
+  int_deque d;
+  assert(d.empty() && d.validate());
+  for (int i = 0; i < 50; ++i) {
+    d.push_back(i);
+    d.push_front(-1 - i);
+  }
+  assert(d.size() == 100 && matches(d, -50));
+  assert(d.front() == -50 && d.back() == 49);
+  assert(d.end() - d.begin() == 100 && *(d.begin() + 73) == 23);
+  assert(*(d.end() - 73) == -23 && d.rbegin()[2] == 47);
+
+  // Pushing an element of the deque itself.
+  d.push_back(d.front());
+  assert(d.back() == -50);
+  d.pop_back();
+
+  // Used as a FIFO, the pointer array gets recentred rather than grown.
+  for (int i = 0; i < 1000; ++i) {
+    d.push_back(50 + i);
+    d.pop_front();
+  }
+  assert(d.size() == 100 && matches(d, 950));
+
+  while (!d.empty()) {
+    d.pop_back();
+    d.pop_front();
+  }
+  assert(d.empty() && d.validate());
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void insert_erase() {
+  std::cout << "insert_erase:" << std::endl;
+
+  int_deque d;
+  for (int i = 0; i < 20; ++i) { d.push_back(i); }
+
+  int_deque::iterator it = d.insert(d.begin() + 5, 100);
+  assert(*it == 100 && d.size() == 21 && d[4] == 4 && d[6] == 5);
+  it = d.insert(d.begin() + 15, 200);
+  assert(*it == 200 && d[14] == 13 && d[16] == 14);
+
+  it = d.erase(d.begin() + 15);
+  assert(*it == 14);
+  it = d.erase(d.begin() + 5);
+  assert(*it == 5 && matches(d, 0));
+
+  // Filled inserts on both halves, both within and beyond the old elements.
+  d.insert(d.begin() + 2, 7, d[1]);
+  d.insert(d.end() - 3, 2, -1);
+  assert(d.size() == 29 && d[2] == 1 && d[8] == 1 && d[9] == 2);
+  assert(d[23] == 16 && d[24] == -1 && d[25] == -1 && d[26] == 17);
+  d.erase(d.begin() + 24, d.begin() + 26);
+  d.erase(d.begin() + 2, d.begin() + 9);
+  assert(matches(d, 0));
+
+  eastl::list<int> const l(3, 9);
+  d.insert(d.begin() + 1, l.begin(), l.end());
+  d.insert(d.end() - 1, l.begin(), l.end());
+  assert(d.size() == 26 && d[1] == 9 && d[3] == 9 && d[4] == 1 && d[24] == 9 && d[25] == 19);
+
+  int_deque copy(d);
+  assert(copy == d);
+  copy.resize(3);
+  assert(copy.size() == 3 && copy < d);
+  copy.assign(d.begin() + 4, d.begin() + 10);
+  assert(copy.size() == 6 && copy.front() == 1);
+  d.swap(copy);
+  assert(d.size() == 6 && copy.size() == 26);
+  d.clear();
+  assert(d.empty() && d.validate());
+
+  eastl::deque<eastl::string> strings(3, eastl::string("abc"));
+  strings.erase(strings.begin());
+  strings.push_front("x");
+  assert(strings.size() == 3 && strings[0] == "x" && strings[2] == "abc");
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void assign() {
+  std::cout << "assign:" << std::endl;
+
+  // Two ints select the count and value form, not the iterator form.
+  int_deque d;
+  d.assign(4, 2);
+  assert(d.size() == 4 && d[0] == 2 && d[3] == 2 && d.validate());
+  d.assign(9, 5);
+  assert(d.size() == 9 && d[0] == 5 && d[8] == 5 && d.validate());
+  d.assign(3, d[8]);
+  assert(d.size() == 3 && d[0] == 5 && d[2] == 5 && d.validate());
+  d.assign(0, 1);
+  assert(d.empty() && d.validate());
+
+  eastl::deque<eastl::string> strings(6, eastl::string("abc"));
+  strings.assign(2, eastl::string("x"));
+  assert(strings.size() == 2 && strings[0] == "x" && strings[1] == "x");
+  strings.assign(7, strings[1]);
+  assert(strings.size() == 7 && strings[0] == "x" && strings[6] == "x");
+
+  // Ranges within the deque itself, starting at or after the front.
+  for (int i = 0; i < 20; ++i) { d.push_back(i); }
+  d.assign(d.begin(), d.begin() + 3);
+  assert(d.size() == 3 && matches(d, 0));
+  d.assign(d.begin(), d.end());
+  assert(d.size() == 3 && matches(d, 0));
+  d.assign(10, 0);
+  for (int i = 0; i < 10; ++i) { d[i] = i; }
+  d.assign(d.begin() + 4, d.begin() + 9);
+  assert(d.size() == 5 && matches(d, 4));
+
+  // Input iterators both shrink and grow the deque.
+  std::istringstream few("7 8 9");
+  d.assign(std::istream_iterator<int>(few), std::istream_iterator<int>());
+  assert(d.size() == 3 && matches(d, 7));
+  std::istringstream many("1 2 3 4 5 6 7 8 9 10 11");
+  d.assign(std::istream_iterator<int>(many), std::istream_iterator<int>());
+  assert(d.size() == 11 && matches(d, 1));
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void adaptors() {
+  std::cout << "adaptors:" << std::endl;
+
+  eastl::queue<int> q;
+  eastl::stack<int> s;
+  for (int i = 0; i < 100; ++i) {
+    q.push(i);
+    s.push(i);
+  }
+  assert(q.front() == 0 && q.back() == 99 && s.top() == 99);
+  q.pop();
+  s.pop();
+  assert(q.front() == 1 && s.top() == 98 && q.size() == 99 && s.size() == 99);
+
+  eastl::queue<int, eastl::list<int> > lq;
+  lq.push(1);
+  assert(lq.front() == 1 && !lq.empty());
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  push_pop();
+  insert_erase();
+  assign();
+  adaptors();
+}
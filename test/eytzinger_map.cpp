@@ -0,0 +1,90 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <iostream>
+
+#include <EASTL/eytzinger_map.h>
+#include <EASTL/vector.h>
+#include <EASTL/vector_map.h>
+
+
+typedef eastl::eytzinger_map<int, int> int_map;
+
+
+static void lookup() {
+  std::cout << "lookup:" << std::endl;
+
+  // Every size up to a few complete levels, to cover partial bottom levels.
+  for(int n = 0; n < 40; ++n) {
+    eastl::vector<eastl::pair<int, int> > values;
+    for(int i = n - 1; i >= 0; --i) {
+      values.push_back(eastl::make_pair(2 * i, i));
+    }
+    int_map const m(values.begin(), values.end());
+    assert(int(m.size()) == n);
+    assert(m.validate());
+
+    for(int k = -1; k <= 2 * n; ++k) {
+      int_map::const_iterator const lb = m.lower_bound(k);
+      int_map::const_iterator const ub = m.upper_bound(k);
+      if((k + 1) / 2 < n) {
+        assert(lb->first == (k + 1) / 2 * 2);
+      } else {
+        assert(lb == m.end());
+      }
+      if(k / 2 + 1 < n && k >= 0) {
+        assert(ub->first == (k / 2 + 1) * 2);
+      } else if(k < 0 && n > 0) {
+        assert(ub->first == 0);
+      } else {
+        assert(ub == m.end());
+      }
+      assert(m.count(k) == ((k >= 0 && k % 2 == 0 && k / 2 < n)? 1u : 0u));
+    }
+  }
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void iteration() {
+  std::cout << "iteration:" << std::endl;
+
+  eastl::vector_map<int, int> vm;
+  for(int i = 0; i < 100; ++i) {
+    vm.insert(eastl::make_pair((i * 37) % 100, i));
+  }
+  vm.insert(eastl::make_pair(5, -1)); // already there
+
+  int_map const m(eastl::sorted_unique, vm.begin(), vm.end());
+  assert(m.size() == 100);
+
+  int n = 0;
+  for(int_map::const_iterator i = m.begin(); i != m.end(); ++i) {
+    assert(i->first == n);
+    assert(i->second == vm.find(n)->second);
+    ++n;
+  }
+  assert(n == 100);
+
+  for(int_map::const_reverse_iterator i = m.rbegin(); i != m.rend(); ++i) {
+    --n;
+    assert(i->first == n);
+  }
+
+  // The root of the layout holds the median.
+  assert(m.base()[0].first == 63);
+
+  int_map copy(m);
+  assert(copy == m);
+  int_map empty;
+  assert(empty.begin() == empty.end());
+  empty.swap(copy);
+  assert(copy.empty() && empty == m);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  lookup();
+  iteration();
+}
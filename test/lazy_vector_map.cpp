@@ -0,0 +1,80 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <iostream>
+
+#include <EASTL/lazy_vector_map.h>
+
+
+typedef eastl::lazy_vector_map<int, int> int_map;
+
+
+static void deferred_insert() {
+  std::cout << "deferred_insert:" << std::endl;
+
+  int_map m;
+  for(int i = 0; i < 4; ++i) {
+    m.insert(eastl::make_pair(i, i)); // in order: nothing pending
+  }
+  assert(m.pending() == 0);
+
+  for(int i = 99; i >= 0; --i) {
+    m.insert(eastl::make_pair(i, -i));
+  }
+  assert(m.pending() == 99); // 99 still extended the sorted part
+  assert(!m.empty());
+
+  // The first read sorts and merges; existing keys win.
+  assert(m.size() == 100);
+  assert(m.pending() == 0);
+  assert(m.find(2)->second == 2);
+  assert(m.find(50)->second == -50);
+  assert(m.find(100) == m.end());
+
+  int n = 0;
+  for(int_map::const_iterator i = m.begin(); i != m.end(); ++i) {
+    assert(i->first == n);
+    ++n;
+  }
+
+  m[200] = 1;
+  m[50] = 7;
+  assert(m.pending() == 0);
+  assert(m.size() == 101 && m.find(50)->second == 7);
+
+  m.erase(200);
+  assert(m.erase(200) == 0);
+  m.insert(eastl::make_pair(-1, 0));
+  assert(m.count(-1) == 1);
+  assert(m.begin()->first == -1);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void compare() {
+  std::cout << "compare:" << std::endl;
+
+  eastl::pair<int, int> const values[] = {
+    eastl::make_pair(3, 0), eastl::make_pair(1, 0), eastl::make_pair(2, 0), eastl::make_pair(1, 1),
+  };
+  int_map const a(values, values + 4);
+  int_map b;
+  b.insert(values + 2, values + 4);
+  b.insert(values, values + 2);
+
+  assert(a.size() == 3 && b.size() == 3);
+  assert(a.find(1)->second == 0);
+  assert(b.find(1)->second == 1);
+  assert(a != b);
+
+  b.erase(b.find(1));
+  b.insert(eastl::make_pair(1, 0));
+  assert(a == b);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  deferred_insert();
+  compare();
+}
@@ -0,0 +1,86 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <iostream>
+
+#include <EASTL/bitset.h>
+#include <EASTL/bitvector.h>
+#include <EASTL/rank_select_index.h>
+#include <EASTL/vector.h>
+
+
+typedef eastl::rank_select_index<> index_type;
+
+
+// Checks every rank and select of the index against a scan of the bits.
+template<class Bits>
+static bool matches(index_type const& index, Bits const& bits, index_type::size_type size) {
+  if (!index.validate() || index.size() != size) { return false; }
+  index_type::size_type rank = 0;
+  for (index_type::size_type i = 0; i < size; ++i) {
+    if (index.rank1(i) != rank || index.rank0(i) != i - rank) { return false; }
+    if (bits[i]) {
+      if (index.select1(rank) != i) { return false; }
+      ++rank;
+    }
+  }
+  return index.rank1(size) == rank && index.count() == rank && index.select1(rank) == size;
+}
+
+static void bitvector() {
+  std::cout << "bitvector:" << std::endl;
+
+  // Sizes around the word, block and superblock boundaries, and densities
+  // from full to a few bits far apart, so select1 searches between samples.
+  unsigned const sizes[] = { 0, 1, 63, 64, 511, 4096, 4097, 100000, 300000 };
+  unsigned const spacings[] = { 1, 2, 7, 1000, 50000 };
+  for (int s = 0; s < 9; ++s) {
+    for (int d = 0; d < 5; ++d) {
+      eastl::bitvector<> bits(sizes[s]);
+      unsigned seed = 1;
+      for (unsigned i = 0; i < sizes[s]; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        if ((seed >> 8) % spacings[d] == 0) { bits.set(i); }
+      }
+      index_type const index(bits);
+      assert(matches(index, bits, sizes[s]));
+    }
+  }
+
+  eastl::bitvector<> bits(10000, true);
+  index_type index(bits);
+  assert(index.select1(9999) == 9999 && index.rank1(10000) == 10000);
+  bits.reset(5000);
+  index.build(bits); // Rebuilt after a change.
+  assert(index.rank1(6000) == 5999 && index.select1(5000) == 5001);
+
+  index_type other;
+  other.swap(index);
+  assert(other.count() == 9999 && index.size() == 0);
+  index.clear();
+  assert(index.validate());
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void bitset() {
+  std::cout << "bitset:" << std::endl;
+
+  eastl::bitset<1000> bits;
+  for (int i = 0; i < 1000; i += 3) { bits.set(i); }
+  index_type const index(bits);
+  assert(matches(index, bits, 1000));
+
+  // Words passed directly, with bits set past the size that must be ignored.
+  eastl::BitsetWordType const words[] = { ~eastl::BitsetWordType(0), ~eastl::BitsetWordType(0) };
+  index_type const partial(words, eastl::kBitsPerWord + 3);
+  assert(partial.count() == eastl::kBitsPerWord + 3);
+  assert(partial.select1(eastl::kBitsPerWord + 3) == eastl::kBitsPerWord + 3);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  bitvector();
+  bitset();
+}
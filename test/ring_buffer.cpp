@@ -0,0 +1,82 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <cstring>
+#include <iostream>
+
+#include <EASTL/bonus/fixed_ring_buffer.h>
+#include <EASTL/bonus/ring_buffer.h>
+#include <EASTL/sort.h>
+
+
+typedef eastl::ring_buffer<int> int_ring;
+
+
+static void growable() {
+  std::cout << "growable:" << std::endl;
+
+  int_ring r(4);
+  assert(r.empty() && r.capacity() == 4);
+  for (int i = 0; i < 3; ++i) { r.push_back(i); }
+  r.pop_front();
+  r.pop_front();
+  for (int i = 3; i < 6; ++i) { r.push_back(i); } // wraps around
+  assert(r.full() && r.front() == 2 && r.back() == 5);
+  assert(r.array_one().second == 2 && r.array_two().second == 2);
+
+  r.push_back(r.front()); // grows, keeping the order
+  assert(r.size() == 5 && r.capacity() > 4 && r.validate());
+  int const expected[] = { 2, 3, 4, 5, 2 };
+  assert(eastl::equal(r.begin(), r.end(), expected));
+  assert(r.array_one().second == 5 && r.array_two().second == 0);
+
+  r.push_front(1);
+  r.pop_back();
+  assert(r.front() == 1 && r.back() == 5 && r.end() - r.begin() == 5);
+  assert(*r.rbegin() == 5 && r[2] == 3);
+
+  // The iterators work with algorithm.h.
+  r.push_front(9);
+  eastl::sort(r.begin(), r.end());
+  assert(r.front() == 1 && r.back() == 9 && eastl::is_sorted(r.begin(), r.end()));
+
+  int_ring copy(r);
+  assert(copy == r);
+  copy.set_capacity(2); // keeps the newest
+  assert(copy.size() == 2 && copy.front() == 5 && copy.back() == 9);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void overwrite() {
+  std::cout << "overwrite:" << std::endl;
+
+  int_ring r(5, true);
+  for (int i = 0; i < 12; ++i) { r.push_back(i); }
+  assert(r.size() == 5 && r.capacity() == 5 && r.front() == 7 && r.back() == 11);
+
+  // Copy out through the two spans.
+  int out[5];
+  int_ring::const_span_type const a = r.array_one();
+  int_ring::const_span_type const b = r.array_two();
+  assert(a.second + b.second == 5);
+  std::memcpy(out, a.first, a.second * sizeof(int));
+  std::memcpy(out + a.second, b.first, b.second * sizeof(int));
+  for (int i = 0; i < 5; ++i) { assert(out[i] == 7 + i); }
+
+  eastl::fixed_ring_buffer<int, 3> f;
+  assert(f.capacity() == 3 && f.max_size() == 3 && f.overwrites());
+  for (int i = 0; i < 10; ++i) { f.push_back(i); }
+  assert(f.size() == 3 && f.front() == 7 && f.back() == 9);
+  f.push_front(0); // drops the newest
+  assert(f.front() == 0 && f.back() == 8);
+  f.clear();
+  assert(f.empty() && f.array_one().second == 0 && f.validate());
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  growable();
+  overwrite();
+}
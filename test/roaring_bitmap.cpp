@@ -0,0 +1,176 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <iostream>
+
+#include <EASTL/bitvector.h>
+#include <EASTL/roaring_bitmap.h>
+#include <EASTL/vector.h>
+
+
+typedef eastl::roaring_bitmap<> bitmap;
+
+static unsigned const kRange = 4 * 65536; // The reference bitvectors cover the first four chunks.
+
+
+// Fills b and the reference r with about one in `spacing` values, plus a range.
+static void fill(bitmap& b, eastl::bitvector<>& r, unsigned spacing, unsigned seed, unsigned first, unsigned last) {
+  for (unsigned i = 0; i < kRange; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    if ((seed >> 8) % spacing == 0) {
+      b.add(i);
+      r.set(i);
+    }
+  }
+  b.add_range(first, last);
+  for (unsigned i = first; i < last; ++i) { r.set(i); }
+}
+
+static bool same(bitmap const& b, eastl::bitvector<> const& r) {
+  if (!b.validate() || b.cardinality() != r.count()) { return false; }
+  eastl::bitvector<>::set_bit_iterator j = r.set_bits_begin();
+  for (bitmap::const_iterator i = b.begin(); i != b.end(); ++i, ++j) {
+    if (*i != *j) { return false; }
+  }
+  return true;
+}
+
+static void basic() {
+  std::cout << "basic:" << std::endl;
+
+  bitmap b;
+  assert(b.empty() && b.begin() == b.end());
+  bool const added = b.add(70000);
+  assert(added);
+  bool const again = b.add(70000);
+  assert(!again);
+  b.add(3);
+  b.add(0xffffffffu);
+  assert(b.contains(3) && b.contains(70000) && b.contains(0xffffffffu) && !b.contains(4));
+  assert(b.cardinality() == 3 && b.container_count() == 3);
+  assert(b.minimum() == 3 && b.maximum() == 0xffffffffu);
+
+  // An array container becomes a bitset past 4096 values, and back.
+  for (unsigned i = 0; i < 8192; i += 2) { b.add(i); }
+  b.add(1);
+  assert(b.validate() && b.cardinality() == 4100);
+  bool const removed = b.remove(1);
+  assert(removed && b.validate() && !b.contains(1));
+  bool const removedAgain = b.remove(1);
+  assert(!removedAgain);
+
+  // Runs split and merge as values are removed and added.
+  b.add_range(100000, 200000);
+  assert(b.cardinality() == 4099 + 100000 && b.contains(199999) && !b.contains(200000));
+  b.remove(150000);
+  assert(b.validate() && !b.contains(150000) && b.contains(150001));
+  b.add(150000);
+  assert(b.validate() && b.contains(150000));
+
+  uint32_t value = 0;
+  for (uint64_t k = 0; k < b.cardinality(); k += 997) {
+    bool const found = b.select(k, value);
+    assert(found && b.rank(value) == k + 1);
+  }
+  bool const past = b.select(b.cardinality(), value);
+  assert(!past);
+
+  bitmap copy(b);
+  assert(copy == b);
+  copy.remove(3);
+  assert(copy != b);
+  b.clear();
+  assert(b.empty() && b.cardinality() == 0);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void operations() {
+  std::cout << "operations:" << std::endl;
+
+  // Sparse, dense and run-heavy chunks against each other.
+  unsigned const spacings[] = { 3, 50, 1000 };
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      bitmap a, b;
+      eastl::bitvector<> ra(kRange), rb(kRange);
+      fill(a, ra, spacings[i], 1 + i, 60000, 140000);
+      fill(b, rb, spacings[j], 7 + j, 130000, 131000 + 20000 * j);
+      if (j == 2) { b.run_optimize(); }
+      assert(same(a, ra) && same(b, rb));
+
+      assert(same(a & b, eastl::bitvector<>(ra) &= rb));
+      assert(same(a | b, eastl::bitvector<>(ra) |= rb));
+      assert(same(a ^ b, eastl::bitvector<>(ra) ^= rb));
+      assert(same(bitmap(a).and_not(b), eastl::bitvector<>(ra).and_not(rb)));
+      assert(same(bitmap(b).and_not(a), eastl::bitvector<>(rb).and_not(ra)));
+
+      bitmap optimized(a);
+      optimized.run_optimize();
+      assert(same(optimized, ra) && optimized == a);
+      assert(same(optimized & b, eastl::bitvector<>(ra) &= rb));
+      assert(same(optimized | b, eastl::bitvector<>(ra) |= rb));
+      assert(same(optimized ^ b, eastl::bitvector<>(ra) ^= rb));
+    }
+  }
+
+  bitmap a;
+  a.add_range(0, 100);
+  a ^= a;
+  assert(a.empty());
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void serialization() {
+  std::cout << "serialization:" << std::endl;
+
+  // The portable Roaring format, as written by the other Roaring libraries.
+  bitmap small;
+  small.add(1);
+  small.add(2);
+  small.add(0x10000);
+  unsigned char const expected[] = {
+    0x3a, 0x30, 0, 0,  2, 0, 0, 0, // Cookie and container count.
+    0, 0, 1, 0,  1, 0, 0, 0,       // Keys and cardinalities - 1.
+    24, 0, 0, 0,  28, 0, 0, 0,     // Offsets.
+    1, 0, 2, 0,  0, 0              // Values.
+  };
+  eastl::vector<unsigned char> buffer(small.serialized_size());
+  assert(buffer.size() == sizeof(expected));
+  bitmap::size_type const written = small.serialize(buffer.data());
+  assert(written == sizeof(expected));
+  for (unsigned i = 0; i < sizeof(expected); ++i) { assert(buffer[i] == expected[i]); }
+
+  // All three container types, with offsets (four or more containers) and without.
+  for (int containers = 2; containers <= 5; containers += 3) {
+    bitmap b;
+    if (containers == 5) {
+      eastl::bitvector<> r(kRange);
+      fill(b, r, 7, 3, 200000, 209000);
+    }
+    b.add_range(65536, 65536 + 40);
+    b.run_optimize();
+    b.add(5000000);
+    assert(b.container_count() == (bitmap::size_type)containers);
+
+    buffer.resize(b.serialized_size());
+    bitmap::size_type const n = b.serialize(buffer.data());
+    assert(n == buffer.size());
+
+    bitmap c;
+    bitmap::size_type const read = c.deserialize(buffer.data(), n);
+    assert(read == n && c == b && c.validate());
+
+    bitmap::size_type const truncated = c.deserialize(buffer.data(), n - 1);
+    assert(truncated == 0 && c.empty());
+  }
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  basic();
+  operations();
+  serialization();
+}
@@ -0,0 +1,123 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+
+#include <EASTL/rope.h>
+#include <EASTL/string.h>
+
+
+typedef eastl::basic_rope<char, counting_allocator> rope_type;
+
+static eastl::string fragment(int i, int n) {
+  eastl::string s;
+  for (int j = 0; j < n; ++j) { s.push_back((char)('a' + (i + j) % 26)); }
+  return s;
+}
+
+// Checks every way of reading r against the expected chars.
+static void check(rope_type const& r, eastl::string const& expected) {
+  assert(r.size() == expected.size() && r.empty() == expected.empty());
+  eastl::string_view const view(expected.data(), expected.size());
+  rope_type::string_type const flat = r.flatten();
+  assert(eastl::string_view(flat.data(), flat.size()) == view && r == view);
+
+  eastl::string chunks;
+  eastl_size_t count = 0;
+  for (rope_type::chunk_iterator it = r.chunk_begin(); it != r.chunk_end(); ++it, ++count) {
+    assert(!(*it).empty());
+    chunks.append((*it).data(), (*it).data() + (*it).size());
+  }
+  assert(chunks == expected && count == r.chunk_count());
+
+  for (eastl_size_t i = 0; i < expected.size(); i += 1 + expected.size() / 97) { assert(r[i] == expected[i]); }
+}
+
+static void concatenation() {
+  std::cout << "concatenation:" << std::endl;
+
+  {
+    rope_type r;
+    check(r, "");
+    assert(r.substr().empty() && r.chunk_begin() == r.chunk_end());
+
+    eastl::string expected;
+    for (int i = 0; i < 3000; ++i) {
+      eastl::string const s = fragment(i, i % 7 == 0 ? 1000 + i : 1 + i % 50);
+      if (i % 3 == 2) {
+        r.prepend(eastl::string_view(s.data(), s.size()));
+        expected.insert(0, s);
+      } else {
+        r += eastl::string_view(s.data(), s.size());
+        expected += s;
+      }
+    }
+    check(r, expected);
+
+    // Appending a rope to itself shares its nodes, so the leaves appear twice.
+    rope_type const copy(r);
+    int const nBlocks = counting_allocator::count();
+    r += r;
+    assert(counting_allocator::count() == nBlocks + 1 && r.chunk_count() == copy.chunk_count() * 2);
+    check(r, expected + expected);
+    check(copy, expected);
+    assert(r != copy && r.substr(copy.size()) == copy);
+
+    r = "abc";
+    r += 'd';
+    assert(r == "abcd" && r.front() == 'a' && r.back() == 'd' && r.chunk_count() == 1);
+
+    // Short appends are merged into leaves rather than each made one.
+    expected.clear();
+    for (int i = 0; i < 10000; ++i) {
+      r += (char)('a' + i % 26);
+      expected.push_back((char)('a' + i % 26));
+    }
+    check(r, "abcd" + expected);
+    assert(r.chunk_count() <= 10000 / 100);
+  }
+  assert(counting_allocator::count() == 0);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void substrings() {
+  std::cout << "substrings:" << std::endl;
+
+  {
+    rope_type r;
+    eastl::string expected;
+    for (int i = 0; i < 500; ++i) {
+      eastl::string const s = fragment(i, 100 + (i * 37) % 400);
+      r += eastl::string_view(s.data(), s.size());
+      expected += s;
+    }
+
+    srand(1);
+    for (int i = 0; i < 300; ++i) {
+      eastl_size_t const position = (eastl_size_t)rand() % expected.size();
+      eastl_size_t const n = (eastl_size_t)rand() % (i % 2 ? 300 : expected.size());
+      eastl::string const s = expected.substr(position, n);
+      check(r.substr(position, n), s);
+
+      eastl::string buffer(n, ' ');
+      eastl_size_t const nCopied = r.copy(&buffer[0], n, position);
+      buffer.resize(nCopied);
+      assert(buffer == s);
+    }
+
+    // A substring outlives the rope it came from.
+    rope_type middle = r.substr(1000, 50000);
+    r.clear();
+    check(middle, expected.substr(1000, 50000));
+  }
+  assert(counting_allocator::count() == 0);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  concatenation();
+  substrings();
+}
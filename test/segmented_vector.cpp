@@ -0,0 +1,127 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <iostream>
+
+#include <EASTL/segmented_vector.h>
+#include <EASTL/string.h>
+
+
+typedef eastl::segmented_vector<int, 4> int_vector;
+
+
+static void push_back() {
+  std::cout << "push_back:" << std::endl;
+
+  int_vector vec;
+  assert(vec.empty());
+  assert(vec.begin() == vec.end());
+
+  vec.push_back(0);
+  int* const first = &vec[0];
+  for(int i = 1; i < 100; ++i) {
+    vec.push_back(i);
+  }
+  assert(vec.size() == 100);
+  assert(vec.capacity() == 100);
+  assert(&vec[0] == first); // elements never move
+  assert(vec.front() == 0 && vec.back() == 99);
+  assert(vec.validate());
+
+  for(int i = 0; i < 100; ++i) {
+    assert(vec[i] == i);
+  }
+
+  vec.pop_back();
+  assert(vec.size() == 99 && vec.back() == 98);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void iterator() {
+  std::cout << "iterator:" << std::endl;
+
+  int_vector vec;
+  for(int i = 0; i < 8; ++i) {
+    vec.push_back(i);
+  }
+  // 8 elements fill two chunks exactly, so end() refers to the table terminator.
+  assert(vec.end() - vec.begin() == 8);
+
+  int n = 0;
+  for(int_vector::const_iterator i = vec.begin(); i != vec.end(); ++i, ++n) {
+    assert(*i == n);
+  }
+  assert(n == 8);
+
+  for(int_vector::iterator i = vec.end(); i != vec.begin();) {
+    --i;
+    --n;
+    assert(*i == n);
+  }
+
+  int_vector::iterator i = vec.begin() + 6;
+  assert(*i == 6);
+  i -= 5;
+  assert(*i == 1);
+  assert(i[4] == 5);
+  assert(vec.begin() < i && i < vec.end());
+  assert(vec.validate_iterator(i) == (eastl::isf_valid | eastl::isf_current | eastl::isf_can_dereference));
+  assert(vec.validate_iterator(vec.end()) == (eastl::isf_valid | eastl::isf_current));
+
+  assert(*vec.rbegin() == 7);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void segments() {
+  std::cout << "segments:" << std::endl;
+
+  int_vector vec(10, 1);
+  assert(vec.segment_count() == 3);
+
+  int sum = 0;
+  for(eastl_size_t s = 0; s < vec.segment_count(); ++s) {
+    for(const int* p = vec.segment_begin(s), *end = vec.segment_end(s); p != end; ++p) {
+      sum += *p;
+    }
+  }
+  assert(sum == 10);
+  assert(vec.segment_end(2) - vec.segment_begin(2) == 2);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void capacity() {
+  std::cout << "capacity:" << std::endl;
+
+  eastl::segmented_vector<eastl::string, 4> vec;
+  vec.reserve(9);
+  assert(vec.capacity() == 12);
+  vec.resize(5, eastl::string("x"));
+
+  eastl::segmented_vector<eastl::string, 4> copy(vec);
+  assert(copy == vec);
+
+  vec.clear();
+  assert(vec.empty() && vec.capacity() == 12);
+  vec.set_capacity();
+  assert(vec.capacity() == 0);
+  assert(vec.begin() == vec.end());
+
+  copy.set_capacity(2);
+  assert(copy.size() == 2 && copy.capacity() == 4);
+
+  vec.swap(copy);
+  assert(vec.size() == 2 && copy.empty());
+  assert(vec.validate() && copy.validate());
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  push_back();
+  iterator();
+  segments();
+  capacity();
+}
@@ -0,0 +1,108 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <iostream>
+
+#include <EASTL/split_vector_map.h>
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+#include <EASTL/vector_map.h>
+
+
+typedef eastl::split_vector_map<int, eastl::string> string_map;
+
+
+static void insert() {
+  std::cout << "insert:" << std::endl;
+
+  string_map m;
+  m.insert(eastl::make_pair(3, eastl::string("c")));
+  m.insert(eastl::make_pair(1, eastl::string("a")));
+  bool const inserted = m.insert(eastl::make_pair(3, eastl::string("x"))).second;
+  assert(!inserted);
+  m[2] = "b";
+  m.insert(m.end(), eastl::make_pair(4, eastl::string("d"))); // good hint
+  m.insert(m.begin(), eastl::make_pair(5, eastl::string("e"))); // bad hint
+  assert(m.size() == 5);
+
+  // The keys and values stay in lockstep.
+  for(int i = 0; i < 5; ++i) {
+    assert(m.keys()[i] == i + 1);
+    assert(m.values()[i] == eastl::string(1, char('a' + i)));
+  }
+
+  string_map::iterator i = m.find(3);
+  assert(i->first == 3 && i->second == "c");
+  i->second = "C";
+  assert(m[3] == "C");
+  assert(m.find(6) == m.end());
+  assert(m.count(4) == 1);
+
+  eastl::pair<int, eastl::string> const p = *m.begin();
+  assert(p.first == 1 && p.second == "a");
+
+  m.erase(3);
+  assert(m.erase(3) == 0);
+  m.erase(m.begin(), m.begin() + 2);
+  assert(m.size() == 2 && m.keys()[0] == 4 && m.values()[0] == "d");
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void bulk_insert() {
+  std::cout << "bulk_insert:" << std::endl;
+
+  eastl::pair<int, eastl::string> const values[] = {
+    eastl::make_pair(5, eastl::string("e")), eastl::make_pair(1, eastl::string("a")),
+    eastl::make_pair(3, eastl::string("c")), eastl::make_pair(1, eastl::string("x")),
+  };
+  string_map m(values, values + 4);
+  assert(m.size() == 3 && m[1] == "a");
+
+  m.insert(eastl::sorted_unique, values + 1, values + 3); // already there
+  m.insert(values, values + 1);
+  assert(m.size() == 3);
+
+  int n = 0;
+  string_map const& cm = m;
+  for(string_map::const_iterator i = cm.begin(); i != cm.end(); ++i, ++n) {
+    assert(i->first == 2 * n + 1);
+  }
+  for(string_map::const_reverse_iterator i = cm.rbegin(); i != cm.rend(); ++i) {
+    --n;
+    assert((*i).first == 2 * n + 1);
+  }
+
+  string_map copy(m);
+  assert(copy == m);
+  copy[0] = "z";
+  assert(copy != m && copy < m);
+
+  // Unsorted ranges with duplicates, within the range and of existing keys,
+  // merge to what vector_map gets.
+  eastl::vector_map<int, eastl::string> reference;
+  string_map merged;
+  unsigned x = 1;
+  for (int round = 0; round < 20; ++round) {
+    eastl::vector<eastl::pair<int, eastl::string> > range;
+    for (int i = 0; i < round * 7; ++i) {
+      x = x * 1103515245u + 12345u;
+      int const key = int((x >> 8) % 200);
+      range.push_back(eastl::make_pair(key, eastl::string(1, char('a' + round))));
+    }
+    reference.insert(range.begin(), range.end());
+    merged.insert(range.begin(), range.end());
+  }
+  assert(merged.size() == reference.size());
+  string_map::const_iterator j = merged.begin();
+  for (eastl::vector_map<int, eastl::string>::const_iterator i = reference.begin(); i != reference.end(); ++i, ++j) {
+    assert(j->first == i->first && j->second == i->second);
+  }
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  insert();
+  bulk_insert();
+}
@@ -0,0 +1,187 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include <EASTL/algorithm.h>
+#include <EASTL/fixed_string.h>
+#include <EASTL/string.h>
+
+
+typedef eastl::basic_string<char, counting_allocator> string_type;
+
+static char const* const kShort = "fifteen chars!!";                 // Fits the local buffer exactly.
+static char const* const kLong = "sixteen chars!!!, and then some"; // Doesn't.
+
+static void local_buffer() {
+  std::cout << "local_buffer:" << std::endl;
+
+  {
+    string_type empty, a(kShort), b(a);
+    assert(counting_allocator::count() == 0);
+    assert(empty.validate() && empty.c_str()[0] == 0 && a.validate() && b == kShort);
+    assert(a.capacity() == EASTL_STRING_LOCAL_SIZE - 1);
+
+    // Growing past the buffer allocates, and shrinking moves back into it.
+    a.push_back('x');
+    assert(counting_allocator::count() == 1 && a.validate());
+    a.pop_back();
+    a.set_capacity();
+    assert(counting_allocator::count() == 0 && a == kShort && a.validate());
+
+    string_type c(kLong);
+    c.reserve(100);
+    c.resize(3);
+    c.set_capacity(3);
+    assert(counting_allocator::count() == 0 && c == "six");
+
+    // Truncating a local string moves nothing, but still ends it.
+    string_type d("hello");
+    d.set_capacity(2);
+    assert(strcmp(d.c_str(), "he") == 0 && d.size() == 2 && d.validate());
+
+    for (char ch = 'a'; ch < 'a' + 15; ++ch) { empty += ch; }
+    assert(counting_allocator::count() == 0 && empty == "abcdefghijklmno");
+    empty.insert(empty.begin(), '-');
+    assert(counting_allocator::count() == 1 && empty == "-abcdefghijklmno");
+  }
+  assert(counting_allocator::count() == 0);
+
+  // Wider characters get fewer of them.
+  eastl::basic_string<char32_t> wide(EASTL_STRING_LOCAL_SIZE / 4 - 1, 'w');
+  assert(wide.capacity() == EASTL_STRING_LOCAL_SIZE / 4 - 1 && wide.validate());
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+// An allocator whose strings get no local buffer, so that an empty one has
+// no room for any chars.
+class unbuffered_allocator : public counting_allocator {
+public:
+  unbuffered_allocator(const char* name = NULL) : counting_allocator(name) {}
+};
+
+namespace eastl {
+template <> struct string_local_size<unbuffered_allocator> { static const size_t value = 0; };
+}
+
+static void no_local_buffer() {
+  std::cout << "no_local_buffer:" << std::endl;
+
+  {
+    typedef eastl::basic_string<char, unbuffered_allocator> unbuffered_string;
+    unbuffered_string s;
+    assert(s.capacity() == 0 && s.validate() && s.c_str()[0] == 0);
+    s.append_sprintf("%d-%s", 42, "abc");
+    assert(s == "42-abc" && s.validate() && counting_allocator::count() == 1);
+    s.clear();
+    s.set_capacity(0);
+    assert(s.capacity() == 0 && s.validate() && counting_allocator::count() == 0);
+    s.push_back('x');
+    assert(s == "x" && s.validate());
+  }
+  assert(counting_allocator::count() == 0);
+
+  // A fixed_string's base keeps only the one char an empty basic_string needs.
+  typedef eastl::fixed_string<char, 64> fixed_type;
+  assert(sizeof(fixed_type) <= 64 + (3 * sizeof(char*)) + sizeof(fixed_type::fixed_allocator_type) + sizeof(void*));
+
+  fixed_type f("full");
+  f.append_sprintf("%d", 12345);
+  assert(f == "full12345" && f.validate());
+  eastl::fixed_string<char, 8> full("1234567");
+  full.append_sprintf("%s", "89");
+  assert(full == "123456789" && full.validate());
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void swap_and_move() {
+  std::cout << "swap_and_move:" << std::endl;
+
+  {
+    // Every combination of local and allocated.
+    char const* const values[] = { "", "ab", kShort, kLong };
+    for (int i = 0; i < 4; ++i) {
+      for (int j = 0; j < 4; ++j) {
+        string_type a(values[i]), b(values[j]);
+        a.swap(b);
+        assert(a == values[j] && b == values[i] && a.validate() && b.validate());
+        assert(*a.end() == 0 && *b.end() == 0);
+        a.swap(a);
+        assert(a == values[j]);
+      }
+    }
+
+#ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
+    string_type a(kShort), b(kLong);
+    string_type c(std::move(a)), d(std::move(b));
+    assert(c == kShort && d == kLong && a.empty() && b.empty() && a.validate() && b.validate());
+    assert(counting_allocator::count() == 1);
+#endif
+  }
+  assert(counting_allocator::count() == 0);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+// Checks a search result against std::string's.
+static bool same(eastl::string::size_type n, std::string::size_type stdN) {
+  return (n == eastl::string::npos) ? (stdN == std::string::npos) : (n == stdN);
+}
+
+// Compares the searches, which examine a SIMD register of characters at a time
+// where available, with std::string's over random strings of every length
+// around the register sizes. The alphabet includes characters above 127.
+static void search() {
+  std::cout << "search:" << std::endl;
+
+  char const alphabet[] = { 'a', 'b', 'c', ' ', '\x7f', '\x80', '\xe1', '\xff' };
+  unsigned seed = 1;
+  for (int length = 0; length <= 100; ++length) {
+    for (int trial = 0; trial < 20; ++trial) {
+      char text[100], pattern[24] = { 'a' };
+      for (int i = 0; i < length; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        text[i] = alphabet[(seed >> 16) % ((trial % 2) ? 3 : 8)];
+      }
+      int const nPattern = trial % 24; // Sets larger than 16 characters take another path.
+      for (int i = 0; i < nPattern; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        pattern[i] = alphabet[(seed >> 16) % 8];
+      }
+      eastl::string const s(text, text + length);
+      std::string const stdS(text, text + length);
+      std::string const stdPattern(pattern, pattern + nPattern);
+      int const nSubstring = nPattern % 5;
+
+      for (int pos = 0; pos <= length + 1; ++pos) {
+        assert(same(s.find(pattern[0], pos), stdS.find(pattern[0], pos)));
+        assert(same(s.rfind(pattern[0], pos), stdS.rfind(pattern[0], pos)));
+        assert(same(s.find(pattern, pos, nSubstring), stdS.find(pattern, pos, nSubstring)));
+        assert(same(s.rfind(pattern, pos, nSubstring), stdS.rfind(pattern, pos, nSubstring)));
+        assert(same(s.find_first_of(pattern, pos, nPattern), stdS.find_first_of(pattern, pos, nPattern)));
+        assert(same(s.find_first_not_of(pattern, pos, nPattern), stdS.find_first_not_of(pattern, pos, nPattern)));
+      }
+
+      char const* const pFound = eastl::find_first_of(text, text + length, pattern, pattern + nPattern);
+      assert((pFound == text + length) ? (stdS.find_first_of(stdPattern) == std::string::npos)
+                                       : ((size_t)(pFound - text) == stdS.find_first_of(stdPattern)));
+      char const* const pNotFound = eastl::find_first_not_of(text, text + length, pattern, pattern + nPattern);
+      assert((pNotFound == text + length) ? (stdS.find_first_not_of(stdPattern) == std::string::npos)
+                                          : ((size_t)(pNotFound - text) == stdS.find_first_not_of(stdPattern)));
+    }
+  }
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  local_buffer();
+  no_local_buffer();
+  swap_and_move();
+  search();
+}
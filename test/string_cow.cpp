@@ -0,0 +1,113 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <iostream>
+
+#include <EASTL/hash_map.h>
+#include <EASTL/map.h>
+#include <EASTL/string.h>
+#include <EASTL/string_cow.h>
+#include <EASTL/vector.h>
+
+
+typedef eastl::basic_string_cow<char, counting_allocator> cow_type;
+
+static char const* const kBlob = "{\"name\":\"config\",\"values\":[1,2,3,4,5,6,7,8]}";
+
+static void sharing() {
+  std::cout << "sharing:" << std::endl;
+
+  {
+    cow_type const empty;
+    assert(empty.empty() && empty.size() == 0 && *empty.c_str() == 0 && empty.use_count() == 0);
+    assert(counting_allocator::count() == 0);
+
+    cow_type const a(kBlob);
+    assert(counting_allocator::count() == 1 && a == kBlob && a.size() == strlen(kBlob) && a.unique());
+
+    eastl::vector<cow_type> copies(100, a);
+    cow_type b;
+    b = copies[50];
+    assert(counting_allocator::count() == 1);
+    assert(a.use_count() == 102 && b.data() == a.data() && copies[99].data() == a.data());
+
+    copies.clear();
+    assert(a.use_count() == 2 && !a.unique());
+    b = "other";
+    assert(a.unique() && b == "other" && a == kBlob);
+  }
+  assert(counting_allocator::count() == 0);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void copy_on_write() {
+  std::cout << "copy_on_write:" << std::endl;
+
+  {
+    cow_type const a(kBlob);
+    cow_type b(a);
+    b.append(",more");
+    assert(a == kBlob && b.size() == a.size() + 5 && b.data() != a.data() && a.unique() && b.unique());
+
+    // Modifying the only copy is done in place.
+    b.reserve(b.size() + 10);
+    char const* const pChars = b.data();
+    b.push_back('!');
+    b.insert(0, eastl::string_view("<"));
+    b.erase(1, 1);
+    assert(b.data() == pChars && b.front() == '<' && b[1] == '"' && b.back() == '!');
+
+    cow_type c(a);
+    c.mutable_data()[0] = '[';
+    assert(a[0] == '{' && c[0] == '[' && c.unique());
+    c.resize(4);
+    assert(c == "[\"na" && c.size() == 4);
+    c.resize(6, '.');
+    assert(c == "[\"na.." && c.find('.') == 4 && c.find(eastl::string_view("na")) == 2);
+
+    // Appending or inserting the string's own chars.
+    cow_type d("abc");
+    d.append(d);
+    d.insert(1, eastl::string_view(d.data() + 3, 2));
+    assert(d == "aabbcabc");
+
+    cow_type e(a);
+    e.clear();
+    assert(e.empty() && a == kBlob && a.unique());
+  }
+  assert(counting_allocator::count() == 0);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void conversion_and_lookup() {
+  std::cout << "conversion_and_lookup:" << std::endl;
+
+  eastl::string const s(kBlob);
+  eastl::string_cow const cow(s);
+  assert(cow == s && s == cow && cow.str() == s && eastl::string(cow) == s);
+  eastl::string_view const v(cow);
+  assert(v.data() == cow.data() && v == cow && cow == v);
+  assert(eastl::hash<eastl::string_cow>()(cow) == eastl::hash<eastl::string>()(s));
+
+  eastl::hash_map<eastl::string_cow, int> hm;
+  eastl::map<eastl::string_cow, int> m;
+  char const* const words[] = { "alpha", "beta", "gamma" };
+  for (int i = 0; i < 3; ++i) {
+    hm[eastl::string_cow(words[i])] = i;
+    m[eastl::string_cow(words[i])] = i;
+  }
+  char const input[] = "beta gamma";
+  assert(hm.find(eastl::string_view(input, 4))->second == 1 && hm.find(eastl::string_view(input)) == hm.end());
+  assert(m.find(eastl::string_view(input + 5))->second == 2 && m.count("delta") == 0);
+  assert(eastl::string_cow("a") < eastl::string_cow("b") && eastl::string_cow("b") != "a");
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  sharing();
+  copy_on_write();
+  conversion_and_lookup();
+}
@@ -0,0 +1,76 @@
+// string_pool.h comes first, to check that it includes what it uses.
+#include <EASTL/string_pool.h>
+
+#include "test.hpp"
+
+#include <cassert>
+#include <cstdio>
+#include <iostream>
+
+#include <EASTL/string.h>
+#include <EASTL/vector.h>
+
+
+typedef eastl::string_pool::atom_type atom_type;
+
+static void interning() {
+  std::cout << "interning:" << std::endl;
+
+  eastl::string_pool pool;
+  assert(pool.empty() && !pool.concurrent());
+  assert(pool.find("cpu") == eastl::string_pool::kInvalidAtom);
+
+  char buffer[] = "cpu.usage cpu";
+  atom_type const usage = pool.intern(eastl::string_view(buffer, 9));
+  atom_type const cpu = pool.intern(eastl::string_view(buffer + 10));
+  atom_type const empty = pool.intern("");
+  buffer[0] = 'x'; // The pool has its own copy.
+
+  assert(usage == 0 && cpu == 1 && empty == 2 && pool.size() == 3);
+  assert(pool.intern("cpu.usage") == usage && pool.intern(eastl::string("cpu")) == cpu && pool.find("") == empty);
+  assert(pool.str(usage) == "cpu.usage" && pool[cpu] == "cpu" && pool.length(usage) == 9 && pool.length(empty) == 0);
+  assert(strcmp(pool.c_str(usage), "cpu.usage") == 0 && *pool.c_str(empty) == 0);
+  assert(pool.hash(usage) == eastl::hash<eastl::string_view>()("cpu.usage"));
+  assert(pool.hash(cpu) == eastl::hash<eastl::string>()(eastl::string("cpu")));
+  assert(pool.find("cpu.") == eastl::string_pool::kInvalidAtom && pool.size() == 3);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+// Many strings, crossing segment and block boundaries, and some longer than a block.
+static void many(bool bConcurrent) {
+  std::cout << (bConcurrent ? "many_concurrent:" : "many:") << std::endl;
+
+  eastl::string_pool pool(bConcurrent);
+  eastl::vector<atom_type> atoms;
+  eastl::vector<eastl::string> strings;
+  char name[32];
+  for (int i = 0; i < 5000; ++i) {
+    sprintf(name, "metric.%d", i * 7919);
+    strings.push_back(eastl::string(name));
+    if (i % 1000 == 0) { strings.back().append(20000 + i, (char)('a' + i % 26)); }
+    atoms.push_back(pool.intern(strings.back()));
+  }
+
+  assert(pool.size() == 5000);
+  char const* const pFirst = pool.c_str(atoms[0]);
+  for (int i = 0; i < 5000; ++i) {
+    atom_type const atom = pool.intern(strings[i]);
+    assert(atom == (atom_type)i && atoms[i] == atom && pool.find(strings[i]) == atom);
+    assert(pool.str(atom) == strings[i] && pool.c_str(atom)[strings[i].size()] == 0);
+    assert(pool.hash(atom) == eastl::hash<eastl::string>()(strings[i]));
+  }
+  assert(pool.size() == 5000 && pool.c_str(atoms[0]) == pFirst);
+
+  pool.clear();
+  assert(pool.empty() && pool.find(strings[0]) == eastl::string_pool::kInvalidAtom);
+  assert(pool.intern(strings[1]) == 0);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  interning();
+  many(false);
+  many(true);
+}
@@ -0,0 +1,153 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <iostream>
+
+#include <EASTL/eytzinger_map.h>
+#include <EASTL/hash_map.h>
+#include <EASTL/lazy_vector_map.h>
+#include <EASTL/map.h>
+#include <EASTL/set.h>
+#include <EASTL/split_vector_map.h>
+#include <EASTL/string.h>
+#include <EASTL/string_view.h>
+#include <EASTL/vector_map.h>
+#include <EASTL/vector_set.h>
+
+
+static void view() {
+  std::cout << "view:" << std::endl;
+
+  char const text[] = "key=value;";
+  eastl::string_view v(text, 9);
+  assert(v.size() == 9 && v.front() == 'k' && v.back() == 'e');
+  assert(v.find('=') == 3 && v.find(';') == eastl::string_view::npos);
+  assert(v.find(eastl::string_view("val")) == 4 && v.find(eastl::string_view("valuex")) == eastl::string_view::npos);
+  assert(v.starts_with("key") && v.ends_with("value") && !v.ends_with("key=value;"));
+
+  eastl::string_view key(v.substr(0, v.find('=')));
+  v.remove_prefix(key.size() + 1);
+  assert(key == "key" && v == "value" && "value" == v);
+  v.remove_suffix(2);
+  assert(v == "val" && v != "value" && v < eastl::string_view("value") && v > key);
+  assert(eastl::string_view().empty() && eastl::string_view("").compare(eastl::string_view()) == 0);
+
+  eastl::string s(key);
+  assert(s == "key" && s == key && key == s && !(s != key) && !(s < key) && !(key < s));
+  eastl::string_view const fromString(s);
+  assert(fromString.data() == s.data() && fromString.size() == 3);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void hash_agreement() {
+  std::cout << "hash_agreement:" << std::endl;
+
+  char const* const values[] = { "", "a", "key", "fifteen chars!!", "a longer string which doesn't fit locally" };
+  for (unsigned i = 0; i < sizeof(values) / sizeof(values[0]); ++i) {
+    eastl::string const s(values[i]);
+    eastl::string_view const v(values[i]);
+    assert(eastl::hash<eastl::string>()(s) == eastl::hash<eastl::string_view>()(v));
+    assert(eastl::hash<eastl::string>()(s) == eastl::hash<eastl::string>()(v));
+  }
+
+  // A view of a token within a buffer hashes as the token alone.
+  eastl::string_view const token("key=value", 3);
+  assert(eastl::hash<eastl::string_view>()(token) == eastl::hash<eastl::string>()(eastl::string("key")));
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void transparent_lookup() {
+  std::cout << "transparent_lookup:" << std::endl;
+
+  char const* const words[] = { "alpha", "beta", "gamma", "delta" };
+  char const input[] = "beta gamma epsilon";
+  eastl::string_view const beta(input, 4), gamma(input + 5, 5), epsilon(input + 11, 7);
+
+  eastl::map<eastl::string, int> m;
+  eastl::multiset<eastl::string> ms;
+  eastl::hash_map<eastl::string, int> hm;
+  eastl::vector_map<eastl::string, int> vm;
+  for (int i = 0; i < 4; ++i) {
+    m[words[i]] = i;
+    ms.insert(words[i]);
+    ms.insert(words[i]);
+    hm[words[i]] = i;
+    vm.insert(eastl::make_pair(eastl::string(words[i]), i));
+  }
+
+  assert(m.find(beta)->second == 1 && m.find(epsilon) == m.end() && m.count(gamma) == 1);
+  assert(m.lower_bound(beta) == m.find("beta") && m.upper_bound(beta) == m.find("delta"));
+  assert(m.equal_range(epsilon).first == m.equal_range(epsilon).second);
+  assert(m.find("gamma")->second == 2);
+
+  assert(ms.count(gamma) == 2 && ms.count(epsilon) == 0);
+  assert(eastl::distance(ms.equal_range(beta).first, ms.equal_range(beta).second) == 2);
+
+  assert(hm.find(beta)->second == 1 && hm.find(epsilon) == hm.end());
+  assert(hm.count(gamma) == 1 && hm.find("delta")->second == 3);
+  assert(eastl::distance(hm.equal_range(gamma).first, hm.equal_range(gamma).second) == 1);
+
+  eastl::vector_map<eastl::string, int> const& cvm = vm;
+  assert(cvm.find(beta)->second == 1 && cvm.find(epsilon) == cvm.end() && cvm.count(gamma) == 1);
+  assert(vm.lower_bound(epsilon) == vm.find("gamma") && vm.upper_bound(beta) == vm.find("delta"));
+  assert(vm.equal_range(gamma).second - vm.equal_range(gamma).first == 1);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void sorted_vector_lookup() {
+  std::cout << "sorted_vector_lookup:" << std::endl;
+
+  char const* const words[] = { "alpha", "beta", "gamma", "delta" };
+  char const input[] = "beta gamma epsilon";
+  eastl::string_view const beta(input, 4), gamma(input + 5, 5), epsilon(input + 11, 7);
+
+  eastl::vector_set<eastl::string> vs;
+  eastl::vector_multiset<eastl::string> vms;
+  eastl::lazy_vector_map<eastl::string, int> lm;
+  eastl::split_vector_map<eastl::string, int> sm;
+  eastl::vector_map<eastl::string, int> vm;
+  for (int i = 0; i < 4; ++i) {
+    vs.insert(eastl::string(words[i]));
+    vms.insert(eastl::string(words[i]));
+    vms.insert(eastl::string(words[i]));
+    lm[eastl::string(words[i])] = i;
+    sm[eastl::string(words[i])] = i;
+    vm.insert(eastl::make_pair(eastl::string(words[i]), i));
+  }
+  eastl::eytzinger_map<eastl::string, int> const em(eastl::sorted_unique, vm.begin(), vm.end());
+
+  assert(*vs.find(beta) == "beta" && vs.find(epsilon) == vs.end() && vs.count(gamma) == 1);
+  assert(vs.lower_bound(epsilon) == vs.find("gamma") && vs.upper_bound(beta) == vs.find("delta"));
+  assert(vs.equal_range(gamma).second - vs.equal_range(gamma).first == 1);
+
+  assert(vms.count(gamma) == 2 && vms.count(epsilon) == 0 && *vms.find(beta) == "beta");
+  assert(vms.lower_bound(beta) + 2 == vms.upper_bound(beta));
+  assert(vms.equal_range(epsilon).first == vms.equal_range(epsilon).second);
+
+  // Transparent reads flush a lazy_vector_map like the others.
+  lm.insert(eastl::make_pair(eastl::string("epsilon"), 4));
+  assert(lm.pending() == 1 && lm.find(epsilon)->second == 4 && lm.pending() == 0);
+  assert(lm.find(beta)->second == 1 && lm.count(gamma) == 1 && lm.upper_bound(beta) == lm.find("delta"));
+  assert(lm.lower_bound(epsilon) == lm.find("epsilon") && lm.equal_range(gamma).second - lm.equal_range(gamma).first == 1);
+
+  eastl::split_vector_map<eastl::string, int> const& csm = sm;
+  assert(csm.find(beta)->second == 1 && csm.find(epsilon) == csm.end() && csm.count(gamma) == 1);
+  assert(sm.lower_bound(epsilon) == sm.find("gamma") && sm.upper_bound(beta) == sm.find("delta"));
+  assert(sm.equal_range(gamma).second - sm.equal_range(gamma).first == 1);
+
+  assert(em.find(beta)->second == 1 && em.find(epsilon) == em.end() && em.count(gamma) == 1);
+  assert(em.lower_bound(epsilon) == em.find("gamma") && em.upper_bound(beta) == em.find("delta"));
+  assert(em.equal_range(epsilon).first == em.equal_range(epsilon).second && em.equal_range(gamma).first == em.find("gamma"));
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  view();
+  hash_agreement();
+  transparent_lookup();
+  sorted_vector_lookup();
+}
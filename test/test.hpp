@@ -1,6 +1,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <EASTL/internal/config.h>
+#include <EASTL/allocator.h>
 
 
 // EASTL expects us to define these, see allocator.h line 194
@@ -27,3 +28,31 @@ int Vsnprintf8(char8_t* pDestination, size_t n,
         return vsnprintf(pDestination, n, pFormat, arguments);
 #endif
 }
+
+// An allocator which counts the blocks it has outstanding, for tests which
+// check how many allocations a container makes.
+class counting_allocator : public eastl::allocator {
+public:
+    counting_allocator(const char* pName = NULL) : eastl::allocator(pName) {}
+
+    void* allocate(size_t n, int flags = 0) {
+        ++count();
+        return eastl::allocator::allocate(n, flags);
+    }
+    void* allocate(size_t n, size_t alignment, size_t offset, int flags = 0) {
+        ++count();
+        return eastl::allocator::allocate(n, alignment, offset, flags);
+    }
+    void deallocate(void* p, size_t n) {
+        --count();
+        eastl::allocator::deallocate(p, n);
+    }
+
+    static int& count() {
+        static int n = 0;
+        return n;
+    }
+};
+
+inline bool operator==(counting_allocator const&, counting_allocator const&) { return true; }
+inline bool operator!=(counting_allocator const&, counting_allocator const&) { return false; }
@@ -0,0 +1,109 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <iostream>
+
+#include <EASTL/string.h>
+#include <EASTL/tuple_vector.h>
+
+#ifdef EA_COMPILER_HAS_VARIADIC_TEMPLATES
+
+typedef eastl::tuple_vector<int, double, eastl::string> row_vector;
+
+static void push_back() {
+  std::cout << "push_back:" << std::endl;
+
+  row_vector vec;
+  assert(vec.empty());
+
+  for(int i = 0; i < 100; ++i) {
+    vec.push_back(i, i * 0.5, eastl::string(1, char('a' + i % 26)));
+  }
+  assert(vec.size() == 100);
+  assert(vec.validate());
+
+  const int* ints = vec.get<0>();
+  const double* doubles = vec.get<1>();
+  for(int i = 0; i < 100; ++i) {
+    assert(ints[i] == i);
+    assert(doubles[i] == i * 0.5);
+  }
+  assert(std::get<2>(vec[27]) == "b");
+
+  // The value may come from the container itself.
+  vec.set_capacity();
+  vec.push_back(vec.get<0>()[3], vec.get<1>()[3], std::get<2>(vec[3]));
+  assert(std::get<0>(vec.back()) == 3 && std::get<2>(vec.back()) == "d");
+
+  vec.pop_back();
+  assert(vec.size() == 100);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void erase() {
+  std::cout << "erase:" << std::endl;
+
+  row_vector vec;
+  vec.resize(10, 7, 1.0, eastl::string("x"));
+  for(int i = 0; i < 10; ++i) {
+    vec.get<0>()[i] = i;
+  }
+
+  vec.erase(vec.begin() + 2, vec.begin() + 4);
+  assert(vec.size() == 8);
+  assert(std::get<0>(vec[2]) == 4);
+
+  vec.erase_unsorted(vec.begin());
+  assert(vec.size() == 7);
+  assert(std::get<0>(vec.front()) == 9);
+  assert(std::get<2>(vec.front()) == "x");
+
+  vec.resize(3);
+  assert(vec.size() == 3 && std::get<0>(vec.back()) == 4);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void iterator() {
+  std::cout << "iterator:" << std::endl;
+
+  row_vector vec(5);
+  int n = 0;
+  for(row_vector::iterator i = vec.begin(); i != vec.end(); ++i) {
+    std::get<0>(*i) = n++;
+  }
+  assert(vec.end() - vec.begin() == 5);
+
+  const row_vector& cvec = vec;
+  n = 0;
+  for(row_vector::const_iterator i = cvec.begin(); i != cvec.end(); ++i) {
+    assert(std::get<0>(*i) == n);
+    assert(std::get<1>(*i) == 0.0);
+    ++n;
+  }
+  assert(std::get<0>(*vec.rbegin()) == 4);
+  assert(vec.validate_iterator(vec.begin() + 5) == (eastl::isf_valid | eastl::isf_current));
+
+  row_vector copy(vec);
+  assert(copy == vec);
+  std::get<1>(copy[0]) = 2.0;
+  assert(copy != vec);
+
+  copy.swap(vec);
+  assert(std::get<1>(vec[0]) == 2.0);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  push_back();
+  erase();
+  iterator();
+}
+
+#else
+
+int main() {}
+
+#endif
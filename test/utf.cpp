@@ -0,0 +1,104 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <cstring>
+#include <iostream>
+
+#include <EASTL/string.h>
+#include <EASTL/utf.h>
+
+
+static bool valid8(char const* p) { return eastl::utf_validate(p, p + std::strlen(p)); }
+
+static void conversion() {
+  std::cout << "conversion:" << std::endl;
+
+  // ASCII runs long enough for the SIMD paths, between a 2, 3 and 4 byte sequence.
+  uint32_t const codePoints[] = { 'a', 0xe9, 0x20ac, 0x1f600, 0x7f, 0x80, 0x7ff, 0x800, 0xd7ff, 0xe000, 0xffff, 0x10000, 0x10ffff };
+  eastl::string32 s32;
+  for (int i = 0; i < 50; ++i) {
+    for (int j = 0; j < i; ++j) { s32.push_back((char32_t)('A' + j % 26)); }
+    s32.push_back((char32_t)codePoints[i % (sizeof(codePoints) / sizeof(codePoints[0]))]);
+  }
+
+  eastl::string8 s8;
+  eastl::string16 s16;
+  bool const bConverted = eastl::utf_convert(s32, s8) && eastl::utf_convert(s32, s16);
+  assert(bConverted);
+  assert(s8.size() == eastl::utf_length<char8_t>(s32.data(), s32.data() + s32.size()));
+  assert(s16.size() == eastl::utf_length<char16_t>(s8.data(), s8.data() + s8.size()) && s16.size() > s32.size());
+  assert(s8.find("\xf0\x9f\x98\x80") != eastl::string8::npos);   // U+1F600
+
+  eastl::string32 back32, back32From16;
+  eastl::string16 back16;
+  eastl::string8 back8;
+  bool const bConvertedBack = eastl::utf_convert(s8, back32) && eastl::utf_convert(s16, back32From16) &&
+                              eastl::utf_convert(s8, back16) && eastl::utf_convert(s16, back8);
+  assert(bConvertedBack && back32 == s32 && back32From16 == s32 && back16 == s16 && back8 == s8);
+
+  // The string conversions allocate once, at the final size, and reuse the
+  // destination's block when it is already big enough.
+  int const nBlocks = counting_allocator::count();
+  {
+    eastl::basic_string<char16_t, counting_allocator> counted;
+    bool const bCounted = eastl::utf_convert(s8, counted);
+    assert(bCounted && counting_allocator::count() == nBlocks + 1 && counted.size() == s16.size());
+    char16_t const* const pBlock = counted.data();
+    bool const bCountedAgain = eastl::utf_convert(s32, counted);
+    assert(bCountedAgain && counted.data() == pBlock && counted.size() == s16.size());
+    assert(std::memcmp(counted.data(), s16.data(), s16.size() * sizeof(char16_t)) == 0);
+  }
+  assert(counting_allocator::count() == nBlocks);
+
+  // Converting a string, or part of it, into itself keeps the text.
+  eastl::string8 self8(s8);
+  char8_t const* const pSelf = self8.data();
+  bool const bSelf = eastl::utf_convert(self8, self8);
+  assert(bSelf && self8 == s8 && self8.data() == pSelf);
+  eastl::string16 self16(s16);
+  bool const bSuffix = eastl::utf_convert(self16.data() + 3, self16.data() + self16.size(), self16);
+  assert(bSuffix && self16.size() == s16.size() - 3 && self16 == s16.substr(3, s16.size() - 3));
+  bool const bPrefix = eastl::utf_convert(self16.data(), self16.data() + 10, self16);
+  assert(bPrefix && self16 == s16.substr(3, 10));
+
+  // The pointer conversion writes exactly utf_length units.
+  eastl::string16 buffer(s16.size() + 1, 0);
+  char16_t const* const pEnd = eastl::utf_convert(s32.data(), s32.data() + s32.size(), &buffer[0]);
+  assert(pEnd == buffer.data() + s16.size() && buffer[s16.size()] == 0);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void validation() {
+  std::cout << "validation:" << std::endl;
+
+  assert(valid8("") && valid8("\xc2\x80\xe0\xa0\x80\xed\x9f\xbf\xee\x80\x80\xf0\x90\x80\x80\xf4\x8f\xbf\xbf"));
+  assert(!valid8("\xc0\x80") && !valid8("\xc1\xbf") && !valid8("\xe0\x9f\xbf") && !valid8("\xf0\x8f\xbf\xbf"));  // Overlong
+  assert(!valid8("\xed\xa0\x80") && !valid8("\xf4\x90\x80\x80") && !valid8("\xf5\x80\x80\x80"));                // Surrogate, above U+10FFFF
+  assert(!valid8("\x80") && !valid8("\xe2\x82") && !valid8("\xe2\x82\x41") && !valid8("\xff"));                 // Stray, truncated
+
+  // An invalid byte after a long ASCII run is found at its position.
+  eastl::string8 text(100, 'x');
+  text += "\xe2\x82\xac\xe2\x82";
+  char const* const pInvalid = eastl::utf_find_invalid(text.data(), text.data() + text.size());
+  assert(pInvalid == text.data() + 103);
+  assert(eastl::utf_length<char32_t>(text.data(), text.data() + text.size()) == 101);
+
+  char16_t const pairs[] = { 'a', 0xd83d, 0xde00, 0xdc00, 0xd800 };
+  assert(eastl::utf_validate(pairs, pairs + 3) && !eastl::utf_validate(pairs, pairs + 4) && !eastl::utf_validate(pairs + 4, pairs + 5));
+
+  char32_t const values[] = { 0x10ffff, 0x110000, 0xdfff };
+  assert(eastl::utf_validate(values, values + 1) && !eastl::utf_validate(values + 1, values + 2) && !eastl::utf_validate(values + 2, values + 3));
+
+  // A failed conversion leaves the destination unchanged.
+  eastl::string16 dest(3, (char16_t)'k');
+  bool const bInvalidConverted = eastl::utf_convert(text, dest);
+  assert(!bInvalidConverted && dest == eastl::string16(3, (char16_t)'k'));
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  conversion();
+  validation();
+}
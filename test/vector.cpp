@@ -2,6 +2,7 @@
 #include <iostream>
 #include <utility>
 
+#include <EASTL/mmap_allocator.h>
 #include <EASTL/string.h>
 #include <EASTL/vector.h>
 
@@ -36,9 +37,178 @@ void move_constructor() {
 
 #endif
 
+// An mmap_allocator which counts the calls which get a block.
+class counting_mmap_allocator : public eastl::mmap_allocator {
+ public:
+  counting_mmap_allocator(const char* pName = NULL) : eastl::mmap_allocator(pName) {}
+  void* allocate(size_t n, int flags = 0) { ++allocations(); return eastl::mmap_allocator::allocate(n, flags); }
+  void* allocate(size_t n, size_t alignment, size_t offset, int flags = 0) {
+    ++allocations();
+    return eastl::mmap_allocator::allocate(n, alignment, offset, flags);
+  }
+  void* reallocate(void* p, size_t prevSize, size_t n, int flags = 0) {
+    ++reallocations();
+    return eastl::mmap_allocator::reallocate(p, prevSize, n, flags);
+  }
+  static int& allocations() { static int n = 0; return n; }
+  static int& reallocations() { static int n = 0; return n; }
+};
+
+namespace eastl {
+template <>
+struct allocator_can_reallocate<counting_mmap_allocator> : public true_type {};
+}
+
+void mmap_allocator_growth() {
+  std::cout << "mmap_allocator_growth:" << std::endl;
+
+  eastl::vector<int, eastl::mmap_allocator> vec;
+  for (int i = 0; i < 100000; ++i) {
+    vec.push_back(i);
+  }
+  vec.push_back(vec[0]);
+  assert(vec.size() == 100001);
+  assert(vec.back() == 0);
+  for (int i = 0; i < 100000; ++i) {
+    assert(vec[i] == i);
+  }
+
+  vec.resize(200000, 7);
+  assert(vec[199999] == 7);
+
+  vec.set_capacity(10);
+  assert(vec.size() == 10);
+  assert(vec.capacity() == 10);
+  assert(vec[9] == 9);
+
+  vec.set_capacity(0);
+  assert(vec.empty());
+  vec.reserve(5000);
+  assert(vec.capacity() == 5000);
+
+  // Growth across many pages is done by reallocate, and keeps the data on each side of every page boundary.
+  size_t const nIntsPerPage = eastl::mmap_allocator::get_page_size() / sizeof(int);
+  eastl::vector<int, counting_mmap_allocator> counted;
+  for (size_t i = 0; i < 2 * nIntsPerPage; ++i) {
+    counted.push_back((int)i);
+  }
+  counted.resize(64 * nIntsPerPage, -1);
+  assert(counting_mmap_allocator::allocations() == 0 && counting_mmap_allocator::reallocations() > 0);
+  for (size_t i = 1; i < 64; ++i) {
+    size_t const nBoundary = i * nIntsPerPage;
+    assert(counted[nBoundary - 1] == (nBoundary <= 2 * nIntsPerPage ? (int)nBoundary - 1 : -1));
+    assert(counted[nBoundary] == (nBoundary < 2 * nIntsPerPage ? (int)nBoundary : -1));
+  }
+
+  // The system refusing the pages is reported as NULL.
+  eastl::mmap_allocator allocator;
+  void* const pHuge = allocator.allocate(~(size_t)0 >> 1);
+  assert(pHuge == NULL);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+// Records the capacity after each reallocation while pushing n values.
+template <class Vector>
+static eastl::vector<size_t> capacity_sequence(size_t n) {
+  Vector vec;
+  eastl::vector<size_t> sequence;
+  for (size_t i = 0; i < n; ++i) {
+    vec.push_back(typename Vector::value_type());
+    if (sequence.empty() || sequence.back() != vec.capacity()) {
+      sequence.push_back(vec.capacity());
+    }
+  }
+  return sequence;
+}
+
+void growth_policies() {
+  std::cout << "growth_policies:" << std::endl;
+
+  size_t const doubling[] = { 1, 2, 4, 8, 16, 32 };
+  eastl::vector<size_t> const sequence2x = capacity_sequence<eastl::vector<int> >(20);
+  assert(sequence2x.size() == 6 && eastl::equal(sequence2x.begin(), sequence2x.end(), doubling));
+
+  size_t const oneAndHalf[] = { 1, 2, 3, 5, 8, 12, 18, 27 };
+  typedef eastl::growth_policy_allocator<eastl::growth_policy_1_5x> allocator_1_5x;
+  eastl::vector<size_t> const sequence1_5x = capacity_sequence<eastl::vector<int, allocator_1_5x> >(20);
+  assert(sequence1_5x.size() == 8 && eastl::equal(sequence1_5x.begin(), sequence1_5x.end(), oneAndHalf));
+
+  // Growth rounded up to whole pages.
+  size_t const nIntsPerPage = eastl::mmap_allocator::get_page_size() / sizeof(int);
+  typedef eastl::growth_policy_allocator<eastl::growth_policy_usable_size<>, eastl::mmap_allocator> page_allocator;
+  eastl::vector<size_t> const sequencePages = capacity_sequence<eastl::vector<int, page_allocator> >(2 * nIntsPerPage + 1);
+  assert(sequencePages.size() == 3 && sequencePages[0] == nIntsPerPage && sequencePages[1] == 2 * nIntsPerPage &&
+         sequencePages[2] == 4 * nIntsPerPage);
+
+  // Strings double from the local buffer's capacity, not counting the trailing 0.
+  size_t const stringDoubling[] = { EASTL_STRING_LOCAL_SIZE - 1, 2 * (EASTL_STRING_LOCAL_SIZE - 1), 4 * (EASTL_STRING_LOCAL_SIZE - 1) };
+  eastl::vector<size_t> const sequenceString = capacity_sequence<eastl::string>(3 * EASTL_STRING_LOCAL_SIZE);
+  assert(sequenceString.size() == 3 && eastl::equal(sequenceString.begin(), sequenceString.end(), stringDoubling));
+
+  // allocate_memory_at_least reports the whole block, through growth_policy_allocator too.
+  eastl::mmap_allocator mmapAllocator;
+  eastl::allocation_result const result = eastl::allocate_memory_at_least(mmapAllocator, 10, 4, 0);
+  assert(result.ptr != NULL && result.count == eastl::mmap_allocator::get_page_size());
+  mmapAllocator.deallocate(result.ptr, result.count);
+
+  page_allocator pageAllocator;
+  eastl::allocation_result const pageResult = eastl::allocate_memory_at_least(pageAllocator, 10, 4, 0);
+  assert(pageResult.ptr != NULL && pageResult.count == eastl::mmap_allocator::get_page_size());
+  pageAllocator.deallocate(pageResult.ptr, pageResult.count);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+inline size_t round_to_64(size_t n) { return (n + 63) & ~size_t(63); }
+
+// An allocator whose blocks are made of 64 byte units, and which says so.
+// It really allocates the rounded size, so ASan catches a container which
+// writes past what allocator_usable_size reports.
+class rounding_allocator : public eastl::allocator {
+ public:
+  rounding_allocator(const char* pName = NULL) : eastl::allocator(pName) {}
+  void* allocate(size_t n, int flags = 0) { return eastl::allocator::allocate(round_to_64(n), flags); }
+  void* allocate(size_t n, size_t alignment, size_t offset, int flags = 0) {
+    return eastl::allocator::allocate(round_to_64(n), alignment, offset, flags);
+  }
+  void deallocate(void* p, size_t n) { eastl::allocator::deallocate(p, round_to_64(n)); }
+};
+
+inline bool operator==(rounding_allocator const&, rounding_allocator const&) { return true; }
+inline bool operator!=(rounding_allocator const&, rounding_allocator const&) { return false; }
+
+inline size_t allocator_usable_size(rounding_allocator const&, size_t n) { return round_to_64(n); }
+
+void allocate_at_least_capacity() {
+  std::cout << "allocate_at_least_capacity:" << std::endl;
+
+  eastl::vector<int, rounding_allocator> vec;
+  vec.push_back(1);
+  assert(vec.capacity() == 64 / sizeof(int));
+
+  vec.reserve(17);
+  assert(vec.capacity() == 128 / sizeof(int));
+  assert(vec[0] == 1);
+
+  eastl::basic_string<char, rounding_allocator> str;
+  str.push_back('a');
+  assert(str.capacity() == EASTL_STRING_LOCAL_SIZE - 1); // Short strings don't allocate.
+  str.append(EASTL_STRING_LOCAL_SIZE, 'a');
+  assert(str.capacity() == 63);
+  str.append(100, 'b');
+  assert(str.capacity() == 127);
+  assert(str[0] == 'a' && str[EASTL_STRING_LOCAL_SIZE + 1] == 'b');
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
 int main() {
 #ifdef EA_COMPILER_HAS_MOVE_SEMANTICS
   move_push_back();
   move_constructor();
 #endif
+  mmap_allocator_growth();
+  growth_policies();
+  allocate_at_least_capacity();
 }
@@ -170,7 +170,7 @@ static void insert() {
 
   // second insert function version (with hint position):
   it=mymap.begin();
-  mymap.insert (it, eastl::pair<char,int>('b',300));  // max efficiency inserting
+  it = mymap.insert (it, eastl::pair<char,int>('b',300));  // max efficiency inserting
   mymap.insert (it, eastl::pair<char,int>('c',400));  // no max efficiency inserting
 
   // third insert function version (range insertion):
@@ -450,6 +450,97 @@ static void get_allocator() {
   mymap.get_allocator().deallocate(p,5);
 }
 
+static void bulk_insert() {
+  std::cout << "bulk_insert:" << std::endl;
+
+  eastl::pair<int, int> const values[] = {
+    eastl::make_pair(5, 0), eastl::make_pair(1, 0), eastl::make_pair(3, 0),
+    eastl::make_pair(1, 1), eastl::make_pair(4, 0), eastl::make_pair(5, 1),
+  };
+  eastl::vector_map<int, int> mymap(values, values + 6);
+  assert(mymap.size() == 4);
+  assert(mymap.begin()->first == 1);
+  assert(mymap[1] == 0 && mymap[5] == 0); // the first of equivalent elements wins
+
+  eastl::pair<int, int> const more[] = {
+    eastl::make_pair(6, 2), eastl::make_pair(0, 2), eastl::make_pair(3, 2),
+  };
+  mymap.insert(more, more + 3);
+  assert(mymap.size() == 6);
+  assert(mymap.begin()->first == 0);
+  assert(mymap[3] == 0); // existing elements are kept
+
+  eastl::pair<int, int> const sorted[] = {
+    eastl::make_pair(2, 3), eastl::make_pair(4, 3), eastl::make_pair(7, 3),
+  };
+  mymap.insert(eastl::sorted_unique, sorted, sorted + 3);
+  assert(mymap.size() == 8);
+  assert(mymap[2] == 3 && mymap[4] == 0 && mymap[7] == 3);
+
+  int expected = 0;
+  for (eastl::vector_map<int, int>::iterator it = mymap.begin(); it != mymap.end(); ++it) {
+    assert(it->first == expected);
+    ++expected;
+  }
+
+  eastl::vector_map<int, int> const copy(eastl::sorted_unique, mymap.begin(), mymap.end());
+  assert(copy == mymap);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+struct string_less {
+  bool operator()(eastl::string const& lhs, char const* rhs) const { return lhs < rhs; }
+  bool operator()(char const* lhs, eastl::string const& rhs) const { return lhs < rhs; }
+};
+
+static void find_as() {
+  std::cout << "find_as:" << std::endl;
+
+  eastl::vector_map<eastl::string, int> mymap;
+  mymap["apple"] = 1;
+  mymap["cherry"] = 3;
+
+  assert(mymap.find_as("cherry", string_less())->second == 3);
+  assert(mymap.find_as("banana", string_less()) == mymap.end());
+  assert(mymap.find_as("zucchini", string_less()) == mymap.end());
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void multimap() {
+  std::cout << "multimap:" << std::endl;
+
+  eastl::pair<char, int> const values[] = {
+    eastl::make_pair('b', 1), eastl::make_pair('a', 2), eastl::make_pair('b', 3), eastl::make_pair('c', 4),
+  };
+  eastl::vector_multimap<char, int> mymap(values, values + 4);
+  mymap.insert(eastl::make_pair('b', 5));
+  mymap.insert(mymap.begin(), eastl::make_pair('b', 6)); // bad hint
+  mymap.insert(mymap.end(), eastl::make_pair('c', 7));
+
+  eastl::pair<char, int> const result[] = {
+    eastl::make_pair('a', 2), eastl::make_pair('b', 1), eastl::make_pair('b', 3),
+    eastl::make_pair('b', 5), eastl::make_pair('b', 6), eastl::make_pair('c', 4),
+    eastl::make_pair('c', 7),
+  };
+  assert(mymap.size() == 7);
+  assert(eastl::equal(mymap.begin(), mymap.end(), result));
+
+  assert(mymap.count('b') == 4);
+  assert(mymap.find('b')->second == 1);
+  assert(mymap.find('d') == mymap.end());
+
+  eastl::vector_multimap<char, int> const copy(eastl::sorted_equivalent, mymap.begin(), mymap.end());
+  assert(copy == mymap);
+
+  eastl::vector_multimap<char, int>::size_type const erased = mymap.erase('b');
+  assert(erased == 4);
+  assert(mymap.size() == 3 && copy < mymap);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
 int main() {
   constructor();
   assign_operator();
@@ -470,4 +561,7 @@ int main() {
   upper_lower_bound();
   equal_range();
   get_allocator();
+  bulk_insert();
+  find_as();
+  multimap();
 }
@@ -0,0 +1,88 @@
+#include "test.hpp"
+
+#include <cassert>
+#include <iostream>
+
+#include <EASTL/string.h>
+#include <EASTL/vector_set.h>
+
+
+typedef eastl::vector_set<int> int_set;
+typedef eastl::vector_multiset<int> int_multiset;
+
+
+static void set() {
+  std::cout << "set:" << std::endl;
+
+  int const values[] = { 5, 1, 3, 1, 4 };
+  int_set s(values, values + 5);
+  assert(s.size() == 4);
+  assert(*s.begin() == 1 && *s.rbegin() == 5);
+
+  bool const inserted = s.insert(3).second;
+  assert(!inserted);
+  s.insert(2);
+  s.insert(s.end(), 6); // good hint
+  s.insert(s.begin(), 0); // good hint
+  s.insert(s.begin(), 7); // bad hint
+  int n = 0;
+  for(int_set::const_iterator i = s.begin(); i != s.end(); ++i) {
+    assert(*i == n);
+    ++n;
+  }
+  assert(n == 8);
+
+  assert(s.count(4) == 1 && s.count(8) == 0);
+  assert(s.lower_bound(4) == s.find(4));
+  assert(s.upper_bound(4) == s.find(5));
+  s.erase(s.find(4));
+  int_set::size_type const nErased = s.erase(5);
+  assert(nErased == 1);
+  assert(s.find(4) == s.end());
+
+  int const more[] = { 4, 5, 8 };
+  s.insert(eastl::sorted_unique, more, more + 3);
+  assert(s.size() == 9 && *s.rbegin() == 8);
+
+  int_set other;
+  other.reserve(2);
+  other.insert(1);
+  assert(s < other);
+  other.swap(s);
+  assert(other.size() == 9 && s.size() == 1);
+
+  eastl::vector_set<eastl::string> strings;
+  strings.insert("b");
+  strings.insert("a");
+  assert(*strings.find_as("b", eastl::less<eastl::string>()) == "b");
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+static void multiset() {
+  std::cout << "multiset:" << std::endl;
+
+  int const values[] = { 2, 1, 2, 3, 2 };
+  int_multiset s(values, values + 5);
+  s.insert(1);
+  s.insert(s.begin(), 3); // bad hint
+  s.insert(s.end(), 3); // good hint
+  assert(s.size() == 8);
+  assert(s.count(1) == 2 && s.count(2) == 3 && s.count(3) == 3);
+
+  int_multiset const copy(eastl::sorted_equivalent, s.begin(), s.end());
+  assert(copy == s);
+
+  int_multiset::size_type const erased = s.erase(2);
+  assert(erased == 3);
+  assert(s.find(2) == s.end() && s.size() == 5);
+  assert(s.equal_range(3).second == s.end());
+  assert(copy < s);
+
+  std::cout << "\tsuccess!!" << std::endl;
+}
+
+int main() {
+  set();
+  multiset();
+}